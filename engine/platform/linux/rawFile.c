@@ -0,0 +1,163 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/* Raw Rendering Engine - "engine/platform/linux/rawFile.c"
+ *
+ * Linux implementation for the file API
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+// mmap, fsync, getpid and O_DIRECTORY
+#define _POSIX_C_SOURCE 200809L
+
+#include <engine/platform/rawFile.h>
+#include <engine/platform/rawMemory.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+bool rawMapFile(char const* path, RawFileMapping* mapping) {
+	mapping->data = NULL;
+	mapping->size = 0u;
+	mapping->handle = NULL;
+
+	int file = open(path, O_RDONLY);
+
+	if (file < 0)
+		return false;
+
+	struct stat file_status;
+
+	if (fstat(file, &file_status) != 0) {
+		close(file);
+		return false;
+	}
+
+	mapping->size = (uint64_t)file_status.st_size;
+
+	if (mapping->size > 0u) {
+		void* data = mmap(NULL, (size_t)mapping->size,
+			PROT_READ, MAP_PRIVATE, file, 0);
+
+		if (data == MAP_FAILED) {
+			close(file);
+			mapping->size = 0u;
+			return false;
+		}
+
+		mapping->data = data;
+	}
+
+	// The mapping keeps the file referenced
+	close(file);
+
+	return true;
+}
+
+void rawUnmapFile(RawFileMapping* mapping) {
+	if (mapping->data)
+		munmap((void*)mapping->data, (size_t)mapping->size);
+
+	mapping->data = NULL;
+	mapping->size = 0u;
+}
+
+bool rawWriteFileAtomic(char const* path, void const* data, uint64_t size) {
+	// Unique per process, so concurrent writers don't share the file
+	size_t temp_path_size = strlen(path) + 32u;
+	char* temp_path = RAW_NULL_PTR;
+
+	RAW_MEM_ALLOC(temp_path, (uint64_t)temp_path_size, sizeof(char));
+
+	if (!temp_path)
+		return false;
+
+	snprintf(temp_path, temp_path_size, "%s.%ld.tmp", path, (long)getpid());
+
+	int file = open(temp_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+	if (file < 0) {
+		RAW_MEM_FREE(temp_path);
+		return false;
+	}
+
+	uint8_t const* bytes = data;
+	uint64_t written = 0u;
+	bool result = true;
+
+	while (result && written < size) {
+		ssize_t n_bytes = write(file, bytes + written, (size_t)(size - written));
+
+		// Interrupted before writing anything, just retry
+		if (n_bytes < 0)
+			result = errno == EINTR;
+		else
+			written += (uint64_t)n_bytes;
+	}
+
+	// Data must reach the disk before the rename does
+	result = result && fsync(file) == 0;
+	result = close(file) == 0 && result;
+	result = result && rename(temp_path, path) == 0;
+
+	if (!result) {
+		unlink(temp_path);
+		RAW_MEM_FREE(temp_path);
+		return false;
+	}
+
+	/*
+	 * The rename is only durable once the directory entry reaches the
+	 * disk, so the parent directory is flushed too
+	 */
+	char const* separator = strrchr(path, '/');
+
+	if (!separator)
+		snprintf(temp_path, temp_path_size, ".");
+	else if (separator == path)
+		snprintf(temp_path, temp_path_size, "/");
+	else
+		snprintf(temp_path, temp_path_size, "%.*s",
+			(int)(separator - path), path);
+
+	int directory = open(temp_path, O_RDONLY | O_DIRECTORY);
+
+	result = directory >= 0 && fsync(directory) == 0;
+
+	if (directory >= 0)
+		close(directory);
+
+	RAW_MEM_FREE(temp_path);
+
+	return result;
+}
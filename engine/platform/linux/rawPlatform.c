@@ -28,12 +28,19 @@
  *
  * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
  * Created: 18/03/2020
- * Last modified: 20/03/2020
+ * Last modified: 19/10/2026
  */
 
+// clock_gettime and nanosleep
+#define _POSIX_C_SOURCE 200809L
+
 #include <engine/platform/rawPlatform.h>
 
+#include <errno.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
 
 void rawPlatformSwitchTerminalColor(RawPlatformTerminalColor color) {
 	switch (color) {
@@ -90,3 +97,103 @@ void rawPlatformSwitchTerminalColor(RawPlatformTerminalColor color) {
 	}
 }
 
+
+typedef struct {
+	RawPlatformThreadFunction function;
+	void* data;
+} RawPlatformThreadStart;
+
+static void* rawPlatformThreadEntry(void* start_data) {
+	RawPlatformThreadStart start = *(RawPlatformThreadStart*)start_data;
+	free(start_data);
+
+	start.function(start.data);
+
+	return NULL;
+}
+
+bool rawPlatformCreateThread(RawPlatformThread* thread,
+	RawPlatformThreadFunction function, void* data) {
+	RawPlatformThreadStart* start = malloc(sizeof(RawPlatformThreadStart));
+
+	if (!start)
+		return false;
+
+	start->function = function;
+	start->data = data;
+
+	if (pthread_create(thread, NULL, rawPlatformThreadEntry, start) != 0) {
+		free(start);
+		return false;
+	}
+
+	return true;
+}
+
+void rawPlatformJoinThread(RawPlatformThread* thread) {
+	pthread_join(*thread, NULL);
+}
+
+uint32_t rawPlatformGetProcessorCount(void) {
+	long n_processors = sysconf(_SC_NPROCESSORS_ONLN);
+	return n_processors > 0 ? (uint32_t)n_processors : 1;
+}
+
+bool rawPlatformCreateMutex(RawPlatformMutex* mutex) {
+	return pthread_mutex_init(mutex, NULL) == 0;
+}
+
+void rawPlatformDestroyMutex(RawPlatformMutex* mutex) {
+	pthread_mutex_destroy(mutex);
+}
+
+void rawPlatformLockMutex(RawPlatformMutex* mutex) {
+	pthread_mutex_lock(mutex);
+}
+
+void rawPlatformUnlockMutex(RawPlatformMutex* mutex) {
+	pthread_mutex_unlock(mutex);
+}
+
+bool rawPlatformCreateConditionVariable(
+	RawPlatformConditionVariable* condition_variable) {
+	return pthread_cond_init(condition_variable, NULL) == 0;
+}
+
+void rawPlatformDestroyConditionVariable(
+	RawPlatformConditionVariable* condition_variable) {
+	pthread_cond_destroy(condition_variable);
+}
+
+void rawPlatformWaitConditionVariable(
+	RawPlatformConditionVariable* condition_variable,
+	RawPlatformMutex* mutex) {
+	pthread_cond_wait(condition_variable, mutex);
+}
+
+void rawPlatformSignalConditionVariable(
+	RawPlatformConditionVariable* condition_variable) {
+	pthread_cond_signal(condition_variable);
+}
+
+void rawPlatformBroadcastConditionVariable(
+	RawPlatformConditionVariable* condition_variable) {
+	pthread_cond_broadcast(condition_variable);
+}
+
+uint64_t rawPlatformGetTime(void) {
+	struct timespec time;
+	clock_gettime(CLOCK_MONOTONIC, &time);
+
+	return (uint64_t)time.tv_sec * 1000000000u + (uint64_t)time.tv_nsec;
+}
+
+void rawPlatformSleep(uint64_t nanoseconds) {
+	struct timespec time = {
+		.tv_sec = (time_t)(nanoseconds / 1000000000u),
+		.tv_nsec = (long)(nanoseconds % 1000000000u)
+	};
+
+	// Resumes after signal interruptions with the remaining time
+	while (nanosleep(&time, &time) != 0 && errno == EINTR);
+}
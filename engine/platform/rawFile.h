@@ -0,0 +1,69 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/* Raw Rendering Engine - "engine/platform/rawFile.h"
+ *
+ * Cross-platform file API
+ *
+ * Read-only file mappings, so large binary blobs are consumed in place,
+ * and atomic writes, so a crash mid-write never leaves a truncated file.
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+
+#ifndef RAW_FILE_H
+#define RAW_FILE_H
+
+#include <engine/platform/rawPlatform.h>
+
+#include <inttypes.h>
+#include <stdbool.h>
+
+typedef struct {
+	void const* data;
+	uint64_t size;
+
+	// Platform specific mapping object, if any
+	void* handle;
+} RawFileMapping;
+
+/*
+ * Maps @path read-only. Empty files are mapped with NULL @data.
+ * The mapping must be released through rawUnmapFile.
+ */
+bool rawMapFile(char const* path, RawFileMapping* mapping);
+void rawUnmapFile(RawFileMapping* mapping);
+
+/*
+ * Writes @data to a temporary file next to @path, flushes it to disk
+ * and renames it over @path, flushing the rename too. Readers see either
+ * the old or the new contents, never a partial write.
+ */
+bool rawWriteFileAtomic(char const* path, void const* data, uint64_t size);
+
+#endif // RAW_FILE_H
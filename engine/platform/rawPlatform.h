@@ -28,12 +28,15 @@
  *
  * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
  * Created: 16/03/2020
- * Last modified: 08/04/2020
+ * Last modified: 19/10/2026
  */
 
 #ifndef RAW_PLATFORM_H
 #define RAW_PLATFORM_H
 
+#include <inttypes.h>
+#include <stdbool.h>
+
 ///-------------------------------------------------------------- CROSS PLATFORM
 /*********************************
  ******** Terminal functionalities
@@ -65,6 +68,15 @@ typedef enum {
 #define RAW_LOAD_LIBRARY_FUNCTION(library, function) \
 	dlsym(library, function)
 
+/*********************************
+ *************** Threading support
+ *********************************/
+#include <pthread.h>
+
+typedef pthread_t RawPlatformThread;
+typedef pthread_mutex_t RawPlatformMutex;
+typedef pthread_cond_t RawPlatformConditionVariable;
+
 /*********************************
  ******** Terminal functionalities
  *********************************/
@@ -114,6 +126,13 @@ void rawPlatformSwitchTerminalColor(RawPlatformTerminalColor color);
 #define RAW_LOAD_LIBRARY_FUNCTION(library, function) \
 	GetProcAddress(library, function)
 
+/*********************************
+ *************** Threading support
+ *********************************/
+typedef HANDLE RawPlatformThread;
+typedef CRITICAL_SECTION RawPlatformMutex;
+typedef CONDITION_VARIABLE RawPlatformConditionVariable;
+
 /*********************************
  ******** Terminal functionalities
  *********************************/
@@ -136,5 +155,56 @@ void rawPlatformSwitchTerminalColor(RawPlatformTerminalColor color);
 
 #endif // Operating system switch
 
+///-------------------------------------------------------------- CROSS PLATFORM
+/*********************************
+ *************** Threading support
+ *********************************/
+typedef void (*RawPlatformThreadFunction)(void* data);
+
+/*
+ * Starts a new thread running @function(@data).
+ * The thread must be released through rawPlatformJoinThread.
+ */
+bool rawPlatformCreateThread(RawPlatformThread* thread,
+	RawPlatformThreadFunction function, void* data);
+
+// Blocks until @thread returns
+void rawPlatformJoinThread(RawPlatformThread* thread);
+
+// Number of logical processors available to the process
+uint32_t rawPlatformGetProcessorCount(void);
+
+bool rawPlatformCreateMutex(RawPlatformMutex* mutex);
+void rawPlatformDestroyMutex(RawPlatformMutex* mutex);
+void rawPlatformLockMutex(RawPlatformMutex* mutex);
+void rawPlatformUnlockMutex(RawPlatformMutex* mutex);
+
+bool rawPlatformCreateConditionVariable(
+	RawPlatformConditionVariable* condition_variable);
+void rawPlatformDestroyConditionVariable(
+	RawPlatformConditionVariable* condition_variable);
+
+/*
+ * Atomically releases @mutex and waits for @condition_variable.
+ * @mutex is locked again before returning. Spurious wake-ups may
+ * happen, so the caller must check its predicate in a loop.
+ */
+void rawPlatformWaitConditionVariable(
+	RawPlatformConditionVariable* condition_variable,
+	RawPlatformMutex* mutex);
+void rawPlatformSignalConditionVariable(
+	RawPlatformConditionVariable* condition_variable);
+void rawPlatformBroadcastConditionVariable(
+	RawPlatformConditionVariable* condition_variable);
+
+/*********************************
+ ******************** Time support
+ *********************************/
+// Monotonic clock, in nanoseconds. Only differences are meaningful.
+uint64_t rawPlatformGetTime(void);
+
+// Suspends the calling thread for at least @nanoseconds
+void rawPlatformSleep(uint64_t nanoseconds);
+
 #endif // RAW_PLATFORM_H
 
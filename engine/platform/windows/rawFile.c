@@ -0,0 +1,147 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/* Raw Rendering Engine - "engine/platform/windows/rawFile.c"
+ *
+ * Windows implementation for the file API
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+#include <engine/platform/rawFile.h>
+#include <engine/platform/rawMemory.h>
+
+#include <stdio.h>
+#include <string.h>
+
+bool rawMapFile(char const* path, RawFileMapping* mapping) {
+	mapping->data = NULL;
+	mapping->size = 0u;
+	mapping->handle = NULL;
+
+	HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL,
+		OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+
+	if (file == INVALID_HANDLE_VALUE)
+		return false;
+
+	LARGE_INTEGER file_size;
+
+	if (!GetFileSizeEx(file, &file_size)) {
+		CloseHandle(file);
+		return false;
+	}
+
+	mapping->size = (uint64_t)file_size.QuadPart;
+
+	if (mapping->size > 0u) {
+		HANDLE file_mapping = CreateFileMappingA(file,
+			NULL, PAGE_READONLY, 0, 0, NULL);
+
+		void* data = file_mapping ?
+			MapViewOfFile(file_mapping, FILE_MAP_READ, 0, 0, 0) : NULL;
+
+		if (!data) {
+			if (file_mapping)
+				CloseHandle(file_mapping);
+
+			CloseHandle(file);
+			mapping->size = 0u;
+			return false;
+		}
+
+		mapping->data = data;
+		mapping->handle = file_mapping;
+	}
+
+	// The view keeps the file referenced
+	CloseHandle(file);
+
+	return true;
+}
+
+void rawUnmapFile(RawFileMapping* mapping) {
+	if (mapping->data)
+		UnmapViewOfFile(mapping->data);
+
+	if (mapping->handle)
+		CloseHandle(mapping->handle);
+
+	mapping->data = NULL;
+	mapping->size = 0u;
+	mapping->handle = NULL;
+}
+
+bool rawWriteFileAtomic(char const* path, void const* data, uint64_t size) {
+	// Unique per process, so concurrent writers don't share the file
+	size_t temp_path_size = strlen(path) + 32u;
+	char* temp_path = RAW_NULL_PTR;
+
+	RAW_MEM_ALLOC(temp_path, (uint64_t)temp_path_size, sizeof(char));
+
+	if (!temp_path)
+		return false;
+
+	snprintf(temp_path, temp_path_size, "%s.%lu.tmp",
+		path, (unsigned long)GetCurrentProcessId());
+
+	HANDLE file = CreateFileA(temp_path, GENERIC_WRITE, 0, NULL,
+		CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+
+	if (file == INVALID_HANDLE_VALUE) {
+		RAW_MEM_FREE(temp_path);
+		return false;
+	}
+
+	uint8_t const* bytes = data;
+	uint64_t written = 0u;
+	bool result = true;
+
+	while (result && written < size) {
+		uint64_t remaining = size - written;
+		DWORD n_bytes = 0;
+
+		result = WriteFile(file, bytes + written,
+			remaining > 0x40000000u ? 0x40000000u : (DWORD)remaining,
+			&n_bytes, NULL) != 0;
+
+		written += n_bytes;
+	}
+
+	// Data must reach the disk before the rename does
+	result = result && FlushFileBuffers(file) != 0;
+	result = CloseHandle(file) != 0 && result;
+	result = result && MoveFileExA(temp_path, path,
+		MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+
+	if (!result)
+		DeleteFileA(temp_path);
+
+	RAW_MEM_FREE(temp_path);
+
+	return result;
+}
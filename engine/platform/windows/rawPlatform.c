@@ -28,12 +28,13 @@
  *
  * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
  * Created: 20/03/2020
- * Last modified: 20/03/2020
+ * Last modified: 19/10/2026
  */
 
 #include <engine/platform/rawPlatform.h>
 
 #include <stdio.h>
+#include <stdlib.h>
 
 void rawPlatformSwitchTerminalColor(RawPlatformTerminalColor color) {
 	HANDLE console = GetStdHandle(STD_OUTPUT_HANDLE);
@@ -99,3 +100,121 @@ void rawPlatformSwitchTerminalColor(RawPlatformTerminalColor color) {
 	}
 }
 
+
+typedef struct {
+	RawPlatformThreadFunction function;
+	void* data;
+} RawPlatformThreadStart;
+
+static DWORD WINAPI rawPlatformThreadEntry(LPVOID start_data) {
+	RawPlatformThreadStart start = *(RawPlatformThreadStart*)start_data;
+	free(start_data);
+
+	start.function(start.data);
+
+	return 0;
+}
+
+bool rawPlatformCreateThread(RawPlatformThread* thread,
+	RawPlatformThreadFunction function, void* data) {
+	RawPlatformThreadStart* start = malloc(sizeof(RawPlatformThreadStart));
+
+	if (!start)
+		return false;
+
+	start->function = function;
+	start->data = data;
+
+	*thread = CreateThread(NULL, 0, rawPlatformThreadEntry, start, 0, NULL);
+
+	if (!*thread) {
+		free(start);
+		return false;
+	}
+
+	return true;
+}
+
+void rawPlatformJoinThread(RawPlatformThread* thread) {
+	WaitForSingleObject(*thread, INFINITE);
+	CloseHandle(*thread);
+}
+
+uint32_t rawPlatformGetProcessorCount(void) {
+	SYSTEM_INFO system_info;
+	GetSystemInfo(&system_info);
+
+	return system_info.dwNumberOfProcessors > 0 ?
+		(uint32_t)system_info.dwNumberOfProcessors : 1;
+}
+
+bool rawPlatformCreateMutex(RawPlatformMutex* mutex) {
+	InitializeCriticalSection(mutex);
+	return true;
+}
+
+void rawPlatformDestroyMutex(RawPlatformMutex* mutex) {
+	DeleteCriticalSection(mutex);
+}
+
+void rawPlatformLockMutex(RawPlatformMutex* mutex) {
+	EnterCriticalSection(mutex);
+}
+
+void rawPlatformUnlockMutex(RawPlatformMutex* mutex) {
+	LeaveCriticalSection(mutex);
+}
+
+bool rawPlatformCreateConditionVariable(
+	RawPlatformConditionVariable* condition_variable) {
+	InitializeConditionVariable(condition_variable);
+	return true;
+}
+
+void rawPlatformDestroyConditionVariable(
+	RawPlatformConditionVariable* condition_variable) {
+	// Windows condition variables hold no resources
+	(void)condition_variable;
+}
+
+void rawPlatformWaitConditionVariable(
+	RawPlatformConditionVariable* condition_variable,
+	RawPlatformMutex* mutex) {
+	SleepConditionVariableCS(condition_variable, mutex, INFINITE);
+}
+
+void rawPlatformSignalConditionVariable(
+	RawPlatformConditionVariable* condition_variable) {
+	WakeConditionVariable(condition_variable);
+}
+
+void rawPlatformBroadcastConditionVariable(
+	RawPlatformConditionVariable* condition_variable) {
+	WakeAllConditionVariable(condition_variable);
+}
+
+uint64_t rawPlatformGetTime(void) {
+	LARGE_INTEGER frequency;
+	LARGE_INTEGER counter;
+
+	QueryPerformanceFrequency(&frequency);
+	QueryPerformanceCounter(&counter);
+
+	// Split to avoid overflowing the multiplication
+	uint64_t seconds = (uint64_t)(counter.QuadPart / frequency.QuadPart);
+	uint64_t remainder = (uint64_t)(counter.QuadPart % frequency.QuadPart);
+
+	return seconds * 1000000000u +
+		remainder * 1000000000u / (uint64_t)frequency.QuadPart;
+}
+
+void rawPlatformSleep(uint64_t nanoseconds) {
+	// Sleep has millisecond granularity, the remainder is spun
+	uint64_t end = rawPlatformGetTime() + nanoseconds;
+
+	if (nanoseconds >= 1000000u)
+		Sleep((DWORD)(nanoseconds / 1000000u));
+
+	while (rawPlatformGetTime() < end)
+		YieldProcessor();
+}
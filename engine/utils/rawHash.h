@@ -0,0 +1,66 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/utils/rawHash.h"
+ *
+ * Hashing utilities
+ *
+ * 64 bit FNV-1a, used to key caches by the contents of plain structs.
+ * Hashed structs must be zero initialized, so padding bytes are stable.
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+#ifndef RAW_HASH_H
+#define RAW_HASH_H
+
+#include <inttypes.h>
+
+#define RAW_HASH_FNV1A_OFFSET_BASIS 0xcbf29ce484222325ull
+#define RAW_HASH_FNV1A_PRIME 0x00000100000001b3ull
+
+/*
+ * Continues @hash with @size bytes of @data. Start a new hash with
+ * RAW_HASH_FNV1A_OFFSET_BASIS.
+ */
+static inline uint64_t rawHashBytes(
+	uint64_t hash, void const* data, uint64_t size) {
+
+	uint8_t const* bytes = data;
+
+	for (uint64_t i = 0; i < size; ++i) {
+		hash ^= bytes[i];
+		hash *= RAW_HASH_FNV1A_PRIME;
+	}
+
+	return hash;
+}
+
+static inline uint64_t rawHashU64(uint64_t hash, uint64_t value) {
+	return rawHashBytes(hash, &value, sizeof(uint64_t));
+}
+
+#endif // RAW_HASH_H
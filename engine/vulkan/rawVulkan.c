@@ -35,7 +35,7 @@
  *
  * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
  * Created: 16/03/2020
- * Last modified: 23/05/2020
+ * Last modified: 19/10/2026
  */
 
 #include <engine/vulkan/rawVulkan.h>
@@ -113,6 +113,14 @@ PFN_vkCreateWin32SurfaceKHR
 	vkCreateWin32SurfaceKHR;
 #endif
 
+/*
+ * Optional Vulkan instance level extensions
+ */
+PFN_vkGetPhysicalDeviceFeatures2KHR
+	vkGetPhysicalDeviceFeatures2KHR;
+PFN_vkGetPhysicalDeviceProperties2KHR
+	vkGetPhysicalDeviceProperties2KHR;
+
 /*
  * Vulkan device level functions
  */
@@ -144,6 +152,8 @@ PFN_vkMapMemory
 	vkMapMemory;
 PFN_vkFlushMappedMemoryRanges
 	vkFlushMappedMemoryRanges;
+PFN_vkInvalidateMappedMemoryRanges
+	vkInvalidateMappedMemoryRanges;
 PFN_vkUnmapMemory
 	vkUnmapMemory;
 PFN_vkCmdCopyBuffer
@@ -152,6 +162,8 @@ PFN_vkCmdCopyBufferToImage
 	vkCmdCopyBufferToImage;
 PFN_vkCmdCopyImageToBuffer
 	vkCmdCopyImageToBuffer;
+PFN_vkCmdFillBuffer
+	vkCmdFillBuffer;
 PFN_vkBeginCommandBuffer
 	vkBeginCommandBuffer;
 PFN_vkEndCommandBuffer
@@ -178,6 +190,8 @@ PFN_vkWaitForFences
 	vkWaitForFences;
 PFN_vkResetFences
 	vkResetFences;
+PFN_vkGetFenceStatus
+	vkGetFenceStatus;
 PFN_vkDestroyFence
 	vkDestroyFence;
 PFN_vkDestroySemaphore
@@ -248,6 +262,14 @@ PFN_vkDestroyPipeline
 	vkDestroyPipeline;
 PFN_vkDestroyEvent
 	vkDestroyEvent;
+PFN_vkCreateQueryPool
+	vkCreateQueryPool;
+PFN_vkGetQueryPoolResults
+	vkGetQueryPoolResults;
+PFN_vkCmdResetQueryPool
+	vkCmdResetQueryPool;
+PFN_vkCmdWriteTimestamp
+	vkCmdWriteTimestamp;
 PFN_vkDestroyQueryPool
 	vkDestroyQueryPool;
 PFN_vkCreateShaderModule
@@ -307,6 +329,20 @@ PFN_vkQueuePresentKHR
 PFN_vkDestroySwapchainKHR
 	vkDestroySwapchainKHR;
 
+/*
+ * Optional Vulkan device level extensions
+ */
+PFN_vkGetSemaphoreCounterValueKHR
+	vkGetSemaphoreCounterValueKHR;
+PFN_vkWaitSemaphoresKHR
+	vkWaitSemaphoresKHR;
+PFN_vkGetRefreshCycleDurationGOOGLE
+	vkGetRefreshCycleDurationGOOGLE;
+PFN_vkGetPastPresentationTimingGOOGLE
+	vkGetPastPresentationTimingGOOGLE;
+PFN_vkWaitForPresentKHR
+	vkWaitForPresentKHR;
+
 bool rawLoadVulkan(RAW_VULKAN_LIBRARY* vulkan) {
 	RAW_LOAD_VULKAN_LIBRARY(*vulkan);
 
@@ -421,6 +457,27 @@ bool rawLoadVulkanInstanceLevelFunctions(
 #endif
 #undef LOAD
 
+#define LOAD(func, extension)                                          \
+	func = RAW_NULL_PTR;                                               \
+                                                                       \
+	for (uint32_t i = 0; i < n_enabled_extensions; ++i) {              \
+		if (strcmp(enabled_extensions[i], extension) == 0) {           \
+			func = (PFN_##func)vkGetInstanceProcAddr(instance, #func); \
+                                                                       \
+			if (!func) {                                               \
+				RAW_LOG_ERROR(#func " could not be loaded!");          \
+                                                                       \
+				return false;                                          \
+			}                                                          \
+		}                                                              \
+	}
+
+	LOAD(vkGetPhysicalDeviceFeatures2KHR,
+		VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
+	LOAD(vkGetPhysicalDeviceProperties2KHR,
+		VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
+#undef LOAD
+
 	return true;
 }
 
@@ -452,10 +509,12 @@ bool rawLoadVulkanDeviceLevelFunctions(
 	LOAD(vkCreateImageView);
 	LOAD(vkMapMemory);
 	LOAD(vkFlushMappedMemoryRanges);
+	LOAD(vkInvalidateMappedMemoryRanges);
 	LOAD(vkUnmapMemory);
 	LOAD(vkCmdCopyBuffer);
 	LOAD(vkCmdCopyBufferToImage);
 	LOAD(vkCmdCopyImageToBuffer);
+	LOAD(vkCmdFillBuffer);
 	LOAD(vkBeginCommandBuffer);
 	LOAD(vkEndCommandBuffer);
 	LOAD(vkQueueSubmit);
@@ -469,6 +528,7 @@ bool rawLoadVulkanDeviceLevelFunctions(
 	LOAD(vkCreateFence);
 	LOAD(vkWaitForFences);
 	LOAD(vkResetFences);
+	LOAD(vkGetFenceStatus);
 	LOAD(vkDestroyFence);
 	LOAD(vkDestroySemaphore);
 	LOAD(vkResetCommandBuffer);
@@ -504,6 +564,10 @@ bool rawLoadVulkanDeviceLevelFunctions(
 	LOAD(vkCreateComputePipelines);
 	LOAD(vkDestroyPipeline);
 	LOAD(vkDestroyEvent);
+	LOAD(vkCreateQueryPool);
+	LOAD(vkGetQueryPoolResults);
+	LOAD(vkCmdResetQueryPool);
+	LOAD(vkCmdWriteTimestamp);
 	LOAD(vkDestroyQueryPool);
 	LOAD(vkCreateShaderModule);
 	LOAD(vkDestroyShaderModule);
@@ -566,6 +630,33 @@ bool rawLoadVulkanDeviceLevelFunctions(
 		VK_KHR_SWAPCHAIN_EXTENSION_NAME);
 #undef LOAD
 
+#define LOAD(func, extension)                                              \
+	func = RAW_NULL_PTR;                                                   \
+                                                                           \
+	for (uint32_t i = 0; i < n_enabled_extensions; ++i) {                  \
+		if (strcmp(enabled_extensions[i], extension) == 0) {               \
+			func = (PFN_##func)vkGetDeviceProcAddr(logical_device, #func); \
+                                                                           \
+			if (!func) {                                                   \
+				RAW_LOG_ERROR(#func " could not be loaded!");              \
+                                                                           \
+				return false;                                              \
+			}                                                              \
+		}                                                                  \
+	}
+
+	LOAD(vkGetSemaphoreCounterValueKHR,
+		VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME);
+	LOAD(vkWaitSemaphoresKHR,
+		VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME);
+	LOAD(vkGetRefreshCycleDurationGOOGLE,
+		VK_GOOGLE_DISPLAY_TIMING_EXTENSION_NAME);
+	LOAD(vkGetPastPresentationTimingGOOGLE,
+		VK_GOOGLE_DISPLAY_TIMING_EXTENSION_NAME);
+	LOAD(vkWaitForPresentKHR,
+		VK_KHR_PRESENT_WAIT_EXTENSION_NAME);
+#undef LOAD
+
 	return true;
 }
 
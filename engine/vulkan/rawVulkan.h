@@ -28,7 +28,7 @@
  *
  * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
  * Created: 16/03/2020
- * Last modified: 23/05/2020
+ * Last modified: 19/10/2026
  */
 
 #ifndef RAW_VULKAN_H
@@ -176,6 +176,20 @@ extern PFN_vkCreateWin32SurfaceKHR
 	vkCreateWin32SurfaceKHR;
 #endif
 
+/*
+ * Optional Vulkan instance level extensions
+ * These are NULL when the extension wasn't enabled
+ */
+#define vkGetPhysicalDeviceFeatures2KHR \
+	rawVkGetPhysicalDeviceFeatures2KHR
+extern PFN_vkGetPhysicalDeviceFeatures2KHR
+	vkGetPhysicalDeviceFeatures2KHR;
+
+#define vkGetPhysicalDeviceProperties2KHR \
+	rawVkGetPhysicalDeviceProperties2KHR
+extern PFN_vkGetPhysicalDeviceProperties2KHR
+	vkGetPhysicalDeviceProperties2KHR;
+
 /*
  * Vulkan device level functions
  */
@@ -249,6 +263,11 @@ extern PFN_vkMapMemory
 extern PFN_vkFlushMappedMemoryRanges
 	vkFlushMappedMemoryRanges;
 
+#define vkInvalidateMappedMemoryRanges \
+	rawVkInvalidateMappedMemoryRanges
+extern PFN_vkInvalidateMappedMemoryRanges
+	vkInvalidateMappedMemoryRanges;
+
 #define vkUnmapMemory \
 	rawVkUnmapMemory
 extern PFN_vkUnmapMemory
@@ -269,6 +288,11 @@ extern PFN_vkCmdCopyBufferToImage
 extern PFN_vkCmdCopyImageToBuffer
 	vkCmdCopyImageToBuffer;
 
+#define vkCmdFillBuffer \
+	rawVkCmdFillBuffer
+extern PFN_vkCmdFillBuffer
+	vkCmdFillBuffer;
+
 #define vkBeginCommandBuffer \
 	rawVkBeginCommandBuffer
 extern PFN_vkBeginCommandBuffer
@@ -334,6 +358,11 @@ extern PFN_vkWaitForFences
 extern PFN_vkResetFences
 	vkResetFences;
 
+#define vkGetFenceStatus \
+	rawVkGetFenceStatus
+extern PFN_vkGetFenceStatus
+	vkGetFenceStatus;
+
 #define vkDestroyFence \
 	rawVkDestroyFence
 extern PFN_vkDestroyFence
@@ -509,6 +538,26 @@ extern PFN_vkDestroyPipeline
 extern PFN_vkDestroyEvent
 	vkDestroyEvent;
 
+#define vkCreateQueryPool \
+	rawVkCreateQueryPool
+extern PFN_vkCreateQueryPool
+	vkCreateQueryPool;
+
+#define vkGetQueryPoolResults \
+	rawVkGetQueryPoolResults
+extern PFN_vkGetQueryPoolResults
+	vkGetQueryPoolResults;
+
+#define vkCmdResetQueryPool \
+	rawVkCmdResetQueryPool
+extern PFN_vkCmdResetQueryPool
+	vkCmdResetQueryPool;
+
+#define vkCmdWriteTimestamp \
+	rawVkCmdWriteTimestamp
+extern PFN_vkCmdWriteTimestamp
+	vkCmdWriteTimestamp;
+
 #define vkDestroyQueryPool \
 	rawVkDestroyQueryPool
 extern PFN_vkDestroyQueryPool
@@ -647,6 +696,35 @@ extern PFN_vkQueuePresentKHR
 extern PFN_vkDestroySwapchainKHR
 	vkDestroySwapchainKHR;
 
+/*
+ * Optional Vulkan device level extensions
+ * These are NULL when the extension wasn't enabled
+ */
+#define vkGetSemaphoreCounterValueKHR \
+	rawVkGetSemaphoreCounterValueKHR
+extern PFN_vkGetSemaphoreCounterValueKHR
+	vkGetSemaphoreCounterValueKHR;
+
+#define vkWaitSemaphoresKHR \
+	rawVkWaitSemaphoresKHR
+extern PFN_vkWaitSemaphoresKHR
+	vkWaitSemaphoresKHR;
+
+#define vkGetRefreshCycleDurationGOOGLE \
+	rawVkGetRefreshCycleDurationGOOGLE
+extern PFN_vkGetRefreshCycleDurationGOOGLE
+	vkGetRefreshCycleDurationGOOGLE;
+
+#define vkGetPastPresentationTimingGOOGLE \
+	rawVkGetPastPresentationTimingGOOGLE
+extern PFN_vkGetPastPresentationTimingGOOGLE
+	vkGetPastPresentationTimingGOOGLE;
+
+#define vkWaitForPresentKHR \
+	rawVkWaitForPresentKHR
+extern PFN_vkWaitForPresentKHR
+	vkWaitForPresentKHR;
+
 /*
  * Loads Vulkan runtime library, vkGetInstanceProcAddr
  * and Vulkan global level functions.
@@ -656,6 +734,7 @@ bool rawLoadVulkan(RAW_VULKAN_LIBRARY* vulkan);
 /*
  * Loads Vulkan intance level functions and extensions.
  * All extensions required by the engine must be present on the hardware.
+ * Functions of optional extensions not in @enabled_extensions are set to NULL.
  */
 bool rawLoadVulkanInstanceLevelFunctions(
 	VkInstance instance,
@@ -666,6 +745,7 @@ bool rawLoadVulkanInstanceLevelFunctions(
 /*
  * Loads Vulkan device level functions and extensions.
  * All extensions required by the engine must be present on the hardware.
+ * Functions of optional extensions not in @enabled_extensions are set to NULL.
  */
 bool rawLoadVulkanDeviceLevelFunctions(
 	VkDevice logical_device,
@@ -0,0 +1,245 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanAsyncCompute.c"
+ *
+ * Async compute scheduling
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+
+#include <engine/vulkan/rawVulkanAsyncCompute.h>
+#include <engine/utils/rawLogger.h>
+
+#include <string.h>
+
+bool rawCreateVulkanAsyncCompute(
+	VkDevice logical_device,
+	uint32_t graphics_queue_family_index,
+	RawVulkanQueueTimeline* graphics_timeline,
+	uint32_t compute_queue_family_index,
+	VkQueue compute_queue,
+	bool use_timeline_semaphore,
+	RawVulkanAsyncCompute* async_compute) {
+
+	memset(async_compute, 0, sizeof(RawVulkanAsyncCompute));
+
+	async_compute->graphics_queue_family_index = graphics_queue_family_index;
+	async_compute->compute_queue_family_index = compute_queue_family_index;
+	async_compute->graphics_timeline = graphics_timeline;
+	async_compute->separate_queue = compute_queue != graphics_timeline->queue;
+	async_compute->ownership_transfer =
+		compute_queue_family_index != graphics_queue_family_index;
+
+	if (async_compute->ownership_transfer && !async_compute->separate_queue) {
+		RAW_LOG_ERROR("Compute queue family doesn't match its queue!");
+		return false;
+	}
+
+	if (!async_compute->separate_queue) {
+		RAW_LOG_INFO("No separate compute queue, "
+			"compute work falls back to the graphics queue");
+		return true;
+	}
+
+	if (!rawCreateVulkanQueueTimeline(logical_device, compute_queue,
+		use_timeline_semaphore, &async_compute->compute_timeline)) {
+		RAW_LOG_ERROR("rawCreateVulkanQueueTimeline failed!");
+		return false;
+	}
+
+	return true;
+}
+
+void rawDestroyVulkanAsyncCompute(
+	VkDevice logical_device,
+	RawVulkanAsyncCompute* async_compute) {
+
+	if (async_compute->separate_queue)
+		rawDestroyVulkanQueueTimeline(
+			logical_device, &async_compute->compute_timeline);
+
+	memset(async_compute, 0, sizeof(RawVulkanAsyncCompute));
+}
+
+RawVulkanQueueTimeline* rawGetVulkanAsyncComputeTimeline(
+	RawVulkanAsyncCompute* async_compute) {
+
+	return async_compute->separate_queue ?
+		&async_compute->compute_timeline : async_compute->graphics_timeline;
+}
+
+bool rawSubmitVulkanAsyncCompute(
+	VkDevice logical_device,
+	RawVulkanAsyncCompute* async_compute,
+	VkSubmitInfo const* const submit_info,
+	RawVulkanTimelinePoint const* const waits,
+	VkPipelineStageFlags const* const wait_stages,
+	uint32_t n_waits,
+	RawVulkanTimelinePoint* signaled_point) {
+
+	signaled_point->timeline =
+		rawGetVulkanAsyncComputeTimeline(async_compute);
+
+	return rawSubmitVulkanQueueTimeline(logical_device,
+		signaled_point->timeline, submit_info, waits, wait_stages, n_waits,
+		&signaled_point->value);
+}
+
+/*
+ * Records a single barrier for every transfer. @queue_family_transfer
+ * sets the families from @direction, @src_stages_from_dst makes the
+ * barrier wait on the dst stages, which chains with the semaphore wait
+ * of the submission instead of the work of its own queue.
+ */
+static bool rawCmdVulkanQueueTransferBarrier(
+	RawVulkanAsyncCompute const* const async_compute,
+	VkCommandBuffer command_buffer,
+	RawVulkanQueueTransferDirection direction,
+	RawVulkanQueueTransfer const* const transfers,
+	uint32_t n_transfers,
+	bool release,
+	bool queue_family_transfer,
+	bool src_stages_from_dst) {
+
+	if (n_transfers > RAW_VULKAN_MAX_QUEUE_TRANSFERS) {
+		RAW_LOG_ERROR("Too many queue transfers in a single barrier!");
+		return false;
+	}
+
+	VkBufferMemoryBarrier buffer_barriers[RAW_VULKAN_MAX_QUEUE_TRANSFERS];
+	VkImageMemoryBarrier image_barriers[RAW_VULKAN_MAX_QUEUE_TRANSFERS];
+	uint32_t n_buffer_barriers = 0u;
+	uint32_t n_image_barriers = 0u;
+
+	uint32_t src_queue_family_index = VK_QUEUE_FAMILY_IGNORED;
+	uint32_t dst_queue_family_index = VK_QUEUE_FAMILY_IGNORED;
+
+	if (queue_family_transfer) {
+		bool to_compute = direction == RAW_VULKAN_GRAPHICS_TO_COMPUTE;
+
+		src_queue_family_index = to_compute ?
+			async_compute->graphics_queue_family_index :
+			async_compute->compute_queue_family_index;
+		dst_queue_family_index = to_compute ?
+			async_compute->compute_queue_family_index :
+			async_compute->graphics_queue_family_index;
+	}
+
+	VkPipelineStageFlags src_stages = 0;
+	VkPipelineStageFlags dst_stages = 0;
+
+	for (uint32_t i = 0; i < n_transfers; ++i) {
+		RawVulkanQueueTransfer const* transfer = &transfers[i];
+
+		// Release only makes writes available, acquire only visible
+		VkAccessFlags src_access = release || !src_stages_from_dst ?
+			transfer->src_access : 0;
+		VkAccessFlags dst_access = release ? 0 : transfer->dst_access;
+
+		if (release)
+			src_stages |= transfer->src_stages;
+		else {
+			src_stages |= src_stages_from_dst ?
+				transfer->dst_stages : transfer->src_stages;
+			dst_stages |= transfer->dst_stages;
+		}
+
+		if (transfer->image != VK_NULL_HANDLE) {
+			image_barriers[n_image_barriers++] = (VkImageMemoryBarrier) {
+				.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+				.pNext = RAW_NULL_PTR,
+				.srcAccessMask = src_access,
+				.dstAccessMask = dst_access,
+				.oldLayout = transfer->old_layout,
+				.newLayout = transfer->new_layout,
+				.srcQueueFamilyIndex = src_queue_family_index,
+				.dstQueueFamilyIndex = dst_queue_family_index,
+				.image = transfer->image,
+				.subresourceRange = transfer->subresource_range
+			};
+		}
+		else {
+			buffer_barriers[n_buffer_barriers++] = (VkBufferMemoryBarrier) {
+				.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+				.pNext = RAW_NULL_PTR,
+				.srcAccessMask = src_access,
+				.dstAccessMask = dst_access,
+				.srcQueueFamilyIndex = src_queue_family_index,
+				.dstQueueFamilyIndex = dst_queue_family_index,
+				.buffer = transfer->buffer,
+				.offset = transfer->offset,
+				.size = transfer->size
+			};
+		}
+	}
+
+	if (n_buffer_barriers + n_image_barriers == 0u)
+		return true;
+
+	vkCmdPipelineBarrier(command_buffer,
+		src_stages ? src_stages : VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+		dst_stages ? dst_stages : VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+		0, 0u, RAW_NULL_PTR, n_buffer_barriers, buffer_barriers,
+		n_image_barriers, image_barriers);
+
+	return true;
+}
+
+bool rawCmdReleaseVulkanQueueOwnership(
+	RawVulkanAsyncCompute const* const async_compute,
+	VkCommandBuffer command_buffer,
+	RawVulkanQueueTransferDirection direction,
+	RawVulkanQueueTransfer const* const transfers,
+	uint32_t n_transfers) {
+
+	// Within a family, the semaphore or the acquire barrier is enough
+	if (!async_compute->ownership_transfer)
+		return true;
+
+	return rawCmdVulkanQueueTransferBarrier(async_compute, command_buffer,
+		direction, transfers, n_transfers, true, true, false);
+}
+
+bool rawCmdAcquireVulkanQueueOwnership(
+	RawVulkanAsyncCompute const* const async_compute,
+	VkCommandBuffer command_buffer,
+	RawVulkanQueueTransferDirection direction,
+	RawVulkanQueueTransfer const* const transfers,
+	uint32_t n_transfers) {
+
+	// Shared queue: an ordinary barrier against the source work
+	if (!async_compute->separate_queue)
+		return rawCmdVulkanQueueTransferBarrier(async_compute,
+			command_buffer, direction, transfers, n_transfers,
+			false, false, false);
+
+	// The semaphore wait already made every write available and visible
+	return rawCmdVulkanQueueTransferBarrier(async_compute, command_buffer,
+		direction, transfers, n_transfers, false,
+		async_compute->ownership_transfer, true);
+}
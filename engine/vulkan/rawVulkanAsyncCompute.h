@@ -0,0 +1,161 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanAsyncCompute.h"
+ *
+ * Async compute scheduling
+ *
+ * Compute passes (culling, particle simulation, post-processing) are
+ * submitted to their own queue, preferably from a compute-only family,
+ * so they overlap with rasterization. Graphics and compute synchronize
+ * through their queue timelines, and exclusive resources moving between
+ * the two families get queue family ownership transfer barriers. When
+ * the device has no separate compute queue, everything falls back to
+ * the graphics queue with regular barriers.
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+
+#ifndef RAW_VULKAN_ASYNC_COMPUTE_H
+#define RAW_VULKAN_ASYNC_COMPUTE_H
+
+#include <engine/vulkan/rawVulkan.h>
+#include <engine/vulkan/rawVulkanSync.h>
+
+#include <inttypes.h>
+#include <stdbool.h>
+
+// Max. resources changing queues in a single barrier
+#define RAW_VULKAN_MAX_QUEUE_TRANSFERS 32u
+
+typedef enum {
+	RAW_VULKAN_GRAPHICS_TO_COMPUTE,
+	RAW_VULKAN_COMPUTE_TO_GRAPHICS
+} RawVulkanQueueTransferDirection;
+
+/*
+ * A buffer range or image subresource range handed from one queue to
+ * the other. @src_* describe the last access on the source queue and
+ * @dst_* the first access on the destination queue. Images set @image
+ * and transition from @old_layout to @new_layout, buffers set @buffer.
+ */
+typedef struct {
+	VkBuffer buffer;
+	VkDeviceSize offset;
+	VkDeviceSize size;
+
+	VkImage image;
+	VkImageSubresourceRange subresource_range;
+	VkImageLayout old_layout;
+	VkImageLayout new_layout;
+
+	VkPipelineStageFlags src_stages;
+	VkAccessFlags src_access;
+	VkPipelineStageFlags dst_stages;
+	VkAccessFlags dst_access;
+} RawVulkanQueueTransfer;
+
+typedef struct {
+	uint32_t graphics_queue_family_index;
+	uint32_t compute_queue_family_index;
+
+	RawVulkanQueueTimeline* graphics_timeline;
+
+	// Only used if compute has a queue of its own
+	RawVulkanQueueTimeline compute_timeline;
+
+	// Compute runs on a different queue than graphics
+	bool separate_queue;
+
+	// Compute runs on a different family, so ownership must be transferred
+	bool ownership_transfer;
+} RawVulkanAsyncCompute;
+
+/*
+ * @compute_queue may be the graphics queue itself, in which case
+ * compute work is simply serialized with graphics.
+ *
+ * @graphics_timeline must outlive @async_compute. @use_timeline_semaphore
+ * follows the rules of rawCreateVulkanQueueTimeline.
+ */
+bool rawCreateVulkanAsyncCompute(
+	VkDevice logical_device,
+	uint32_t graphics_queue_family_index,
+	RawVulkanQueueTimeline* graphics_timeline,
+	uint32_t compute_queue_family_index,
+	VkQueue compute_queue,
+	bool use_timeline_semaphore,
+	RawVulkanAsyncCompute* async_compute);
+
+void rawDestroyVulkanAsyncCompute(
+	VkDevice logical_device,
+	RawVulkanAsyncCompute* async_compute);
+
+// Timeline compute submissions are ordered by
+RawVulkanQueueTimeline* rawGetVulkanAsyncComputeTimeline(
+	RawVulkanAsyncCompute* async_compute);
+
+/*
+ * Submits compute work, waiting on @waits at @wait_stages. The point
+ * reached once the work is done is stored in @signaled_point, to be
+ * waited on by the graphics submissions consuming its results.
+ */
+bool rawSubmitVulkanAsyncCompute(
+	VkDevice logical_device,
+	RawVulkanAsyncCompute* async_compute,
+	VkSubmitInfo const* const submit_info,
+	RawVulkanTimelinePoint const* const waits,
+	VkPipelineStageFlags const* const wait_stages,
+	uint32_t n_waits,
+	RawVulkanTimelinePoint* signaled_point);
+
+/*
+ * Records the release half of the transfers into @command_buffer, which
+ * must be submitted to the source queue. Nothing is recorded if both
+ * directions share a queue family.
+ */
+bool rawCmdReleaseVulkanQueueOwnership(
+	RawVulkanAsyncCompute const* const async_compute,
+	VkCommandBuffer command_buffer,
+	RawVulkanQueueTransferDirection direction,
+	RawVulkanQueueTransfer const* const transfers,
+	uint32_t n_transfers);
+
+/*
+ * Records the acquire half of the transfers into @command_buffer, which
+ * must be submitted to the destination queue. On separate queues, the
+ * submission must wait on the source work at the transfers dst stages.
+ * On a shared queue, a regular barrier is recorded instead.
+ */
+bool rawCmdAcquireVulkanQueueOwnership(
+	RawVulkanAsyncCompute const* const async_compute,
+	VkCommandBuffer command_buffer,
+	RawVulkanQueueTransferDirection direction,
+	RawVulkanQueueTransfer const* const transfers,
+	uint32_t n_transfers);
+
+#endif // RAW_VULKAN_ASYNC_COMPUTE_H
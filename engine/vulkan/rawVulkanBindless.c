@@ -0,0 +1,473 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanBindless.c"
+ *
+ * Bindless descriptor heap
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+
+#include <engine/vulkan/rawVulkanBindless.h>
+#include <engine/vulkan/rawVulkanPhysicalDevice.h>
+#include <engine/platform/rawMemory.h>
+#include <engine/utils/rawLogger.h>
+
+#include <string.h>
+
+bool rawGetVulkanBindlessDeviceFeatures(
+	VkPhysicalDevice physical_device,
+	VkPhysicalDeviceDescriptorIndexingFeaturesEXT* features) {
+
+	memset(features, 0, sizeof(VkPhysicalDeviceDescriptorIndexingFeaturesEXT));
+
+	if (!vkGetPhysicalDeviceFeatures2KHR ||
+		!rawIsVulkanPhysicalDeviceExtensionSupported(physical_device,
+			VK_KHR_MAINTENANCE3_EXTENSION_NAME) ||
+		!rawIsVulkanPhysicalDeviceExtensionSupported(physical_device,
+			VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME))
+		return false;
+
+	VkPhysicalDeviceDescriptorIndexingFeaturesEXT supported = {
+		.sType =
+			VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT,
+		.pNext = RAW_NULL_PTR
+	};
+
+	VkPhysicalDeviceFeatures2KHR features2 = {
+		.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2_KHR,
+		.pNext = &supported
+	};
+
+	vkGetPhysicalDeviceFeatures2KHR(physical_device, &features2);
+
+	if (!supported.descriptorBindingSampledImageUpdateAfterBind ||
+		!supported.descriptorBindingStorageBufferUpdateAfterBind ||
+		!supported.descriptorBindingUpdateUnusedWhilePending ||
+		!supported.descriptorBindingPartiallyBound ||
+		!supported.runtimeDescriptorArray)
+		return false;
+
+	features->sType =
+		VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT;
+	features->pNext = RAW_NULL_PTR;
+	features->descriptorBindingSampledImageUpdateAfterBind = VK_TRUE;
+	features->descriptorBindingStorageBufferUpdateAfterBind = VK_TRUE;
+	features->descriptorBindingUpdateUnusedWhilePending = VK_TRUE;
+	features->descriptorBindingPartiallyBound = VK_TRUE;
+	features->runtimeDescriptorArray = VK_TRUE;
+
+	return true;
+}
+
+static bool rawCreateVulkanBindlessArray(
+	uint32_t capacity,
+	RawVulkanBindlessArray* array) {
+
+	RAW_MEM_ALLOC(array->free_indices, (uint64_t)capacity, sizeof(uint32_t));
+	RAW_MEM_ALLOC(array->retired_indices, (uint64_t)capacity,
+		sizeof(RawVulkanBindlessRetiredIndex));
+
+	if (!array->free_indices || !array->retired_indices) {
+		RAW_LOG_ERROR("RAW_MEM_ALLOC failed on "
+			"rawCreateVulkanBindlessArray!");
+		return false;
+	}
+
+	array->capacity = capacity;
+
+	// Popped from the back, so indices are handed out from 0
+	for (uint32_t i = 0; i < capacity; ++i)
+		array->free_indices[i] = capacity - 1u - i;
+
+	array->n_free_indices = capacity;
+	array->first_retired_index = 0u;
+	array->n_retired_indices = 0u;
+
+	return true;
+}
+
+bool rawCreateVulkanBindlessHeap(
+	VkDevice logical_device,
+	uint32_t max_sampled_images,
+	uint32_t max_storage_buffers,
+	uint32_t max_samplers,
+	RawVulkanBindlessHeap* heap) {
+
+	memset(heap, 0, sizeof(RawVulkanBindlessHeap));
+
+	if (max_sampled_images == 0u || max_storage_buffers == 0u ||
+		max_samplers == 0u) {
+		RAW_LOG_ERROR("Bindless heap arrays can't be empty!");
+		return false;
+	}
+
+	uint32_t capacities[RAW_VULKAN_BINDLESS_RESOURCE_TYPE_COUNT] = {
+		max_sampled_images,
+		max_storage_buffers,
+		max_samplers
+	};
+
+	VkDescriptorType const descriptor_types[
+		RAW_VULKAN_BINDLESS_RESOURCE_TYPE_COUNT] = {
+		VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE,
+		VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+		VK_DESCRIPTOR_TYPE_SAMPLER
+	};
+
+	VkDescriptorSetLayoutBinding bindings[
+		RAW_VULKAN_BINDLESS_RESOURCE_TYPE_COUNT];
+	VkDescriptorBindingFlagsEXT binding_flags[
+		RAW_VULKAN_BINDLESS_RESOURCE_TYPE_COUNT];
+	VkDescriptorPoolSize pool_sizes[RAW_VULKAN_BINDLESS_RESOURCE_TYPE_COUNT];
+
+	for (uint32_t i = 0; i < RAW_VULKAN_BINDLESS_RESOURCE_TYPE_COUNT; ++i) {
+		if (!rawCreateVulkanBindlessArray(capacities[i], &heap->arrays[i])) {
+			rawDestroyVulkanBindlessHeap(logical_device, heap);
+			return false;
+		}
+
+		bindings[i] = (VkDescriptorSetLayoutBinding){
+			.binding = i,
+			.descriptorType = descriptor_types[i],
+			.descriptorCount = capacities[i],
+			.stageFlags = VK_SHADER_STAGE_ALL,
+			.pImmutableSamplers = RAW_NULL_PTR
+		};
+
+		// Unregistered slots are never written, hence partially bound
+		binding_flags[i] = VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT |
+			VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT_EXT |
+			VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT_EXT;
+
+		pool_sizes[i] = (VkDescriptorPoolSize){
+			.type = descriptor_types[i],
+			.descriptorCount = capacities[i]
+		};
+	}
+
+	VkDescriptorSetLayoutBindingFlagsCreateInfoEXT binding_flags_info = {
+		.sType =
+			VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO_EXT,
+		.pNext = RAW_NULL_PTR,
+		.bindingCount = RAW_VULKAN_BINDLESS_RESOURCE_TYPE_COUNT,
+		.pBindingFlags = binding_flags
+	};
+
+	VkDescriptorSetLayoutCreateInfo layout_create_info = {
+		.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
+		.pNext = &binding_flags_info,
+		.flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT_EXT,
+		.bindingCount = RAW_VULKAN_BINDLESS_RESOURCE_TYPE_COUNT,
+		.pBindings = bindings
+	};
+
+	// TODO: Pass allocation callback
+	VkResult result = vkCreateDescriptorSetLayout(logical_device,
+		&layout_create_info, RAW_NULL_PTR, &heap->set_layout);
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("vkCreateDescriptorSetLayout failed!");
+		heap->set_layout = VK_NULL_HANDLE;
+		rawDestroyVulkanBindlessHeap(logical_device, heap);
+		return false;
+	}
+
+	VkDescriptorPoolCreateInfo pool_create_info = {
+		.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT_EXT,
+		.maxSets = 1u,
+		.poolSizeCount = RAW_VULKAN_BINDLESS_RESOURCE_TYPE_COUNT,
+		.pPoolSizes = pool_sizes
+	};
+
+	// TODO: Pass allocation callback
+	result = vkCreateDescriptorPool(logical_device,
+		&pool_create_info, RAW_NULL_PTR, &heap->descriptor_pool);
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("vkCreateDescriptorPool failed!");
+		heap->descriptor_pool = VK_NULL_HANDLE;
+		rawDestroyVulkanBindlessHeap(logical_device, heap);
+		return false;
+	}
+
+	VkDescriptorSetAllocateInfo allocate_info = {
+		.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.descriptorPool = heap->descriptor_pool,
+		.descriptorSetCount = 1u,
+		.pSetLayouts = &heap->set_layout
+	};
+
+	result = vkAllocateDescriptorSets(
+		logical_device, &allocate_info, &heap->descriptor_set);
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("vkAllocateDescriptorSets failed!");
+		rawDestroyVulkanBindlessHeap(logical_device, heap);
+		return false;
+	}
+
+	return true;
+}
+
+void rawDestroyVulkanBindlessHeap(
+	VkDevice logical_device,
+	RawVulkanBindlessHeap* heap) {
+
+	// The set goes away with its pool
+	if (heap->descriptor_pool != VK_NULL_HANDLE)
+		// TODO: Pass allocation callback
+		vkDestroyDescriptorPool(logical_device,
+			heap->descriptor_pool, RAW_NULL_PTR);
+
+	if (heap->set_layout != VK_NULL_HANDLE)
+		// TODO: Pass allocation callback
+		vkDestroyDescriptorSetLayout(logical_device,
+			heap->set_layout, RAW_NULL_PTR);
+
+	for (uint32_t i = 0; i < RAW_VULKAN_BINDLESS_RESOURCE_TYPE_COUNT; ++i) {
+		if (heap->arrays[i].free_indices)
+			RAW_MEM_FREE(heap->arrays[i].free_indices);
+
+		if (heap->arrays[i].retired_indices)
+			RAW_MEM_FREE(heap->arrays[i].retired_indices);
+	}
+
+	memset(heap, 0, sizeof(RawVulkanBindlessHeap));
+}
+
+void rawBeginVulkanBindlessHeapFrame(
+	RawVulkanBindlessHeap* heap,
+	uint64_t frame_number,
+	uint64_t oldest_pending_frame_number) {
+
+	heap->frame_number = frame_number;
+	heap->oldest_pending_frame_number = oldest_pending_frame_number;
+}
+
+static bool rawAcquireVulkanBindlessIndex(
+	RawVulkanBindlessHeap* heap,
+	RawVulkanBindlessResourceType resource_type,
+	uint32_t* index) {
+
+	RawVulkanBindlessArray* array = &heap->arrays[resource_type];
+
+	// Retired in release order, so the oldest ones are in front
+	while (array->n_retired_indices > 0u) {
+		RawVulkanBindlessRetiredIndex const* retired =
+			&array->retired_indices[array->first_retired_index];
+
+		if (retired->frame_number >= heap->oldest_pending_frame_number)
+			break;
+
+		array->free_indices[array->n_free_indices++] = retired->index;
+
+		array->first_retired_index =
+			(array->first_retired_index + 1u) % array->capacity;
+		--array->n_retired_indices;
+	}
+
+	if (array->n_free_indices == 0u) {
+		RAW_LOG_ERROR("Bindless heap array is full!");
+		return false;
+	}
+
+	*index = array->free_indices[--array->n_free_indices];
+
+	return true;
+}
+
+static void rawWriteVulkanBindlessDescriptor(
+	VkDevice logical_device,
+	RawVulkanBindlessHeap* heap,
+	RawVulkanBindlessResourceType resource_type,
+	VkDescriptorType descriptor_type,
+	uint32_t index,
+	VkDescriptorImageInfo const* const image_info,
+	VkDescriptorBufferInfo const* const buffer_info) {
+
+	VkWriteDescriptorSet write = {
+		.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+		.pNext = RAW_NULL_PTR,
+		.dstSet = heap->descriptor_set,
+		.dstBinding = (uint32_t)resource_type,
+		.dstArrayElement = index,
+		.descriptorCount = 1u,
+		.descriptorType = descriptor_type,
+		.pImageInfo = image_info,
+		.pBufferInfo = buffer_info,
+		.pTexelBufferView = RAW_NULL_PTR
+	};
+
+	vkUpdateDescriptorSets(logical_device, 1u, &write, 0u, RAW_NULL_PTR);
+}
+
+bool rawRegisterVulkanBindlessImage(
+	VkDevice logical_device,
+	RawVulkanBindlessHeap* heap,
+	VkImageView image_view,
+	VkImageLayout image_layout,
+	uint32_t* index) {
+
+	if (!rawAcquireVulkanBindlessIndex(heap,
+		RAW_VULKAN_BINDLESS_SAMPLED_IMAGE, index))
+		return false;
+
+	VkDescriptorImageInfo image_info = {
+		.sampler = VK_NULL_HANDLE,
+		.imageView = image_view,
+		.imageLayout = image_layout
+	};
+
+	rawWriteVulkanBindlessDescriptor(logical_device, heap,
+		RAW_VULKAN_BINDLESS_SAMPLED_IMAGE, VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE,
+		*index, &image_info, RAW_NULL_PTR);
+
+	return true;
+}
+
+bool rawRegisterVulkanBindlessBuffer(
+	VkDevice logical_device,
+	RawVulkanBindlessHeap* heap,
+	VkBuffer buffer,
+	VkDeviceSize offset,
+	VkDeviceSize range,
+	uint32_t* index) {
+
+	if (!rawAcquireVulkanBindlessIndex(heap,
+		RAW_VULKAN_BINDLESS_STORAGE_BUFFER, index))
+		return false;
+
+	VkDescriptorBufferInfo buffer_info = {
+		.buffer = buffer,
+		.offset = offset,
+		.range = range
+	};
+
+	rawWriteVulkanBindlessDescriptor(logical_device, heap,
+		RAW_VULKAN_BINDLESS_STORAGE_BUFFER, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+		*index, RAW_NULL_PTR, &buffer_info);
+
+	return true;
+}
+
+bool rawRegisterVulkanBindlessSampler(
+	VkDevice logical_device,
+	RawVulkanBindlessHeap* heap,
+	VkSampler sampler,
+	uint32_t* index) {
+
+	if (!rawAcquireVulkanBindlessIndex(heap,
+		RAW_VULKAN_BINDLESS_SAMPLER, index))
+		return false;
+
+	VkDescriptorImageInfo image_info = {
+		.sampler = sampler,
+		.imageView = VK_NULL_HANDLE,
+		.imageLayout = VK_IMAGE_LAYOUT_UNDEFINED
+	};
+
+	rawWriteVulkanBindlessDescriptor(logical_device, heap,
+		RAW_VULKAN_BINDLESS_SAMPLER, VK_DESCRIPTOR_TYPE_SAMPLER,
+		*index, &image_info, RAW_NULL_PTR);
+
+	return true;
+}
+
+bool rawReleaseVulkanBindlessIndex(
+	RawVulkanBindlessHeap* heap,
+	RawVulkanBindlessResourceType resource_type,
+	uint32_t index) {
+
+	RawVulkanBindlessArray* array = &heap->arrays[resource_type];
+
+	if (index >= array->capacity ||
+		array->n_free_indices + array->n_retired_indices == array->capacity) {
+		RAW_LOG_ERROR("Invalid bindless index release!");
+		return false;
+	}
+
+	uint32_t last = (array->first_retired_index +
+		array->n_retired_indices) % array->capacity;
+
+	array->retired_indices[last] = (RawVulkanBindlessRetiredIndex){
+		.index = index,
+		.frame_number = heap->frame_number
+	};
+
+	++array->n_retired_indices;
+
+	return true;
+}
+
+bool rawCreateVulkanBindlessPipelineLayout(
+	VkDevice logical_device,
+	RawVulkanBindlessHeap const* const heap,
+	VkShaderStageFlags push_constant_stages,
+	uint32_t push_constant_size,
+	VkPipelineLayout* pipeline_layout) {
+
+	VkPushConstantRange push_constant_range = {
+		.stageFlags = push_constant_stages,
+		.offset = 0u,
+		.size = push_constant_size
+	};
+
+	VkPipelineLayoutCreateInfo create_info = {
+		.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = 0,
+		.setLayoutCount = 1u,
+		.pSetLayouts = &heap->set_layout,
+		.pushConstantRangeCount = push_constant_size > 0u ? 1u : 0u,
+		.pPushConstantRanges = &push_constant_range
+	};
+
+	// TODO: Pass allocation callback
+	VkResult result = vkCreatePipelineLayout(logical_device,
+		&create_info, RAW_NULL_PTR, pipeline_layout);
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("vkCreatePipelineLayout failed!");
+		return false;
+	}
+
+	return true;
+}
+
+void rawCmdBindVulkanBindlessHeap(
+	VkCommandBuffer command_buffer,
+	RawVulkanBindlessHeap const* const heap,
+	VkPipelineBindPoint bind_point,
+	VkPipelineLayout pipeline_layout) {
+
+	vkCmdBindDescriptorSets(command_buffer, bind_point, pipeline_layout,
+		0u, 1u, &heap->descriptor_set, 0u, RAW_NULL_PTR);
+}
@@ -0,0 +1,192 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanBindless.h"
+ *
+ * Bindless descriptor heap
+ *
+ * A single global descriptor set holds large arrays of sampled images,
+ * storage buffers and samplers. Resources are registered once into stable
+ * array indices and shaders pick them through push constants, so the set
+ * is bound once per frame instead of once per draw. Requires
+ * VK_EXT_descriptor_indexing (core in Vulkan 1.2) and its update after
+ * bind features.
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+
+#ifndef RAW_VULKAN_BINDLESS_H
+#define RAW_VULKAN_BINDLESS_H
+
+#include <engine/vulkan/rawVulkan.h>
+
+#include <inttypes.h>
+#include <stdbool.h>
+
+/*
+ * Also the binding of each array in the heap's set layout, e.g.
+ *     layout(set = 0, binding = 1) buffer Data { ... } data[];
+ */
+typedef enum {
+	RAW_VULKAN_BINDLESS_SAMPLED_IMAGE,
+	RAW_VULKAN_BINDLESS_STORAGE_BUFFER,
+	RAW_VULKAN_BINDLESS_SAMPLER,
+	RAW_VULKAN_BINDLESS_RESOURCE_TYPE_COUNT
+} RawVulkanBindlessResourceType;
+
+typedef struct {
+	uint32_t index;
+
+	// Frame in which the index was released
+	uint64_t frame_number;
+} RawVulkanBindlessRetiredIndex;
+
+typedef struct {
+	uint32_t capacity;
+
+	// Stack of indices ready to be handed out
+	uint32_t* free_indices;
+	uint32_t n_free_indices;
+
+	/*
+	 * Released indices, in release order. They're only reused once
+	 * the GPU is done with the frame which released them.
+	 */
+	RawVulkanBindlessRetiredIndex* retired_indices;
+	uint32_t first_retired_index;
+	uint32_t n_retired_indices;
+} RawVulkanBindlessArray;
+
+typedef struct {
+	VkDescriptorSetLayout set_layout;
+	VkDescriptorPool descriptor_pool;
+	VkDescriptorSet descriptor_set;
+
+	RawVulkanBindlessArray arrays[RAW_VULKAN_BINDLESS_RESOURCE_TYPE_COUNT];
+
+	// Frame being recorded and the oldest one the GPU may still be using
+	uint64_t frame_number;
+	uint64_t oldest_pending_frame_number;
+} RawVulkanBindlessHeap;
+
+/*
+ * Checks whether @physical_device supports the heap. If so, @features is
+ * filled with only the features the heap needs, ready to be chained to
+ * rawCreateVulkanLogicalDevice through @device_features_chain. Its pNext
+ * is NULL.
+ *
+ * VK_KHR_get_physical_device_properties2 must have been enabled on the
+ * instance, and VK_KHR_maintenance3 and VK_EXT_descriptor_indexing
+ * must then be enabled on the logical device.
+ */
+bool rawGetVulkanBindlessDeviceFeatures(
+	VkPhysicalDevice physical_device,
+	VkPhysicalDeviceDescriptorIndexingFeaturesEXT* features);
+
+/*
+ * Creates the global set with room for @max_sampled_images,
+ * @max_storage_buffers and @max_samplers descriptors. They must be
+ * within the maxDescriptorSetUpdateAfterBind* limits of the device.
+ */
+bool rawCreateVulkanBindlessHeap(
+	VkDevice logical_device,
+	uint32_t max_sampled_images,
+	uint32_t max_storage_buffers,
+	uint32_t max_samplers,
+	RawVulkanBindlessHeap* heap);
+
+void rawDestroyVulkanBindlessHeap(
+	VkDevice logical_device,
+	RawVulkanBindlessHeap* heap);
+
+/*
+ * Indices released before @oldest_pending_frame_number
+ * are no longer used by the GPU and may be handed out again.
+ *
+ * With a RawVulkanFrameManager of n frames, after rawBeginVulkanFrame
+ * this is its frame_number and frame_number - n + 1 (or 0).
+ */
+void rawBeginVulkanBindlessHeapFrame(
+	RawVulkanBindlessHeap* heap,
+	uint64_t frame_number,
+	uint64_t oldest_pending_frame_number);
+
+/*
+ * Writes the resource to a free slot of its array, whose index is
+ * stored in @index. Writing is allowed while the set is bound and other
+ * slots are used by frames in flight.
+ */
+bool rawRegisterVulkanBindlessImage(
+	VkDevice logical_device,
+	RawVulkanBindlessHeap* heap,
+	VkImageView image_view,
+	VkImageLayout image_layout,
+	uint32_t* index);
+
+bool rawRegisterVulkanBindlessBuffer(
+	VkDevice logical_device,
+	RawVulkanBindlessHeap* heap,
+	VkBuffer buffer,
+	VkDeviceSize offset,
+	VkDeviceSize range,
+	uint32_t* index);
+
+bool rawRegisterVulkanBindlessSampler(
+	VkDevice logical_device,
+	RawVulkanBindlessHeap* heap,
+	VkSampler sampler,
+	uint32_t* index);
+
+/*
+ * Gives @index back to the heap. Frames in flight may still read the
+ * slot, so it's only reused after the current frame completed.
+ */
+bool rawReleaseVulkanBindlessIndex(
+	RawVulkanBindlessHeap* heap,
+	RawVulkanBindlessResourceType resource_type,
+	uint32_t index);
+
+/*
+ * Pipeline layout with the heap as set 0 and a single push constant
+ * range of @push_constant_size bytes, where the indices of the
+ * resources used by a draw are passed.
+ */
+bool rawCreateVulkanBindlessPipelineLayout(
+	VkDevice logical_device,
+	RawVulkanBindlessHeap const* const heap,
+	VkShaderStageFlags push_constant_stages,
+	uint32_t push_constant_size,
+	VkPipelineLayout* pipeline_layout);
+
+// Binds the heap as set 0. Once per command buffer is enough.
+void rawCmdBindVulkanBindlessHeap(
+	VkCommandBuffer command_buffer,
+	RawVulkanBindlessHeap const* const heap,
+	VkPipelineBindPoint bind_point,
+	VkPipelineLayout pipeline_layout);
+
+#endif // RAW_VULKAN_BINDLESS_H
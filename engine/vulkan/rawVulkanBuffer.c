@@ -0,0 +1,463 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanBuffer.c"
+ *
+ * Vulkan buffer suballocation
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+#include <engine/vulkan/rawVulkanBuffer.h>
+#include <engine/vulkan/rawVulkanMemory.h>
+#include <engine/platform/rawMemory.h>
+#include <engine/utils/rawLogger.h>
+
+#include <string.h>
+
+static VkDeviceSize rawGreatestCommonDivisor(VkDeviceSize a, VkDeviceSize b) {
+	while (b != 0u) {
+		VkDeviceSize t = a % b;
+		a = b;
+		b = t;
+	}
+
+	return a;
+}
+
+static VkDeviceSize rawLeastCommonMultiple(VkDeviceSize a, VkDeviceSize b) {
+	if (a == 0u)
+		return b;
+
+	if (b == 0u)
+		return a;
+
+	return (a / rawGreatestCommonDivisor(a, b)) * b;
+}
+
+static bool rawGrowVulkanMegaBufferFreeRanges(
+	RawVulkanMegaBuffer* mega_buffer) {
+
+	uint32_t max_free_ranges = mega_buffer->max_free_ranges * 2u;
+	RawVulkanBufferRange* free_ranges = RAW_NULL_PTR;
+
+	RAW_MEM_ALLOC(free_ranges, (uint64_t)max_free_ranges,
+		sizeof(RawVulkanBufferRange));
+
+	if (!free_ranges) {
+		RAW_LOG_ERROR("RAW_MEM_ALLOC failed on "
+			"rawGrowVulkanMegaBufferFreeRanges!");
+		return false;
+	}
+
+	memcpy(free_ranges, mega_buffer->free_ranges,
+		mega_buffer->n_free_ranges * sizeof(RawVulkanBufferRange));
+
+	RAW_MEM_FREE(mega_buffer->free_ranges);
+
+	mega_buffer->free_ranges = free_ranges;
+	mega_buffer->max_free_ranges = max_free_ranges;
+
+	return true;
+}
+
+static bool rawInsertVulkanMegaBufferFreeRange(
+	RawVulkanMegaBuffer* mega_buffer,
+	uint32_t position,
+	VkDeviceSize offset,
+	VkDeviceSize size) {
+
+	if (mega_buffer->n_free_ranges == mega_buffer->max_free_ranges &&
+		!rawGrowVulkanMegaBufferFreeRanges(mega_buffer))
+		return false;
+
+	memmove(mega_buffer->free_ranges + position + 1u,
+		mega_buffer->free_ranges + position,
+		(mega_buffer->n_free_ranges - position) *
+			sizeof(RawVulkanBufferRange));
+
+	mega_buffer->free_ranges[position].offset = offset;
+	mega_buffer->free_ranges[position].size = size;
+	++mega_buffer->n_free_ranges;
+
+	return true;
+}
+
+static void rawRemoveVulkanMegaBufferFreeRange(
+	RawVulkanMegaBuffer* mega_buffer,
+	uint32_t position) {
+
+	memmove(mega_buffer->free_ranges + position,
+		mega_buffer->free_ranges + position + 1u,
+		(mega_buffer->n_free_ranges - position - 1u) *
+			sizeof(RawVulkanBufferRange));
+
+	--mega_buffer->n_free_ranges;
+}
+
+bool rawCreateVulkanMegaBuffer(
+	VkDevice logical_device,
+	VkPhysicalDeviceProperties const* const physical_device_properties,
+	VkPhysicalDeviceMemoryProperties const* const memory_properties,
+	RawVulkanBufferUsageClass usage_class,
+	VkDeviceSize capacity,
+	VkMemoryPropertyFlags memory_properties_flags,
+	RawVulkanMegaBuffer* mega_buffer) {
+
+	VkPhysicalDeviceLimits const* limits =
+		&physical_device_properties->limits;
+
+	VkBufferUsageFlags usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+	VkDeviceSize alignment = 4u;
+
+	switch (usage_class) {
+		case RAW_VULKAN_BUFFER_USAGE_CLASS_VERTEX:
+			usage |= VK_BUFFER_USAGE_VERTEX_BUFFER_BIT;
+			break;
+
+		case RAW_VULKAN_BUFFER_USAGE_CLASS_INDEX:
+			usage |= VK_BUFFER_USAGE_INDEX_BUFFER_BIT;
+			break;
+
+		case RAW_VULKAN_BUFFER_USAGE_CLASS_UNIFORM:
+			usage |= VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
+			alignment = rawLeastCommonMultiple(alignment,
+				limits->minUniformBufferOffsetAlignment);
+			break;
+
+		case RAW_VULKAN_BUFFER_USAGE_CLASS_STORAGE:
+			usage |= VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
+				VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+			alignment = rawLeastCommonMultiple(alignment,
+				limits->minStorageBufferOffsetAlignment);
+			break;
+
+		// Indirect commands are usually written by compute shaders
+		case RAW_VULKAN_BUFFER_USAGE_CLASS_INDIRECT:
+			usage |= VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT |
+				VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+			alignment = rawLeastCommonMultiple(alignment,
+				limits->minStorageBufferOffsetAlignment);
+			break;
+
+		default:
+			RAW_LOG_ERROR("Invalid mega-buffer usage class!");
+			return false;
+	}
+
+	mega_buffer->buffer = VK_NULL_HANDLE;
+	mega_buffer->memory = VK_NULL_HANDLE;
+	mega_buffer->capacity = capacity;
+	mega_buffer->alignment = alignment;
+	mega_buffer->non_coherent_atom_size = limits->nonCoherentAtomSize;
+	mega_buffer->usage_class = usage_class;
+	mega_buffer->mapped_data = RAW_NULL_PTR;
+	mega_buffer->host_coherent = false;
+	mega_buffer->free_ranges = RAW_NULL_PTR;
+	mega_buffer->n_free_ranges = 0u;
+	mega_buffer->max_free_ranges = 16u;
+
+	VkBufferCreateInfo buffer_create_info = {
+		.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = 0,
+		.size = capacity,
+		.usage = usage,
+		.sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+		.queueFamilyIndexCount = 0u,
+		.pQueueFamilyIndices = RAW_NULL_PTR
+	};
+
+	// TODO: Pass allocation callback
+	VkResult result = vkCreateBuffer(logical_device,
+		&buffer_create_info, RAW_NULL_PTR, &mega_buffer->buffer);
+
+	if ((result != VK_SUCCESS) || (mega_buffer->buffer == VK_NULL_HANDLE)) {
+		RAW_LOG_ERROR("Could not create mega-buffer!");
+		return false;
+	}
+
+	VkMemoryRequirements memory_requirements;
+
+	vkGetBufferMemoryRequirements(logical_device,
+		mega_buffer->buffer, &memory_requirements);
+
+	VkMemoryPropertyFlags chosen_properties;
+
+	if (!rawAllocateVulkanMemory(logical_device, memory_properties,
+		&memory_requirements, memory_properties_flags, 0,
+		&chosen_properties, &mega_buffer->memory)) {
+		RAW_LOG_ERROR("rawAllocateVulkanMemory failed "
+			"for mega-buffer!");
+		rawDestroyVulkanMegaBuffer(logical_device, mega_buffer);
+		return false;
+	}
+
+	result = vkBindBufferMemory(logical_device,
+		mega_buffer->buffer, mega_buffer->memory, 0u);
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("vkBindBufferMemory failed for mega-buffer!");
+		rawDestroyVulkanMegaBuffer(logical_device, mega_buffer);
+		return false;
+	}
+
+	if (chosen_properties & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) {
+		result = vkMapMemory(logical_device, mega_buffer->memory,
+			0u, VK_WHOLE_SIZE, 0, &mega_buffer->mapped_data);
+
+		if (result != VK_SUCCESS) {
+			RAW_LOG_ERROR("vkMapMemory failed for mega-buffer!");
+			rawDestroyVulkanMegaBuffer(logical_device, mega_buffer);
+			return false;
+		}
+
+		mega_buffer->host_coherent = (chosen_properties &
+			VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) != 0;
+	}
+
+	RAW_MEM_ALLOC(mega_buffer->free_ranges,
+		(uint64_t)mega_buffer->max_free_ranges,
+		sizeof(RawVulkanBufferRange));
+
+	if (!mega_buffer->free_ranges) {
+		RAW_LOG_ERROR("RAW_MEM_ALLOC failed on rawCreateVulkanMegaBuffer!");
+		rawDestroyVulkanMegaBuffer(logical_device, mega_buffer);
+		return false;
+	}
+
+	mega_buffer->free_ranges[0].offset = 0u;
+	mega_buffer->free_ranges[0].size = capacity;
+	mega_buffer->n_free_ranges = 1u;
+
+	return true;
+}
+
+void rawDestroyVulkanMegaBuffer(
+	VkDevice logical_device,
+	RawVulkanMegaBuffer* mega_buffer) {
+
+	if (mega_buffer->mapped_data) {
+		vkUnmapMemory(logical_device, mega_buffer->memory);
+		mega_buffer->mapped_data = RAW_NULL_PTR;
+	}
+
+	if (mega_buffer->buffer) {
+		// TODO: Pass allocation callback
+		vkDestroyBuffer(logical_device, mega_buffer->buffer, RAW_NULL_PTR);
+		mega_buffer->buffer = VK_NULL_HANDLE;
+	}
+	else
+		RAW_LOG_WARNING("Attempting to destroy "
+			"NULL Vulkan mega-buffer!");
+
+	if (mega_buffer->memory)
+		rawFreeVulkanMemory(logical_device, &mega_buffer->memory);
+
+	if (mega_buffer->free_ranges)
+		RAW_MEM_FREE(mega_buffer->free_ranges);
+
+	mega_buffer->n_free_ranges = 0u;
+	mega_buffer->max_free_ranges = 0u;
+}
+
+bool rawAllocateVulkanMegaBuffer(
+	RawVulkanMegaBuffer* mega_buffer,
+	VkDeviceSize size,
+	VkDeviceSize element_size,
+	RawVulkanBufferAllocation* allocation) {
+
+	VkDeviceSize alignment =
+		rawLeastCommonMultiple(mega_buffer->alignment, element_size);
+
+	// First fit
+	for (uint32_t i = 0; i < mega_buffer->n_free_ranges; ++i) {
+		RawVulkanBufferRange range = mega_buffer->free_ranges[i];
+
+		VkDeviceSize offset = rawAlignVulkanDeviceSize(
+			range.offset, alignment);
+		VkDeviceSize padding = offset - range.offset;
+
+		if (padding + size > range.size)
+			continue;
+
+		VkDeviceSize tail = range.size - padding - size;
+
+		if (padding > 0u && tail > 0u) {
+			mega_buffer->free_ranges[i].size = padding;
+
+			if (!rawInsertVulkanMegaBufferFreeRange(mega_buffer,
+				i + 1u, offset + size, tail)) {
+				mega_buffer->free_ranges[i] = range;
+				return false;
+			}
+		}
+		else if (padding > 0u)
+			mega_buffer->free_ranges[i].size = padding;
+		else if (tail > 0u) {
+			mega_buffer->free_ranges[i].offset = offset + size;
+			mega_buffer->free_ranges[i].size = tail;
+		}
+		else
+			rawRemoveVulkanMegaBufferFreeRange(mega_buffer, i);
+
+		allocation->buffer = mega_buffer->buffer;
+		allocation->offset = offset;
+		allocation->size = size;
+		allocation->mapped_data = mega_buffer->mapped_data ?
+			(uint8_t*)mega_buffer->mapped_data + offset : RAW_NULL_PTR;
+
+		return true;
+	}
+
+	RAW_LOG_WARNING("Mega-buffer is out of space for "
+		"%" PRIu64 " bytes!", (uint64_t)size);
+
+	return false;
+}
+
+void rawFreeVulkanMegaBuffer(
+	RawVulkanMegaBuffer* mega_buffer,
+	RawVulkanBufferAllocation* allocation) {
+
+	if (allocation->buffer != mega_buffer->buffer) {
+		RAW_LOG_WARNING("Attempting to free an allocation "
+			"that doesn't belong to the mega-buffer!");
+		return;
+	}
+
+	VkDeviceSize offset = allocation->offset;
+	VkDeviceSize size = allocation->size;
+
+	uint32_t position = 0u;
+
+	while (position < mega_buffer->n_free_ranges &&
+		mega_buffer->free_ranges[position].offset < offset)
+		++position;
+
+	bool merges_previous = position > 0u &&
+		mega_buffer->free_ranges[position - 1u].offset +
+		mega_buffer->free_ranges[position - 1u].size == offset;
+
+	bool merges_next = position < mega_buffer->n_free_ranges &&
+		offset + size == mega_buffer->free_ranges[position].offset;
+
+	if (merges_previous && merges_next) {
+		mega_buffer->free_ranges[position - 1u].size +=
+			size + mega_buffer->free_ranges[position].size;
+		rawRemoveVulkanMegaBufferFreeRange(mega_buffer, position);
+	}
+	else if (merges_previous)
+		mega_buffer->free_ranges[position - 1u].size += size;
+	else if (merges_next) {
+		mega_buffer->free_ranges[position].offset = offset;
+		mega_buffer->free_ranges[position].size += size;
+	}
+	else if (!rawInsertVulkanMegaBufferFreeRange(
+		mega_buffer, position, offset, size)) {
+		// The range is leaked until the mega-buffer is destroyed
+		RAW_LOG_ERROR("Could not return range to the mega-buffer!");
+	}
+
+	allocation->buffer = VK_NULL_HANDLE;
+	allocation->offset = 0u;
+	allocation->size = 0u;
+	allocation->mapped_data = RAW_NULL_PTR;
+}
+
+bool rawFlushVulkanMegaBufferAllocation(
+	VkDevice logical_device,
+	RawVulkanMegaBuffer const* const mega_buffer,
+	RawVulkanBufferAllocation const* const allocation) {
+
+	if (!mega_buffer->mapped_data || mega_buffer->host_coherent)
+		return true;
+
+	VkDeviceSize atom_size = mega_buffer->non_coherent_atom_size;
+
+	if (atom_size == 0u)
+		atom_size = 1u;
+
+	VkDeviceSize begin = (allocation->offset / atom_size) * atom_size;
+	VkDeviceSize end = rawAlignVulkanDeviceSize(
+		allocation->offset + allocation->size, atom_size);
+
+	if (end > mega_buffer->capacity)
+		end = mega_buffer->capacity;
+
+	VkMappedMemoryRange range = {
+		.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE,
+		.pNext = RAW_NULL_PTR,
+		.memory = mega_buffer->memory,
+		.offset = begin,
+		.size = end == mega_buffer->capacity ? VK_WHOLE_SIZE : end - begin
+	};
+
+	if (vkFlushMappedMemoryRanges(logical_device, 1u, &range) != VK_SUCCESS) {
+		RAW_LOG_ERROR("vkFlushMappedMemoryRanges failed!");
+		return false;
+	}
+
+	return true;
+}
+
+void rawCmdBindVulkanVertexMegaBuffer(
+	VkCommandBuffer command_buffer,
+	uint32_t binding,
+	RawVulkanMegaBuffer const* const mega_buffer) {
+
+	VkDeviceSize offset = 0u;
+
+	vkCmdBindVertexBuffers(command_buffer,
+		binding, 1u, &mega_buffer->buffer, &offset);
+}
+
+void rawCmdBindVulkanIndexMegaBuffer(
+	VkCommandBuffer command_buffer,
+	RawVulkanMegaBuffer const* const mega_buffer,
+	VkIndexType index_type) {
+
+	vkCmdBindIndexBuffer(command_buffer,
+		mega_buffer->buffer, 0u, index_type);
+}
+
+void rawCmdDrawVulkanMegaBufferIndexed(
+	VkCommandBuffer command_buffer,
+	RawVulkanBufferAllocation const* const index_allocation,
+	VkIndexType index_type,
+	RawVulkanBufferAllocation const* const vertex_allocation,
+	uint32_t vertex_stride,
+	uint32_t n_instances,
+	uint32_t first_instance) {
+
+	uint32_t index_size = rawGetVulkanIndexSize(index_type);
+
+	vkCmdDrawIndexed(command_buffer,
+		(uint32_t)(index_allocation->size / index_size), n_instances,
+		(uint32_t)(index_allocation->offset / index_size),
+		(int32_t)(vertex_allocation->offset / vertex_stride),
+		first_instance);
+}
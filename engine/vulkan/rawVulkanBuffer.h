@@ -0,0 +1,189 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanBuffer.h"
+ *
+ * Vulkan buffer suballocation
+ *
+ * A single large VkBuffer (mega-buffer) is created per usage class
+ * and handed out in sub-ranges, so many meshes can be drawn
+ * with a single vertex/index buffer bind.
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+#ifndef RAW_VULKAN_BUFFER_H
+#define RAW_VULKAN_BUFFER_H
+
+#include <engine/vulkan/rawVulkan.h>
+
+#include <inttypes.h>
+#include <stdbool.h>
+
+typedef enum {
+	RAW_VULKAN_BUFFER_USAGE_CLASS_VERTEX,
+	RAW_VULKAN_BUFFER_USAGE_CLASS_INDEX,
+	RAW_VULKAN_BUFFER_USAGE_CLASS_UNIFORM,
+	RAW_VULKAN_BUFFER_USAGE_CLASS_STORAGE,
+	RAW_VULKAN_BUFFER_USAGE_CLASS_INDIRECT,
+	RAW_VULKAN_BUFFER_USAGE_CLASS_COUNT
+} RawVulkanBufferUsageClass;
+
+/*
+ * Free range inside a mega-buffer
+ */
+typedef struct {
+	VkDeviceSize offset;
+	VkDeviceSize size;
+} RawVulkanBufferRange;
+
+typedef struct {
+	VkBuffer buffer;
+	VkDeviceMemory memory;
+	VkDeviceSize capacity;
+	VkDeviceSize alignment;
+	VkDeviceSize non_coherent_atom_size;
+	RawVulkanBufferUsageClass usage_class;
+
+	// Persistently mapped pointer, RAW_NULL_PTR
+	// if the memory is not host visible
+	void* mapped_data;
+	bool host_coherent;
+
+	// Sorted by offset, adjacent ranges are always merged
+	RawVulkanBufferRange* free_ranges;
+	uint32_t n_free_ranges;
+	uint32_t max_free_ranges;
+} RawVulkanMegaBuffer;
+
+/*
+ * Sub-range of a mega-buffer.
+ * @buffer is shared by every allocation of the same mega-buffer,
+ * so @offset must be used for binding, descriptor writes and draws.
+ */
+typedef struct {
+	VkBuffer buffer;
+	VkDeviceSize offset;
+	VkDeviceSize size;
+
+	// Points to @offset inside the mapped mega-buffer,
+	// RAW_NULL_PTR if the memory is not host visible
+	void* mapped_data;
+} RawVulkanBufferAllocation;
+
+/*
+ * Creates a single VkBuffer of @capacity bytes for @usage_class,
+ * backed by one memory allocation with @memory_properties.
+ * Host visible memory is persistently mapped.
+ *
+ * The base allocation alignment is taken from
+ * @physical_device_properties limits
+ */
+bool rawCreateVulkanMegaBuffer(
+	VkDevice logical_device,
+	VkPhysicalDeviceProperties const* const physical_device_properties,
+	VkPhysicalDeviceMemoryProperties const* const memory_properties,
+	RawVulkanBufferUsageClass usage_class,
+	VkDeviceSize capacity,
+	VkMemoryPropertyFlags memory_properties_flags,
+	RawVulkanMegaBuffer* mega_buffer);
+
+void rawDestroyVulkanMegaBuffer(
+	VkDevice logical_device,
+	RawVulkanMegaBuffer* mega_buffer);
+
+/*
+ * Sub-allocates @size bytes from @mega_buffer.
+ * The offset will be a multiple of @element_size
+ * (e.g. the vertex stride or the index size) and of the
+ * mega-buffer base alignment, so it can be turned into
+ * firstIndex/vertexOffset.
+ * @element_size may be 0 if no element alignment is needed.
+ *
+ * Returns false when there is no free range large enough.
+ */
+bool rawAllocateVulkanMegaBuffer(
+	RawVulkanMegaBuffer* mega_buffer,
+	VkDeviceSize size,
+	VkDeviceSize element_size,
+	RawVulkanBufferAllocation* allocation);
+
+/*
+ * Returns the range of @allocation to @mega_buffer.
+ * It's the caller's responsibility to guarantee
+ * the GPU is not using the range anymore.
+ */
+void rawFreeVulkanMegaBuffer(
+	RawVulkanMegaBuffer* mega_buffer,
+	RawVulkanBufferAllocation* allocation);
+
+/*
+ * Makes host writes to @allocation visible to the device.
+ * Does nothing for host coherent memory.
+ */
+bool rawFlushVulkanMegaBufferAllocation(
+	VkDevice logical_device,
+	RawVulkanMegaBuffer const* const mega_buffer,
+	RawVulkanBufferAllocation const* const allocation);
+
+/*
+ * Binds the whole vertex mega-buffer at offset 0.
+ * Sub-allocations are then selected through vertexOffset.
+ */
+void rawCmdBindVulkanVertexMegaBuffer(
+	VkCommandBuffer command_buffer,
+	uint32_t binding,
+	RawVulkanMegaBuffer const* const mega_buffer);
+
+/*
+ * Binds the whole index mega-buffer at offset 0.
+ * Sub-allocations are then selected through firstIndex.
+ */
+void rawCmdBindVulkanIndexMegaBuffer(
+	VkCommandBuffer command_buffer,
+	RawVulkanMegaBuffer const* const mega_buffer,
+	VkIndexType index_type);
+
+/*
+ * Records an indexed draw of the mesh stored in @index_allocation
+ * and @vertex_allocation. The vertex and index mega-buffers must have
+ * been bound through rawCmdBindVulkanVertexMegaBuffer and
+ * rawCmdBindVulkanIndexMegaBuffer.
+ */
+void rawCmdDrawVulkanMegaBufferIndexed(
+	VkCommandBuffer command_buffer,
+	RawVulkanBufferAllocation const* const index_allocation,
+	VkIndexType index_type,
+	RawVulkanBufferAllocation const* const vertex_allocation,
+	uint32_t vertex_stride,
+	uint32_t n_instances,
+	uint32_t first_instance);
+
+static inline uint32_t rawGetVulkanIndexSize(VkIndexType index_type) {
+	return index_type == VK_INDEX_TYPE_UINT16 ? 2u : 4u;
+}
+
+#endif // RAW_VULKAN_BUFFER_H
@@ -0,0 +1,251 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanCommandAllocator.c"
+ *
+ * Vulkan command buffer allocation
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+#include <engine/vulkan/rawVulkanCommandAllocator.h>
+#include <engine/platform/rawMemory.h>
+#include <engine/utils/rawLogger.h>
+
+#include <string.h>
+
+#define RAW_VULKAN_COMMAND_BUFFER_BATCH_SIZE 4u
+
+static bool rawGrowVulkanCommandBufferList(
+	VkDevice logical_device,
+	VkCommandPool command_pool,
+	VkCommandBufferLevel level,
+	RawVulkanCommandBufferList* list) {
+
+	uint32_t n_new = list->n_command_buffers > 0u ?
+		list->n_command_buffers : RAW_VULKAN_COMMAND_BUFFER_BATCH_SIZE;
+	uint32_t n_command_buffers = list->n_command_buffers + n_new;
+
+	VkCommandBuffer* command_buffers = RAW_NULL_PTR;
+
+	RAW_MEM_ALLOC(command_buffers, (uint64_t)n_command_buffers,
+		sizeof(VkCommandBuffer));
+
+	if (!command_buffers) {
+		RAW_LOG_ERROR("RAW_MEM_ALLOC failed on "
+			"rawGrowVulkanCommandBufferList!");
+		return false;
+	}
+
+	VkCommandBufferAllocateInfo allocate_info = {
+		.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.commandPool = command_pool,
+		.level = level,
+		.commandBufferCount = n_new
+	};
+
+	VkResult result = vkAllocateCommandBuffers(logical_device,
+		&allocate_info, command_buffers + list->n_command_buffers);
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("vkAllocateCommandBuffers failed!");
+		RAW_MEM_FREE(command_buffers);
+		return false;
+	}
+
+	if (list->command_buffers) {
+		memcpy(command_buffers, list->command_buffers,
+			list->n_command_buffers * sizeof(VkCommandBuffer));
+		RAW_MEM_FREE(list->command_buffers);
+	}
+
+	list->command_buffers = command_buffers;
+	list->n_command_buffers = n_command_buffers;
+
+	return true;
+}
+
+bool rawCreateVulkanCommandAllocator(
+	VkDevice logical_device,
+	uint32_t queue_family_index,
+	uint32_t n_threads,
+	uint32_t n_frames,
+	RawVulkanCommandAllocator* command_allocator) {
+
+	command_allocator->queue_family_index = queue_family_index;
+	command_allocator->n_threads = n_threads;
+	command_allocator->n_frames = n_frames;
+	command_allocator->pools = RAW_NULL_PTR;
+
+	uint32_t n_pools = n_threads * n_frames;
+
+	RAW_MEM_ALLOC(command_allocator->pools, (uint64_t)n_pools,
+		sizeof(RawVulkanThreadCommandPool));
+
+	if (!command_allocator->pools) {
+		RAW_LOG_ERROR("RAW_MEM_ALLOC failed on "
+			"rawCreateVulkanCommandAllocator!");
+		return false;
+	}
+
+	memset(command_allocator->pools, 0,
+		n_pools * sizeof(RawVulkanThreadCommandPool));
+
+	VkCommandPoolCreateInfo command_pool_create_info = {
+		.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT,
+		.queueFamilyIndex = queue_family_index
+	};
+
+	for (uint32_t i = 0; i < n_pools; ++i) {
+		// TODO: Pass allocation callback
+		VkResult result = vkCreateCommandPool(logical_device,
+			&command_pool_create_info, RAW_NULL_PTR,
+			&command_allocator->pools[i].command_pool);
+
+		if (result != VK_SUCCESS) {
+			RAW_LOG_ERROR("vkCreateCommandPool failed!");
+			rawDestroyVulkanCommandAllocator(
+				logical_device, command_allocator);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void rawDestroyVulkanCommandAllocator(
+	VkDevice logical_device,
+	RawVulkanCommandAllocator* command_allocator) {
+
+	if (!command_allocator->pools) {
+		RAW_LOG_WARNING("Attempting to destroy "
+			"NULL Vulkan command allocator!");
+		return;
+	}
+
+	uint32_t n_pools =
+		command_allocator->n_threads * command_allocator->n_frames;
+
+	for (uint32_t i = 0; i < n_pools; ++i) {
+		RawVulkanThreadCommandPool* pool = &command_allocator->pools[i];
+
+		// Destroying the pool frees its command buffers
+		if (pool->command_pool != VK_NULL_HANDLE) {
+			// TODO: Pass allocation callback
+			vkDestroyCommandPool(logical_device,
+				pool->command_pool, RAW_NULL_PTR);
+		}
+
+		if (pool->primary.command_buffers)
+			RAW_MEM_FREE(pool->primary.command_buffers);
+
+		if (pool->secondary.command_buffers)
+			RAW_MEM_FREE(pool->secondary.command_buffers);
+	}
+
+	RAW_MEM_FREE(command_allocator->pools);
+}
+
+bool rawAllocateVulkanCommandBuffer(
+	VkDevice logical_device,
+	RawVulkanCommandAllocator* command_allocator,
+	uint32_t frame_index,
+	uint32_t thread_index,
+	VkCommandBufferLevel level,
+	VkCommandBuffer* command_buffer) {
+
+	if (frame_index >= command_allocator->n_frames ||
+		thread_index >= command_allocator->n_threads) {
+		RAW_LOG_ERROR("Invalid frame/thread index for "
+			"rawAllocateVulkanCommandBuffer!");
+		return false;
+	}
+
+	RawVulkanThreadCommandPool* pool = &command_allocator->pools[
+		frame_index * command_allocator->n_threads + thread_index];
+
+	RawVulkanCommandBufferList* list =
+		level == VK_COMMAND_BUFFER_LEVEL_PRIMARY ?
+			&pool->primary : &pool->secondary;
+
+	if (list->n_used == list->n_command_buffers &&
+		!rawGrowVulkanCommandBufferList(logical_device,
+			pool->command_pool, level, list))
+		return false;
+
+	*command_buffer = list->command_buffers[list->n_used++];
+
+	return true;
+}
+
+bool rawResetVulkanCommandAllocatorFrame(
+	VkDevice logical_device,
+	RawVulkanCommandAllocator* command_allocator,
+	uint32_t frame_index,
+	VkFence frame_fence) {
+
+	if (frame_index >= command_allocator->n_frames) {
+		RAW_LOG_ERROR("Invalid frame index for "
+			"rawResetVulkanCommandAllocatorFrame!");
+		return false;
+	}
+
+	if (frame_fence != VK_NULL_HANDLE) {
+		VkResult result = vkWaitForFences(logical_device,
+			1u, &frame_fence, VK_TRUE, UINT64_MAX);
+
+		if (result != VK_SUCCESS) {
+			RAW_LOG_ERROR("vkWaitForFences failed!");
+			return false;
+		}
+	}
+
+	RawVulkanThreadCommandPool* pools = command_allocator->pools +
+		frame_index * command_allocator->n_threads;
+
+	for (uint32_t i = 0; i < command_allocator->n_threads; ++i) {
+		// Pools that weren't used this frame have nothing to reset
+		if (pools[i].primary.n_used == 0u &&
+			pools[i].secondary.n_used == 0u)
+			continue;
+
+		VkResult result = vkResetCommandPool(
+			logical_device, pools[i].command_pool, 0);
+
+		if (result != VK_SUCCESS) {
+			RAW_LOG_ERROR("vkResetCommandPool failed!");
+			return false;
+		}
+
+		pools[i].primary.n_used = 0u;
+		pools[i].secondary.n_used = 0u;
+	}
+
+	return true;
+}
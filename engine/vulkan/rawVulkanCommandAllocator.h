@@ -0,0 +1,121 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanCommandAllocator.h"
+ *
+ * Vulkan command buffer allocation
+ *
+ * One command pool is kept per worker thread per frame in flight,
+ * so recording threads never share a pool. Pools are reset as a
+ * whole once the frame is done and their command buffers reused.
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+#ifndef RAW_VULKAN_COMMAND_ALLOCATOR_H
+#define RAW_VULKAN_COMMAND_ALLOCATOR_H
+
+#include <engine/vulkan/rawVulkan.h>
+
+#include <inttypes.h>
+#include <stdbool.h>
+
+/*
+ * Command buffers already allocated from a pool.
+ * The first @n_used are handed out in the current frame,
+ * the remaining ones are free to be reused.
+ */
+typedef struct {
+	VkCommandBuffer* command_buffers;
+	uint32_t n_command_buffers;
+	uint32_t n_used;
+} RawVulkanCommandBufferList;
+
+typedef struct {
+	VkCommandPool command_pool;
+	RawVulkanCommandBufferList primary;
+	RawVulkanCommandBufferList secondary;
+} RawVulkanThreadCommandPool;
+
+typedef struct {
+	uint32_t queue_family_index;
+	uint32_t n_threads;
+	uint32_t n_frames;
+
+	// Indexed by [frame_index * n_threads + thread_index]
+	RawVulkanThreadCommandPool* pools;
+} RawVulkanCommandAllocator;
+
+/*
+ * Creates @n_threads * @n_frames command pools
+ * for @queue_family_index
+ */
+bool rawCreateVulkanCommandAllocator(
+	VkDevice logical_device,
+	uint32_t queue_family_index,
+	uint32_t n_threads,
+	uint32_t n_frames,
+	RawVulkanCommandAllocator* command_allocator);
+
+void rawDestroyVulkanCommandAllocator(
+	VkDevice logical_device,
+	RawVulkanCommandAllocator* command_allocator);
+
+/*
+ * Hands out a command buffer from the pool owned by
+ * @thread_index for @frame_index. Previously allocated
+ * command buffers are reused, new ones are only allocated
+ * when the pool runs out of them.
+ *
+ * Different threads may call this function concurrently
+ * as long as each one uses its own @thread_index.
+ *
+ * The command buffer is valid until the next call to
+ * rawResetVulkanCommandAllocatorFrame for @frame_index
+ */
+bool rawAllocateVulkanCommandBuffer(
+	VkDevice logical_device,
+	RawVulkanCommandAllocator* command_allocator,
+	uint32_t frame_index,
+	uint32_t thread_index,
+	VkCommandBufferLevel level,
+	VkCommandBuffer* command_buffer);
+
+/*
+ * Resets every pool of @frame_index through vkResetCommandPool,
+ * making all of its command buffers available again.
+ *
+ * If @frame_fence is not VK_NULL_HANDLE, the function waits for it
+ * before resetting. Otherwise it's the caller's responsibility to
+ * guarantee the GPU is done with the frame's command buffers.
+ */
+bool rawResetVulkanCommandAllocatorFrame(
+	VkDevice logical_device,
+	RawVulkanCommandAllocator* command_allocator,
+	uint32_t frame_index,
+	VkFence frame_fence);
+
+#endif // RAW_VULKAN_COMMAND_ALLOCATOR_H
@@ -0,0 +1,395 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanDeferred.c"
+ *
+ * Deferred shading in a single render pass
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+
+#include <engine/vulkan/rawVulkanDeferred.h>
+#include <engine/vulkan/rawVulkanMemory.h>
+#include <engine/utils/rawLogger.h>
+
+#include <string.h>
+
+bool rawGetVulkanDeferredDepthFormat(
+	VkPhysicalDevice physical_device,
+	VkFormat* depth_format) {
+
+	// D16_UNORM depth attachments are required by the spec
+	VkFormat const candidates[] = {
+		VK_FORMAT_D32_SFLOAT,
+		VK_FORMAT_X8_D24_UNORM_PACK32,
+		VK_FORMAT_D16_UNORM
+	};
+
+	uint32_t const n_candidates = sizeof(candidates) / sizeof(VkFormat);
+
+	for (uint32_t i = 0; i < n_candidates; ++i) {
+		VkFormatProperties format_properties;
+		vkGetPhysicalDeviceFormatProperties(physical_device,
+			candidates[i], &format_properties);
+
+		if (format_properties.optimalTilingFeatures &
+			VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT) {
+			*depth_format = candidates[i];
+			return true;
+		}
+	}
+
+	RAW_LOG_ERROR("No depth format supports depth attachments!");
+	return false;
+}
+
+static bool rawCreateVulkanTransientAttachment(
+	VkDevice logical_device,
+	VkPhysicalDeviceMemoryProperties const* const memory_properties,
+	VkFormat format,
+	VkExtent2D extent,
+	bool is_depth,
+	RawVulkanTransientAttachment* attachment,
+	bool* lazily_allocated) {
+
+	attachment->format = format;
+
+	/*
+	 * Transient images may only be used as attachments. They never
+	 * leave tile memory, so lazily allocated memory needs no backing.
+	 */
+	VkImageCreateInfo image_create_info = {
+		.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = 0,
+		.imageType = VK_IMAGE_TYPE_2D,
+		.format = format,
+		.extent = { extent.width, extent.height, 1u },
+		.mipLevels = 1u,
+		.arrayLayers = 1u,
+		.samples = VK_SAMPLE_COUNT_1_BIT,
+		.tiling = VK_IMAGE_TILING_OPTIMAL,
+		.usage = (is_depth ?
+			VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT :
+			VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT) |
+			VK_IMAGE_USAGE_INPUT_ATTACHMENT_BIT |
+			VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT,
+		.sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+		.queueFamilyIndexCount = 0u,
+		.pQueueFamilyIndices = RAW_NULL_PTR,
+		.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED
+	};
+
+	// TODO: Pass allocation callback
+	VkResult result = vkCreateImage(logical_device,
+		&image_create_info, RAW_NULL_PTR, &attachment->image);
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("vkCreateImage failed!");
+		return false;
+	}
+
+	VkMemoryRequirements memory_requirements;
+	vkGetImageMemoryRequirements(logical_device,
+		attachment->image, &memory_requirements);
+
+	VkMemoryPropertyFlags chosen_properties;
+
+	if (!rawAllocateVulkanMemory(logical_device, memory_properties,
+		&memory_requirements, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+		VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT, &chosen_properties,
+		&attachment->memory)) {
+		RAW_LOG_ERROR("rawAllocateVulkanMemory failed!");
+		return false;
+	}
+
+	if (!(chosen_properties & VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT))
+		*lazily_allocated = false;
+
+	result = vkBindImageMemory(logical_device,
+		attachment->image, attachment->memory, 0);
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("vkBindImageMemory failed!");
+		return false;
+	}
+
+	VkImageViewCreateInfo image_view_create_info = {
+		.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = 0,
+		.image = attachment->image,
+		.viewType = VK_IMAGE_VIEW_TYPE_2D,
+		.format = format,
+		.components = {
+			VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY,
+			VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY
+		},
+		.subresourceRange = {
+			is_depth ? VK_IMAGE_ASPECT_DEPTH_BIT : VK_IMAGE_ASPECT_COLOR_BIT,
+			0u, 1u, 0u, 1u
+		}
+	};
+
+	// TODO: Pass allocation callback
+	result = vkCreateImageView(logical_device,
+		&image_view_create_info, RAW_NULL_PTR, &attachment->image_view);
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("vkCreateImageView failed!");
+		return false;
+	}
+
+	return true;
+}
+
+bool rawCreateVulkanDeferredTargets(
+	VkDevice logical_device,
+	VkPhysicalDeviceMemoryProperties const* const memory_properties,
+	VkFormat depth_format,
+	VkExtent2D extent,
+	RawVulkanDeferredTargets* deferred_targets) {
+
+	memset(deferred_targets, 0, sizeof(RawVulkanDeferredTargets));
+
+	deferred_targets->extent = extent;
+	deferred_targets->lazily_allocated = true;
+
+	VkFormat const formats[RAW_VULKAN_DEFERRED_ATTACHMENT_COUNT] = {
+		[RAW_VULKAN_DEFERRED_ALBEDO] = RAW_VULKAN_DEFERRED_ALBEDO_FORMAT,
+		[RAW_VULKAN_DEFERRED_NORMAL] = RAW_VULKAN_DEFERRED_NORMAL_FORMAT,
+		[RAW_VULKAN_DEFERRED_DEPTH] = depth_format
+	};
+
+	for (uint32_t i = RAW_VULKAN_DEFERRED_ALBEDO;
+		i < RAW_VULKAN_DEFERRED_ATTACHMENT_COUNT; ++i) {
+		if (!rawCreateVulkanTransientAttachment(logical_device,
+			memory_properties, formats[i], extent,
+			i == RAW_VULKAN_DEFERRED_DEPTH,
+			&deferred_targets->attachments[i],
+			&deferred_targets->lazily_allocated)) {
+			RAW_LOG_ERROR("Deferred G-buffer creation failed!");
+			rawDestroyVulkanDeferredTargets(logical_device,
+				RAW_NULL_PTR, RAW_NULL_PTR, deferred_targets);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void rawDestroyVulkanDeferredTargets(
+	VkDevice logical_device,
+	RawVulkanFramebufferCache* framebuffer_cache,
+	RawVulkanDescriptorSetCache* descriptor_set_cache,
+	RawVulkanDeferredTargets* deferred_targets) {
+
+	for (uint32_t i = RAW_VULKAN_DEFERRED_ALBEDO;
+		i < RAW_VULKAN_DEFERRED_ATTACHMENT_COUNT; ++i) {
+		RawVulkanTransientAttachment* attachment =
+			&deferred_targets->attachments[i];
+
+		if (attachment->image_view && framebuffer_cache &&
+			!rawEvictVulkanFramebuffersUsingImageView(
+				framebuffer_cache, attachment->image_view))
+			RAW_LOG_ERROR("rawEvictVulkanFramebuffersUsingImageView failed!");
+
+		if (attachment->image_view && descriptor_set_cache)
+			rawEvictVulkanDescriptorSetsUsingImageView(logical_device,
+				descriptor_set_cache, attachment->image_view);
+
+		// TODO: Pass allocation callback
+		if (attachment->image_view)
+			vkDestroyImageView(logical_device,
+				attachment->image_view, RAW_NULL_PTR);
+
+		// TODO: Pass allocation callback
+		if (attachment->image)
+			vkDestroyImage(logical_device, attachment->image, RAW_NULL_PTR);
+
+		if (attachment->memory)
+			rawFreeVulkanMemory(logical_device, &attachment->memory);
+	}
+
+	memset(deferred_targets, 0, sizeof(RawVulkanDeferredTargets));
+}
+
+bool rawGetVulkanDeferredRenderPass(
+	VkDevice logical_device,
+	RawVulkanRenderPassCache* render_pass_cache,
+	VkFormat output_format,
+	VkImageLayout output_final_layout,
+	VkFormat depth_format,
+	VkRenderPass* render_pass) {
+
+	RawVulkanRenderPassKey key;
+	rawInitVulkanRenderPassKey(&key);
+
+	key.n_attachments = RAW_VULKAN_DEFERRED_ATTACHMENT_COUNT;
+
+	key.attachments[RAW_VULKAN_DEFERRED_OUTPUT] = (VkAttachmentDescription){
+		.flags = 0,
+		.format = output_format,
+		.samples = VK_SAMPLE_COUNT_1_BIT,
+		.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR,
+		.storeOp = VK_ATTACHMENT_STORE_OP_STORE,
+		.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE,
+		.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE,
+		.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+		.finalLayout = output_final_layout
+	};
+
+	VkFormat const formats[RAW_VULKAN_DEFERRED_ATTACHMENT_COUNT] = {
+		[RAW_VULKAN_DEFERRED_ALBEDO] = RAW_VULKAN_DEFERRED_ALBEDO_FORMAT,
+		[RAW_VULKAN_DEFERRED_NORMAL] = RAW_VULKAN_DEFERRED_NORMAL_FORMAT,
+		[RAW_VULKAN_DEFERRED_DEPTH] = depth_format
+	};
+
+	// The G-buffer lives and dies in tile memory: cleared, never stored
+	for (uint32_t i = RAW_VULKAN_DEFERRED_ALBEDO;
+		i < RAW_VULKAN_DEFERRED_ATTACHMENT_COUNT; ++i) {
+		key.attachments[i] = (VkAttachmentDescription){
+			.flags = 0,
+			.format = formats[i],
+			.samples = VK_SAMPLE_COUNT_1_BIT,
+			.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR,
+			.storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE,
+			.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE,
+			.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE,
+			.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+			.finalLayout = i == RAW_VULKAN_DEFERRED_DEPTH ?
+				VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL :
+				VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
+		};
+	}
+
+	key.n_subpasses = 2u;
+
+	RawVulkanSubpassLayout* gbuffer =
+		&key.subpasses[RAW_VULKAN_DEFERRED_GBUFFER_SUBPASS];
+
+	gbuffer->color_attachments[0] = RAW_VULKAN_DEFERRED_ALBEDO;
+	gbuffer->color_attachments[1] = RAW_VULKAN_DEFERRED_NORMAL;
+	gbuffer->n_color_attachments = 2u;
+	gbuffer->depth_stencil_attachment = RAW_VULKAN_DEFERRED_DEPTH;
+
+	RawVulkanSubpassLayout* lighting =
+		&key.subpasses[RAW_VULKAN_DEFERRED_LIGHTING_SUBPASS];
+
+	lighting->color_attachments[0] = RAW_VULKAN_DEFERRED_OUTPUT;
+	lighting->n_color_attachments = 1u;
+	lighting->input_attachments[0] = RAW_VULKAN_DEFERRED_ALBEDO;
+	lighting->input_attachments[1] = RAW_VULKAN_DEFERRED_NORMAL;
+	lighting->input_attachments[2] = RAW_VULKAN_DEFERRED_DEPTH;
+	lighting->n_input_attachments = 3u;
+
+	if (!rawGetVulkanRenderPass(logical_device, render_pass_cache,
+		&key, render_pass)) {
+		RAW_LOG_ERROR("rawGetVulkanRenderPass failed!");
+		return false;
+	}
+
+	return true;
+}
+
+bool rawGetVulkanDeferredFramebuffer(
+	VkDevice logical_device,
+	RawVulkanFramebufferCache* framebuffer_cache,
+	RawVulkanSwapchain const* const swapchain,
+	VkRenderPass render_pass,
+	RawVulkanDeferredTargets const* const deferred_targets,
+	VkImageView output_image_view,
+	VkFramebuffer* framebuffer) {
+
+	VkImageView image_views[RAW_VULKAN_DEFERRED_ATTACHMENT_COUNT];
+
+	for (uint32_t i = 0; i < RAW_VULKAN_DEFERRED_ATTACHMENT_COUNT; ++i)
+		image_views[i] = deferred_targets->attachments[i].image_view;
+
+	image_views[RAW_VULKAN_DEFERRED_OUTPUT] = output_image_view;
+
+	if (!rawGetVulkanFramebuffer(logical_device, framebuffer_cache,
+		swapchain, render_pass, image_views,
+		RAW_VULKAN_DEFERRED_ATTACHMENT_COUNT, deferred_targets->extent,
+		framebuffer)) {
+		RAW_LOG_ERROR("rawGetVulkanFramebuffer failed!");
+		return false;
+	}
+
+	return true;
+}
+
+void rawCmdBeginVulkanDeferredPass(
+	VkCommandBuffer command_buffer,
+	VkRenderPass render_pass,
+	VkFramebuffer framebuffer,
+	RawVulkanDeferredTargets const* const deferred_targets,
+	VkClearColorValue output_clear_color) {
+
+	VkClearValue clear_values[RAW_VULKAN_DEFERRED_ATTACHMENT_COUNT];
+	memset(clear_values, 0, sizeof(clear_values));
+
+	clear_values[RAW_VULKAN_DEFERRED_OUTPUT].color = output_clear_color;
+	clear_values[RAW_VULKAN_DEFERRED_DEPTH].depthStencil.depth = 1.0f;
+
+	VkRenderPassBeginInfo render_pass_begin_info = {
+		.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO,
+		.pNext = RAW_NULL_PTR,
+		.renderPass = render_pass,
+		.framebuffer = framebuffer,
+		.renderArea = { { 0, 0 }, deferred_targets->extent },
+		.clearValueCount = RAW_VULKAN_DEFERRED_ATTACHMENT_COUNT,
+		.pClearValues = clear_values
+	};
+
+	vkCmdBeginRenderPass(command_buffer, &render_pass_begin_info,
+		VK_SUBPASS_CONTENTS_INLINE);
+}
+
+bool rawAddVulkanDeferredInputAttachments(
+	RawVulkanDescriptorSetKey* key,
+	uint32_t first_binding,
+	RawVulkanDeferredTargets const* const deferred_targets) {
+
+	// Layouts of the lighting subpass input attachment references
+	for (uint32_t i = RAW_VULKAN_DEFERRED_ALBEDO;
+		i < RAW_VULKAN_DEFERRED_ATTACHMENT_COUNT; ++i) {
+		if (!rawAddVulkanDescriptorImage(key,
+			first_binding + i - RAW_VULKAN_DEFERRED_ALBEDO,
+			VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT,
+			deferred_targets->attachments[i].image_view,
+			i == RAW_VULKAN_DEFERRED_DEPTH ?
+				VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL :
+				VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL,
+			VK_NULL_HANDLE)) {
+			RAW_LOG_ERROR("rawAddVulkanDescriptorImage failed!");
+			return false;
+		}
+	}
+
+	return true;
+}
@@ -0,0 +1,170 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanDeferred.h"
+ *
+ * Deferred shading in a single render pass
+ *
+ * The G-buffer and lighting passes are subpasses of one render pass, the
+ * lighting subpass reading the G-buffer as input attachments. Tiled GPUs
+ * then keep the G-buffer in tile memory for the whole pass: it's cleared
+ * on load, never stored, and its images are transient, backed by lazily
+ * allocated memory when the device has it.
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+
+#ifndef RAW_VULKAN_DEFERRED_H
+#define RAW_VULKAN_DEFERRED_H
+
+#include <engine/vulkan/rawVulkan.h>
+#include <engine/vulkan/rawVulkanDescriptorCache.h>
+#include <engine/vulkan/rawVulkanPresentation.h>
+#include <engine/vulkan/rawVulkanRenderPassCache.h>
+
+#include <stdbool.h>
+
+#define RAW_VULKAN_DEFERRED_ALBEDO_FORMAT VK_FORMAT_R8G8B8A8_UNORM
+#define RAW_VULKAN_DEFERRED_NORMAL_FORMAT VK_FORMAT_A2B10G10R10_UNORM_PACK32
+
+#define RAW_VULKAN_DEFERRED_GBUFFER_SUBPASS 0u
+#define RAW_VULKAN_DEFERRED_LIGHTING_SUBPASS 1u
+
+/*
+ * Attachments of the deferred render pass, in framebuffer order.
+ * The lighting subpass reads albedo, normal and depth, in this order,
+ * as input attachments 0, 1 and 2.
+ */
+typedef enum {
+	RAW_VULKAN_DEFERRED_OUTPUT,
+	RAW_VULKAN_DEFERRED_ALBEDO,
+	RAW_VULKAN_DEFERRED_NORMAL,
+	RAW_VULKAN_DEFERRED_DEPTH,
+	RAW_VULKAN_DEFERRED_ATTACHMENT_COUNT
+} RawVulkanDeferredAttachment;
+
+typedef struct {
+	VkImage image;
+	VkImageView image_view;
+	VkDeviceMemory memory;
+	VkFormat format;
+} RawVulkanTransientAttachment;
+
+typedef struct {
+	// Indexed by RawVulkanDeferredAttachment, the output is not owned
+	RawVulkanTransientAttachment
+		attachments[RAW_VULKAN_DEFERRED_ATTACHMENT_COUNT];
+
+	VkExtent2D extent;
+
+	// Every G-buffer image is backed by lazily allocated memory
+	bool lazily_allocated;
+} RawVulkanDeferredTargets;
+
+/*
+ * First depth only format supporting depth attachments, so a single
+ * view serves as both depth attachment and input attachment.
+ */
+bool rawGetVulkanDeferredDepthFormat(
+	VkPhysicalDevice physical_device,
+	VkFormat* depth_format);
+
+/*
+ * Creates the G-buffer images. Their memory is lazily allocated when
+ * the device has such a memory type, device local otherwise.
+ * Targets must be recreated along with the output images, e.g. when the
+ * swapchain is.
+ */
+bool rawCreateVulkanDeferredTargets(
+	VkDevice logical_device,
+	VkPhysicalDeviceMemoryProperties const* const memory_properties,
+	VkFormat depth_format,
+	VkExtent2D extent,
+	RawVulkanDeferredTargets* deferred_targets);
+
+/*
+ * The GPU must be done with the targets. Framebuffers and descriptor
+ * sets over them would outlive their views, so they're evicted from
+ * @framebuffer_cache and @descriptor_set_cache first. Either cache may
+ * be NULL if the targets were never used with it.
+ */
+void rawDestroyVulkanDeferredTargets(
+	VkDevice logical_device,
+	RawVulkanFramebufferCache* framebuffer_cache,
+	RawVulkanDescriptorSetCache* descriptor_set_cache,
+	RawVulkanDeferredTargets* deferred_targets);
+
+/*
+ * The deferred render pass, from @render_pass_cache. The output is
+ * cleared and stored, ending in @output_final_layout.
+ */
+bool rawGetVulkanDeferredRenderPass(
+	VkDevice logical_device,
+	RawVulkanRenderPassCache* render_pass_cache,
+	VkFormat output_format,
+	VkImageLayout output_final_layout,
+	VkFormat depth_format,
+	VkRenderPass* render_pass);
+
+/*
+ * The framebuffer over @output_image_view and the G-buffer, from
+ * @framebuffer_cache. @swapchain is forwarded to rawGetVulkanFramebuffer
+ * and may be NULL when the output isn't a swapchain image. Such outputs
+ * aren't tracked: rawEvictVulkanFramebuffersUsingImageView must be
+ * called before destroying their views.
+ */
+bool rawGetVulkanDeferredFramebuffer(
+	VkDevice logical_device,
+	RawVulkanFramebufferCache* framebuffer_cache,
+	RawVulkanSwapchain const* const swapchain,
+	VkRenderPass render_pass,
+	RawVulkanDeferredTargets const* const deferred_targets,
+	VkImageView output_image_view,
+	VkFramebuffer* framebuffer);
+
+/*
+ * Begins the deferred render pass in its G-buffer subpass, clearing the
+ * output to @output_clear_color, the G-buffer to zero and depth to 1.
+ * vkCmdNextSubpass moves on to the lighting subpass.
+ */
+void rawCmdBeginVulkanDeferredPass(
+	VkCommandBuffer command_buffer,
+	VkRenderPass render_pass,
+	VkFramebuffer framebuffer,
+	RawVulkanDeferredTargets const* const deferred_targets,
+	VkClearColorValue output_clear_color);
+
+/*
+ * Adds the G-buffer input attachments of the lighting subpass to @key,
+ * at bindings @first_binding to @first_binding + 2.
+ */
+bool rawAddVulkanDeferredInputAttachments(
+	RawVulkanDescriptorSetKey* key,
+	uint32_t first_binding,
+	RawVulkanDeferredTargets const* const deferred_targets);
+
+#endif // RAW_VULKAN_DEFERRED_H
@@ -0,0 +1,282 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanDescriptorAllocator.c"
+ *
+ * Transient descriptor set allocation
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+#include <engine/vulkan/rawVulkanDescriptorAllocator.h>
+#include <engine/platform/rawMemory.h>
+#include <engine/utils/rawLogger.h>
+
+#include <string.h>
+
+static bool rawOpenVulkanDescriptorPool(
+	VkDevice logical_device,
+	RawVulkanDescriptorAllocator* descriptor_allocator,
+	RawVulkanDescriptorPoolList* list) {
+
+	uint32_t n_descriptor_pools = list->n_descriptor_pools + 1u;
+	VkDescriptorPool* descriptor_pools = RAW_NULL_PTR;
+
+	RAW_MEM_ALLOC(descriptor_pools, (uint64_t)n_descriptor_pools,
+		sizeof(VkDescriptorPool));
+
+	if (!descriptor_pools) {
+		RAW_LOG_ERROR("RAW_MEM_ALLOC failed on "
+			"rawOpenVulkanDescriptorPool!");
+		return false;
+	}
+
+	// No FREE_DESCRIPTOR_SET_BIT, so drivers can allocate linearly
+	VkDescriptorPoolCreateInfo create_info = {
+		.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = 0,
+		.maxSets = descriptor_allocator->max_sets_per_pool,
+		.poolSizeCount = descriptor_allocator->n_pool_sizes,
+		.pPoolSizes = descriptor_allocator->pool_sizes
+	};
+
+	// TODO: Pass allocation callback
+	VkResult result = vkCreateDescriptorPool(logical_device, &create_info,
+		RAW_NULL_PTR, &descriptor_pools[list->n_descriptor_pools]);
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("vkCreateDescriptorPool failed!");
+		RAW_MEM_FREE(descriptor_pools);
+		return false;
+	}
+
+	if (list->descriptor_pools) {
+		memcpy(descriptor_pools, list->descriptor_pools,
+			list->n_descriptor_pools * sizeof(VkDescriptorPool));
+		RAW_MEM_FREE(list->descriptor_pools);
+	}
+
+	list->descriptor_pools = descriptor_pools;
+	list->n_descriptor_pools = n_descriptor_pools;
+
+	return true;
+}
+
+// Moves on to the next pool of the frame, opening one if needed
+static bool rawAdvanceVulkanDescriptorPool(
+	VkDevice logical_device,
+	RawVulkanDescriptorAllocator* descriptor_allocator,
+	RawVulkanDescriptorPoolList* list) {
+
+	if (list->n_used == list->n_descriptor_pools &&
+		!rawOpenVulkanDescriptorPool(
+			logical_device, descriptor_allocator, list))
+		return false;
+
+	++list->n_used;
+	list->n_allocated_sets = 0u;
+
+	return true;
+}
+
+bool rawCreateVulkanDescriptorAllocator(
+	VkDevice logical_device,
+	uint32_t n_frames,
+	uint32_t max_sets_per_pool,
+	VkDescriptorPoolSize const* pool_sizes,
+	uint32_t n_pool_sizes,
+	RawVulkanDescriptorAllocator* descriptor_allocator) {
+
+	memset(descriptor_allocator, 0, sizeof(RawVulkanDescriptorAllocator));
+
+	if (n_pool_sizes > RAW_VULKAN_MAX_DESCRIPTOR_POOL_SIZES) {
+		RAW_LOG_ERROR("Too many descriptor pool sizes!");
+		return false;
+	}
+
+	descriptor_allocator->n_frames = n_frames;
+	descriptor_allocator->max_sets_per_pool = max_sets_per_pool;
+	descriptor_allocator->n_pool_sizes = n_pool_sizes;
+
+	memcpy(descriptor_allocator->pool_sizes, pool_sizes,
+		n_pool_sizes * sizeof(VkDescriptorPoolSize));
+
+	RAW_MEM_ALLOC(descriptor_allocator->frames, (uint64_t)n_frames,
+		sizeof(RawVulkanDescriptorPoolList));
+
+	if (!descriptor_allocator->frames) {
+		RAW_LOG_ERROR("RAW_MEM_ALLOC failed on "
+			"rawCreateVulkanDescriptorAllocator!");
+		return false;
+	}
+
+	memset(descriptor_allocator->frames, 0,
+		n_frames * sizeof(RawVulkanDescriptorPoolList));
+
+	for (uint32_t i = 0; i < n_frames; ++i) {
+		if (!rawOpenVulkanDescriptorPool(logical_device,
+			descriptor_allocator, &descriptor_allocator->frames[i])) {
+			rawDestroyVulkanDescriptorAllocator(
+				logical_device, descriptor_allocator);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void rawDestroyVulkanDescriptorAllocator(
+	VkDevice logical_device,
+	RawVulkanDescriptorAllocator* descriptor_allocator) {
+
+	if (!descriptor_allocator->frames) {
+		RAW_LOG_WARNING("Attempting to destroy "
+			"NULL Vulkan descriptor allocator!");
+		return;
+	}
+
+	for (uint32_t i = 0; i < descriptor_allocator->n_frames; ++i) {
+		RawVulkanDescriptorPoolList* list = &descriptor_allocator->frames[i];
+
+		for (uint32_t j = 0; j < list->n_descriptor_pools; ++j)
+			// TODO: Pass allocation callback
+			vkDestroyDescriptorPool(logical_device,
+				list->descriptor_pools[j], RAW_NULL_PTR);
+
+		if (list->descriptor_pools)
+			RAW_MEM_FREE(list->descriptor_pools);
+	}
+
+	RAW_MEM_FREE(descriptor_allocator->frames);
+
+	memset(descriptor_allocator, 0, sizeof(RawVulkanDescriptorAllocator));
+}
+
+bool rawAllocateVulkanDescriptorSet(
+	VkDevice logical_device,
+	RawVulkanDescriptorAllocator* descriptor_allocator,
+	uint32_t frame_index,
+	VkDescriptorSetLayout set_layout,
+	VkDescriptorSet* descriptor_set) {
+
+	if (frame_index >= descriptor_allocator->n_frames) {
+		RAW_LOG_ERROR("Invalid frame index for "
+			"rawAllocateVulkanDescriptorSet!");
+		return false;
+	}
+
+	RawVulkanDescriptorPoolList* list =
+		&descriptor_allocator->frames[frame_index];
+
+	// maxSets is tracked here, only descriptor counts can run out
+	if ((list->n_used == 0u || list->n_allocated_sets ==
+		descriptor_allocator->max_sets_per_pool) &&
+		!rawAdvanceVulkanDescriptorPool(
+			logical_device, descriptor_allocator, list))
+		return false;
+
+	VkDescriptorSetAllocateInfo allocate_info = {
+		.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.descriptorPool = list->descriptor_pools[list->n_used - 1u],
+		.descriptorSetCount = 1u,
+		.pSetLayouts = &set_layout
+	};
+
+	VkResult result = vkAllocateDescriptorSets(
+		logical_device, &allocate_info, descriptor_set);
+
+	if (result == VK_ERROR_OUT_OF_POOL_MEMORY ||
+		result == VK_ERROR_FRAGMENTED_POOL) {
+
+		if (!rawAdvanceVulkanDescriptorPool(
+			logical_device, descriptor_allocator, list))
+			return false;
+
+		allocate_info.descriptorPool =
+			list->descriptor_pools[list->n_used - 1u];
+
+		result = vkAllocateDescriptorSets(
+			logical_device, &allocate_info, descriptor_set);
+
+		if (result != VK_SUCCESS) {
+			RAW_LOG_ERROR("vkAllocateDescriptorSets failed on an empty "
+				"pool, the set doesn't fit the pool sizes!");
+			return false;
+		}
+	}
+	else if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("vkAllocateDescriptorSets failed!");
+		return false;
+	}
+
+	++list->n_allocated_sets;
+
+	return true;
+}
+
+bool rawResetVulkanDescriptorAllocatorFrame(
+	VkDevice logical_device,
+	RawVulkanDescriptorAllocator* descriptor_allocator,
+	uint32_t frame_index,
+	VkFence frame_fence) {
+
+	if (frame_index >= descriptor_allocator->n_frames) {
+		RAW_LOG_ERROR("Invalid frame index for "
+			"rawResetVulkanDescriptorAllocatorFrame!");
+		return false;
+	}
+
+	if (frame_fence != VK_NULL_HANDLE) {
+		VkResult result = vkWaitForFences(logical_device,
+			1u, &frame_fence, VK_TRUE, UINT64_MAX);
+
+		if (result != VK_SUCCESS) {
+			RAW_LOG_ERROR("vkWaitForFences failed!");
+			return false;
+		}
+	}
+
+	RawVulkanDescriptorPoolList* list =
+		&descriptor_allocator->frames[frame_index];
+
+	// Pools past n_used weren't touched this frame
+	for (uint32_t i = 0; i < list->n_used; ++i) {
+		VkResult result = vkResetDescriptorPool(
+			logical_device, list->descriptor_pools[i], 0);
+
+		if (result != VK_SUCCESS) {
+			RAW_LOG_ERROR("vkResetDescriptorPool failed!");
+			return false;
+		}
+	}
+
+	list->n_used = 0u;
+	list->n_allocated_sets = 0u;
+
+	return true;
+}
@@ -0,0 +1,118 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanDescriptorAllocator.h"
+ *
+ * Transient descriptor set allocation
+ *
+ * Each frame in flight owns a growing list of descriptor pools. Sets are
+ * allocated linearly from the current pool, and a new pool is opened when
+ * it runs out. Sets are never freed one by one: every pool of a frame is
+ * reset as a whole once the GPU is done with it, and kept for reuse.
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+#ifndef RAW_VULKAN_DESCRIPTOR_ALLOCATOR_H
+#define RAW_VULKAN_DESCRIPTOR_ALLOCATOR_H
+
+#include <engine/vulkan/rawVulkan.h>
+
+#include <inttypes.h>
+#include <stdbool.h>
+
+#define RAW_VULKAN_MAX_DESCRIPTOR_POOL_SIZES 11u
+
+/*
+ * Pools of a frame. The first @n_used have been allocated from
+ * in the current frame, the remaining ones are reset and free.
+ */
+typedef struct {
+	VkDescriptorPool* descriptor_pools;
+	uint32_t n_descriptor_pools;
+	uint32_t n_used;
+
+	// From the current pool, the last used one
+	uint32_t n_allocated_sets;
+} RawVulkanDescriptorPoolList;
+
+typedef struct {
+	uint32_t n_frames;
+
+	// Capacity of every pool
+	uint32_t max_sets_per_pool;
+	VkDescriptorPoolSize pool_sizes[RAW_VULKAN_MAX_DESCRIPTOR_POOL_SIZES];
+	uint32_t n_pool_sizes;
+
+	RawVulkanDescriptorPoolList* frames;
+} RawVulkanDescriptorAllocator;
+
+/*
+ * Every pool holds @max_sets_per_pool sets and @pool_sizes descriptors.
+ * One pool per frame is created upfront, more are opened on demand.
+ */
+bool rawCreateVulkanDescriptorAllocator(
+	VkDevice logical_device,
+	uint32_t n_frames,
+	uint32_t max_sets_per_pool,
+	VkDescriptorPoolSize const* pool_sizes,
+	uint32_t n_pool_sizes,
+	RawVulkanDescriptorAllocator* descriptor_allocator);
+
+void rawDestroyVulkanDescriptorAllocator(
+	VkDevice logical_device,
+	RawVulkanDescriptorAllocator* descriptor_allocator);
+
+/*
+ * Allocates a set of @set_layout for @frame_index. When the current
+ * pool is exhausted or fragmented the allocation moves on to the next
+ * pool, opening a new one if needed.
+ *
+ * Not thread safe, recording threads should have their own allocators.
+ * The set is valid until the next call to
+ * rawResetVulkanDescriptorAllocatorFrame for @frame_index.
+ */
+bool rawAllocateVulkanDescriptorSet(
+	VkDevice logical_device,
+	RawVulkanDescriptorAllocator* descriptor_allocator,
+	uint32_t frame_index,
+	VkDescriptorSetLayout set_layout,
+	VkDescriptorSet* descriptor_set);
+
+/*
+ * Resets every pool used by @frame_index through vkResetDescriptorPool.
+ *
+ * If @frame_fence is not VK_NULL_HANDLE, the function waits for it
+ * before resetting. Otherwise it's the caller's responsibility to
+ * guarantee the GPU is done with the frame's descriptor sets.
+ */
+bool rawResetVulkanDescriptorAllocatorFrame(
+	VkDevice logical_device,
+	RawVulkanDescriptorAllocator* descriptor_allocator,
+	uint32_t frame_index,
+	VkFence frame_fence);
+
+#endif // RAW_VULKAN_DESCRIPTOR_ALLOCATOR_H
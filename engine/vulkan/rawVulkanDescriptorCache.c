@@ -0,0 +1,632 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanDescriptorCache.c"
+ *
+ * Content addressed descriptor set cache
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+
+#include <engine/vulkan/rawVulkanDescriptorCache.h>
+#include <engine/platform/rawMemory.h>
+#include <engine/utils/rawHash.h>
+#include <engine/utils/rawLogger.h>
+
+#include <string.h>
+
+#define RAW_VULKAN_DESCRIPTOR_CACHE_NONE UINT32_MAX
+
+void rawInitVulkanDescriptorSetKey(
+	VkDescriptorSetLayout set_layout,
+	RawVulkanDescriptorSetKey* key) {
+
+	// Padding is zeroed as well, keys are hashed and compared bytewise
+	memset(key, 0, sizeof(RawVulkanDescriptorSetKey));
+	key->set_layout = set_layout;
+}
+
+// Slot of @binding in the sorted bindings of @key, added if new
+static RawVulkanDescriptorBinding* rawGetVulkanDescriptorKeyBinding(
+	RawVulkanDescriptorSetKey* key,
+	uint32_t binding) {
+
+	uint32_t i = 0;
+
+	while (i < key->n_bindings && key->bindings[i].binding < binding)
+		++i;
+
+	if (i < key->n_bindings && key->bindings[i].binding == binding)
+		return &key->bindings[i];
+
+	if (key->n_bindings == RAW_VULKAN_MAX_DESCRIPTOR_SET_KEY_BINDINGS) {
+		RAW_LOG_ERROR("Too many descriptor set key bindings!");
+		return RAW_NULL_PTR;
+	}
+
+	memmove(&key->bindings[i + 1u], &key->bindings[i],
+		(key->n_bindings - i) * sizeof(RawVulkanDescriptorBinding));
+	memset(&key->bindings[i], 0, sizeof(RawVulkanDescriptorBinding));
+
+	++key->n_bindings;
+
+	key->bindings[i].binding = binding;
+
+	return &key->bindings[i];
+}
+
+bool rawAddVulkanDescriptorBuffer(
+	RawVulkanDescriptorSetKey* key,
+	uint32_t binding,
+	VkDescriptorType descriptor_type,
+	VkBuffer buffer,
+	VkDeviceSize offset,
+	VkDeviceSize range) {
+
+	if (descriptor_type != VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER &&
+		descriptor_type != VK_DESCRIPTOR_TYPE_STORAGE_BUFFER &&
+		descriptor_type != VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC &&
+		descriptor_type != VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC) {
+		RAW_LOG_ERROR("Unsupported buffer descriptor type!");
+		return false;
+	}
+
+	RawVulkanDescriptorBinding* descriptor =
+		rawGetVulkanDescriptorKeyBinding(key, binding);
+
+	if (!descriptor)
+		return false;
+
+	descriptor->descriptor_type = descriptor_type;
+	descriptor->buffer = buffer;
+	descriptor->offset = offset;
+	descriptor->range = range;
+	descriptor->image_view = VK_NULL_HANDLE;
+	descriptor->image_layout = VK_IMAGE_LAYOUT_UNDEFINED;
+	descriptor->sampler = VK_NULL_HANDLE;
+
+	return true;
+}
+
+bool rawAddVulkanDescriptorImage(
+	RawVulkanDescriptorSetKey* key,
+	uint32_t binding,
+	VkDescriptorType descriptor_type,
+	VkImageView image_view,
+	VkImageLayout image_layout,
+	VkSampler sampler) {
+
+	bool uses_image = descriptor_type != VK_DESCRIPTOR_TYPE_SAMPLER;
+	bool uses_sampler = descriptor_type == VK_DESCRIPTOR_TYPE_SAMPLER ||
+		descriptor_type == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+
+	if (uses_image &&
+		descriptor_type != VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER &&
+		descriptor_type != VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE &&
+		descriptor_type != VK_DESCRIPTOR_TYPE_STORAGE_IMAGE &&
+		descriptor_type != VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT) {
+		RAW_LOG_ERROR("Unsupported image descriptor type!");
+		return false;
+	}
+
+	RawVulkanDescriptorBinding* descriptor =
+		rawGetVulkanDescriptorKeyBinding(key, binding);
+
+	if (!descriptor)
+		return false;
+
+	// Ignored handles are cleared, so they don't split the key
+	descriptor->descriptor_type = descriptor_type;
+	descriptor->buffer = VK_NULL_HANDLE;
+	descriptor->offset = 0u;
+	descriptor->range = 0u;
+	descriptor->image_view = uses_image ? image_view : VK_NULL_HANDLE;
+	descriptor->image_layout =
+		uses_image ? image_layout : VK_IMAGE_LAYOUT_UNDEFINED;
+	descriptor->sampler = uses_sampler ? sampler : VK_NULL_HANDLE;
+
+	return true;
+}
+
+uint64_t rawHashVulkanDescriptorSetKey(
+	RawVulkanDescriptorSetKey const* const key) {
+
+	uint64_t hash = rawHashBytes(RAW_HASH_FNV1A_OFFSET_BASIS,
+		&key->set_layout, sizeof(VkDescriptorSetLayout));
+
+	hash = rawHashBytes(hash, key->bindings,
+		key->n_bindings * sizeof(RawVulkanDescriptorBinding));
+
+	return rawHashU64(hash, key->n_bindings);
+}
+
+static bool rawCompareVulkanDescriptorSetKeys(
+	RawVulkanDescriptorSetKey const* const a,
+	RawVulkanDescriptorSetKey const* const b) {
+
+	return a->set_layout == b->set_layout &&
+		a->n_bindings == b->n_bindings &&
+		memcmp(a->bindings, b->bindings,
+			a->n_bindings * sizeof(RawVulkanDescriptorBinding)) == 0;
+}
+
+bool rawCreateVulkanDescriptorSetCache(
+	VkDevice logical_device,
+	uint32_t max_sets,
+	VkDescriptorPoolSize const* pool_sizes,
+	uint32_t n_pool_sizes,
+	RawVulkanDescriptorSetCache* cache) {
+
+	memset(cache, 0, sizeof(RawVulkanDescriptorSetCache));
+
+	cache->lru_head = RAW_VULKAN_DESCRIPTOR_CACHE_NONE;
+	cache->lru_tail = RAW_VULKAN_DESCRIPTOR_CACHE_NONE;
+	cache->free_head = RAW_VULKAN_DESCRIPTOR_CACHE_NONE;
+	cache->retired_head = RAW_VULKAN_DESCRIPTOR_CACHE_NONE;
+
+	if (max_sets == 0u) {
+		RAW_LOG_ERROR("Descriptor set cache must hold at least one set!");
+		return false;
+	}
+
+	uint32_t capacity = 1u;
+
+	while (capacity * 3u < max_sets * 4u)
+		capacity <<= 1u;
+
+	RAW_MEM_ALLOC(cache->entries, (uint64_t)max_sets,
+		sizeof(RawVulkanDescriptorSetCacheEntry));
+
+	if (!cache->entries) {
+		RAW_LOG_ERROR("RAW_MEM_ALLOC failed on "
+			"rawCreateVulkanDescriptorSetCache!");
+		return false;
+	}
+
+	memset(cache->entries, 0,
+		max_sets * sizeof(RawVulkanDescriptorSetCacheEntry));
+
+	cache->max_sets = max_sets;
+
+	for (uint32_t i = 0; i < max_sets; ++i) {
+		cache->entries[i].previous = RAW_VULKAN_DESCRIPTOR_CACHE_NONE;
+		cache->entries[i].next = i + 1u < max_sets ?
+			i + 1u : RAW_VULKAN_DESCRIPTOR_CACHE_NONE;
+	}
+
+	cache->free_head = 0u;
+
+	RAW_MEM_ALLOC(cache->slots, (uint64_t)capacity, sizeof(uint32_t));
+
+	if (!cache->slots) {
+		RAW_LOG_ERROR("RAW_MEM_ALLOC failed on "
+			"rawCreateVulkanDescriptorSetCache!");
+		rawDestroyVulkanDescriptorSetCache(logical_device, cache);
+		return false;
+	}
+
+	memset(cache->slots, 0xff, capacity * sizeof(uint32_t));
+	cache->capacity = capacity;
+
+	// Evicted sets are freed one by one, unlike transient ones
+	VkDescriptorPoolCreateInfo create_info = {
+		.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT,
+		.maxSets = max_sets,
+		.poolSizeCount = n_pool_sizes,
+		.pPoolSizes = pool_sizes
+	};
+
+	// TODO: Pass allocation callback
+	VkResult result = vkCreateDescriptorPool(logical_device,
+		&create_info, RAW_NULL_PTR, &cache->descriptor_pool);
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("vkCreateDescriptorPool failed!");
+		cache->descriptor_pool = VK_NULL_HANDLE;
+		rawDestroyVulkanDescriptorSetCache(logical_device, cache);
+		return false;
+	}
+
+	return true;
+}
+
+void rawDestroyVulkanDescriptorSetCache(
+	VkDevice logical_device,
+	RawVulkanDescriptorSetCache* cache) {
+
+	if (!cache->entries) {
+		RAW_LOG_WARNING("Attempting to destroy "
+			"NULL Vulkan descriptor set cache!");
+		return;
+	}
+
+	// Destroying the pool frees every set allocated from it
+	if (cache->descriptor_pool != VK_NULL_HANDLE)
+		// TODO: Pass allocation callback
+		vkDestroyDescriptorPool(logical_device,
+			cache->descriptor_pool, RAW_NULL_PTR);
+
+	if (cache->slots)
+		RAW_MEM_FREE(cache->slots);
+
+	RAW_MEM_FREE(cache->entries);
+
+	memset(cache, 0, sizeof(RawVulkanDescriptorSetCache));
+}
+
+// Frees the set of an entry already out of the table and lists
+static void rawFreeVulkanDescriptorSetCacheEntry(
+	VkDevice logical_device,
+	RawVulkanDescriptorSetCache* cache,
+	uint32_t index) {
+
+	RawVulkanDescriptorSetCacheEntry* entry = &cache->entries[index];
+
+	vkFreeDescriptorSets(logical_device,
+		cache->descriptor_pool, 1u, &entry->descriptor_set);
+
+	entry->descriptor_set = VK_NULL_HANDLE;
+	entry->next = cache->free_head;
+	cache->free_head = index;
+
+	--cache->n_sets;
+}
+
+void rawBeginVulkanDescriptorSetCacheFrame(
+	VkDevice logical_device,
+	RawVulkanDescriptorSetCache* cache,
+	uint64_t frame_number,
+	uint64_t oldest_pending_frame_number) {
+
+	cache->frame_number = frame_number;
+	cache->oldest_pending_frame_number = oldest_pending_frame_number;
+
+	uint32_t* link = &cache->retired_head;
+
+	while (*link != RAW_VULKAN_DESCRIPTOR_CACHE_NONE) {
+		uint32_t index = *link;
+		RawVulkanDescriptorSetCacheEntry* entry = &cache->entries[index];
+
+		if (entry->frame_number < oldest_pending_frame_number) {
+			*link = entry->next;
+			rawFreeVulkanDescriptorSetCacheEntry(
+				logical_device, cache, index);
+		}
+		else {
+			link = &entry->next;
+		}
+	}
+}
+
+static void rawUnlinkVulkanDescriptorSetCacheEntry(
+	RawVulkanDescriptorSetCache* cache,
+	uint32_t index) {
+
+	RawVulkanDescriptorSetCacheEntry* entry = &cache->entries[index];
+
+	if (entry->previous != RAW_VULKAN_DESCRIPTOR_CACHE_NONE)
+		cache->entries[entry->previous].next = entry->next;
+	else
+		cache->lru_head = entry->next;
+
+	if (entry->next != RAW_VULKAN_DESCRIPTOR_CACHE_NONE)
+		cache->entries[entry->next].previous = entry->previous;
+	else
+		cache->lru_tail = entry->previous;
+
+	entry->previous = RAW_VULKAN_DESCRIPTOR_CACHE_NONE;
+	entry->next = RAW_VULKAN_DESCRIPTOR_CACHE_NONE;
+}
+
+// Makes @index the most recently used entry
+static void rawLinkVulkanDescriptorSetCacheEntry(
+	RawVulkanDescriptorSetCache* cache,
+	uint32_t index) {
+
+	RawVulkanDescriptorSetCacheEntry* entry = &cache->entries[index];
+
+	entry->previous = cache->lru_tail;
+	entry->next = RAW_VULKAN_DESCRIPTOR_CACHE_NONE;
+
+	if (cache->lru_tail != RAW_VULKAN_DESCRIPTOR_CACHE_NONE)
+		cache->entries[cache->lru_tail].next = index;
+	else
+		cache->lru_head = index;
+
+	cache->lru_tail = index;
+}
+
+/*
+ * Takes @index out of the table, so lookups no longer find it.
+ * Linear probing with backward shift deletion, so no tombstones are left.
+ */
+static void rawRemoveVulkanDescriptorSetCacheSlot(
+	RawVulkanDescriptorSetCache* cache,
+	uint32_t index) {
+
+	uint32_t mask = cache->capacity - 1u;
+	uint32_t slot = (uint32_t)cache->entries[index].key_hash & mask;
+
+	while (cache->slots[slot] != index)
+		slot = (slot + 1u) & mask;
+
+	uint32_t next_slot = slot;
+
+	for (;;) {
+		next_slot = (next_slot + 1u) & mask;
+
+		uint32_t moved = cache->slots[next_slot];
+
+		if (moved == RAW_VULKAN_DESCRIPTOR_CACHE_NONE)
+			break;
+
+		uint32_t home = (uint32_t)cache->entries[moved].key_hash & mask;
+
+		// Moves back entries whose probe sequence crosses the hole
+		if (((next_slot - home) & mask) >= ((next_slot - slot) & mask)) {
+			cache->slots[slot] = moved;
+			slot = next_slot;
+		}
+	}
+
+	cache->slots[slot] = RAW_VULKAN_DESCRIPTOR_CACHE_NONE;
+}
+
+// Evicts the least recently used entry, if the GPU is done with it
+static bool rawEvictVulkanDescriptorSet(
+	VkDevice logical_device,
+	RawVulkanDescriptorSetCache* cache) {
+
+	uint32_t index = cache->lru_head;
+
+	if (index == RAW_VULKAN_DESCRIPTOR_CACHE_NONE ||
+		cache->entries[index].frame_number >=
+		cache->oldest_pending_frame_number)
+		return false;
+
+	rawRemoveVulkanDescriptorSetCacheSlot(cache, index);
+	rawUnlinkVulkanDescriptorSetCacheEntry(cache, index);
+	rawFreeVulkanDescriptorSetCacheEntry(logical_device, cache, index);
+
+	return true;
+}
+
+static bool rawVulkanDescriptorSetKeyUses(
+	RawVulkanDescriptorSetKey const* const key,
+	VkBuffer buffer,
+	VkImageView image_view,
+	VkSampler sampler) {
+
+	for (uint32_t i = 0; i < key->n_bindings; ++i) {
+		RawVulkanDescriptorBinding const* binding = &key->bindings[i];
+
+		if ((buffer != VK_NULL_HANDLE && binding->buffer == buffer) ||
+			(image_view != VK_NULL_HANDLE &&
+			binding->image_view == image_view) ||
+			(sampler != VK_NULL_HANDLE && binding->sampler == sampler))
+			return true;
+	}
+
+	return false;
+}
+
+/*
+ * Drops every set using one of the non null handles. Sets the GPU is
+ * done with are freed now, the others once their last frame completes.
+ */
+static void rawEvictVulkanDescriptorSetsUsing(
+	VkDevice logical_device,
+	RawVulkanDescriptorSetCache* cache,
+	VkBuffer buffer,
+	VkImageView image_view,
+	VkSampler sampler) {
+
+	uint32_t index = cache->lru_head;
+
+	while (index != RAW_VULKAN_DESCRIPTOR_CACHE_NONE) {
+		RawVulkanDescriptorSetCacheEntry* entry = &cache->entries[index];
+		uint32_t next = entry->next;
+
+		if (rawVulkanDescriptorSetKeyUses(
+			&entry->key, buffer, image_view, sampler)) {
+			rawRemoveVulkanDescriptorSetCacheSlot(cache, index);
+			rawUnlinkVulkanDescriptorSetCacheEntry(cache, index);
+
+			if (entry->frame_number < cache->oldest_pending_frame_number) {
+				rawFreeVulkanDescriptorSetCacheEntry(
+					logical_device, cache, index);
+			}
+			else {
+				entry->next = cache->retired_head;
+				cache->retired_head = index;
+			}
+		}
+
+		index = next;
+	}
+}
+
+static void rawWriteVulkanDescriptorSet(
+	VkDevice logical_device,
+	RawVulkanDescriptorSetKey const* const key,
+	VkDescriptorSet descriptor_set) {
+
+	VkWriteDescriptorSet writes[RAW_VULKAN_MAX_DESCRIPTOR_SET_KEY_BINDINGS];
+	VkDescriptorBufferInfo buffer_infos[
+		RAW_VULKAN_MAX_DESCRIPTOR_SET_KEY_BINDINGS];
+	VkDescriptorImageInfo image_infos[
+		RAW_VULKAN_MAX_DESCRIPTOR_SET_KEY_BINDINGS];
+
+	for (uint32_t i = 0; i < key->n_bindings; ++i) {
+		RawVulkanDescriptorBinding const* binding = &key->bindings[i];
+
+		bool is_buffer = binding->buffer != VK_NULL_HANDLE;
+
+		buffer_infos[i] = (VkDescriptorBufferInfo){
+			.buffer = binding->buffer,
+			.offset = binding->offset,
+			.range = binding->range
+		};
+
+		image_infos[i] = (VkDescriptorImageInfo){
+			.sampler = binding->sampler,
+			.imageView = binding->image_view,
+			.imageLayout = binding->image_layout
+		};
+
+		writes[i] = (VkWriteDescriptorSet){
+			.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+			.pNext = RAW_NULL_PTR,
+			.dstSet = descriptor_set,
+			.dstBinding = binding->binding,
+			.dstArrayElement = 0u,
+			.descriptorCount = 1u,
+			.descriptorType = binding->descriptor_type,
+			.pImageInfo = is_buffer ? RAW_NULL_PTR : &image_infos[i],
+			.pBufferInfo = is_buffer ? &buffer_infos[i] : RAW_NULL_PTR,
+			.pTexelBufferView = RAW_NULL_PTR
+		};
+	}
+
+	vkUpdateDescriptorSets(logical_device,
+		key->n_bindings, writes, 0u, RAW_NULL_PTR);
+}
+
+bool rawGetVulkanDescriptorSet(
+	VkDevice logical_device,
+	RawVulkanDescriptorSetCache* cache,
+	RawVulkanDescriptorSetKey const* const key,
+	VkDescriptorSet* descriptor_set) {
+
+	uint64_t key_hash = rawHashVulkanDescriptorSetKey(key);
+
+	uint32_t mask = cache->capacity - 1u;
+	uint32_t slot = (uint32_t)key_hash & mask;
+
+	while (cache->slots[slot] != RAW_VULKAN_DESCRIPTOR_CACHE_NONE) {
+		uint32_t index = cache->slots[slot];
+		RawVulkanDescriptorSetCacheEntry* entry = &cache->entries[index];
+
+		if (entry->key_hash == key_hash &&
+			rawCompareVulkanDescriptorSetKeys(&entry->key, key)) {
+			entry->frame_number = cache->frame_number;
+
+			rawUnlinkVulkanDescriptorSetCacheEntry(cache, index);
+			rawLinkVulkanDescriptorSetCacheEntry(cache, index);
+
+			*descriptor_set = entry->descriptor_set;
+			return true;
+		}
+
+		slot = (slot + 1u) & mask;
+	}
+
+	if (cache->n_sets == cache->max_sets &&
+		!rawEvictVulkanDescriptorSet(logical_device, cache)) {
+		RAW_LOG_ERROR("Every cached descriptor set is in flight!");
+		return false;
+	}
+
+	VkDescriptorSetAllocateInfo allocate_info = {
+		.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.descriptorPool = cache->descriptor_pool,
+		.descriptorSetCount = 1u,
+		.pSetLayouts = &key->set_layout
+	};
+
+	VkDescriptorSet new_descriptor_set;
+	VkResult result;
+
+	// Descriptor counts may run out before maxSets does
+	for (;;) {
+		result = vkAllocateDescriptorSets(
+			logical_device, &allocate_info, &new_descriptor_set);
+
+		if ((result != VK_ERROR_OUT_OF_POOL_MEMORY &&
+			result != VK_ERROR_FRAGMENTED_POOL) ||
+			!rawEvictVulkanDescriptorSet(logical_device, cache))
+			break;
+	}
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("vkAllocateDescriptorSets failed!");
+		return false;
+	}
+
+	rawWriteVulkanDescriptorSet(logical_device, key, new_descriptor_set);
+
+	// The eviction may have moved entries around, probe again
+	slot = (uint32_t)key_hash & mask;
+
+	while (cache->slots[slot] != RAW_VULKAN_DESCRIPTOR_CACHE_NONE)
+		slot = (slot + 1u) & mask;
+
+	uint32_t index = cache->free_head;
+	RawVulkanDescriptorSetCacheEntry* entry = &cache->entries[index];
+
+	cache->free_head = entry->next;
+
+	entry->key = *key;
+	entry->key_hash = key_hash;
+	entry->descriptor_set = new_descriptor_set;
+	entry->frame_number = cache->frame_number;
+
+	cache->slots[slot] = index;
+	rawLinkVulkanDescriptorSetCacheEntry(cache, index);
+
+	++cache->n_sets;
+
+	*descriptor_set = new_descriptor_set;
+	return true;
+}
+
+void rawEvictVulkanDescriptorSetsUsingBuffer(
+	VkDevice logical_device,
+	RawVulkanDescriptorSetCache* cache,
+	VkBuffer buffer) {
+	rawEvictVulkanDescriptorSetsUsing(logical_device, cache,
+		buffer, VK_NULL_HANDLE, VK_NULL_HANDLE);
+}
+
+void rawEvictVulkanDescriptorSetsUsingImageView(
+	VkDevice logical_device,
+	RawVulkanDescriptorSetCache* cache,
+	VkImageView image_view) {
+	rawEvictVulkanDescriptorSetsUsing(logical_device, cache,
+		VK_NULL_HANDLE, image_view, VK_NULL_HANDLE);
+}
+
+void rawEvictVulkanDescriptorSetsUsingSampler(
+	VkDevice logical_device,
+	RawVulkanDescriptorSetCache* cache,
+	VkSampler sampler) {
+	rawEvictVulkanDescriptorSetsUsing(logical_device, cache,
+		VK_NULL_HANDLE, VK_NULL_HANDLE, sampler);
+}
@@ -0,0 +1,225 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanDescriptorCache.h"
+ *
+ * Content addressed descriptor set cache
+ *
+ * Descriptor sets are keyed by their layout and everything written to
+ * them. Looking up a key that was seen before returns the same set, with
+ * no vkAllocateDescriptorSets or vkUpdateDescriptorSets call. Sets live
+ * in a pool created with FREE_DESCRIPTOR_SET_BIT and are evicted in least
+ * recently used order, but only once the last frame using them completed.
+ *
+ * Keys hold raw handles, and a destroyed handle may be reused for a new
+ * resource. Sets using a buffer, image view or sampler must be evicted
+ * through rawEvictVulkanDescriptorSetsUsing* before it's destroyed.
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+
+#ifndef RAW_VULKAN_DESCRIPTOR_CACHE_H
+#define RAW_VULKAN_DESCRIPTOR_CACHE_H
+
+#include <engine/vulkan/rawVulkan.h>
+
+#include <inttypes.h>
+#include <stdbool.h>
+
+#define RAW_VULKAN_MAX_DESCRIPTOR_SET_KEY_BINDINGS 16u
+
+/*
+ * A single descriptor written to @binding. Buffer descriptors use
+ * @buffer, @offset and @range, image and sampler descriptors use
+ * @image_view, @image_layout and @sampler.
+ */
+typedef struct {
+	uint32_t binding;
+	VkDescriptorType descriptor_type;
+
+	VkBuffer buffer;
+	VkDeviceSize offset;
+	VkDeviceSize range;
+
+	VkImageView image_view;
+	VkImageLayout image_layout;
+	VkSampler sampler;
+} RawVulkanDescriptorBinding;
+
+/*
+ * Bindings are kept sorted, so the order in which they
+ * are added doesn't change the key.
+ */
+typedef struct {
+	VkDescriptorSetLayout set_layout;
+
+	RawVulkanDescriptorBinding bindings[
+		RAW_VULKAN_MAX_DESCRIPTOR_SET_KEY_BINDINGS];
+	uint32_t n_bindings;
+} RawVulkanDescriptorSetKey;
+
+typedef struct {
+	RawVulkanDescriptorSetKey key;
+	uint64_t key_hash;
+
+	// VK_NULL_HANDLE marks an unused entry
+	VkDescriptorSet descriptor_set;
+
+	// Last frame which looked the set up
+	uint64_t frame_number;
+
+	/*
+	 * Least recently used list of the cache. Unused and retired entries
+	 * are chained through @next. UINT32_MAX ends every list.
+	 */
+	uint32_t previous;
+	uint32_t next;
+} RawVulkanDescriptorSetCacheEntry;
+
+typedef struct {
+	VkDescriptorPool descriptor_pool;
+
+	RawVulkanDescriptorSetCacheEntry* entries;
+	uint32_t max_sets;
+	uint32_t n_sets;
+
+	/*
+	 * Open addressing table of entry indices, UINT32_MAX marks an
+	 * empty slot. The capacity is a power of two, at least 4/3 of
+	 * @max_sets.
+	 */
+	uint32_t* slots;
+	uint32_t capacity;
+
+	// Least and most recently used entries
+	uint32_t lru_head;
+	uint32_t lru_tail;
+	uint32_t free_head;
+
+	/*
+	 * Evicted entries whose sets may still be in use by the GPU. They
+	 * count towards @n_sets until freed.
+	 */
+	uint32_t retired_head;
+
+	// Frame being recorded and the oldest one the GPU may still be using
+	uint64_t frame_number;
+	uint64_t oldest_pending_frame_number;
+} RawVulkanDescriptorSetCache;
+
+// Zeroes @key, which must then be filled by rawAddVulkanDescriptor*
+void rawInitVulkanDescriptorSetKey(
+	VkDescriptorSetLayout set_layout,
+	RawVulkanDescriptorSetKey* key);
+
+bool rawAddVulkanDescriptorBuffer(
+	RawVulkanDescriptorSetKey* key,
+	uint32_t binding,
+	VkDescriptorType descriptor_type,
+	VkBuffer buffer,
+	VkDeviceSize offset,
+	VkDeviceSize range);
+
+// @sampler or @image_view are ignored by descriptor types not using them
+bool rawAddVulkanDescriptorImage(
+	RawVulkanDescriptorSetKey* key,
+	uint32_t binding,
+	VkDescriptorType descriptor_type,
+	VkImageView image_view,
+	VkImageLayout image_layout,
+	VkSampler sampler);
+
+uint64_t rawHashVulkanDescriptorSetKey(
+	RawVulkanDescriptorSetKey const* const key);
+
+/*
+ * The cache holds up to @max_sets sets, allocated from a single pool
+ * of @pool_sizes descriptors.
+ */
+bool rawCreateVulkanDescriptorSetCache(
+	VkDevice logical_device,
+	uint32_t max_sets,
+	VkDescriptorPoolSize const* pool_sizes,
+	uint32_t n_pool_sizes,
+	RawVulkanDescriptorSetCache* cache);
+
+void rawDestroyVulkanDescriptorSetCache(
+	VkDevice logical_device,
+	RawVulkanDescriptorSetCache* cache);
+
+/*
+ * Starts tagging lookups with @frame_number. Sets last looked up before
+ * @oldest_pending_frame_number are no longer used by the GPU and may be
+ * evicted, and the retired ones among them are freed.
+ *
+ * With a RawVulkanFrameManager of n frames, after rawBeginVulkanFrame
+ * this is its frame_number and frame_number - n + 1 (or 0).
+ */
+void rawBeginVulkanDescriptorSetCacheFrame(
+	VkDevice logical_device,
+	RawVulkanDescriptorSetCache* cache,
+	uint64_t frame_number,
+	uint64_t oldest_pending_frame_number);
+
+/*
+ * The set described by @key. On a miss, the set is allocated and
+ * written, evicting the least recently used sets if the cache or its
+ * pool are full.
+ *
+ * Fails if every cached set may still be in use by the GPU, in which
+ * case a transient set (see rawVulkanDescriptorAllocator.h) should be
+ * used for the draw instead. Not thread safe.
+ */
+bool rawGetVulkanDescriptorSet(
+	VkDevice logical_device,
+	RawVulkanDescriptorSetCache* cache,
+	RawVulkanDescriptorSetKey const* const key,
+	VkDescriptorSet* descriptor_set);
+
+/*
+ * Drops every cached set using @buffer, @image_view or @sampler, so a
+ * new resource reusing the handle never matches them. Must be called
+ * before destroying the resource. Sets still in use by frames in flight
+ * are retired, and freed by rawBeginVulkanDescriptorSetCacheFrame once
+ * those frames complete; the resource itself must outlive them as well.
+ */
+void rawEvictVulkanDescriptorSetsUsingBuffer(
+	VkDevice logical_device,
+	RawVulkanDescriptorSetCache* cache,
+	VkBuffer buffer);
+
+void rawEvictVulkanDescriptorSetsUsingImageView(
+	VkDevice logical_device,
+	RawVulkanDescriptorSetCache* cache,
+	VkImageView image_view);
+
+void rawEvictVulkanDescriptorSetsUsingSampler(
+	VkDevice logical_device,
+	RawVulkanDescriptorSetCache* cache,
+	VkSampler sampler);
+
+#endif // RAW_VULKAN_DESCRIPTOR_CACHE_H
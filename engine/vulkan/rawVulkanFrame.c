@@ -0,0 +1,321 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanFrame.c"
+ *
+ * Frames in flight management
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+
+#include <engine/vulkan/rawVulkanFrame.h>
+#include <engine/platform/rawMemory.h>
+#include <engine/utils/rawLogger.h>
+
+#include <string.h>
+
+bool rawCreateVulkanFrameManager(
+	VkDevice logical_device,
+	uint32_t n_frames,
+	RawVulkanFrameManager* frame_manager) {
+
+	frame_manager->frames = RAW_NULL_PTR;
+	frame_manager->n_frames = n_frames;
+	frame_manager->frame_index = 0u;
+	frame_manager->frame_number = 0u;
+	frame_manager->image_index = 0u;
+	frame_manager->free_semaphores = RAW_NULL_PTR;
+	frame_manager->n_free_semaphores = 0u;
+	frame_manager->present_info_next = RAW_NULL_PTR;
+
+	RAW_MEM_ALLOC(frame_manager->frames,
+		(uint64_t)n_frames, sizeof(RawVulkanFrame));
+
+	if (!frame_manager->frames) {
+		RAW_LOG_ERROR("RAW_MEM_ALLOC failed on "
+			"rawCreateVulkanFrameManager!");
+		return false;
+	}
+
+	memset(frame_manager->frames, 0, n_frames * sizeof(RawVulkanFrame));
+
+	/*
+	 * Every frame may hold an image acquired semaphore,
+	 * one more is needed for the acquisition in progress
+	 */
+	uint32_t n_semaphores = n_frames + 1u;
+
+	RAW_MEM_ALLOC(frame_manager->free_semaphores,
+		(uint64_t)n_semaphores, sizeof(VkSemaphore));
+
+	if (!frame_manager->free_semaphores) {
+		RAW_LOG_ERROR("RAW_MEM_ALLOC failed on "
+			"rawCreateVulkanFrameManager!");
+		RAW_MEM_FREE(frame_manager->frames);
+		return false;
+	}
+
+	VkSemaphoreCreateInfo semaphore_create_info = {
+		.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = 0
+	};
+
+	VkFenceCreateInfo fence_create_info = {
+		.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = VK_FENCE_CREATE_SIGNALED_BIT
+	};
+
+	for (uint32_t i = 0; i < n_semaphores; ++i) {
+		// TODO: Pass allocation callback
+		VkResult result = vkCreateSemaphore(logical_device,
+			&semaphore_create_info, RAW_NULL_PTR,
+			&frame_manager->free_semaphores[i]);
+
+		if (result != VK_SUCCESS) {
+			RAW_LOG_ERROR("vkCreateSemaphore failed!");
+			rawDestroyVulkanFrameManager(logical_device, frame_manager);
+			return false;
+		}
+
+		++frame_manager->n_free_semaphores;
+	}
+
+	for (uint32_t i = 0; i < n_frames; ++i) {
+		RawVulkanFrame* frame = &frame_manager->frames[i];
+
+		// TODO: Pass allocation callback
+		VkResult result = vkCreateFence(logical_device,
+			&fence_create_info, RAW_NULL_PTR, &frame->in_flight_fence);
+
+		if (result != VK_SUCCESS) {
+			RAW_LOG_ERROR("vkCreateFence failed!");
+			rawDestroyVulkanFrameManager(logical_device, frame_manager);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void rawDestroyVulkanFrameManager(
+	VkDevice logical_device,
+	RawVulkanFrameManager* frame_manager) {
+
+	if (!frame_manager->frames) {
+		RAW_LOG_WARNING("Attempting to destroy "
+			"NULL Vulkan frame manager!");
+		return;
+	}
+
+	for (uint32_t i = 0; i < frame_manager->n_frames; ++i) {
+		RawVulkanFrame* frame = &frame_manager->frames[i];
+
+		if (frame->in_flight_fence != VK_NULL_HANDLE) {
+			vkWaitForFences(logical_device, 1u,
+				&frame->in_flight_fence, VK_TRUE, UINT64_MAX);
+
+			// TODO: Pass allocation callback
+			vkDestroyFence(logical_device,
+				frame->in_flight_fence, RAW_NULL_PTR);
+		}
+
+		if (frame->image_acquired_semaphore != VK_NULL_HANDLE) {
+			// TODO: Pass allocation callback
+			vkDestroySemaphore(logical_device,
+				frame->image_acquired_semaphore, RAW_NULL_PTR);
+		}
+	}
+
+	for (uint32_t i = 0; i < frame_manager->n_free_semaphores; ++i) {
+		// TODO: Pass allocation callback
+		vkDestroySemaphore(logical_device,
+			frame_manager->free_semaphores[i], RAW_NULL_PTR);
+	}
+
+	RAW_MEM_FREE(frame_manager->free_semaphores);
+	RAW_MEM_FREE(frame_manager->frames);
+}
+
+bool rawBeginVulkanFrame(
+	VkDevice logical_device,
+	RawVulkanFrameManager* frame_manager,
+	VkSwapchainKHR swapchain,
+	RawVulkanCommandAllocator* command_allocator,
+	uint32_t* image_index,
+	bool* swapchain_out_of_date) {
+
+	*swapchain_out_of_date = false;
+
+	RawVulkanFrame* frame =
+		&frame_manager->frames[frame_manager->frame_index];
+
+	// Only the frame slot being reused must be finished
+	VkResult result = vkWaitForFences(logical_device,
+		1u, &frame->in_flight_fence, VK_TRUE, UINT64_MAX);
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("vkWaitForFences failed!");
+		return false;
+	}
+
+	// The previous submission of this slot waited on its semaphore
+	if (frame->image_acquired_semaphore != VK_NULL_HANDLE) {
+		frame_manager->free_semaphores[frame_manager->n_free_semaphores++] =
+			frame->image_acquired_semaphore;
+		frame->image_acquired_semaphore = VK_NULL_HANDLE;
+	}
+
+	if (command_allocator && !rawResetVulkanCommandAllocatorFrame(
+		logical_device, command_allocator,
+		frame_manager->frame_index, VK_NULL_HANDLE)) {
+		RAW_LOG_ERROR("rawResetVulkanCommandAllocatorFrame failed!");
+		return false;
+	}
+
+	VkSemaphore image_acquired_semaphore =
+		frame_manager->free_semaphores[--frame_manager->n_free_semaphores];
+
+	result = vkAcquireNextImageKHR(logical_device, swapchain, UINT64_MAX,
+		image_acquired_semaphore, VK_NULL_HANDLE, image_index);
+
+	if (result == VK_ERROR_OUT_OF_DATE_KHR) {
+		// The semaphore wasn't signaled, so it can go back to the pool
+		frame_manager->free_semaphores[frame_manager->n_free_semaphores++] =
+			image_acquired_semaphore;
+		*swapchain_out_of_date = true;
+		return true;
+	}
+
+	if (result != VK_SUCCESS && result != VK_SUBOPTIMAL_KHR) {
+		RAW_LOG_ERROR("vkAcquireNextImageKHR failed!");
+		frame_manager->free_semaphores[frame_manager->n_free_semaphores++] =
+			image_acquired_semaphore;
+		return false;
+	}
+
+	// A suboptimal image is still rendered, recreation is left to the end
+	frame->image_acquired_semaphore = image_acquired_semaphore;
+	frame_manager->image_index = *image_index;
+
+	return true;
+}
+
+bool rawEndVulkanFrame(
+	VkDevice logical_device,
+	RawVulkanFrameManager* frame_manager,
+	VkQueue graphics_queue,
+	VkQueue present_queue,
+	VkSwapchainKHR swapchain,
+	VkSemaphore render_finished_semaphore,
+	VkCommandBuffer const* const command_buffers,
+	uint32_t n_command_buffers,
+	bool* swapchain_out_of_date) {
+
+	*swapchain_out_of_date = false;
+
+	RawVulkanFrame* frame =
+		&frame_manager->frames[frame_manager->frame_index];
+
+	/*
+	 * The fence is only reset right before the submission that signals
+	 * it, so a frame abandoned at acquisition never blocks its slot
+	 */
+	VkResult result = vkResetFences(logical_device,
+		1u, &frame->in_flight_fence);
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("vkResetFences failed!");
+		return false;
+	}
+
+	VkPipelineStageFlags wait_stage =
+		VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+
+	VkSubmitInfo submit_info = {
+		.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+		.pNext = RAW_NULL_PTR,
+		.waitSemaphoreCount = 1u,
+		.pWaitSemaphores = &frame->image_acquired_semaphore,
+		.pWaitDstStageMask = &wait_stage,
+		.commandBufferCount = n_command_buffers,
+		.pCommandBuffers = command_buffers,
+		.signalSemaphoreCount = 1u,
+		.pSignalSemaphores = &render_finished_semaphore
+	};
+
+	result = vkQueueSubmit(graphics_queue,
+		1u, &submit_info, frame->in_flight_fence);
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("vkQueueSubmit failed!");
+
+		/*
+		 * The fence was already reset, and the next rawBeginVulkanFrame
+		 * of this slot would wait on it forever. An empty submission
+		 * signals it again, consuming the acquisition semaphore as well.
+		 */
+		submit_info.commandBufferCount = 0u;
+		submit_info.signalSemaphoreCount = 0u;
+
+		if (vkQueueSubmit(graphics_queue, 1u, &submit_info,
+			frame->in_flight_fence) != VK_SUCCESS)
+			RAW_LOG_ERROR("vkQueueSubmit failed!");
+
+		return false;
+	}
+
+	VkPresentInfoKHR present_info = {
+		.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR,
+		.pNext = frame_manager->present_info_next,
+		.waitSemaphoreCount = 1u,
+		.pWaitSemaphores = &render_finished_semaphore,
+		.swapchainCount = 1u,
+		.pSwapchains = &swapchain,
+		.pImageIndices = &frame_manager->image_index,
+		.pResults = RAW_NULL_PTR
+	};
+
+	result = vkQueuePresentKHR(present_queue, &present_info);
+
+	frame_manager->frame_index =
+		(frame_manager->frame_index + 1u) % frame_manager->n_frames;
+	++frame_manager->frame_number;
+
+	if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR) {
+		*swapchain_out_of_date = true;
+		return true;
+	}
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("vkQueuePresentKHR failed!");
+		return false;
+	}
+
+	return true;
+}
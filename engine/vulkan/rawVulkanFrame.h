@@ -0,0 +1,142 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanFrame.h"
+ *
+ * Frames in flight management
+ *
+ * Each frame in flight owns a fence and the semaphore that orders image
+ * acquisition and rendering. Beginning a frame only
+ * waits for the fence of the frame slot being reused, so the CPU can
+ * record frame N + 1 while the GPU is still working on frame N.
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+
+#ifndef RAW_VULKAN_FRAME_H
+#define RAW_VULKAN_FRAME_H
+
+#include <engine/vulkan/rawVulkan.h>
+#include <engine/vulkan/rawVulkanCommandAllocator.h>
+
+#include <inttypes.h>
+#include <stdbool.h>
+
+typedef struct {
+	// Signaled once the GPU is done with the frame's submission
+	VkFence in_flight_fence;
+
+	// Taken from the manager's semaphore pool on acquisition
+	VkSemaphore image_acquired_semaphore;
+} RawVulkanFrame;
+
+typedef struct {
+	RawVulkanFrame* frames;
+	uint32_t n_frames;
+
+	// Frame slot in use between rawBeginVulkanFrame and rawEndVulkanFrame
+	uint32_t frame_index;
+	uint64_t frame_number;
+	uint32_t image_index;
+
+	/*
+	 * Image acquired semaphores not held by any frame.
+	 * An acquisition may fail after a semaphore has been picked,
+	 * so they are recycled instead of being bound to a frame slot.
+	 */
+	VkSemaphore* free_semaphores;
+	uint32_t n_free_semaphores;
+
+	/*
+	 * Chained to VkPresentInfoKHR::pNext by rawEndVulkanFrame,
+	 * e.g. by the frame pacer to tag presents with an id
+	 */
+	void const* present_info_next;
+} RawVulkanFrameManager;
+
+/*
+ * Creates @n_frames frame slots. Fences are created signaled,
+ * so the first use of each slot doesn't block.
+ */
+bool rawCreateVulkanFrameManager(
+	VkDevice logical_device,
+	uint32_t n_frames,
+	RawVulkanFrameManager* frame_manager);
+
+/*
+ * Waits for every frame in flight before
+ * destroying the synchronization objects
+ */
+void rawDestroyVulkanFrameManager(
+	VkDevice logical_device,
+	RawVulkanFrameManager* frame_manager);
+
+/*
+ * Waits for the fence of the frame slot being reused, recycles its
+ * command buffers through @command_allocator (if not NULL, it must
+ * have been created with the same number of frames) and acquires the
+ * next image of @swapchain, returned in @image_index.
+ *
+ * @swapchain_out_of_date is set when the swapchain must be recreated
+ * before rendering. In that case no image is acquired and the frame
+ * must not be ended.
+ */
+bool rawBeginVulkanFrame(
+	VkDevice logical_device,
+	RawVulkanFrameManager* frame_manager,
+	VkSwapchainKHR swapchain,
+	RawVulkanCommandAllocator* command_allocator,
+	uint32_t* image_index,
+	bool* swapchain_out_of_date);
+
+/*
+ * Submits @command_buffers to @graphics_queue, waiting for the image
+ * acquisition, and presents the image on @present_queue once rendering
+ * is finished. The frame's fence is signaled when the submission
+ * completes. Then advances to the next frame slot.
+ *
+ * @render_finished_semaphore is signaled by the submission and waited
+ * by the present. The fence doesn't cover that wait, so the semaphore
+ * must belong to the acquired image rather than to the frame slot:
+ * an image is only acquired again once its previous present is done
+ * (see RawVulkanSwapchain::render_finished_semaphores).
+ *
+ * @swapchain_out_of_date is set when the presentation reported the
+ * swapchain as out of date or suboptimal.
+ */
+bool rawEndVulkanFrame(
+	VkDevice logical_device,
+	RawVulkanFrameManager* frame_manager,
+	VkQueue graphics_queue,
+	VkQueue present_queue,
+	VkSwapchainKHR swapchain,
+	VkSemaphore render_finished_semaphore,
+	VkCommandBuffer const* const command_buffers,
+	uint32_t n_command_buffers,
+	bool* swapchain_out_of_date);
+
+#endif // RAW_VULKAN_FRAME_H
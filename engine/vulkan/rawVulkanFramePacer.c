@@ -0,0 +1,521 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanFramePacer.c"
+ *
+ * Frame pacing and latency measurement
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+
+#include <engine/vulkan/rawVulkanFramePacer.h>
+#include <engine/platform/rawMemory.h>
+#include <engine/platform/rawPlatform.h>
+#include <engine/utils/rawLogger.h>
+
+#include <string.h>
+
+// Bounds the wait for the display, so a stalled compositor can't hang us
+#define RAW_VULKAN_FRAME_PACER_PRESENT_WAIT_TIMEOUT 100000000u
+
+bool rawCreateVulkanFramePacer(
+	VkPhysicalDevice physical_device,
+	VkDevice logical_device,
+	uint32_t queue_family_index,
+	uint32_t n_frames,
+	RawVulkanFramePacer* frame_pacer) {
+
+	memset(frame_pacer, 0, sizeof(RawVulkanFramePacer));
+
+	frame_pacer->n_frames = n_frames;
+	frame_pacer->present_swapchain = VK_NULL_HANDLE;
+
+	for (uint32_t i = 0; i < RAW_VULKAN_MAX_FRAME_PACER_HISTORY; ++i)
+		frame_pacer->history[i].frame_number = UINT64_MAX;
+
+	RAW_MEM_ALLOC(frame_pacer->slot_frame_numbers,
+		(uint64_t)n_frames, sizeof(uint64_t));
+
+	if (!frame_pacer->slot_frame_numbers) {
+		RAW_LOG_ERROR("RAW_MEM_ALLOC failed on rawCreateVulkanFramePacer!");
+		return false;
+	}
+
+	for (uint32_t i = 0; i < n_frames; ++i)
+		frame_pacer->slot_frame_numbers[i] = UINT64_MAX;
+
+	VkPhysicalDeviceProperties properties;
+	vkGetPhysicalDeviceProperties(physical_device, &properties);
+
+	frame_pacer->timestamp_period =
+		(double)properties.limits.timestampPeriod;
+
+	uint32_t n_queue_families;
+
+	vkGetPhysicalDeviceQueueFamilyProperties(
+		physical_device, &n_queue_families, RAW_NULL_PTR);
+
+	VkQueueFamilyProperties* queue_families;
+
+	RAW_MEM_ALLOC(queue_families,
+		(uint64_t)n_queue_families, sizeof(VkQueueFamilyProperties));
+
+	if (!queue_families) {
+		RAW_LOG_ERROR("RAW_MEM_ALLOC failed on rawCreateVulkanFramePacer!");
+		RAW_MEM_FREE(frame_pacer->slot_frame_numbers);
+		return false;
+	}
+
+	vkGetPhysicalDeviceQueueFamilyProperties(
+		physical_device, &n_queue_families, queue_families);
+
+	uint32_t timestamp_valid_bits = queue_family_index < n_queue_families ?
+		queue_families[queue_family_index].timestampValidBits : 0u;
+
+	RAW_MEM_FREE(queue_families);
+
+	if (timestamp_valid_bits == 0u) {
+		RAW_LOG_WARNING("Queue family %d doesn't support timestamps, "
+			"GPU frame time won't be measured!", queue_family_index);
+		return true;
+	}
+
+	frame_pacer->timestamp_mask = timestamp_valid_bits >= 64u ?
+		UINT64_MAX : (((uint64_t)1u << timestamp_valid_bits) - 1u);
+
+	VkQueryPoolCreateInfo query_pool_create_info = {
+		.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = 0,
+		.queryType = VK_QUERY_TYPE_TIMESTAMP,
+		.queryCount = 2u * n_frames,
+		.pipelineStatistics = 0
+	};
+
+	// TODO: Pass allocation callback
+	VkResult result = vkCreateQueryPool(logical_device,
+		&query_pool_create_info, RAW_NULL_PTR, &frame_pacer->query_pool);
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("vkCreateQueryPool failed!");
+		RAW_MEM_FREE(frame_pacer->slot_frame_numbers);
+		return false;
+	}
+
+	return true;
+}
+
+void rawDestroyVulkanFramePacer(
+	VkDevice logical_device,
+	RawVulkanFramePacer* frame_pacer) {
+
+	if (frame_pacer->query_pool != VK_NULL_HANDLE) {
+		// TODO: Pass allocation callback
+		vkDestroyQueryPool(logical_device,
+			frame_pacer->query_pool, RAW_NULL_PTR);
+		frame_pacer->query_pool = VK_NULL_HANDLE;
+	}
+
+	if (frame_pacer->slot_frame_numbers)
+		RAW_MEM_FREE(frame_pacer->slot_frame_numbers);
+}
+
+// History entry of @frame_number, NULL if it was overwritten
+static RawVulkanFrameTimings* rawGetVulkanFramePacerTimings(
+	RawVulkanFramePacer* frame_pacer,
+	uint64_t frame_number) {
+
+	RawVulkanFrameTimings* timings = &frame_pacer->history[
+		frame_number % RAW_VULKAN_MAX_FRAME_PACER_HISTORY];
+
+	return timings->frame_number == frame_number ?
+		timings : RAW_NULL_PTR;
+}
+
+static void rawCollectVulkanDisplayTimings(
+	VkDevice logical_device,
+	RawVulkanFramePacer* frame_pacer,
+	VkSwapchainKHR swapchain) {
+
+	if (frame_pacer->refresh_duration == 0u &&
+		vkGetRefreshCycleDurationGOOGLE) {
+		VkRefreshCycleDurationGOOGLE refresh_cycle_duration;
+
+		if (vkGetRefreshCycleDurationGOOGLE(logical_device, swapchain,
+			&refresh_cycle_duration) == VK_SUCCESS)
+			frame_pacer->refresh_duration =
+				refresh_cycle_duration.refreshDuration;
+	}
+
+	if (!vkGetPastPresentationTimingGOOGLE ||
+		swapchain != frame_pacer->present_swapchain)
+		return;
+
+	VkPastPresentationTimingGOOGLE
+		past_timings[RAW_VULKAN_MAX_FRAME_PACER_HISTORY];
+	uint32_t n_past_timings = RAW_VULKAN_MAX_FRAME_PACER_HISTORY;
+
+	VkResult result = vkGetPastPresentationTimingGOOGLE(logical_device,
+		swapchain, &n_past_timings, past_timings);
+
+	// Timings left behind are returned on the next call
+	if (result != VK_SUCCESS && result != VK_INCOMPLETE)
+		return;
+
+	for (uint32_t i = 0; i < n_past_timings; ++i) {
+		// Present ids are the low bits of the frame number plus one
+		uint32_t frame_bits = past_timings[i].presentID - 1u;
+		uint32_t index = frame_bits % RAW_VULKAN_MAX_FRAME_PACER_HISTORY;
+
+		RawVulkanFrameTimings* timings = &frame_pacer->history[index];
+
+		if ((uint32_t)timings->frame_number != frame_bits ||
+			past_timings[i].actualPresentTime <=
+				frame_pacer->present_times[index])
+			continue;
+
+		// The display timing clock is the platform's monotonic clock
+		timings->present_latency = past_timings[i].actualPresentTime -
+			frame_pacer->present_times[index];
+	}
+}
+
+/*
+ * Keeps at most n_frames - 1 presents waiting for the display,
+ * so frames aren't rendered only to wait in the present queue
+ */
+static bool rawWaitVulkanPresents(
+	VkDevice logical_device,
+	RawVulkanFramePacer* frame_pacer,
+	VkSwapchainKHR swapchain) {
+
+	uint64_t n_queued_presents =
+		frame_pacer->n_frames > 1u ? frame_pacer->n_frames - 1u : 1u;
+
+	if (!vkWaitForPresentKHR ||
+		swapchain != frame_pacer->present_swapchain ||
+		frame_pacer->frame_number < n_queued_presents)
+		return true;
+
+	uint64_t waited_frame = frame_pacer->frame_number - n_queued_presents;
+
+	VkResult result = vkWaitForPresentKHR(logical_device, swapchain,
+		waited_frame + 1u, RAW_VULKAN_FRAME_PACER_PRESENT_WAIT_TIMEOUT);
+
+	// Swapchain problems are reported by acquisition and presentation
+	if (result == VK_TIMEOUT || result == VK_SUBOPTIMAL_KHR ||
+		result == VK_ERROR_OUT_OF_DATE_KHR)
+		return true;
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("vkWaitForPresentKHR failed!");
+		return false;
+	}
+
+	RawVulkanFrameTimings* timings =
+		rawGetVulkanFramePacerTimings(frame_pacer, waited_frame);
+
+	// Display timing is exact, this is only an upper bound
+	if (timings && timings->present_latency == 0u) {
+		timings->present_latency = rawPlatformGetTime() -
+			frame_pacer->present_times[
+				waited_frame % RAW_VULKAN_MAX_FRAME_PACER_HISTORY];
+	}
+
+	return true;
+}
+
+/*
+ * Frames are started one predicted frame time apart, minus some slack
+ * so the GPU doesn't run dry while the CPU records the next frame
+ */
+static uint64_t rawSleepUntilVulkanFrameStart(
+	RawVulkanFramePacer* frame_pacer) {
+
+	if (frame_pacer->frame_number == 0u)
+		return 0u;
+
+	RawVulkanFrameTimings average_timings;
+	rawGetVulkanFramePacerAverageTimings(frame_pacer, &average_timings);
+
+	uint64_t frame_time = average_timings.cpu_frame_time;
+
+	if (average_timings.gpu_frame_time > frame_time)
+		frame_time = average_timings.gpu_frame_time;
+
+	if (frame_pacer->min_frame_time > frame_time)
+		frame_time = frame_pacer->min_frame_time;
+
+	uint64_t start_time = frame_pacer->frame_start_time +
+		frame_time - frame_time / 8u;
+	uint64_t current_time = rawPlatformGetTime();
+
+	if (start_time <= current_time)
+		return 0u;
+
+	uint64_t sleep_time = start_time - current_time;
+
+	// Guards against a stale prediction after a long pause
+	if (sleep_time > frame_time)
+		sleep_time = frame_time;
+
+	rawPlatformSleep(sleep_time);
+
+	return sleep_time;
+}
+
+static void rawCollectVulkanGpuTimings(
+	VkDevice logical_device,
+	RawVulkanFramePacer* frame_pacer,
+	uint32_t frame_index) {
+
+	uint64_t timed_frame = frame_pacer->slot_frame_numbers[frame_index];
+
+	if (frame_pacer->query_pool == VK_NULL_HANDLE ||
+		timed_frame == UINT64_MAX)
+		return;
+
+	frame_pacer->slot_frame_numbers[frame_index] = UINT64_MAX;
+
+	uint64_t timestamps[2];
+
+	// Not ready if the frame was never submitted
+	VkResult result = vkGetQueryPoolResults(logical_device,
+		frame_pacer->query_pool, 2u * frame_index, 2u,
+		sizeof(timestamps), timestamps, sizeof(uint64_t),
+		VK_QUERY_RESULT_64_BIT);
+
+	if (result != VK_SUCCESS)
+		return;
+
+	RawVulkanFrameTimings* timings =
+		rawGetVulkanFramePacerTimings(frame_pacer, timed_frame);
+
+	if (timings) {
+		uint64_t ticks = (timestamps[1] - timestamps[0]) &
+			frame_pacer->timestamp_mask;
+
+		timings->gpu_frame_time =
+			(uint64_t)((double)ticks * frame_pacer->timestamp_period);
+	}
+}
+
+bool rawBeginVulkanPacedFrame(
+	VkDevice logical_device,
+	RawVulkanFramePacer* frame_pacer,
+	RawVulkanFrameManager* frame_manager,
+	VkSwapchainKHR swapchain,
+	RawVulkanCommandAllocator* command_allocator,
+	uint32_t* image_index,
+	bool* swapchain_out_of_date) {
+
+	frame_pacer->frame_number = frame_manager->frame_number;
+
+	rawCollectVulkanDisplayTimings(logical_device, frame_pacer, swapchain);
+
+	if (!rawWaitVulkanPresents(logical_device, frame_pacer, swapchain))
+		return false;
+
+	uint64_t sleep_time = rawSleepUntilVulkanFrameStart(frame_pacer);
+
+	RawVulkanFrameTimings* timings = &frame_pacer->history[
+		frame_pacer->frame_number % RAW_VULKAN_MAX_FRAME_PACER_HISTORY];
+
+	memset(timings, 0, sizeof(RawVulkanFrameTimings));
+	timings->frame_number = frame_pacer->frame_number;
+	timings->sleep_time = sleep_time;
+
+	frame_pacer->frame_start_time = rawPlatformGetTime();
+
+	if (!rawBeginVulkanFrame(logical_device, frame_manager, swapchain,
+		command_allocator, image_index, swapchain_out_of_date)) {
+		RAW_LOG_ERROR("rawBeginVulkanFrame failed!");
+		return false;
+	}
+
+	frame_pacer->acquire_time = rawPlatformGetTime();
+
+	// The slot's fence was waited, so its timestamps are available
+	rawCollectVulkanGpuTimings(logical_device,
+		frame_pacer, frame_manager->frame_index);
+
+	return true;
+}
+
+bool rawEndVulkanPacedFrame(
+	VkDevice logical_device,
+	RawVulkanFramePacer* frame_pacer,
+	RawVulkanFrameManager* frame_manager,
+	VkQueue graphics_queue,
+	VkQueue present_queue,
+	VkSwapchainKHR swapchain,
+	VkSemaphore render_finished_semaphore,
+	VkCommandBuffer const* const command_buffers,
+	uint32_t n_command_buffers,
+	bool* swapchain_out_of_date) {
+
+	uint64_t frame_number = frame_manager->frame_number;
+	void const* present_info_next = RAW_NULL_PTR;
+
+	// Zero means no id, so frames are identified by their number plus one
+	if (vkWaitForPresentKHR) {
+		frame_pacer->present_id = frame_number + 1u;
+
+		frame_pacer->present_id_info = (VkPresentIdKHR) {
+			.sType = VK_STRUCTURE_TYPE_PRESENT_ID_KHR,
+			.pNext = present_info_next,
+			.swapchainCount = 1u,
+			.pPresentIds = &frame_pacer->present_id
+		};
+
+		present_info_next = &frame_pacer->present_id_info;
+	}
+
+	if (vkGetPastPresentationTimingGOOGLE) {
+		frame_pacer->present_time = (VkPresentTimeGOOGLE) {
+			.presentID = (uint32_t)(frame_number + 1u),
+			.desiredPresentTime = 0u
+		};
+
+		frame_pacer->present_times_info = (VkPresentTimesInfoGOOGLE) {
+			.sType = VK_STRUCTURE_TYPE_PRESENT_TIMES_INFO_GOOGLE,
+			.pNext = present_info_next,
+			.swapchainCount = 1u,
+			.pTimes = &frame_pacer->present_time
+		};
+
+		present_info_next = &frame_pacer->present_times_info;
+	}
+
+	uint64_t present_time = rawPlatformGetTime();
+
+	frame_pacer->present_times[
+		frame_number % RAW_VULKAN_MAX_FRAME_PACER_HISTORY] = present_time;
+
+	frame_manager->present_info_next = present_info_next;
+
+	bool result = rawEndVulkanFrame(logical_device, frame_manager,
+		graphics_queue, present_queue, swapchain, render_finished_semaphore,
+		command_buffers, n_command_buffers, swapchain_out_of_date);
+
+	frame_manager->present_info_next = RAW_NULL_PTR;
+
+	if (!result) {
+		RAW_LOG_ERROR("rawEndVulkanFrame failed!");
+		return false;
+	}
+
+	if (present_info_next)
+		frame_pacer->present_swapchain = swapchain;
+
+	RawVulkanFrameTimings* timings =
+		rawGetVulkanFramePacerTimings(frame_pacer, frame_number);
+
+	if (timings) {
+		timings->cpu_frame_time =
+			present_time - frame_pacer->frame_start_time;
+		timings->acquire_to_present_time =
+			rawPlatformGetTime() - frame_pacer->acquire_time;
+	}
+
+	return true;
+}
+
+void rawCmdBeginVulkanFrameTimer(
+	RawVulkanFramePacer const* const frame_pacer,
+	RawVulkanFrameManager const* const frame_manager,
+	VkCommandBuffer command_buffer) {
+
+	if (frame_pacer->query_pool == VK_NULL_HANDLE)
+		return;
+
+	uint32_t first_query = 2u * frame_manager->frame_index;
+
+	vkCmdResetQueryPool(command_buffer,
+		frame_pacer->query_pool, first_query, 2u);
+
+	vkCmdWriteTimestamp(command_buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+		frame_pacer->query_pool, first_query);
+}
+
+void rawCmdEndVulkanFrameTimer(
+	RawVulkanFramePacer* frame_pacer,
+	RawVulkanFrameManager const* const frame_manager,
+	VkCommandBuffer command_buffer) {
+
+	if (frame_pacer->query_pool == VK_NULL_HANDLE)
+		return;
+
+	vkCmdWriteTimestamp(command_buffer,
+		VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, frame_pacer->query_pool,
+		2u * frame_manager->frame_index + 1u);
+
+	frame_pacer->slot_frame_numbers[frame_manager->frame_index] =
+		frame_manager->frame_number;
+}
+
+void rawGetVulkanFramePacerAverageTimings(
+	RawVulkanFramePacer const* const frame_pacer,
+	RawVulkanFrameTimings* average_timings) {
+
+	uint64_t sums[5] = { 0u };
+	uint64_t counts[5] = { 0u };
+
+	for (uint32_t i = 0; i < RAW_VULKAN_MAX_FRAME_PACER_HISTORY; ++i) {
+		RawVulkanFrameTimings const* timings = &frame_pacer->history[i];
+
+		if (timings->frame_number == UINT64_MAX)
+			continue;
+
+		uint64_t values[5] = {
+			timings->sleep_time,
+			timings->cpu_frame_time,
+			timings->gpu_frame_time,
+			timings->acquire_to_present_time,
+			timings->present_latency
+		};
+
+		// Zero is unmeasured, except for the sleep
+		for (uint32_t j = 0; j < 5u; ++j) {
+			if (values[j] != 0u || j == 0u) {
+				sums[j] += values[j];
+				++counts[j];
+			}
+		}
+	}
+
+	for (uint32_t j = 0; j < 5u; ++j)
+		if (counts[j] > 0u)
+			sums[j] /= counts[j];
+
+	average_timings->frame_number = frame_pacer->frame_number;
+	average_timings->sleep_time = sums[0];
+	average_timings->cpu_frame_time = sums[1];
+	average_timings->gpu_frame_time = sums[2];
+	average_timings->acquire_to_present_time = sums[3];
+	average_timings->present_latency = sums[4];
+}
@@ -0,0 +1,190 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanFramePacer.h"
+ *
+ * Frame pacing and latency measurement
+ *
+ * Wraps the frame manager's begin and end to measure CPU frame time,
+ * GPU frame time (through timestamp queries) and acquire-to-present
+ * latency. Before each frame the CPU sleeps until the predicted optimal
+ * start, so it neither starves the GPU nor queues frames that would only
+ * add latency. VK_GOOGLE_display_timing gives the exact present-to-
+ * display latency, VK_KHR_present_wait bounds the presents waiting to be
+ * displayed. Both are used only if their functions were loaded.
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+
+#ifndef RAW_VULKAN_FRAME_PACER_H
+#define RAW_VULKAN_FRAME_PACER_H
+
+#include <engine/vulkan/rawVulkan.h>
+#include <engine/vulkan/rawVulkanCommandAllocator.h>
+#include <engine/vulkan/rawVulkanFrame.h>
+
+#include <inttypes.h>
+#include <stdbool.h>
+
+// Frames whose timings are kept for the predictions
+#define RAW_VULKAN_MAX_FRAME_PACER_HISTORY 16u
+
+/*
+ * Timings of a single frame, in nanoseconds. Zero when not measured,
+ * GPU and display timings only become known a few frames later.
+ */
+typedef struct {
+	uint64_t frame_number;
+
+	// Pacing sleep before the frame started
+	uint64_t sleep_time;
+
+	// From the end of the pacing sleep to the present call
+	uint64_t cpu_frame_time;
+
+	// Between the timestamps of rawCmd{Begin,End}VulkanFrameTimer
+	uint64_t gpu_frame_time;
+
+	// From the image acquisition to the present call returning
+	uint64_t acquire_to_present_time;
+
+	/*
+	 * From the present call to the image reaching the display.
+	 * Exact with VK_GOOGLE_display_timing, an upper bound with
+	 * VK_KHR_present_wait, unknown otherwise.
+	 */
+	uint64_t present_latency;
+} RawVulkanFrameTimings;
+
+typedef struct {
+	uint32_t n_frames;
+
+	// Two timestamps per frame slot, VK_NULL_HANDLE if unsupported
+	VkQueryPool query_pool;
+	double timestamp_period;
+	uint64_t timestamp_mask;
+
+	// Frame timed on each slot, UINT64_MAX if none
+	uint64_t* slot_frame_numbers;
+
+	RawVulkanFrameTimings history[RAW_VULKAN_MAX_FRAME_PACER_HISTORY];
+
+	// Platform clock at each present call
+	uint64_t present_times[RAW_VULKAN_MAX_FRAME_PACER_HISTORY];
+
+	// Display refresh period, zero if unknown
+	uint64_t refresh_duration;
+
+	/*
+	 * Frames never start closer than this. Zero lets the slowest of
+	 * CPU and GPU set the pace, @refresh_duration matches the display.
+	 */
+	uint64_t min_frame_time;
+
+	uint64_t frame_number;
+	uint64_t frame_start_time;
+	uint64_t acquire_time;
+
+	// Swapchain that received the last identified present
+	VkSwapchainKHR present_swapchain;
+
+	// Chained to the present of the frame being ended
+	uint64_t present_id;
+	VkPresentIdKHR present_id_info;
+	VkPresentTimeGOOGLE present_time;
+	VkPresentTimesInfoGOOGLE present_times_info;
+} RawVulkanFramePacer;
+
+/*
+ * @queue_family_index is the family frames are submitted to, which
+ * tells the valid timestamp bits. @n_frames must match the frame
+ * manager the pacer is used with.
+ *
+ * If VK_KHR_present_wait was loaded, presents are tagged with ids, so
+ * VK_KHR_present_id and both extensions' features must be enabled too.
+ */
+bool rawCreateVulkanFramePacer(
+	VkPhysicalDevice physical_device,
+	VkDevice logical_device,
+	uint32_t queue_family_index,
+	uint32_t n_frames,
+	RawVulkanFramePacer* frame_pacer);
+
+void rawDestroyVulkanFramePacer(
+	VkDevice logical_device,
+	RawVulkanFramePacer* frame_pacer);
+
+/*
+ * Collects the timings of finished frames, sleeps until the predicted
+ * optimal start and then begins the frame like rawBeginVulkanFrame.
+ */
+bool rawBeginVulkanPacedFrame(
+	VkDevice logical_device,
+	RawVulkanFramePacer* frame_pacer,
+	RawVulkanFrameManager* frame_manager,
+	VkSwapchainKHR swapchain,
+	RawVulkanCommandAllocator* command_allocator,
+	uint32_t* image_index,
+	bool* swapchain_out_of_date);
+
+/*
+ * Ends the frame like rawEndVulkanFrame, tagging the present for
+ * the display timing and present wait extensions
+ */
+bool rawEndVulkanPacedFrame(
+	VkDevice logical_device,
+	RawVulkanFramePacer* frame_pacer,
+	RawVulkanFrameManager* frame_manager,
+	VkQueue graphics_queue,
+	VkQueue present_queue,
+	VkSwapchainKHR swapchain,
+	VkSemaphore render_finished_semaphore,
+	VkCommandBuffer const* const command_buffers,
+	uint32_t n_command_buffers,
+	bool* swapchain_out_of_date);
+
+/*
+ * GPU frame time is measured between these two. Begin must be recorded
+ * at the start of the frame's first command buffer and end at the end
+ * of its last one, both outside render passes.
+ */
+void rawCmdBeginVulkanFrameTimer(
+	RawVulkanFramePacer const* const frame_pacer,
+	RawVulkanFrameManager const* const frame_manager,
+	VkCommandBuffer command_buffer);
+
+void rawCmdEndVulkanFrameTimer(
+	RawVulkanFramePacer* frame_pacer,
+	RawVulkanFrameManager const* const frame_manager,
+	VkCommandBuffer command_buffer);
+
+// Mean of every measured timing in the history
+void rawGetVulkanFramePacerAverageTimings(
+	RawVulkanFramePacer const* const frame_pacer,
+	RawVulkanFrameTimings* average_timings);
+
+#endif // RAW_VULKAN_FRAME_PACER_H
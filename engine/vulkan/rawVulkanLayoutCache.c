@@ -0,0 +1,304 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanLayoutCache.c"
+ *
+ * Descriptor set and pipeline layout cache
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+
+#include <engine/vulkan/rawVulkanLayoutCache.h>
+#include <engine/platform/rawMemory.h>
+#include <engine/utils/rawHash.h>
+#include <engine/utils/rawLogger.h>
+
+#include <string.h>
+
+bool rawCreateVulkanLayoutCache(
+	uint32_t max_set_layouts,
+	uint32_t max_pipeline_layouts,
+	RawVulkanLayoutCache* layout_cache) {
+
+	memset(layout_cache, 0, sizeof(RawVulkanLayoutCache));
+
+	layout_cache->max_set_layouts = max_set_layouts;
+	layout_cache->max_pipeline_layouts = max_pipeline_layouts;
+
+	RAW_MEM_ALLOC(layout_cache->set_layouts,
+		(uint64_t)max_set_layouts, sizeof(RawVulkanSetLayoutEntry));
+	RAW_MEM_ALLOC(layout_cache->pipeline_layouts,
+		(uint64_t)max_pipeline_layouts, sizeof(RawVulkanPipelineLayoutEntry));
+
+	if (!layout_cache->set_layouts || !layout_cache->pipeline_layouts) {
+		RAW_LOG_ERROR("RAW_MEM_ALLOC failed on rawCreateVulkanLayoutCache!");
+		rawDestroyVulkanLayoutCache(VK_NULL_HANDLE, layout_cache);
+		return false;
+	}
+
+	return true;
+}
+
+void rawDestroyVulkanLayoutCache(
+	VkDevice logical_device,
+	RawVulkanLayoutCache* layout_cache) {
+
+	// Pipeline layouts first, they reference the set layouts
+	for (uint32_t i = 0; i < layout_cache->n_pipeline_layouts; ++i)
+		// TODO: Pass allocation callback
+		vkDestroyPipelineLayout(logical_device,
+			layout_cache->pipeline_layouts[i].pipeline_layout, RAW_NULL_PTR);
+
+	for (uint32_t i = 0; i < layout_cache->n_set_layouts; ++i)
+		// TODO: Pass allocation callback
+		vkDestroyDescriptorSetLayout(logical_device,
+			layout_cache->set_layouts[i].set_layout, RAW_NULL_PTR);
+
+	if (layout_cache->pipeline_layouts)
+		RAW_MEM_FREE(layout_cache->pipeline_layouts);
+
+	if (layout_cache->set_layouts)
+		RAW_MEM_FREE(layout_cache->set_layouts);
+
+	memset(layout_cache, 0, sizeof(RawVulkanLayoutCache));
+}
+
+bool rawGetVulkanDescriptorSetLayout(
+	VkDevice logical_device,
+	RawVulkanLayoutCache* layout_cache,
+	VkDescriptorSetLayoutBinding const* bindings,
+	uint32_t n_bindings,
+	VkDescriptorSetLayout* set_layout) {
+
+	if (n_bindings > RAW_VULKAN_MAX_REFLECTED_BINDINGS) {
+		RAW_LOG_ERROR("Too many bindings for a cached set layout!");
+		return false;
+	}
+
+	RawVulkanSetLayoutEntry key;
+	memset(&key, 0, sizeof(RawVulkanSetLayoutEntry));
+
+	// Canonical order, insertion sorted by binding number
+	for (uint32_t i = 0; i < n_bindings; ++i) {
+		uint32_t j = i;
+
+		while (j > 0u && key.bindings[j - 1u].binding > bindings[i].binding) {
+			key.bindings[j] = key.bindings[j - 1u];
+			--j;
+		}
+
+		key.bindings[j] = bindings[i];
+		key.bindings[j].pImmutableSamplers = RAW_NULL_PTR;
+	}
+
+	key.n_bindings = n_bindings;
+	key.hash = rawHashBytes(RAW_HASH_FNV1A_OFFSET_BASIS, key.bindings,
+		n_bindings * sizeof(VkDescriptorSetLayoutBinding));
+
+	for (uint32_t i = 0; i < layout_cache->n_set_layouts; ++i) {
+		RawVulkanSetLayoutEntry const* entry = &layout_cache->set_layouts[i];
+
+		if (entry->hash == key.hash && entry->n_bindings == n_bindings &&
+			memcmp(entry->bindings, key.bindings,
+				n_bindings * sizeof(VkDescriptorSetLayoutBinding)) == 0) {
+			*set_layout = entry->set_layout;
+			return true;
+		}
+	}
+
+	if (layout_cache->n_set_layouts == layout_cache->max_set_layouts) {
+		RAW_LOG_ERROR("Descriptor set layout cache is full!");
+		return false;
+	}
+
+	VkDescriptorSetLayoutCreateInfo create_info = {
+		.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = 0,
+		.bindingCount = n_bindings,
+		.pBindings = key.bindings
+	};
+
+	// TODO: Pass allocation callback
+	VkResult result = vkCreateDescriptorSetLayout(logical_device,
+		&create_info, RAW_NULL_PTR, &key.set_layout);
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("vkCreateDescriptorSetLayout failed!");
+		return false;
+	}
+
+	layout_cache->set_layouts[layout_cache->n_set_layouts++] = key;
+	*set_layout = key.set_layout;
+
+	return true;
+}
+
+bool rawGetVulkanPipelineLayout(
+	VkDevice logical_device,
+	RawVulkanLayoutCache* layout_cache,
+	RawVulkanShaderReflection const* reflections,
+	uint32_t n_reflections,
+	VkShaderStageFlags stage_mask,
+	VkDescriptorSetLayout const* external_set_layouts,
+	uint32_t n_external_set_layouts,
+	VkPipelineLayout* pipeline_layout,
+	VkDescriptorSetLayout* set_layouts,
+	uint32_t* n_set_layouts) {
+
+	RawVulkanShaderReflection reflection;
+
+	if (!rawMergeVulkanShaderReflections(
+		reflections, n_reflections, &reflection))
+		return false;
+
+	RawVulkanPipelineLayoutEntry key;
+	memset(&key, 0, sizeof(RawVulkanPipelineLayoutEntry));
+
+	if (n_external_set_layouts > RAW_VULKAN_MAX_DESCRIPTOR_SETS)
+		n_external_set_layouts = RAW_VULKAN_MAX_DESCRIPTOR_SETS;
+
+	for (uint32_t i = 0; i < reflection.n_bindings; ++i) {
+		RawVulkanReflectedBinding const* binding = &reflection.bindings[i];
+
+		if (binding->set >= RAW_VULKAN_MAX_DESCRIPTOR_SETS) {
+			RAW_LOG_ERROR("Binding %" PRIu32 " of set %" PRIu32
+				" can't be laid out!", binding->binding, binding->set);
+			return false;
+		}
+
+		bool external = binding->set < n_external_set_layouts &&
+			external_set_layouts[binding->set] != VK_NULL_HANDLE;
+
+		if (binding->descriptor_count == 0u && !external) {
+			RAW_LOG_ERROR("Runtime array %" PRIu32 " of set %" PRIu32
+				" needs an external set layout!",
+				binding->binding, binding->set);
+			return false;
+		}
+
+		if (binding->set + 1u > key.n_set_layouts)
+			key.n_set_layouts = binding->set + 1u;
+	}
+
+	for (uint32_t set = 0; set < key.n_set_layouts; ++set) {
+		if (set < n_external_set_layouts &&
+			external_set_layouts[set] != VK_NULL_HANDLE) {
+			key.set_layouts[set] = external_set_layouts[set];
+			continue;
+		}
+
+		VkDescriptorSetLayoutBinding bindings[
+			RAW_VULKAN_MAX_REFLECTED_BINDINGS];
+		uint32_t n_bindings = 0u;
+
+		for (uint32_t i = 0; i < reflection.n_bindings; ++i) {
+			RawVulkanReflectedBinding const* binding =
+				&reflection.bindings[i];
+
+			if (binding->set != set)
+				continue;
+
+			bindings[n_bindings++] = (VkDescriptorSetLayoutBinding){
+				.binding = binding->binding,
+				.descriptorType = binding->descriptor_type,
+				.descriptorCount = binding->descriptor_count,
+				.stageFlags = stage_mask ? stage_mask : binding->stage_flags,
+				.pImmutableSamplers = RAW_NULL_PTR
+			};
+		}
+
+		if (!rawGetVulkanDescriptorSetLayout(logical_device, layout_cache,
+			bindings, n_bindings, &key.set_layouts[set]))
+			return false;
+	}
+
+	if (reflection.push_constant_range.size > 0u) {
+		key.push_constant_range = reflection.push_constant_range;
+
+		if (stage_mask)
+			key.push_constant_range.stageFlags = stage_mask;
+	}
+
+	key.hash = rawHashBytes(RAW_HASH_FNV1A_OFFSET_BASIS, key.set_layouts,
+		key.n_set_layouts * sizeof(VkDescriptorSetLayout));
+	key.hash = rawHashBytes(key.hash, &key.push_constant_range,
+		sizeof(VkPushConstantRange));
+
+	if (set_layouts)
+		memcpy(set_layouts, key.set_layouts,
+			key.n_set_layouts * sizeof(VkDescriptorSetLayout));
+
+	if (n_set_layouts)
+		*n_set_layouts = key.n_set_layouts;
+
+	for (uint32_t i = 0; i < layout_cache->n_pipeline_layouts; ++i) {
+		RawVulkanPipelineLayoutEntry const* entry =
+			&layout_cache->pipeline_layouts[i];
+
+		if (entry->hash == key.hash &&
+			entry->n_set_layouts == key.n_set_layouts &&
+			memcmp(entry->set_layouts, key.set_layouts,
+				sizeof(key.set_layouts)) == 0 &&
+			memcmp(&entry->push_constant_range, &key.push_constant_range,
+				sizeof(VkPushConstantRange)) == 0) {
+			*pipeline_layout = entry->pipeline_layout;
+			return true;
+		}
+	}
+
+	if (layout_cache->n_pipeline_layouts ==
+		layout_cache->max_pipeline_layouts) {
+		RAW_LOG_ERROR("Pipeline layout cache is full!");
+		return false;
+	}
+
+	VkPipelineLayoutCreateInfo create_info = {
+		.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = 0,
+		.setLayoutCount = key.n_set_layouts,
+		.pSetLayouts = key.set_layouts,
+		.pushConstantRangeCount =
+			key.push_constant_range.size > 0u ? 1u : 0u,
+		.pPushConstantRanges = &key.push_constant_range
+	};
+
+	// TODO: Pass allocation callback
+	VkResult result = vkCreatePipelineLayout(logical_device,
+		&create_info, RAW_NULL_PTR, &key.pipeline_layout);
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("vkCreatePipelineLayout failed!");
+		return false;
+	}
+
+	layout_cache->pipeline_layouts[layout_cache->n_pipeline_layouts++] = key;
+	*pipeline_layout = key.pipeline_layout;
+
+	return true;
+}
@@ -0,0 +1,123 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanLayoutCache.h"
+ *
+ * Descriptor set and pipeline layout cache
+ *
+ * Layouts are generated from shader reflection and deduplicated by a
+ * hash of their contents, so pipelines with the same interface share
+ * layout objects. Sets a pipeline doesn't use still get an empty layout,
+ * and stage flags can be widened to a common mask: pipelines agreeing on
+ * their first sets then have compatible layouts, and switching between
+ * them doesn't disturb bound descriptor sets.
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+
+#ifndef RAW_VULKAN_LAYOUT_CACHE_H
+#define RAW_VULKAN_LAYOUT_CACHE_H
+
+#include <engine/vulkan/rawVulkan.h>
+#include <engine/vulkan/rawVulkanReflection.h>
+
+#include <inttypes.h>
+#include <stdbool.h>
+
+typedef struct {
+	uint64_t hash;
+	VkDescriptorSetLayoutBinding bindings[RAW_VULKAN_MAX_REFLECTED_BINDINGS];
+	uint32_t n_bindings;
+	VkDescriptorSetLayout set_layout;
+} RawVulkanSetLayoutEntry;
+
+typedef struct {
+	uint64_t hash;
+	VkDescriptorSetLayout set_layouts[RAW_VULKAN_MAX_DESCRIPTOR_SETS];
+	uint32_t n_set_layouts;
+	VkPushConstantRange push_constant_range;
+	VkPipelineLayout pipeline_layout;
+} RawVulkanPipelineLayoutEntry;
+
+typedef struct {
+	RawVulkanSetLayoutEntry* set_layouts;
+	uint32_t n_set_layouts;
+	uint32_t max_set_layouts;
+
+	RawVulkanPipelineLayoutEntry* pipeline_layouts;
+	uint32_t n_pipeline_layouts;
+	uint32_t max_pipeline_layouts;
+} RawVulkanLayoutCache;
+
+bool rawCreateVulkanLayoutCache(
+	uint32_t max_set_layouts,
+	uint32_t max_pipeline_layouts,
+	RawVulkanLayoutCache* layout_cache);
+
+// Destroys every layout in the cache
+void rawDestroyVulkanLayoutCache(
+	VkDevice logical_device,
+	RawVulkanLayoutCache* layout_cache);
+
+/*
+ * The set layout of @bindings, in any order, created on a miss.
+ * Immutable samplers aren't supported.
+ */
+bool rawGetVulkanDescriptorSetLayout(
+	VkDevice logical_device,
+	RawVulkanLayoutCache* layout_cache,
+	VkDescriptorSetLayoutBinding const* bindings,
+	uint32_t n_bindings,
+	VkDescriptorSetLayout* set_layout);
+
+/*
+ * The pipeline layout of the merged @reflections, created on a miss.
+ * A non zero @stage_mask replaces the reflected stage flags of every
+ * binding and of the push constant range, e.g. with
+ * VK_SHADER_STAGE_ALL_GRAPHICS to make layouts compatible across
+ * pipelines. @set_layouts, if not NULL, receives one layout per set
+ * up to the highest one used.
+ *
+ * Non null entries of @external_set_layouts, indexed by set, are used
+ * as is instead of reflecting those sets, e.g. the set layout of a
+ * RawVulkanBindlessHeap. Runtime sized arrays have no count to lay out,
+ * so they're only allowed in external sets. @external_set_layouts may
+ * be NULL if @n_external_set_layouts is 0.
+ */
+bool rawGetVulkanPipelineLayout(
+	VkDevice logical_device,
+	RawVulkanLayoutCache* layout_cache,
+	RawVulkanShaderReflection const* reflections,
+	uint32_t n_reflections,
+	VkShaderStageFlags stage_mask,
+	VkDescriptorSetLayout const* external_set_layouts,
+	uint32_t n_external_set_layouts,
+	VkPipelineLayout* pipeline_layout,
+	VkDescriptorSetLayout* set_layouts,
+	uint32_t* n_set_layouts);
+
+#endif // RAW_VULKAN_LAYOUT_CACHE_H
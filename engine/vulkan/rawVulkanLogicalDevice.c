@@ -28,7 +28,7 @@
  *
  * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
  * Created: 19/03/2020
- * Last modified: 22/04/2020
+ * Last modified: 19/10/2026
  */
 
 #include <engine/vulkan/rawVulkanLogicalDevice.h>
@@ -41,11 +41,12 @@ bool rawCreateVulkanLogicalDevice(
 	char const* const* device_extensions,
 	uint32_t n_device_extensions,
 	VkPhysicalDeviceFeatures* device_features,
+	void const* device_features_chain,
 	VkDevice* logical_device) {
 
 	VkDeviceCreateInfo device_create_info = {
 		.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,
-		.pNext = RAW_NULL_PTR,
+		.pNext = device_features_chain,
 		.flags = 0,
 		.queueCreateInfoCount = n_device_queues,
 		.pQueueCreateInfos = device_queues,
@@ -28,7 +28,7 @@
  *
  * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
  * Created: 19/03/2020
- * Last modified: 22/04/2020
+ * Last modified: 19/10/2026
  */
 
 #ifndef RAW_VULKAN_LOGICAL_DEVICE_H
@@ -52,6 +52,10 @@
  *
  *     @device_features is taken from
  *     @physical_device
+ *
+ *     @device_features_chain, if not NULL, is a chain of extension
+ *     feature structures supported by @physical_device. It's passed
+ *     as VkDeviceCreateInfo::pNext
  */
 bool rawCreateVulkanLogicalDevice(
 	VkPhysicalDevice physical_device,
@@ -60,6 +64,7 @@ bool rawCreateVulkanLogicalDevice(
 	char const* const* device_extensions,
 	uint32_t n_device_extensions,
 	VkPhysicalDeviceFeatures* device_features,
+	void const* device_features_chain,
 	VkDevice* logical_device);
 
 void rawDestroyVulkanLogicalDevice(VkDevice* logical_device);
@@ -0,0 +1,122 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanMemory.c"
+ *
+ * Vulkan device memory related functions
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+#include <engine/vulkan/rawVulkanMemory.h>
+#include <engine/utils/rawLogger.h>
+
+bool rawGetVulkanMemoryTypeIndex(
+	VkPhysicalDeviceMemoryProperties const* const memory_properties,
+	uint32_t memory_type_bits,
+	VkMemoryPropertyFlags required_properties,
+	VkMemoryPropertyFlags preferred_properties,
+	uint32_t* memory_type_index) {
+
+	VkMemoryPropertyFlags desired_properties =
+		required_properties | preferred_properties;
+
+	for (uint32_t i = 0; i < memory_properties->memoryTypeCount; ++i) {
+		if ((memory_type_bits & (1u << i)) &&
+			(memory_properties->memoryTypes[i].propertyFlags &
+			desired_properties) == desired_properties) {
+			*memory_type_index = i;
+			return true;
+		}
+	}
+
+	for (uint32_t i = 0; i < memory_properties->memoryTypeCount; ++i) {
+		if ((memory_type_bits & (1u << i)) &&
+			(memory_properties->memoryTypes[i].propertyFlags &
+			required_properties) == required_properties) {
+			*memory_type_index = i;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool rawAllocateVulkanMemory(
+	VkDevice logical_device,
+	VkPhysicalDeviceMemoryProperties const* const memory_properties,
+	VkMemoryRequirements const* const memory_requirements,
+	VkMemoryPropertyFlags required_properties,
+	VkMemoryPropertyFlags preferred_properties,
+	VkMemoryPropertyFlags* chosen_properties,
+	VkDeviceMemory* memory) {
+
+	uint32_t memory_type_index;
+
+	if (!rawGetVulkanMemoryTypeIndex(memory_properties,
+		memory_requirements->memoryTypeBits, required_properties,
+		preferred_properties, &memory_type_index)) {
+		RAW_LOG_ERROR("There is no memory type with "
+			"the required properties!");
+		return false;
+	}
+
+	VkMemoryAllocateInfo allocate_info = {
+		.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.allocationSize = memory_requirements->size,
+		.memoryTypeIndex = memory_type_index
+	};
+
+	// TODO: Pass allocation callback
+	VkResult result = vkAllocateMemory(logical_device,
+		&allocate_info, RAW_NULL_PTR, memory);
+
+	if ((result != VK_SUCCESS) || (*memory == VK_NULL_HANDLE)) {
+		RAW_LOG_ERROR("vkAllocateMemory failed!");
+		return false;
+	}
+
+	if (chosen_properties)
+		*chosen_properties = memory_properties->
+			memoryTypes[memory_type_index].propertyFlags;
+
+	return true;
+}
+
+void rawFreeVulkanMemory(
+	VkDevice logical_device,
+	VkDeviceMemory* memory) {
+
+	if (*memory) {
+		// TODO: Pass allocation callback
+		vkFreeMemory(logical_device, *memory, RAW_NULL_PTR);
+		*memory = VK_NULL_HANDLE;
+	}
+	else
+		RAW_LOG_WARNING("Attempting to free "
+			"NULL Vulkan device memory!");
+}
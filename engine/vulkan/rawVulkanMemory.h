@@ -0,0 +1,94 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanMemory.h"
+ *
+ * Vulkan device memory related functions
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+#ifndef RAW_VULKAN_MEMORY_H
+#define RAW_VULKAN_MEMORY_H
+
+#include <engine/vulkan/rawVulkan.h>
+
+#include <inttypes.h>
+#include <stdbool.h>
+
+/*
+ * If successful, an index to a memory type allowed by
+ * @memory_type_bits will be stored in parameter
+ *     @*memory_type_index
+ *
+ * Memory types with all @required_properties and all
+ * @preferred_properties are chosen first. If there is none,
+ * the first memory type with @required_properties is chosen.
+ */
+bool rawGetVulkanMemoryTypeIndex(
+	VkPhysicalDeviceMemoryProperties const* const memory_properties,
+	uint32_t memory_type_bits,
+	VkMemoryPropertyFlags required_properties,
+	VkMemoryPropertyFlags preferred_properties,
+	uint32_t* memory_type_index);
+
+/*
+ * Allocates device memory satisfying @memory_requirements.
+ * The property flags of the chosen memory type
+ * will be stored in parameter
+ *     @*chosen_properties
+ *
+ * It's the caller's responsibility to free that
+ * memory through a call to rawFreeVulkanMemory
+ */
+bool rawAllocateVulkanMemory(
+	VkDevice logical_device,
+	VkPhysicalDeviceMemoryProperties const* const memory_properties,
+	VkMemoryRequirements const* const memory_requirements,
+	VkMemoryPropertyFlags required_properties,
+	VkMemoryPropertyFlags preferred_properties,
+	VkMemoryPropertyFlags* chosen_properties,
+	VkDeviceMemory* memory);
+
+void rawFreeVulkanMemory(
+	VkDevice logical_device,
+	VkDeviceMemory* memory);
+
+/*
+ * Rounds @value up to the next multiple of @alignment.
+ * @alignment doesn't have to be a power of two.
+ */
+static inline VkDeviceSize rawAlignVulkanDeviceSize(
+	VkDeviceSize value,
+	VkDeviceSize alignment) {
+
+	if (alignment <= 1u)
+		return value;
+
+	return ((value + alignment - 1u) / alignment) * alignment;
+}
+
+#endif // RAW_VULKAN_MEMORY_H
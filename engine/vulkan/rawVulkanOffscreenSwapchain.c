@@ -0,0 +1,710 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanOffscreenSwapchain.c"
+ *
+ * Offscreen swapchain
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+
+#include <engine/vulkan/rawVulkanOffscreenSwapchain.h>
+#include <engine/vulkan/rawVulkanMemory.h>
+#include <engine/platform/rawMemory.h>
+#include <engine/utils/rawLogger.h>
+
+#include <string.h>
+
+// Bytes per texel of the color formats frames can be read back in
+static uint32_t rawGetVulkanFormatTexelSize(VkFormat format) {
+	switch (format) {
+		case VK_FORMAT_R8_UNORM:
+			return 1u;
+
+		case VK_FORMAT_R8G8_UNORM:
+			return 2u;
+
+		case VK_FORMAT_R8G8B8A8_UNORM:
+		case VK_FORMAT_R8G8B8A8_SRGB:
+		case VK_FORMAT_B8G8R8A8_UNORM:
+		case VK_FORMAT_B8G8R8A8_SRGB:
+		case VK_FORMAT_A2B10G10R10_UNORM_PACK32:
+		case VK_FORMAT_A2R10G10B10_UNORM_PACK32:
+		case VK_FORMAT_B10G11R11_UFLOAT_PACK32:
+		case VK_FORMAT_R32_SFLOAT:
+			return 4u;
+
+		case VK_FORMAT_R16G16B16A16_UNORM:
+		case VK_FORMAT_R16G16B16A16_SFLOAT:
+			return 8u;
+
+		case VK_FORMAT_R32G32B32A32_SFLOAT:
+			return 16u;
+
+		default:
+			return 0u;
+	}
+}
+
+static bool rawCreateVulkanOffscreenImage(
+	VkDevice logical_device,
+	VkPhysicalDeviceMemoryProperties const* const memory_properties,
+	RawVulkanOffscreenSwapchain* swapchain,
+	VkImageUsageFlags usage,
+	uint32_t image_index) {
+
+	VkImageCreateInfo image_create_info = {
+		.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = 0,
+		.imageType = VK_IMAGE_TYPE_2D,
+		.format = swapchain->format,
+		.extent = { swapchain->extent.width, swapchain->extent.height, 1u },
+		.mipLevels = 1u,
+		.arrayLayers = 1u,
+		.samples = VK_SAMPLE_COUNT_1_BIT,
+		.tiling = VK_IMAGE_TILING_OPTIMAL,
+		.usage = usage,
+		.sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+		.queueFamilyIndexCount = 0u,
+		.pQueueFamilyIndices = RAW_NULL_PTR,
+		.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED
+	};
+
+	// TODO: Pass allocation callback
+	VkResult result = vkCreateImage(logical_device, &image_create_info,
+		RAW_NULL_PTR, &swapchain->images[image_index]);
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("vkCreateImage failed!");
+		return false;
+	}
+
+	RawVulkanOffscreenImage* image = &swapchain->offscreen_images[image_index];
+
+	VkMemoryRequirements memory_requirements;
+
+	vkGetImageMemoryRequirements(logical_device,
+		swapchain->images[image_index], &memory_requirements);
+
+	if (!rawAllocateVulkanMemory(logical_device, memory_properties,
+		&memory_requirements, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, 0,
+		RAW_NULL_PTR, &image->memory)) {
+		RAW_LOG_ERROR("rawAllocateVulkanMemory failed!");
+		return false;
+	}
+
+	result = vkBindImageMemory(logical_device,
+		swapchain->images[image_index], image->memory, 0u);
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("vkBindImageMemory failed!");
+		return false;
+	}
+
+	// Signaled, so the first acquisition doesn't block
+	VkFenceCreateInfo fence_create_info = {
+		.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = VK_FENCE_CREATE_SIGNALED_BIT
+	};
+
+	// TODO: Pass allocation callback
+	result = vkCreateFence(logical_device, &fence_create_info,
+		RAW_NULL_PTR, &image->present_fence);
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("vkCreateFence failed!");
+		return false;
+	}
+
+	return true;
+}
+
+static bool rawCreateVulkanOffscreenReadback(
+	VkDevice logical_device,
+	VkPhysicalDeviceMemoryProperties const* const memory_properties,
+	RawVulkanOffscreenSwapchain* swapchain,
+	uint32_t image_index) {
+
+	RawVulkanOffscreenImage* image = &swapchain->offscreen_images[image_index];
+
+	VkBufferCreateInfo buffer_create_info = {
+		.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = 0,
+		.size = swapchain->readback_size,
+		.usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+		.sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+		.queueFamilyIndexCount = 0u,
+		.pQueueFamilyIndices = RAW_NULL_PTR
+	};
+
+	// TODO: Pass allocation callback
+	VkResult result = vkCreateBuffer(logical_device, &buffer_create_info,
+		RAW_NULL_PTR, &image->readback_buffer);
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("vkCreateBuffer failed!");
+		return false;
+	}
+
+	VkMemoryRequirements memory_requirements;
+
+	vkGetBufferMemoryRequirements(logical_device,
+		image->readback_buffer, &memory_requirements);
+
+	VkMemoryPropertyFlags memory_type_properties;
+
+	// Cached memory makes host reads much faster
+	if (!rawAllocateVulkanMemory(logical_device, memory_properties,
+		&memory_requirements, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT,
+		VK_MEMORY_PROPERTY_HOST_CACHED_BIT, &memory_type_properties,
+		&image->readback_memory)) {
+		RAW_LOG_ERROR("rawAllocateVulkanMemory failed!");
+		return false;
+	}
+
+	swapchain->readback_coherent = (memory_type_properties &
+		VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) != 0;
+
+	result = vkBindBufferMemory(logical_device,
+		image->readback_buffer, image->readback_memory, 0u);
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("vkBindBufferMemory failed!");
+		return false;
+	}
+
+	result = vkMapMemory(logical_device, image->readback_memory,
+		0u, VK_WHOLE_SIZE, 0, &image->readback_data);
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("vkMapMemory failed!");
+		image->readback_data = RAW_NULL_PTR;
+		return false;
+	}
+
+	VkCommandBufferAllocateInfo allocate_info = {
+		.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.commandPool = swapchain->command_pool,
+		.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+		.commandBufferCount = 1u
+	};
+
+	result = vkAllocateCommandBuffers(logical_device,
+		&allocate_info, &image->readback_command_buffer);
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("vkAllocateCommandBuffers failed!");
+		return false;
+	}
+
+	// The copy never changes, so it's recorded once and resubmitted
+	VkCommandBufferBeginInfo begin_info = {
+		.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = 0,
+		.pInheritanceInfo = RAW_NULL_PTR
+	};
+
+	result = vkBeginCommandBuffer(image->readback_command_buffer,
+		&begin_info);
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("vkBeginCommandBuffer failed!");
+		return false;
+	}
+
+	bool transition = swapchain->present_layout !=
+		VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+
+	// Presents wait on the transfer stage, covering the transition
+	VkImageMemoryBarrier image_barrier = {
+		.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+		.pNext = RAW_NULL_PTR,
+		.srcAccessMask = 0,
+		.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT,
+		.oldLayout = swapchain->present_layout,
+		.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+		.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+		.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+		.image = swapchain->images[image_index],
+		.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0u, 1u, 0u, 1u }
+	};
+
+	if (transition) {
+		vkCmdPipelineBarrier(image->readback_command_buffer,
+			VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+			0, 0u, RAW_NULL_PTR, 0u, RAW_NULL_PTR, 1u, &image_barrier);
+	}
+
+	VkBufferImageCopy region = {
+		.bufferOffset = 0u,
+		.bufferRowLength = 0u,
+		.bufferImageHeight = 0u,
+		.imageSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, 0u, 0u, 1u },
+		.imageOffset = { 0, 0, 0 },
+		.imageExtent = {
+			swapchain->extent.width, swapchain->extent.height, 1u }
+	};
+
+	vkCmdCopyImageToBuffer(image->readback_command_buffer,
+		swapchain->images[image_index],
+		VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+		image->readback_buffer, 1u, &region);
+
+	VkBufferMemoryBarrier buffer_barrier = {
+		.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+		.pNext = RAW_NULL_PTR,
+		.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+		.dstAccessMask = VK_ACCESS_HOST_READ_BIT,
+		.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+		.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+		.buffer = image->readback_buffer,
+		.offset = 0u,
+		.size = VK_WHOLE_SIZE
+	};
+
+	// Back to the layout the application expects
+	image_barrier.srcAccessMask = 0;
+	image_barrier.dstAccessMask = 0;
+	image_barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+	image_barrier.newLayout = swapchain->present_layout;
+
+	vkCmdPipelineBarrier(image->readback_command_buffer,
+		VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0,
+		0u, RAW_NULL_PTR, 1u, &buffer_barrier,
+		transition ? 1u : 0u, &image_barrier);
+
+	result = vkEndCommandBuffer(image->readback_command_buffer);
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("vkEndCommandBuffer failed!");
+		return false;
+	}
+
+	return true;
+}
+
+bool rawCreateVulkanOffscreenSwapchain(
+	VkPhysicalDevice physical_device,
+	VkDevice logical_device,
+	uint32_t queue_family_index,
+	VkQueue queue,
+	VkFormat format,
+	VkImageUsageFlags usage,
+	VkImageLayout present_layout,
+	uint32_t width,
+	uint32_t height,
+	uint32_t n_images,
+	bool enable_readback,
+	RawVulkanOffscreenSwapchain* swapchain) {
+
+	memset(swapchain, 0, sizeof(RawVulkanOffscreenSwapchain));
+
+	swapchain->queue = queue;
+	swapchain->format = format;
+	swapchain->extent = (VkExtent2D){ width, height };
+	swapchain->present_layout = present_layout;
+	swapchain->n_images = n_images;
+	swapchain->readback = enable_readback;
+
+	if (enable_readback) {
+		uint32_t texel_size = rawGetVulkanFormatTexelSize(format);
+
+		if (texel_size == 0u) {
+			RAW_LOG_ERROR("Offscreen swapchain readback "
+				"doesn't support format %d!", format);
+			return false;
+		}
+
+		swapchain->readback_row_pitch = width * texel_size;
+		swapchain->readback_size =
+			(VkDeviceSize)swapchain->readback_row_pitch * height;
+
+		usage |= VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+	}
+
+	RAW_MEM_ALLOC(swapchain->images, (uint64_t)n_images, sizeof(VkImage));
+	RAW_MEM_ALLOC(swapchain->offscreen_images,
+		(uint64_t)n_images, sizeof(RawVulkanOffscreenImage));
+	RAW_MEM_ALLOC(swapchain->pending_readbacks,
+		(uint64_t)n_images, sizeof(uint32_t));
+
+	if (!swapchain->images || !swapchain->offscreen_images ||
+		!swapchain->pending_readbacks) {
+		RAW_LOG_ERROR("RAW_MEM_ALLOC failed on "
+			"rawCreateVulkanOffscreenSwapchain!");
+		rawDestroyVulkanOffscreenSwapchain(logical_device, swapchain);
+		return false;
+	}
+
+	memset(swapchain->images, 0, n_images * sizeof(VkImage));
+	memset(swapchain->offscreen_images, 0,
+		n_images * sizeof(RawVulkanOffscreenImage));
+
+	VkPhysicalDeviceMemoryProperties memory_properties;
+	vkGetPhysicalDeviceMemoryProperties(physical_device, &memory_properties);
+
+	if (enable_readback) {
+		VkCommandPoolCreateInfo command_pool_create_info = {
+			.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+			.pNext = RAW_NULL_PTR,
+			.flags = 0,
+			.queueFamilyIndex = queue_family_index
+		};
+
+		// TODO: Pass allocation callback
+		VkResult result = vkCreateCommandPool(logical_device,
+			&command_pool_create_info, RAW_NULL_PTR,
+			&swapchain->command_pool);
+
+		if (result != VK_SUCCESS) {
+			RAW_LOG_ERROR("vkCreateCommandPool failed!");
+			rawDestroyVulkanOffscreenSwapchain(logical_device, swapchain);
+			return false;
+		}
+	}
+
+	for (uint32_t i = 0; i < n_images; ++i) {
+		if (!rawCreateVulkanOffscreenImage(logical_device,
+				&memory_properties, swapchain, usage, i) ||
+			(enable_readback && !rawCreateVulkanOffscreenReadback(
+				logical_device, &memory_properties, swapchain, i))) {
+			rawDestroyVulkanOffscreenSwapchain(logical_device, swapchain);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void rawDestroyVulkanOffscreenSwapchain(
+	VkDevice logical_device,
+	RawVulkanOffscreenSwapchain* swapchain) {
+
+	if (!swapchain->images || !swapchain->offscreen_images) {
+		if (swapchain->images)
+			RAW_MEM_FREE(swapchain->images);
+
+		if (swapchain->offscreen_images)
+			RAW_MEM_FREE(swapchain->offscreen_images);
+
+		if (swapchain->pending_readbacks)
+			RAW_MEM_FREE(swapchain->pending_readbacks);
+
+		return;
+	}
+
+	for (uint32_t i = 0; i < swapchain->n_images; ++i) {
+		RawVulkanOffscreenImage* image = &swapchain->offscreen_images[i];
+
+		if (image->present_fence != VK_NULL_HANDLE) {
+			vkWaitForFences(logical_device, 1u,
+				&image->present_fence, VK_TRUE, UINT64_MAX);
+
+			// TODO: Pass allocation callback
+			vkDestroyFence(logical_device,
+				image->present_fence, RAW_NULL_PTR);
+		}
+
+		if (image->readback_data)
+			vkUnmapMemory(logical_device, image->readback_memory);
+
+		if (image->readback_buffer != VK_NULL_HANDLE) {
+			// TODO: Pass allocation callback
+			vkDestroyBuffer(logical_device,
+				image->readback_buffer, RAW_NULL_PTR);
+		}
+
+		if (image->readback_memory != VK_NULL_HANDLE)
+			rawFreeVulkanMemory(logical_device, &image->readback_memory);
+
+		if (swapchain->images[i] != VK_NULL_HANDLE) {
+			// TODO: Pass allocation callback
+			vkDestroyImage(logical_device,
+				swapchain->images[i], RAW_NULL_PTR);
+		}
+
+		if (image->memory != VK_NULL_HANDLE)
+			rawFreeVulkanMemory(logical_device, &image->memory);
+	}
+
+	// Frees the readback command buffers as well
+	if (swapchain->command_pool != VK_NULL_HANDLE) {
+		// TODO: Pass allocation callback
+		vkDestroyCommandPool(logical_device,
+			swapchain->command_pool, RAW_NULL_PTR);
+		swapchain->command_pool = VK_NULL_HANDLE;
+	}
+
+	if (swapchain->pending_readbacks)
+		RAW_MEM_FREE(swapchain->pending_readbacks);
+
+	RAW_MEM_FREE(swapchain->offscreen_images);
+	RAW_MEM_FREE(swapchain->images);
+}
+
+bool rawAcquireNextVulkanOffscreenImage(
+	VkDevice logical_device,
+	RawVulkanOffscreenSwapchain* swapchain,
+	uint64_t timeout,
+	VkSemaphore semaphore,
+	VkFence fence,
+	uint32_t* image_index,
+	bool* image_acquired) {
+
+	*image_acquired = false;
+
+	RawVulkanOffscreenImage* image =
+		&swapchain->offscreen_images[swapchain->next_image_index];
+
+	// Images are acquired in order, so every image is held
+	if (image->acquired)
+		return true;
+
+	VkResult result = vkWaitForFences(logical_device,
+		1u, &image->present_fence, VK_TRUE, timeout);
+
+	if (result == VK_TIMEOUT)
+		return true;
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("vkWaitForFences failed!");
+		return false;
+	}
+
+	// The image is ready now, but the signal operations must be queued
+	if (semaphore != VK_NULL_HANDLE || fence != VK_NULL_HANDLE) {
+		VkSubmitInfo submit_info = {
+			.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+			.pNext = RAW_NULL_PTR,
+			.waitSemaphoreCount = 0u,
+			.pWaitSemaphores = RAW_NULL_PTR,
+			.pWaitDstStageMask = RAW_NULL_PTR,
+			.commandBufferCount = 0u,
+			.pCommandBuffers = RAW_NULL_PTR,
+			.signalSemaphoreCount = 1u,
+			.pSignalSemaphores = &semaphore
+		};
+
+		result = vkQueueSubmit(swapchain->queue,
+			semaphore != VK_NULL_HANDLE ? 1u : 0u, &submit_info, fence);
+
+		if (result != VK_SUCCESS) {
+			RAW_LOG_ERROR("vkQueueSubmit failed!");
+			return false;
+		}
+	}
+
+	image->acquired = true;
+
+	*image_index = swapchain->next_image_index;
+	*image_acquired = true;
+
+	swapchain->next_image_index =
+		(swapchain->next_image_index + 1u) % swapchain->n_images;
+
+	return true;
+}
+
+bool rawQueuePresentVulkanOffscreen(
+	VkDevice logical_device,
+	RawVulkanOffscreenSwapchain* swapchain,
+	VkSemaphore const* const wait_semaphores,
+	uint32_t n_wait_semaphores,
+	uint32_t image_index) {
+
+	if (image_index >= swapchain->n_images ||
+		!swapchain->offscreen_images[image_index].acquired) {
+		RAW_LOG_ERROR("Presenting offscreen image %d, "
+			"which wasn't acquired!", image_index);
+		return false;
+	}
+
+	if (n_wait_semaphores > RAW_VULKAN_MAX_OFFSCREEN_PRESENT_WAITS) {
+		RAW_LOG_ERROR("Too many semaphores waited by offscreen present!");
+		return false;
+	}
+
+	RawVulkanOffscreenImage* image = &swapchain->offscreen_images[image_index];
+
+	VkPipelineStageFlags wait_stages[RAW_VULKAN_MAX_OFFSCREEN_PRESENT_WAITS];
+
+	for (uint32_t i = 0; i < n_wait_semaphores; ++i) {
+		wait_stages[i] = swapchain->readback ?
+			VK_PIPELINE_STAGE_TRANSFER_BIT :
+			VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+	}
+
+	VkResult result = vkResetFences(logical_device,
+		1u, &image->present_fence);
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("vkResetFences failed!");
+		return false;
+	}
+
+	VkSubmitInfo submit_info = {
+		.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+		.pNext = RAW_NULL_PTR,
+		.waitSemaphoreCount = n_wait_semaphores,
+		.pWaitSemaphores = wait_semaphores,
+		.pWaitDstStageMask = wait_stages,
+		.commandBufferCount = swapchain->readback ? 1u : 0u,
+		.pCommandBuffers = &image->readback_command_buffer,
+		.signalSemaphoreCount = 0u,
+		.pSignalSemaphores = RAW_NULL_PTR
+	};
+
+	result = vkQueueSubmit(swapchain->queue,
+		1u, &submit_info, image->present_fence);
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("vkQueueSubmit failed!");
+
+		/*
+		 * The fence was already reset, and the next acquisition of this
+		 * image would wait on it forever. An empty submission signals it
+		 * again once the semaphores are consumed, and the image is
+		 * released unread, as if it was never acquired.
+		 */
+		submit_info.commandBufferCount = 0u;
+
+		if (vkQueueSubmit(swapchain->queue, 1u, &submit_info,
+			image->present_fence) != VK_SUCCESS)
+			RAW_LOG_ERROR("vkQueueSubmit failed!");
+
+		image->acquired = false;
+
+		return false;
+	}
+
+	image->acquired = false;
+	image->frame_number = swapchain->frame_number++;
+
+	if (!swapchain->readback)
+		return true;
+
+	/*
+	 * An unread frame of this image is about to be overwritten. Images
+	 * may be presented in any order, so it can be anywhere in the ring:
+	 * it's removed and the frames queued after it are shifted back.
+	 */
+	for (uint32_t i = 0; i < swapchain->n_pending_readbacks; ++i) {
+		uint32_t pending_readback =
+			(swapchain->first_pending_readback + i) % swapchain->n_images;
+
+		if (swapchain->pending_readbacks[pending_readback] != image_index)
+			continue;
+
+		for (uint32_t j = i + 1u; j < swapchain->n_pending_readbacks; ++j) {
+			uint32_t next_pending_readback =
+				(swapchain->first_pending_readback + j) % swapchain->n_images;
+
+			swapchain->pending_readbacks[pending_readback] =
+				swapchain->pending_readbacks[next_pending_readback];
+			pending_readback = next_pending_readback;
+		}
+
+		--swapchain->n_pending_readbacks;
+		++swapchain->n_dropped_frames;
+
+		// Each image is queued at most once
+		break;
+	}
+
+	uint32_t last_pending_readback = (swapchain->first_pending_readback +
+		swapchain->n_pending_readbacks) % swapchain->n_images;
+
+	swapchain->pending_readbacks[last_pending_readback] = image_index;
+	++swapchain->n_pending_readbacks;
+
+	return true;
+}
+
+bool rawReadVulkanOffscreenFrame(
+	VkDevice logical_device,
+	RawVulkanOffscreenSwapchain* swapchain,
+	RawVulkanOffscreenFrame* frame,
+	bool* frame_read) {
+
+	*frame_read = false;
+
+	if (!swapchain->readback || swapchain->n_pending_readbacks == 0u)
+		return true;
+
+	uint32_t image_index =
+		swapchain->pending_readbacks[swapchain->first_pending_readback];
+
+	RawVulkanOffscreenImage* image = &swapchain->offscreen_images[image_index];
+
+	VkResult result = vkGetFenceStatus(logical_device, image->present_fence);
+
+	if (result == VK_NOT_READY)
+		return true;
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("vkGetFenceStatus failed!");
+		return false;
+	}
+
+	if (!swapchain->readback_coherent) {
+		VkMappedMemoryRange memory_range = {
+			.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE,
+			.pNext = RAW_NULL_PTR,
+			.memory = image->readback_memory,
+			.offset = 0u,
+			.size = VK_WHOLE_SIZE
+		};
+
+		result = vkInvalidateMappedMemoryRanges(logical_device,
+			1u, &memory_range);
+
+		if (result != VK_SUCCESS) {
+			RAW_LOG_ERROR("vkInvalidateMappedMemoryRanges failed!");
+			return false;
+		}
+	}
+
+	frame->data = image->readback_data;
+	frame->size = swapchain->readback_size;
+	frame->row_pitch = swapchain->readback_row_pitch;
+	frame->format = swapchain->format;
+	frame->extent = swapchain->extent;
+	frame->frame_number = image->frame_number;
+
+	swapchain->first_pending_readback =
+		(swapchain->first_pending_readback + 1u) % swapchain->n_images;
+	--swapchain->n_pending_readbacks;
+
+	*frame_read = true;
+
+	return true;
+}
@@ -0,0 +1,185 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanOffscreenSwapchain.h"
+ *
+ * Offscreen swapchain
+ *
+ * A ring of offscreen images behind the same acquire and present flow
+ * as a window swapchain, so the renderer runs headless at full speed,
+ * e.g. on CI machines with a CPU implementation such as lavapipe.
+ * Optionally, every present copies the image into a persistently mapped
+ * host buffer of its own. Finished frames are polled in present order,
+ * so reading them back never stalls the GPU.
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+
+#ifndef RAW_VULKAN_OFFSCREEN_SWAPCHAIN_H
+#define RAW_VULKAN_OFFSCREEN_SWAPCHAIN_H
+
+#include <engine/vulkan/rawVulkan.h>
+
+#include <inttypes.h>
+#include <stdbool.h>
+
+// Max. semaphores waited by a single present
+#define RAW_VULKAN_MAX_OFFSCREEN_PRESENT_WAITS 8u
+
+typedef struct {
+	VkDeviceMemory memory;
+
+	// Signaled once the image's last present and readback are done
+	VkFence present_fence;
+
+	// Held by the application between acquisition and presentation
+	bool acquired;
+
+	// Pre-recorded copy into @readback_buffer, if readback is enabled
+	VkCommandBuffer readback_command_buffer;
+	VkBuffer readback_buffer;
+	VkDeviceMemory readback_memory;
+	void* readback_data;
+
+	uint64_t frame_number;
+} RawVulkanOffscreenImage;
+
+typedef struct {
+	VkQueue queue;
+	VkCommandPool command_pool;
+
+	VkFormat format;
+	VkExtent2D extent;
+
+	// Layout images are left in by the application when presented
+	VkImageLayout present_layout;
+
+	// Same layout as the images of a window swapchain
+	VkImage* images;
+	RawVulkanOffscreenImage* offscreen_images;
+	uint32_t n_images;
+
+	// Images are handed out in order
+	uint32_t next_image_index;
+	uint64_t frame_number;
+
+	bool readback;
+	bool readback_coherent;
+	VkDeviceSize readback_size;
+	uint32_t readback_row_pitch;
+
+	// Presented images whose frames weren't read yet, oldest first
+	uint32_t* pending_readbacks;
+	uint32_t first_pending_readback;
+	uint32_t n_pending_readbacks;
+
+	// Frames overwritten before being read
+	uint64_t n_dropped_frames;
+} RawVulkanOffscreenSwapchain;
+
+typedef struct {
+	// Tightly packed rows, valid until the image is presented again
+	void const* data;
+	VkDeviceSize size;
+	uint32_t row_pitch;
+
+	VkFormat format;
+	VkExtent2D extent;
+	uint64_t frame_number;
+} RawVulkanOffscreenFrame;
+
+/*
+ * Creates @n_images images of @format and @width x @height, usable as
+ * @usage. Acquisitions and presents are submitted to @queue, of family
+ * @queue_family_index.
+ *
+ * @present_layout is the layout the application leaves images in when
+ * presenting them, e.g. VK_IMAGE_LAYOUT_PRESENT_SRC_KHR to share the
+ * rendering code with a window swapchain.
+ *
+ * With @enable_readback, @format must be a color format whose texel
+ * size is known and frames are read through rawReadVulkanOffscreenFrame.
+ */
+bool rawCreateVulkanOffscreenSwapchain(
+	VkPhysicalDevice physical_device,
+	VkDevice logical_device,
+	uint32_t queue_family_index,
+	VkQueue queue,
+	VkFormat format,
+	VkImageUsageFlags usage,
+	VkImageLayout present_layout,
+	uint32_t width,
+	uint32_t height,
+	uint32_t n_images,
+	bool enable_readback,
+	RawVulkanOffscreenSwapchain* swapchain);
+
+// Waits for every present in flight before destroying the images
+void rawDestroyVulkanOffscreenSwapchain(
+	VkDevice logical_device,
+	RawVulkanOffscreenSwapchain* swapchain);
+
+/*
+ * Counterpart of vkAcquireNextImageKHR. Waits up to @timeout for the
+ * next image's previous present to finish, then signals @semaphore and
+ * @fence (both optional) through @swapchain's queue.
+ *
+ * @image_acquired is cleared if the wait timed out or every image is
+ * held by the application, in which case nothing is signaled.
+ */
+bool rawAcquireNextVulkanOffscreenImage(
+	VkDevice logical_device,
+	RawVulkanOffscreenSwapchain* swapchain,
+	uint64_t timeout,
+	VkSemaphore semaphore,
+	VkFence fence,
+	uint32_t* image_index,
+	bool* image_acquired);
+
+/*
+ * Counterpart of vkQueuePresentKHR. The image is released once
+ * @wait_semaphores are signaled, after its readback if enabled.
+ */
+bool rawQueuePresentVulkanOffscreen(
+	VkDevice logical_device,
+	RawVulkanOffscreenSwapchain* swapchain,
+	VkSemaphore const* const wait_semaphores,
+	uint32_t n_wait_semaphores,
+	uint32_t image_index);
+
+/*
+ * Stores the oldest presented frame not read yet in @frame, without
+ * blocking. @frame_read is cleared if its readback hasn't finished
+ * yet or there are no frames to read.
+ */
+bool rawReadVulkanOffscreenFrame(
+	VkDevice logical_device,
+	RawVulkanOffscreenSwapchain* swapchain,
+	RawVulkanOffscreenFrame* frame,
+	bool* frame_read);
+
+#endif // RAW_VULKAN_OFFSCREEN_SWAPCHAIN_H
@@ -0,0 +1,366 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanParallelRecorder.c"
+ *
+ * Parallel command recording
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+
+#include <engine/vulkan/rawVulkanParallelRecorder.h>
+#include <engine/platform/rawMemory.h>
+#include <engine/utils/rawLogger.h>
+
+// Chunks per recording thread, so faster threads can pick up the slack
+#define RAW_VULKAN_CHUNKS_PER_RECORDING_THREAD 4u
+
+static bool rawRecordVulkanDrawChunk(
+	RawVulkanParallelRecorder* recorder,
+	RawVulkanParallelRecordingJob* job,
+	uint32_t chunk_index,
+	uint32_t thread_index) {
+
+	VkCommandBuffer command_buffer;
+
+	if (!rawAllocateVulkanCommandBuffer(recorder->logical_device,
+		recorder->command_allocator, job->frame_index, thread_index,
+		VK_COMMAND_BUFFER_LEVEL_SECONDARY, &command_buffer)) {
+		RAW_LOG_ERROR("rawAllocateVulkanCommandBuffer failed!");
+		return false;
+	}
+
+	VkCommandBufferBeginInfo begin_info = {
+		.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT |
+			VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT,
+		.pInheritanceInfo = &job->inheritance_info
+	};
+
+	VkResult result = vkBeginCommandBuffer(command_buffer, &begin_info);
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("vkBeginCommandBuffer failed!");
+		return false;
+	}
+
+	uint32_t first_draw = chunk_index * job->n_draws_per_chunk;
+	uint32_t n_draws = job->n_draws - first_draw;
+
+	if (n_draws > job->n_draws_per_chunk)
+		n_draws = job->n_draws_per_chunk;
+
+	job->record_function(command_buffer,
+		first_draw, n_draws, thread_index, job->user_data);
+
+	result = vkEndCommandBuffer(command_buffer);
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("vkEndCommandBuffer failed!");
+		return false;
+	}
+
+	recorder->secondary_command_buffers[chunk_index] = command_buffer;
+
+	return true;
+}
+
+// Fails once every chunk of @job is claimed or @job is no longer current
+static bool rawClaimVulkanDrawChunk(
+	RawVulkanParallelRecorder* recorder,
+	RawVulkanParallelRecordingJob* job,
+	uint32_t* chunk_index) {
+
+	uint_least64_t counter = atomic_load(&recorder->next_chunk);
+
+	for (;;) {
+		if ((uint32_t)(counter >> 32u) != job->generation ||
+			(uint32_t)counter >= job->n_chunks)
+			return false;
+
+		if (atomic_compare_exchange_weak(
+			&recorder->next_chunk, &counter, counter + 1u)) {
+			*chunk_index = (uint32_t)counter;
+			return true;
+		}
+	}
+}
+
+static void rawRecordVulkanDrawChunks(
+	RawVulkanParallelRecorder* recorder,
+	RawVulkanParallelRecordingJob* job,
+	uint32_t thread_index) {
+
+	uint32_t chunk_index;
+
+	while (rawClaimVulkanDrawChunk(recorder, job, &chunk_index)) {
+		if (!rawRecordVulkanDrawChunk(
+			recorder, job, chunk_index, thread_index))
+			atomic_store(&recorder->failed, true);
+	}
+}
+
+static void rawVulkanParallelRecorderWorkerMain(void* data) {
+	RawVulkanParallelRecorderWorker* worker = data;
+	RawVulkanParallelRecorder* recorder = worker->recorder;
+
+	uint64_t job_generation = 0u;
+
+	rawPlatformLockMutex(&recorder->mutex);
+
+	for (;;) {
+		while (!recorder->quit && recorder->job_generation == job_generation)
+			rawPlatformWaitConditionVariable(
+				&recorder->job_available, &recorder->mutex);
+
+		if (recorder->quit)
+			break;
+
+		job_generation = recorder->job_generation;
+		RawVulkanParallelRecordingJob job = recorder->job;
+		++recorder->n_active_workers;
+
+		rawPlatformUnlockMutex(&recorder->mutex);
+
+		rawRecordVulkanDrawChunks(recorder, &job, worker->thread_index);
+
+		rawPlatformLockMutex(&recorder->mutex);
+
+		if (--recorder->n_active_workers == 0u)
+			rawPlatformBroadcastConditionVariable(&recorder->job_finished);
+	}
+
+	rawPlatformUnlockMutex(&recorder->mutex);
+}
+
+// Must be called with the recorder's mutex locked
+static void rawWaitVulkanParallelRecorderWorkers(
+	RawVulkanParallelRecorder* recorder) {
+	while (recorder->n_active_workers > 0u)
+		rawPlatformWaitConditionVariable(
+			&recorder->job_finished, &recorder->mutex);
+}
+
+static void rawStopVulkanParallelRecorderWorkers(
+	RawVulkanParallelRecorder* recorder,
+	uint32_t n_started_threads) {
+
+	rawPlatformLockMutex(&recorder->mutex);
+	recorder->quit = true;
+	rawPlatformBroadcastConditionVariable(&recorder->job_available);
+	rawPlatformUnlockMutex(&recorder->mutex);
+
+	for (uint32_t i = 0; i < n_started_threads; ++i)
+		rawPlatformJoinThread(&recorder->workers[i].thread);
+}
+
+static void rawFreeVulkanParallelRecorderMemory(
+	RawVulkanParallelRecorder* recorder) {
+	if (recorder->workers)
+		RAW_MEM_FREE(recorder->workers);
+
+	RAW_MEM_FREE(recorder->secondary_command_buffers);
+}
+
+bool rawCreateVulkanParallelRecorder(
+	VkDevice logical_device,
+	RawVulkanCommandAllocator* command_allocator,
+	uint32_t n_worker_threads,
+	RawVulkanParallelRecorder* recorder) {
+
+	if (command_allocator->n_threads < n_worker_threads + 1u) {
+		RAW_LOG_ERROR("Command allocator has fewer threads "
+			"than the parallel recorder needs!");
+		return false;
+	}
+
+	recorder->logical_device = logical_device;
+	recorder->command_allocator = command_allocator;
+	recorder->workers = RAW_NULL_PTR;
+	recorder->n_worker_threads = n_worker_threads;
+	recorder->job_generation = 0u;
+	recorder->n_active_workers = 0u;
+	recorder->quit = false;
+	recorder->secondary_command_buffers = RAW_NULL_PTR;
+	recorder->max_chunks =
+		(n_worker_threads + 1u) * RAW_VULKAN_CHUNKS_PER_RECORDING_THREAD;
+
+	atomic_init(&recorder->next_chunk, (uint_least64_t)0u);
+	atomic_init(&recorder->failed, false);
+
+	RAW_MEM_ALLOC(recorder->secondary_command_buffers,
+		(uint64_t)recorder->max_chunks, sizeof(VkCommandBuffer));
+
+	if (!recorder->secondary_command_buffers) {
+		RAW_LOG_ERROR("RAW_MEM_ALLOC failed on "
+			"rawCreateVulkanParallelRecorder!");
+		return false;
+	}
+
+	if (n_worker_threads > 0u) {
+		RAW_MEM_ALLOC(recorder->workers, (uint64_t)n_worker_threads,
+			sizeof(RawVulkanParallelRecorderWorker));
+
+		if (!recorder->workers) {
+			RAW_LOG_ERROR("RAW_MEM_ALLOC failed on "
+				"rawCreateVulkanParallelRecorder!");
+			rawFreeVulkanParallelRecorderMemory(recorder);
+			return false;
+		}
+	}
+
+	if (!rawPlatformCreateMutex(&recorder->mutex) ||
+		!rawPlatformCreateConditionVariable(&recorder->job_available) ||
+		!rawPlatformCreateConditionVariable(&recorder->job_finished)) {
+		RAW_LOG_ERROR("Synchronization primitive creation failed on "
+			"rawCreateVulkanParallelRecorder!");
+		rawFreeVulkanParallelRecorderMemory(recorder);
+		return false;
+	}
+
+	for (uint32_t i = 0; i < n_worker_threads; ++i) {
+		recorder->workers[i].recorder = recorder;
+		// Thread 0 is the one calling rawCmdRecordVulkanDrawsInParallel
+		recorder->workers[i].thread_index = i + 1u;
+
+		if (!rawPlatformCreateThread(&recorder->workers[i].thread,
+			rawVulkanParallelRecorderWorkerMain, &recorder->workers[i])) {
+			RAW_LOG_ERROR("rawPlatformCreateThread failed!");
+			recorder->n_worker_threads = i;
+			rawDestroyVulkanParallelRecorder(recorder);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void rawDestroyVulkanParallelRecorder(
+	RawVulkanParallelRecorder* recorder) {
+
+	if (!recorder->secondary_command_buffers) {
+		RAW_LOG_WARNING("Attempting to destroy "
+			"NULL Vulkan parallel recorder!");
+		return;
+	}
+
+	rawStopVulkanParallelRecorderWorkers(
+		recorder, recorder->n_worker_threads);
+
+	rawPlatformDestroyConditionVariable(&recorder->job_finished);
+	rawPlatformDestroyConditionVariable(&recorder->job_available);
+	rawPlatformDestroyMutex(&recorder->mutex);
+
+	rawFreeVulkanParallelRecorderMemory(recorder);
+}
+
+bool rawCmdRecordVulkanDrawsInParallel(
+	RawVulkanParallelRecorder* recorder,
+	uint32_t frame_index,
+	VkCommandBuffer primary_command_buffer,
+	VkRenderPass render_pass,
+	uint32_t subpass,
+	VkFramebuffer framebuffer,
+	uint32_t n_draws,
+	uint32_t min_draws_per_chunk,
+	RawVulkanRecordDrawsFunction record_function,
+	void* user_data) {
+
+	if (n_draws == 0u)
+		return true;
+
+	if (min_draws_per_chunk == 0u)
+		min_draws_per_chunk = 1u;
+
+	uint32_t n_chunks =
+		(n_draws + min_draws_per_chunk - 1u) / min_draws_per_chunk;
+
+	if (n_chunks > recorder->max_chunks)
+		n_chunks = recorder->max_chunks;
+
+	uint32_t n_draws_per_chunk = (n_draws + n_chunks - 1u) / n_chunks;
+
+	RawVulkanParallelRecordingJob job = {
+		.frame_index = frame_index,
+		.inheritance_info = {
+			.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO,
+			.pNext = RAW_NULL_PTR,
+			.renderPass = render_pass,
+			.subpass = subpass,
+			.framebuffer = framebuffer,
+			.occlusionQueryEnable = VK_FALSE,
+			.queryFlags = 0,
+			.pipelineStatistics = 0
+		},
+		.record_function = record_function,
+		.user_data = user_data,
+		.n_draws = n_draws,
+		.n_draws_per_chunk = n_draws_per_chunk,
+		// Rounding up the chunk size may leave trailing chunks empty
+		.n_chunks = (n_draws + n_draws_per_chunk - 1u) / n_draws_per_chunk
+	};
+
+	rawPlatformLockMutex(&recorder->mutex);
+
+	// Late workers may still be holding the previous job
+	rawWaitVulkanParallelRecorderWorkers(recorder);
+
+	/*
+	 * The job is published on every call, so a worker waking up late
+	 * either copies the current job or fails to claim its chunks
+	 */
+	job.generation = (uint32_t)++recorder->job_generation;
+	recorder->job = job;
+
+	atomic_store(&recorder->next_chunk, (uint_least64_t)job.generation << 32u);
+	atomic_store(&recorder->failed, false);
+
+	// Small draw lists aren't worth waking the workers up
+	if (job.n_chunks > 1u && recorder->n_worker_threads > 0u)
+		rawPlatformBroadcastConditionVariable(&recorder->job_available);
+
+	rawPlatformUnlockMutex(&recorder->mutex);
+
+	rawRecordVulkanDrawChunks(recorder, &job, 0u);
+
+	// Every chunk has been claimed, wait for the ones still recording
+	rawPlatformLockMutex(&recorder->mutex);
+	rawWaitVulkanParallelRecorderWorkers(recorder);
+	rawPlatformUnlockMutex(&recorder->mutex);
+
+	if (atomic_load(&recorder->failed)) {
+		RAW_LOG_ERROR("Parallel recording of secondary "
+			"command buffers failed!");
+		return false;
+	}
+
+	vkCmdExecuteCommands(primary_command_buffer,
+		job.n_chunks, recorder->secondary_command_buffers);
+
+	return true;
+}
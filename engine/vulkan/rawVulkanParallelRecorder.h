@@ -0,0 +1,155 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanParallelRecorder.h"
+ *
+ * Parallel command recording
+ *
+ * A render pass draw list is split into chunks which are recorded
+ * concurrently into secondary command buffers by a pool of worker
+ * threads, then stitched into the primary command buffer in draw order.
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+
+#ifndef RAW_VULKAN_PARALLEL_RECORDER_H
+#define RAW_VULKAN_PARALLEL_RECORDER_H
+
+#include <engine/platform/rawPlatform.h>
+#include <engine/vulkan/rawVulkan.h>
+#include <engine/vulkan/rawVulkanCommandAllocator.h>
+
+#include <inttypes.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+
+/*
+ * Records draws [@first_draw, @first_draw + @n_draws) into the
+ * already begun secondary @command_buffer. It is called concurrently
+ * from several threads, each one with a distinct @thread_index.
+ */
+typedef void (*RawVulkanRecordDrawsFunction)(
+	VkCommandBuffer command_buffer,
+	uint32_t first_draw,
+	uint32_t n_draws,
+	uint32_t thread_index,
+	void* user_data);
+
+typedef struct {
+	uint32_t frame_index;
+	VkCommandBufferInheritanceInfo inheritance_info;
+	RawVulkanRecordDrawsFunction record_function;
+	void* user_data;
+	uint32_t n_draws;
+	uint32_t n_draws_per_chunk;
+	uint32_t n_chunks;
+
+	// Low 32 bits of the recorder's job generation when published
+	uint32_t generation;
+} RawVulkanParallelRecordingJob;
+
+typedef struct RawVulkanParallelRecorder RawVulkanParallelRecorder;
+
+typedef struct {
+	RawVulkanParallelRecorder* recorder;
+	RawPlatformThread thread;
+	uint32_t thread_index;
+} RawVulkanParallelRecorderWorker;
+
+struct RawVulkanParallelRecorder {
+	VkDevice logical_device;
+	RawVulkanCommandAllocator* command_allocator;
+
+	RawVulkanParallelRecorderWorker* workers;
+	uint32_t n_worker_threads;
+
+	RawPlatformMutex mutex;
+	RawPlatformConditionVariable job_available;
+	RawPlatformConditionVariable job_finished;
+
+	RawVulkanParallelRecordingJob job;
+	uint64_t job_generation;
+	uint32_t n_active_workers;
+	bool quit;
+
+	/*
+	 * Generation of the current job in the high 32 bits, next chunk to
+	 * claim in the low ones. A thread holding an older job fails to
+	 * claim, so it can't record stale data into the current job.
+	 */
+	atomic_uint_least64_t next_chunk;
+	atomic_bool failed;
+
+	// Secondary command buffer of each chunk, in draw order
+	VkCommandBuffer* secondary_command_buffers;
+	uint32_t max_chunks;
+};
+
+/*
+ * Starts @n_worker_threads persistent recording threads.
+ * The thread calling rawCmdRecordVulkanDrawsInParallel also records,
+ * so @command_allocator must have been created with at least
+ * @n_worker_threads + 1 threads. Thread 0 is the calling thread.
+ *
+ * @command_allocator must outlive the recorder.
+ */
+bool rawCreateVulkanParallelRecorder(
+	VkDevice logical_device,
+	RawVulkanCommandAllocator* command_allocator,
+	uint32_t n_worker_threads,
+	RawVulkanParallelRecorder* recorder);
+
+void rawDestroyVulkanParallelRecorder(
+	RawVulkanParallelRecorder* recorder);
+
+/*
+ * Splits @n_draws into chunks of at least @min_draws_per_chunk,
+ * records every chunk into its own secondary command buffer through
+ * @record_function and executes them in @primary_command_buffer,
+ * preserving draw order.
+ *
+ * @primary_command_buffer must be inside @subpass of @render_pass,
+ * begun with VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS.
+ * @framebuffer may be VK_NULL_HANDLE, at a possible performance cost.
+ *
+ * Secondary command buffers come from @frame_index of the recorder's
+ * command allocator, so they are recycled together with the frame.
+ * The function returns once every chunk has been recorded.
+ */
+bool rawCmdRecordVulkanDrawsInParallel(
+	RawVulkanParallelRecorder* recorder,
+	uint32_t frame_index,
+	VkCommandBuffer primary_command_buffer,
+	VkRenderPass render_pass,
+	uint32_t subpass,
+	VkFramebuffer framebuffer,
+	uint32_t n_draws,
+	uint32_t min_draws_per_chunk,
+	RawVulkanRecordDrawsFunction record_function,
+	void* user_data);
+
+#endif // RAW_VULKAN_PARALLEL_RECORDER_H
@@ -0,0 +1,232 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanPermutation.c"
+ *
+ * Specialization constant shader permutations
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+
+#include <engine/vulkan/rawVulkanPermutation.h>
+#include <engine/platform/rawMemory.h>
+#include <engine/utils/rawLogger.h>
+
+#include <string.h>
+
+bool rawCreateVulkanShaderPermutations(
+	VkPipelineBindPoint bind_point,
+	RawVulkanPipelineState const* const base_state,
+	uint32_t max_variants,
+	RawVulkanShaderPermutations* permutations) {
+
+	memset(permutations, 0, sizeof(RawVulkanShaderPermutations));
+
+	if (base_state->n_shader_stages == 0u) {
+		RAW_LOG_ERROR("Shader permutations need at least one stage!");
+		return false;
+	}
+
+	permutations->bind_point = bind_point;
+	permutations->base_state = *base_state;
+	permutations->max_variants = max_variants;
+
+	RAW_MEM_ALLOC(permutations->variants,
+		(uint64_t)max_variants, sizeof(RawVulkanPermutationVariant));
+
+	if (!permutations->variants) {
+		RAW_LOG_ERROR("RAW_MEM_ALLOC failed on "
+			"rawCreateVulkanShaderPermutations!");
+		return false;
+	}
+
+	return true;
+}
+
+void rawDestroyVulkanShaderPermutations(
+	RawVulkanShaderPermutations* permutations) {
+
+	if (permutations->variants)
+		RAW_MEM_FREE(permutations->variants);
+
+	memset(permutations, 0, sizeof(RawVulkanShaderPermutations));
+}
+
+bool rawAddVulkanPermutationConstant(
+	RawVulkanShaderPermutations* permutations,
+	uint32_t constant_id,
+	RawVulkanPermutationOptionType type,
+	uint32_t default_value,
+	uint32_t* option_index) {
+
+	if (permutations->n_variants > 0u) {
+		RAW_LOG_ERROR("Permutation options must be added "
+			"before requesting permutations!");
+		return false;
+	}
+
+	if (permutations->n_options == RAW_VULKAN_MAX_PERMUTATION_OPTIONS) {
+		RAW_LOG_ERROR("Too many permutation options!");
+		return false;
+	}
+
+	for (uint32_t i = 0; i < permutations->n_options; ++i) {
+		if (permutations->options[i].constant_id == constant_id) {
+			RAW_LOG_ERROR("Specialization constant %" PRIu32
+				" is already a permutation option!", constant_id);
+			return false;
+		}
+	}
+
+	*option_index = permutations->n_options;
+
+	permutations->options[permutations->n_options++] =
+		(RawVulkanPermutationOption){
+			.constant_id = constant_id,
+			.type = type,
+			.default_value = default_value
+		};
+
+	return true;
+}
+
+bool rawAddVulkanPermutationToggle(
+	RawVulkanShaderPermutations* permutations,
+	uint32_t constant_id,
+	bool default_value,
+	uint32_t* option_index) {
+
+	return rawAddVulkanPermutationConstant(permutations, constant_id,
+		RAW_VULKAN_PERMUTATION_TOGGLE,
+		default_value ? VK_TRUE : VK_FALSE, option_index);
+}
+
+void rawGetDefaultVulkanPermutation(
+	RawVulkanShaderPermutations const* const permutations,
+	RawVulkanPermutation* permutation) {
+
+	memset(permutation, 0, sizeof(RawVulkanPermutation));
+
+	for (uint32_t i = 0; i < permutations->n_options; ++i)
+		permutation->values[i] = permutations->options[i].default_value;
+}
+
+void rawSetVulkanPermutationToggle(
+	RawVulkanPermutation* permutation,
+	uint32_t option_index,
+	bool value) {
+	permutation->values[option_index] = value ? VK_TRUE : VK_FALSE;
+}
+
+void rawSetVulkanPermutationUint(
+	RawVulkanPermutation* permutation,
+	uint32_t option_index,
+	uint32_t value) {
+	permutation->values[option_index] = value;
+}
+
+void rawSetVulkanPermutationFloat(
+	RawVulkanPermutation* permutation,
+	uint32_t option_index,
+	float value) {
+	memcpy(&permutation->values[option_index], &value, sizeof(float));
+}
+
+bool rawRequestVulkanPermutation(
+	RawVulkanPipelineCompiler* compiler,
+	RawVulkanShaderPermutations* permutations,
+	RawVulkanPermutation const* const permutation,
+	RawVulkanPipelineHandle* handle) {
+
+	RawVulkanPipelineState state = permutations->base_state;
+
+	for (uint32_t i = 0; i < permutations->n_options; ++i) {
+		if (!rawSetVulkanPipelineSpecializationConstant(&state,
+			permutations->options[i].constant_id,
+			&permutation->values[i], sizeof(uint32_t)))
+			return false;
+	}
+
+	uint64_t state_hash = rawHashVulkanPipelineState(&state);
+
+	// Requesting an existing variant works even when all are taken
+	for (uint32_t i = 0; i < permutations->n_variants; ++i) {
+		RawVulkanPermutationVariant const* variant =
+			&permutations->variants[i];
+
+		if (variant->state_hash != state_hash)
+			continue;
+
+		// The compiler trusts the hash, so a collision must stop here
+		if (memcmp(&variant->state, &state,
+			sizeof(RawVulkanPipelineState)) != 0) {
+			RAW_LOG_ERROR("Pipeline state hash collision!");
+			return false;
+		}
+
+		*handle = variant->handle;
+		return true;
+	}
+
+	if (permutations->n_variants == permutations->max_variants) {
+		RAW_LOG_ERROR("Too many shader permutations!");
+		return false;
+	}
+
+	RawVulkanPermutationVariant* variant =
+		&permutations->variants[permutations->n_variants];
+
+	variant->state = state;
+	variant->state_hash = state_hash;
+
+	bool result;
+
+	if (permutations->bind_point == VK_PIPELINE_BIND_POINT_GRAPHICS) {
+		rawFillVulkanGraphicsPipelineCreateInfo(
+			&variant->state, &variant->graphics_create_info);
+
+		result = rawRequestVulkanGraphicsPipeline(compiler,
+			variant->state_hash, &variant->graphics_create_info.create_info,
+			&variant->handle);
+	}
+	else {
+		rawFillVulkanComputePipelineCreateInfo(
+			&variant->state, &variant->compute_create_info);
+
+		result = rawRequestVulkanComputePipeline(compiler,
+			variant->state_hash, &variant->compute_create_info.create_info,
+			&variant->handle);
+	}
+
+	if (!result)
+		return false;
+
+	++permutations->n_variants;
+	*handle = variant->handle;
+
+	return true;
+}
@@ -0,0 +1,167 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanPermutation.h"
+ *
+ * Specialization constant shader permutations
+ *
+ * A material declares feature toggles and tuning constants, each one a
+ * specialization constant of its shaders, on top of a base pipeline
+ * state. Every combination it asks for is specialized from the same
+ * SPIR-V and compiled through the asynchronous pipeline compiler, so
+ * variants get compile time constant branches and loop counts without
+ * multiplying the shader build output.
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+
+#ifndef RAW_VULKAN_PERMUTATION_H
+#define RAW_VULKAN_PERMUTATION_H
+
+#include <engine/vulkan/rawVulkan.h>
+#include <engine/vulkan/rawVulkanPipelineCompiler.h>
+#include <engine/vulkan/rawVulkanPipelineState.h>
+
+#include <inttypes.h>
+#include <stdbool.h>
+
+#define RAW_VULKAN_MAX_PERMUTATION_OPTIONS \
+	RAW_VULKAN_MAX_PIPELINE_SPECIALIZATION_CONSTANTS
+
+typedef enum {
+	// VkBool32 feature switch
+	RAW_VULKAN_PERMUTATION_TOGGLE,
+
+	// 32 bit tuning constants, e.g. loop, sample or workgroup sizes
+	RAW_VULKAN_PERMUTATION_UINT,
+	RAW_VULKAN_PERMUTATION_INT,
+	RAW_VULKAN_PERMUTATION_FLOAT
+} RawVulkanPermutationOptionType;
+
+typedef struct {
+	uint32_t constant_id;
+	RawVulkanPermutationOptionType type;
+
+	// Bit pattern of the 32 bit value
+	uint32_t default_value;
+} RawVulkanPermutationOption;
+
+// One value per option, in the order options were added
+typedef struct {
+	uint32_t values[RAW_VULKAN_MAX_PERMUTATION_OPTIONS];
+} RawVulkanPermutation;
+
+typedef struct {
+	RawVulkanPipelineState state;
+	uint64_t state_hash;
+
+	// Pointed to by pending compiler requests, so variants never move
+	RawVulkanGraphicsPipelineCreateInfo graphics_create_info;
+	RawVulkanComputePipelineCreateInfo compute_create_info;
+
+	RawVulkanPipelineHandle handle;
+} RawVulkanPermutationVariant;
+
+typedef struct {
+	VkPipelineBindPoint bind_point;
+	RawVulkanPipelineState base_state;
+
+	RawVulkanPermutationOption options[RAW_VULKAN_MAX_PERMUTATION_OPTIONS];
+	uint32_t n_options;
+
+	RawVulkanPermutationVariant* variants;
+	uint32_t n_variants;
+	uint32_t max_variants;
+} RawVulkanShaderPermutations;
+
+/*
+ * Compute permutations use the first shader stage of @base_state, and
+ * only its layout besides. At most @max_variants distinct permutations
+ * can be requested.
+ */
+bool rawCreateVulkanShaderPermutations(
+	VkPipelineBindPoint bind_point,
+	RawVulkanPipelineState const* const base_state,
+	uint32_t max_variants,
+	RawVulkanShaderPermutations* permutations);
+
+/*
+ * Pipelines belong to the compiler. Requests still pending point into
+ * the permutations, so wait for the compiler to be idle first.
+ */
+void rawDestroyVulkanShaderPermutations(
+	RawVulkanShaderPermutations* permutations);
+
+/*
+ * Options must be added before any permutation is requested.
+ * @option_index identifies the option in RawVulkanPermutation.
+ */
+bool rawAddVulkanPermutationToggle(
+	RawVulkanShaderPermutations* permutations,
+	uint32_t constant_id,
+	bool default_value,
+	uint32_t* option_index);
+
+bool rawAddVulkanPermutationConstant(
+	RawVulkanShaderPermutations* permutations,
+	uint32_t constant_id,
+	RawVulkanPermutationOptionType type,
+	uint32_t default_value,
+	uint32_t* option_index);
+
+// Every option at its default value
+void rawGetDefaultVulkanPermutation(
+	RawVulkanShaderPermutations const* const permutations,
+	RawVulkanPermutation* permutation);
+
+void rawSetVulkanPermutationToggle(
+	RawVulkanPermutation* permutation,
+	uint32_t option_index,
+	bool value);
+
+void rawSetVulkanPermutationUint(
+	RawVulkanPermutation* permutation,
+	uint32_t option_index,
+	uint32_t value);
+
+void rawSetVulkanPermutationFloat(
+	RawVulkanPermutation* permutation,
+	uint32_t option_index,
+	float value);
+
+/*
+ * Specializes the base state with @permutation and queues it on
+ * @compiler, returning at once. Requesting a permutation again returns
+ * the same @handle, to be resolved with rawGetVulkanPipeline.
+ */
+bool rawRequestVulkanPermutation(
+	RawVulkanPipelineCompiler* compiler,
+	RawVulkanShaderPermutations* permutations,
+	RawVulkanPermutation const* const permutation,
+	RawVulkanPipelineHandle* handle);
+
+#endif // RAW_VULKAN_PERMUTATION_H
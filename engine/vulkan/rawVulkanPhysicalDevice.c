@@ -28,7 +28,7 @@
  *
  * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
  * Created: 18/03/2020
- * Last modified: 24/05/2020
+ * Last modified: 19/10/2026
  */
 
 #include <engine/vulkan/rawVulkanPhysicalDevice.h>
@@ -161,6 +161,52 @@ bool rawGetVulkanPhysicalDeviceCharacteristics(
 	return true;
 }
 
+bool rawIsVulkanPhysicalDeviceExtensionSupported(
+	VkPhysicalDevice physical_device,
+	char const* extension_name) {
+
+	uint32_t n_available_extensions;
+
+	VkResult result = vkEnumerateDeviceExtensionProperties(
+		physical_device, RAW_NULL_PTR,
+		&n_available_extensions, RAW_NULL_PTR);
+
+	if (result != VK_SUCCESS || n_available_extensions == 0u)
+		return false;
+
+	VkExtensionProperties* available_extensions = RAW_NULL_PTR;
+
+	RAW_MEM_ALLOC(available_extensions, (uint64_t)n_available_extensions,
+		sizeof(VkExtensionProperties));
+
+	if (!available_extensions) {
+		RAW_LOG_ERROR("RAW_MEM_ALLOC failed on "
+			"rawIsVulkanPhysicalDeviceExtensionSupported!");
+
+		return false;
+	}
+
+	result = vkEnumerateDeviceExtensionProperties(
+		physical_device, RAW_NULL_PTR,
+		&n_available_extensions, available_extensions);
+
+	bool supported = false;
+
+	if (result == VK_SUCCESS) {
+		for (uint32_t i = 0; i < n_available_extensions; ++i) {
+			if (strcmp(available_extensions[i].extensionName,
+				extension_name) == 0) {
+				supported = true;
+				break;
+			}
+		}
+	}
+
+	RAW_MEM_FREE(available_extensions);
+
+	return supported;
+}
+
 bool rawGetVulkanPhysicalDeviceQueueFamilyIndex(
 	VkQueueFamilyProperties const* const queue_families,
 	uint32_t n_queue_families,
@@ -179,6 +225,42 @@ bool rawGetVulkanPhysicalDeviceQueueFamilyIndex(
 	return false;
 }
 
+bool rawGetVulkanPhysicalDeviceDedicatedQueueFamilyIndex(
+	VkQueueFamilyProperties const* const queue_families,
+	uint32_t n_queue_families,
+	VkQueueFlags desired_capabilities,
+	uint32_t* queue_family_index) {
+
+	VkQueueFlags const work_capabilities = VK_QUEUE_GRAPHICS_BIT |
+		VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT;
+
+	uint32_t min_extra_capabilities = UINT32_MAX;
+
+	for (uint32_t i = 0; i < n_queue_families; ++i) {
+		if (queue_families[i].queueCount == 0u ||
+			(queue_families[i].queueFlags &
+			desired_capabilities) != desired_capabilities)
+			continue;
+
+		VkQueueFlags extra_capabilities = queue_families[i].queueFlags &
+			work_capabilities & ~desired_capabilities;
+
+		uint32_t n_extra_capabilities = 0u;
+
+		while (extra_capabilities) {
+			extra_capabilities &= extra_capabilities - 1u;
+			++n_extra_capabilities;
+		}
+
+		if (n_extra_capabilities < min_extra_capabilities) {
+			min_extra_capabilities = n_extra_capabilities;
+			*queue_family_index = i;
+		}
+	}
+
+	return min_extra_capabilities != UINT32_MAX;
+}
+
 // TODO: Improve queue selection
 // (check when its better to have one or multiple queues)
 bool rawSelectVulkanPhysicalDeviceWithDesiredCharacteristics(
@@ -330,16 +412,19 @@ bool rawSelectVulkanPhysicalDeviceWithDesiredCharacteristics(
 		for (uint32_t j = 0; j < n_desired_queue_capabilities; ++j) {
 			uint32_t queue_family_index; 
 
-			if (rawGetVulkanPhysicalDeviceQueueFamilyIndex(
+			if (rawGetVulkanPhysicalDeviceDedicatedQueueFamilyIndex(
 				queue_families, n_queue_families,
-				desired_queue_capabilities[j], &queue_family_index))
-				++n_queues_per_queue_family[queue_family_index];
+				desired_queue_capabilities[j], &queue_family_index)) {
+				if (n_queues_per_queue_family[queue_family_index] <
+					queue_families[queue_family_index].queueCount)
+					++n_queues_per_queue_family[queue_family_index];
+			}
 			else {
 				physical_device_support_desired_queues = false;
 
 				RAW_LOG_INFO(
-					"rawGetVulkanPhysicalDeviceQueueFamilyIndex failed "
-					"for physical device %d and desired queue capability "
+					"rawGetVulkanPhysicalDeviceDedicatedQueueFamilyIndex "
+					"failed for physical device %d and desired queue capability "
 					"%d!", i, j);
 
 				break;
@@ -28,7 +28,7 @@
  *
  * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
  * Created: 18/03/2020
- * Last modified: 22/04/2020
+ * Last modified: 19/10/2026
  */
 
 #ifndef RAW_VULKAN_PHYSICAL_DEVICE_H
@@ -67,6 +67,15 @@ bool rawGetVulkanPhysicalDeviceCharacteristics(
 	VkQueueFamilyProperties** queue_families,
 	uint32_t* n_queue_families);
 
+/*
+ * Returns whether @physical_device exposes the
+ * device extension @extension_name. Used to decide
+ * on optional extensions before creating the logical device.
+ */
+bool rawIsVulkanPhysicalDeviceExtensionSupported(
+	VkPhysicalDevice physical_device,
+	char const* extension_name);
+
 /*
  * If successful, an index to a queue family with
  * the desired capabilities will be stored in parameter
@@ -78,6 +87,18 @@ bool rawGetVulkanPhysicalDeviceQueueFamilyIndex(
 	VkQueueFlags desired_capabilities,
 	uint32_t* queue_family_index);
 
+/*
+ * Same as rawGetVulkanPhysicalDeviceQueueFamilyIndex, but prefers the
+ * family with the fewest graphics, compute and transfer capabilities
+ * besides the desired ones. Compute requests land on async compute
+ * families and transfer requests on DMA families, when available.
+ */
+bool rawGetVulkanPhysicalDeviceDedicatedQueueFamilyIndex(
+	VkQueueFamilyProperties const* const queue_families,
+	uint32_t n_queue_families,
+	VkQueueFlags desired_capabilities,
+	uint32_t* queue_family_index);
+
 /*
  * If successful, an index to the first physical device
  * in @available_devices that has the desired properties
@@ -89,6 +110,10 @@ bool rawGetVulkanPhysicalDeviceQueueFamilyIndex(
  * queue will be stored in parameter
  *     @*presentation_queue_family_index
  *
+ * Each desired queue capability is served by the queue family found by
+ * rawGetVulkanPhysicalDeviceDedicatedQueueFamilyIndex. Capabilities
+ * exceeding the queue count of their family share its last queue.
+ *
  * If successful, the function will allocate memory for:
  *     @*queue_priorities
  *     @*queue_create_infos
@@ -0,0 +1,240 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanPipelineCache.c"
+ *
+ * Disk-persistent pipeline cache
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+
+#include <engine/vulkan/rawVulkanPipelineCache.h>
+#include <engine/platform/rawFile.h>
+#include <engine/platform/rawMemory.h>
+#include <engine/utils/rawLogger.h>
+
+#include <string.h>
+
+static uint32_t rawReadLittleEndianU32(uint8_t const* bytes) {
+	return (uint32_t)bytes[0] | ((uint32_t)bytes[1] << 8) |
+		((uint32_t)bytes[2] << 16) | ((uint32_t)bytes[3] << 24);
+}
+
+bool rawValidateVulkanPipelineCacheHeader(
+	RawVulkanPipelineCacheStore const* const store,
+	void const* data,
+	uint64_t size) {
+
+	if (!data || size < RAW_VULKAN_PIPELINE_CACHE_HEADER_SIZE)
+		return false;
+
+	// The header is always little endian, regardless of the host
+	uint8_t const* bytes = data;
+
+	uint32_t header_size = rawReadLittleEndianU32(bytes);
+	uint32_t header_version = rawReadLittleEndianU32(bytes + 4);
+	uint32_t vendor_id = rawReadLittleEndianU32(bytes + 8);
+	uint32_t device_id = rawReadLittleEndianU32(bytes + 12);
+
+	return header_size >= RAW_VULKAN_PIPELINE_CACHE_HEADER_SIZE &&
+		header_size <= size &&
+		header_version == VK_PIPELINE_CACHE_HEADER_VERSION_ONE &&
+		vendor_id == store->vendor_id &&
+		device_id == store->device_id &&
+		memcmp(bytes + 16, store->uuid, VK_UUID_SIZE) == 0;
+}
+
+bool rawCreateVulkanPipelineCacheStore(
+	VkPhysicalDevice physical_device,
+	VkDevice logical_device,
+	char const* path,
+	uint32_t n_thread_caches,
+	RawVulkanPipelineCacheStore* store) {
+
+	memset(store, 0, sizeof(RawVulkanPipelineCacheStore));
+
+	VkPhysicalDeviceProperties properties;
+	vkGetPhysicalDeviceProperties(physical_device, &properties);
+
+	store->vendor_id = properties.vendorID;
+	store->device_id = properties.deviceID;
+	memcpy(store->uuid, properties.pipelineCacheUUID, VK_UUID_SIZE);
+
+	RawFileMapping mapping;
+	bool mapped = rawMapFile(path, &mapping);
+
+	if (mapped) {
+		store->loaded_from_disk = rawValidateVulkanPipelineCacheHeader(
+			store, mapping.data, mapping.size);
+
+		if (!store->loaded_from_disk)
+			RAW_LOG_WARNING("Ignoring incompatible pipeline cache \"%s\"",
+				path);
+	}
+
+	VkPipelineCacheCreateInfo create_info = {
+		.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = 0,
+		.initialDataSize = store->loaded_from_disk ?
+			(size_t)mapping.size : 0u,
+		.pInitialData = store->loaded_from_disk ?
+			mapping.data : RAW_NULL_PTR
+	};
+
+	// TODO: Pass allocation callback
+	VkResult result = vkCreatePipelineCache(logical_device,
+		&create_info, RAW_NULL_PTR, &store->pipeline_cache);
+
+	// Drivers may still reject data with a valid header
+	if (result != VK_SUCCESS && store->loaded_from_disk) {
+		RAW_LOG_WARNING("Driver rejected pipeline cache \"%s\"", path);
+
+		store->loaded_from_disk = false;
+		create_info.initialDataSize = 0u;
+		create_info.pInitialData = RAW_NULL_PTR;
+
+		// TODO: Pass allocation callback
+		result = vkCreatePipelineCache(logical_device,
+			&create_info, RAW_NULL_PTR, &store->pipeline_cache);
+	}
+
+	// The driver copied what it needed
+	if (mapped)
+		rawUnmapFile(&mapping);
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("vkCreatePipelineCache failed!");
+		store->pipeline_cache = VK_NULL_HANDLE;
+		return false;
+	}
+
+	if (n_thread_caches == 0u)
+		return true;
+
+	RAW_MEM_ALLOC(store->thread_caches,
+		(uint64_t)n_thread_caches, sizeof(VkPipelineCache));
+
+	if (!store->thread_caches) {
+		RAW_LOG_ERROR("RAW_MEM_ALLOC failed on "
+			"rawCreateVulkanPipelineCacheStore!");
+		rawDestroyVulkanPipelineCacheStore(logical_device, store);
+		return false;
+	}
+
+	create_info.initialDataSize = 0u;
+	create_info.pInitialData = RAW_NULL_PTR;
+
+	for (uint32_t i = 0; i < n_thread_caches; ++i) {
+		// TODO: Pass allocation callback
+		if (vkCreatePipelineCache(logical_device, &create_info,
+			RAW_NULL_PTR, &store->thread_caches[i]) != VK_SUCCESS) {
+
+			RAW_LOG_ERROR("vkCreatePipelineCache failed!");
+			rawDestroyVulkanPipelineCacheStore(logical_device, store);
+			return false;
+		}
+
+		++store->n_thread_caches;
+	}
+
+	return true;
+}
+
+void rawDestroyVulkanPipelineCacheStore(
+	VkDevice logical_device,
+	RawVulkanPipelineCacheStore* store) {
+
+	for (uint32_t i = 0; i < store->n_thread_caches; ++i)
+		// TODO: Pass allocation callback
+		vkDestroyPipelineCache(logical_device,
+			store->thread_caches[i], RAW_NULL_PTR);
+
+	if (store->thread_caches)
+		RAW_MEM_FREE(store->thread_caches);
+
+	if (store->pipeline_cache != VK_NULL_HANDLE)
+		// TODO: Pass allocation callback
+		vkDestroyPipelineCache(logical_device,
+			store->pipeline_cache, RAW_NULL_PTR);
+
+	memset(store, 0, sizeof(RawVulkanPipelineCacheStore));
+}
+
+bool rawSaveVulkanPipelineCacheStore(
+	VkDevice logical_device,
+	RawVulkanPipelineCacheStore* store,
+	char const* path) {
+
+	if (store->n_thread_caches > 0u &&
+		vkMergePipelineCaches(logical_device, store->pipeline_cache,
+			store->n_thread_caches, store->thread_caches) != VK_SUCCESS) {
+
+		RAW_LOG_ERROR("vkMergePipelineCaches failed!");
+		return false;
+	}
+
+	size_t size = 0u;
+
+	if (vkGetPipelineCacheData(logical_device, store->pipeline_cache,
+		&size, RAW_NULL_PTR) != VK_SUCCESS) {
+
+		RAW_LOG_ERROR("vkGetPipelineCacheData failed!");
+		return false;
+	}
+
+	void* data = RAW_NULL_PTR;
+
+	if (size > 0u) {
+		RAW_MEM_ALLOC(data, (uint64_t)size, sizeof(uint8_t));
+
+		if (!data) {
+			RAW_LOG_ERROR("RAW_MEM_ALLOC failed on "
+				"rawSaveVulkanPipelineCacheStore!");
+			return false;
+		}
+
+		// VK_INCOMPLETE still leaves a usable, shorter cache
+		if (vkGetPipelineCacheData(logical_device, store->pipeline_cache,
+			&size, data) < 0) {
+
+			RAW_LOG_ERROR("vkGetPipelineCacheData failed!");
+			RAW_MEM_FREE(data);
+			return false;
+		}
+	}
+
+	bool result = rawWriteFileAtomic(path, data, (uint64_t)size);
+
+	if (!result)
+		RAW_LOG_ERROR("rawWriteFileAtomic failed for \"%s\"!", path);
+
+	if (data)
+		RAW_MEM_FREE(data);
+
+	return result;
+}
@@ -0,0 +1,99 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanPipelineCache.h"
+ *
+ * Disk-persistent pipeline cache
+ *
+ * The main cache is seeded from a file mapped at device creation, once
+ * its header is validated against the running device. Worker threads
+ * compile into caches of their own, merged into the main one on save,
+ * which replaces the file atomically.
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+
+#ifndef RAW_VULKAN_PIPELINE_CACHE_H
+#define RAW_VULKAN_PIPELINE_CACHE_H
+
+#include <engine/vulkan/rawVulkan.h>
+
+#include <inttypes.h>
+#include <stdbool.h>
+
+// Size of the VK_PIPELINE_CACHE_HEADER_VERSION_ONE header
+#define RAW_VULKAN_PIPELINE_CACHE_HEADER_SIZE 32u
+
+typedef struct {
+	VkPipelineCache pipeline_cache;
+
+	// One per thread, so compilation doesn't contend on a single cache
+	VkPipelineCache* thread_caches;
+	uint32_t n_thread_caches;
+
+	// Whether the initial data came from a valid file
+	bool loaded_from_disk;
+
+	uint32_t vendor_id;
+	uint32_t device_id;
+	uint8_t uuid[VK_UUID_SIZE];
+} RawVulkanPipelineCacheStore;
+
+/*
+ * Maps @path, if it exists, and seeds the main cache with its contents.
+ * Files written by another driver or device are ignored with a warning,
+ * so a stale cache never fails device creation.
+ */
+bool rawCreateVulkanPipelineCacheStore(
+	VkPhysicalDevice physical_device,
+	VkDevice logical_device,
+	char const* path,
+	uint32_t n_thread_caches,
+	RawVulkanPipelineCacheStore* store);
+
+void rawDestroyVulkanPipelineCacheStore(
+	VkDevice logical_device,
+	RawVulkanPipelineCacheStore* store);
+
+/*
+ * Merges the thread caches into the main one and atomically writes it to
+ * @path. Must not race with compilations using the store.
+ */
+bool rawSaveVulkanPipelineCacheStore(
+	VkDevice logical_device,
+	RawVulkanPipelineCacheStore* store,
+	char const* path);
+
+/*
+ * Whether @data holds a pipeline cache header compatible with @store.
+ */
+bool rawValidateVulkanPipelineCacheHeader(
+	RawVulkanPipelineCacheStore const* const store,
+	void const* data,
+	uint64_t size);
+
+#endif // RAW_VULKAN_PIPELINE_CACHE_H
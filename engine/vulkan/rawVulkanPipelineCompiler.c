@@ -0,0 +1,381 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanPipelineCompiler.c"
+ *
+ * Asynchronous pipeline compilation
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+
+#include <engine/vulkan/rawVulkanPipelineCompiler.h>
+#include <engine/platform/rawMemory.h>
+#include <engine/utils/rawLogger.h>
+
+#include <string.h>
+
+static void rawCompileVulkanPipelineRequest(
+	RawVulkanPipelineCompiler* compiler,
+	RawVulkanPipelineRequest* request,
+	uint32_t thread_index) {
+
+	VkPipelineCache pipeline_cache =
+		compiler->cache_store->thread_caches[thread_index];
+
+	VkPipeline pipeline = VK_NULL_HANDLE;
+	VkResult result;
+
+	if (request->bind_point == VK_PIPELINE_BIND_POINT_GRAPHICS)
+		// TODO: Pass allocation callback
+		result = vkCreateGraphicsPipelines(compiler->logical_device,
+			pipeline_cache, 1u, &request->graphics_create_info,
+			RAW_NULL_PTR, &pipeline);
+	else
+		// TODO: Pass allocation callback
+		result = vkCreateComputePipelines(compiler->logical_device,
+			pipeline_cache, 1u, &request->compute_create_info,
+			RAW_NULL_PTR, &pipeline);
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("Pipeline compilation failed for state %016" PRIx64,
+			request->state_hash);
+
+		atomic_store_explicit(&request->status,
+			RAW_VULKAN_PIPELINE_FAILED, memory_order_release);
+		return;
+	}
+
+	request->pipeline = pipeline;
+
+	// Publishes the pipeline to readers of the ready flag
+	atomic_store_explicit(&request->status,
+		RAW_VULKAN_PIPELINE_READY, memory_order_release);
+}
+
+static void rawVulkanPipelineCompilerWorkerMain(void* data) {
+	RawVulkanPipelineCompilerWorker* worker = data;
+	RawVulkanPipelineCompiler* compiler = worker->compiler;
+
+	rawPlatformLockMutex(&compiler->mutex);
+
+	for (;;) {
+		while (!compiler->quit && compiler->n_queued == 0u)
+			rawPlatformWaitConditionVariable(
+				&compiler->request_available, &compiler->mutex);
+
+		if (compiler->quit)
+			break;
+
+		uint32_t request_index = compiler->queue[compiler->queue_head];
+
+		compiler->queue_head =
+			(compiler->queue_head + 1u) % compiler->max_requests;
+		--compiler->n_queued;
+
+		rawPlatformUnlockMutex(&compiler->mutex);
+
+		rawCompileVulkanPipelineRequest(compiler,
+			&compiler->requests[request_index], worker->thread_index);
+
+		rawPlatformLockMutex(&compiler->mutex);
+
+		if (--compiler->n_pending == 0u)
+			rawPlatformBroadcastConditionVariable(&compiler->idle);
+	}
+
+	rawPlatformUnlockMutex(&compiler->mutex);
+}
+
+static void rawStopVulkanPipelineCompilerWorkers(
+	RawVulkanPipelineCompiler* compiler,
+	uint32_t n_started_threads) {
+
+	rawPlatformLockMutex(&compiler->mutex);
+	compiler->quit = true;
+	rawPlatformBroadcastConditionVariable(&compiler->request_available);
+	rawPlatformUnlockMutex(&compiler->mutex);
+
+	for (uint32_t i = 0; i < n_started_threads; ++i)
+		rawPlatformJoinThread(&compiler->workers[i].thread);
+}
+
+static void rawFreeVulkanPipelineCompilerMemory(
+	RawVulkanPipelineCompiler* compiler) {
+	if (compiler->workers)
+		RAW_MEM_FREE(compiler->workers);
+
+	if (compiler->queue)
+		RAW_MEM_FREE(compiler->queue);
+
+	if (compiler->request_slots)
+		RAW_MEM_FREE(compiler->request_slots);
+
+	RAW_MEM_FREE(compiler->requests);
+}
+
+bool rawCreateVulkanPipelineCompiler(
+	VkDevice logical_device,
+	RawVulkanPipelineCacheStore* cache_store,
+	uint32_t n_worker_threads,
+	uint32_t max_pipelines,
+	RawVulkanPipelineCompiler* compiler) {
+
+	if (n_worker_threads == 0u || max_pipelines == 0u) {
+		RAW_LOG_ERROR("The pipeline compiler needs at least "
+			"one worker thread and one pipeline!");
+		return false;
+	}
+
+	if (cache_store->n_thread_caches < n_worker_threads) {
+		RAW_LOG_ERROR("Pipeline cache store has fewer thread caches "
+			"than the pipeline compiler needs!");
+		return false;
+	}
+
+	memset(compiler, 0, sizeof(RawVulkanPipelineCompiler));
+
+	compiler->logical_device = logical_device;
+	compiler->cache_store = cache_store;
+	compiler->n_worker_threads = n_worker_threads;
+	compiler->max_requests = max_pipelines;
+
+	RAW_MEM_ALLOC(compiler->requests,
+		(uint64_t)max_pipelines, sizeof(RawVulkanPipelineRequest));
+
+	if (!compiler->requests) {
+		RAW_LOG_ERROR("RAW_MEM_ALLOC failed on "
+			"rawCreateVulkanPipelineCompiler!");
+		return false;
+	}
+
+	uint32_t capacity = 1u;
+
+	while (capacity * 3u < max_pipelines * 4u)
+		capacity <<= 1u;
+
+	RAW_MEM_ALLOC(compiler->queue,
+		(uint64_t)max_pipelines, sizeof(uint32_t));
+	RAW_MEM_ALLOC(compiler->request_slots,
+		(uint64_t)capacity, sizeof(uint32_t));
+	RAW_MEM_ALLOC(compiler->workers, (uint64_t)n_worker_threads,
+		sizeof(RawVulkanPipelineCompilerWorker));
+
+	if (!compiler->queue || !compiler->request_slots || !compiler->workers) {
+		RAW_LOG_ERROR("RAW_MEM_ALLOC failed on "
+			"rawCreateVulkanPipelineCompiler!");
+		rawFreeVulkanPipelineCompilerMemory(compiler);
+		return false;
+	}
+
+	memset(compiler->request_slots, 0xff, capacity * sizeof(uint32_t));
+	compiler->capacity = capacity;
+
+	// One at a time, so the ones already created can be destroyed
+	if (!rawPlatformCreateMutex(&compiler->mutex)) {
+		RAW_LOG_ERROR("rawPlatformCreateMutex failed!");
+		rawFreeVulkanPipelineCompilerMemory(compiler);
+		return false;
+	}
+
+	if (!rawPlatformCreateConditionVariable(&compiler->request_available)) {
+		RAW_LOG_ERROR("rawPlatformCreateConditionVariable failed!");
+		rawPlatformDestroyMutex(&compiler->mutex);
+		rawFreeVulkanPipelineCompilerMemory(compiler);
+		return false;
+	}
+
+	if (!rawPlatformCreateConditionVariable(&compiler->idle)) {
+		RAW_LOG_ERROR("rawPlatformCreateConditionVariable failed!");
+		rawPlatformDestroyConditionVariable(&compiler->request_available);
+		rawPlatformDestroyMutex(&compiler->mutex);
+		rawFreeVulkanPipelineCompilerMemory(compiler);
+		return false;
+	}
+
+	for (uint32_t i = 0; i < n_worker_threads; ++i) {
+		compiler->workers[i].compiler = compiler;
+		compiler->workers[i].thread_index = i;
+
+		if (!rawPlatformCreateThread(&compiler->workers[i].thread,
+			rawVulkanPipelineCompilerWorkerMain, &compiler->workers[i])) {
+			RAW_LOG_ERROR("rawPlatformCreateThread failed!");
+			compiler->n_worker_threads = i;
+			rawDestroyVulkanPipelineCompiler(compiler);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void rawDestroyVulkanPipelineCompiler(
+	RawVulkanPipelineCompiler* compiler) {
+
+	if (!compiler->requests) {
+		RAW_LOG_WARNING("Attempting to destroy "
+			"NULL Vulkan pipeline compiler!");
+		return;
+	}
+
+	rawStopVulkanPipelineCompilerWorkers(
+		compiler, compiler->n_worker_threads);
+
+	for (uint32_t i = 0; i < compiler->n_requests; ++i) {
+		RawVulkanPipelineRequest* request = &compiler->requests[i];
+
+		if (atomic_load(&request->status) == RAW_VULKAN_PIPELINE_READY)
+			// TODO: Pass allocation callback
+			vkDestroyPipeline(compiler->logical_device,
+				request->pipeline, RAW_NULL_PTR);
+	}
+
+	rawPlatformDestroyConditionVariable(&compiler->idle);
+	rawPlatformDestroyConditionVariable(&compiler->request_available);
+	rawPlatformDestroyMutex(&compiler->mutex);
+
+	rawFreeVulkanPipelineCompilerMemory(compiler);
+	compiler->requests = RAW_NULL_PTR;
+}
+
+static bool rawQueueVulkanPipelineRequest(
+	RawVulkanPipelineCompiler* compiler,
+	uint64_t state_hash,
+	VkPipelineBindPoint bind_point,
+	VkGraphicsPipelineCreateInfo const* const graphics_create_info,
+	VkComputePipelineCreateInfo const* const compute_create_info,
+	RawVulkanPipelineHandle* handle) {
+
+	uint32_t mask = compiler->capacity - 1u;
+	uint32_t slot = (uint32_t)state_hash & mask;
+
+	rawPlatformLockMutex(&compiler->mutex);
+
+	// Never full, so an empty slot always ends the probe
+	while (compiler->request_slots[slot] != UINT32_MAX) {
+		uint32_t request_index = compiler->request_slots[slot];
+
+		if (compiler->requests[request_index].state_hash == state_hash) {
+			rawPlatformUnlockMutex(&compiler->mutex);
+			*handle = request_index;
+			return true;
+		}
+
+		slot = (slot + 1u) & mask;
+	}
+
+	if (compiler->n_requests == compiler->max_requests) {
+		rawPlatformUnlockMutex(&compiler->mutex);
+		RAW_LOG_ERROR("Pipeline compiler is full!");
+		*handle = RAW_VULKAN_INVALID_PIPELINE_HANDLE;
+		return false;
+	}
+
+	uint32_t request_index = compiler->n_requests++;
+	RawVulkanPipelineRequest* request = &compiler->requests[request_index];
+
+	compiler->request_slots[slot] = request_index;
+
+	memset(request, 0, sizeof(RawVulkanPipelineRequest));
+
+	request->state_hash = state_hash;
+	request->bind_point = bind_point;
+	request->pipeline = VK_NULL_HANDLE;
+	atomic_init(&request->status, RAW_VULKAN_PIPELINE_PENDING);
+
+	if (graphics_create_info)
+		request->graphics_create_info = *graphics_create_info;
+
+	if (compute_create_info)
+		request->compute_create_info = *compute_create_info;
+
+	uint32_t queue_tail = (compiler->queue_head + compiler->n_queued) %
+		compiler->max_requests;
+
+	compiler->queue[queue_tail] = request_index;
+	++compiler->n_queued;
+	++compiler->n_pending;
+
+	rawPlatformSignalConditionVariable(&compiler->request_available);
+	rawPlatformUnlockMutex(&compiler->mutex);
+
+	*handle = request_index;
+
+	return true;
+}
+
+bool rawRequestVulkanGraphicsPipeline(
+	RawVulkanPipelineCompiler* compiler,
+	uint64_t state_hash,
+	VkGraphicsPipelineCreateInfo const* const create_info,
+	RawVulkanPipelineHandle* handle) {
+
+	return rawQueueVulkanPipelineRequest(compiler, state_hash,
+		VK_PIPELINE_BIND_POINT_GRAPHICS, create_info, RAW_NULL_PTR, handle);
+}
+
+bool rawRequestVulkanComputePipeline(
+	RawVulkanPipelineCompiler* compiler,
+	uint64_t state_hash,
+	VkComputePipelineCreateInfo const* const create_info,
+	RawVulkanPipelineHandle* handle) {
+
+	return rawQueueVulkanPipelineRequest(compiler, state_hash,
+		VK_PIPELINE_BIND_POINT_COMPUTE, RAW_NULL_PTR, create_info, handle);
+}
+
+RawVulkanPipelineStatus rawGetVulkanPipelineStatus(
+	RawVulkanPipelineCompiler const* const compiler,
+	RawVulkanPipelineHandle handle) {
+
+	// Pairs with the release store of the compiling worker
+	return (RawVulkanPipelineStatus)atomic_load_explicit(
+		&compiler->requests[handle].status, memory_order_acquire);
+}
+
+VkPipeline rawGetVulkanPipeline(
+	RawVulkanPipelineCompiler const* const compiler,
+	RawVulkanPipelineHandle handle,
+	VkPipeline fallback) {
+
+	if (handle == RAW_VULKAN_INVALID_PIPELINE_HANDLE ||
+		rawGetVulkanPipelineStatus(compiler, handle) !=
+		RAW_VULKAN_PIPELINE_READY)
+		return fallback;
+
+	return compiler->requests[handle].pipeline;
+}
+
+void rawWaitVulkanPipelineCompilerIdle(
+	RawVulkanPipelineCompiler* compiler) {
+
+	rawPlatformLockMutex(&compiler->mutex);
+
+	while (compiler->n_pending > 0u)
+		rawPlatformWaitConditionVariable(&compiler->idle, &compiler->mutex);
+
+	rawPlatformUnlockMutex(&compiler->mutex);
+}
@@ -0,0 +1,185 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanPipelineCompiler.h"
+ *
+ * Asynchronous pipeline compilation
+ *
+ * Pipeline requests, keyed by a hash of their state, are queued and
+ * compiled by a pool of worker threads, each one into its own thread
+ * cache of a pipeline cache store. Callers get a handle at once and poll
+ * its ready flag, skipping the draw or binding a fallback pipeline until
+ * the compilation finishes, so new materials never hitch a frame.
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+
+#ifndef RAW_VULKAN_PIPELINE_COMPILER_H
+#define RAW_VULKAN_PIPELINE_COMPILER_H
+
+#include <engine/platform/rawPlatform.h>
+#include <engine/vulkan/rawVulkan.h>
+#include <engine/vulkan/rawVulkanPipelineCache.h>
+
+#include <inttypes.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+
+#define RAW_VULKAN_INVALID_PIPELINE_HANDLE UINT32_MAX
+
+typedef uint32_t RawVulkanPipelineHandle;
+
+typedef enum {
+	RAW_VULKAN_PIPELINE_PENDING,
+	RAW_VULKAN_PIPELINE_READY,
+	RAW_VULKAN_PIPELINE_FAILED
+} RawVulkanPipelineStatus;
+
+typedef struct {
+	uint64_t state_hash;
+	VkPipelineBindPoint bind_point;
+
+	// Only the one matching bind_point is used
+	VkGraphicsPipelineCreateInfo graphics_create_info;
+	VkComputePipelineCreateInfo compute_create_info;
+
+	// Written by a worker before status leaves PENDING
+	VkPipeline pipeline;
+	atomic_uint status;
+} RawVulkanPipelineRequest;
+
+typedef struct RawVulkanPipelineCompiler RawVulkanPipelineCompiler;
+
+typedef struct {
+	RawVulkanPipelineCompiler* compiler;
+	RawPlatformThread thread;
+	uint32_t thread_index;
+} RawVulkanPipelineCompilerWorker;
+
+struct RawVulkanPipelineCompiler {
+	VkDevice logical_device;
+	RawVulkanPipelineCacheStore* cache_store;
+
+	RawVulkanPipelineCompilerWorker* workers;
+	uint32_t n_worker_threads;
+
+	RawPlatformMutex mutex;
+	RawPlatformConditionVariable request_available;
+	RawPlatformConditionVariable idle;
+
+	// Handles index this array, which never moves
+	RawVulkanPipelineRequest* requests;
+	uint32_t n_requests;
+	uint32_t max_requests;
+
+	/*
+	 * Open addressing table of request indices by state hash,
+	 * UINT32_MAX marks an empty slot. The capacity is a power of two,
+	 * at least 4/3 of @max_requests.
+	 */
+	uint32_t* request_slots;
+	uint32_t capacity;
+
+	// Ring of request indices waiting for a worker
+	uint32_t* queue;
+	uint32_t queue_head;
+	uint32_t n_queued;
+
+	// Queued plus being compiled
+	uint32_t n_pending;
+	bool quit;
+};
+
+/*
+ * Starts @n_worker_threads compilation threads. Worker i compiles into
+ * @cache_store's thread cache i, so the store must have at least
+ * @n_worker_threads of them; they are merged when the store is saved.
+ * @cache_store must outlive the compiler.
+ *
+ * At most @max_pipelines distinct states can be requested.
+ */
+bool rawCreateVulkanPipelineCompiler(
+	VkDevice logical_device,
+	RawVulkanPipelineCacheStore* cache_store,
+	uint32_t n_worker_threads,
+	uint32_t max_pipelines,
+	RawVulkanPipelineCompiler* compiler);
+
+/*
+ * Requests not yet compiled are dropped. Compiled pipelines are
+ * destroyed, so the device must not be using them anymore.
+ */
+void rawDestroyVulkanPipelineCompiler(
+	RawVulkanPipelineCompiler* compiler);
+
+/*
+ * Queues the compilation of @create_info, identified by @state_hash,
+ * and returns its @handle immediately. Requesting a hash again returns
+ * the existing handle without compiling anything.
+ *
+ * Only the hash is compared, as @create_info holds pointers which
+ * differ between equal states. The caller must guarantee distinct
+ * states never share a hash, e.g. by comparing the states themselves
+ * as RawVulkanShaderPermutations does before requesting.
+ *
+ * @create_info is copied, but everything it points to must stay valid
+ * until the request is no longer pending.
+ */
+bool rawRequestVulkanGraphicsPipeline(
+	RawVulkanPipelineCompiler* compiler,
+	uint64_t state_hash,
+	VkGraphicsPipelineCreateInfo const* const create_info,
+	RawVulkanPipelineHandle* handle);
+
+bool rawRequestVulkanComputePipeline(
+	RawVulkanPipelineCompiler* compiler,
+	uint64_t state_hash,
+	VkComputePipelineCreateInfo const* const create_info,
+	RawVulkanPipelineHandle* handle);
+
+/*
+ * Never blocks. Safe to call while workers are compiling.
+ */
+RawVulkanPipelineStatus rawGetVulkanPipelineStatus(
+	RawVulkanPipelineCompiler const* const compiler,
+	RawVulkanPipelineHandle handle);
+
+/*
+ * The compiled pipeline of @handle, or @fallback while it is pending or
+ * if it failed. A VK_NULL_HANDLE @fallback tells the caller to skip the
+ * draw. Never blocks.
+ */
+VkPipeline rawGetVulkanPipeline(
+	RawVulkanPipelineCompiler const* const compiler,
+	RawVulkanPipelineHandle handle,
+	VkPipeline fallback);
+
+// Blocks until every request made so far is no longer pending
+void rawWaitVulkanPipelineCompilerIdle(
+	RawVulkanPipelineCompiler* compiler);
+
+#endif // RAW_VULKAN_PIPELINE_COMPILER_H
@@ -0,0 +1,462 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanPipelineState.c"
+ *
+ * Canonical graphics pipeline state
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+
+#include <engine/vulkan/rawVulkanPipelineState.h>
+#include <engine/platform/rawMemory.h>
+#include <engine/utils/rawHash.h>
+#include <engine/utils/rawLogger.h>
+
+#include <string.h>
+
+void rawInitVulkanPipelineState(RawVulkanPipelineState* state) {
+	memset(state, 0, sizeof(RawVulkanPipelineState));
+
+	state->topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+	state->polygon_mode = VK_POLYGON_MODE_FILL;
+	state->cull_mode = VK_CULL_MODE_BACK_BIT;
+	state->front_face = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+	state->line_width = 1.0f;
+	state->samples = VK_SAMPLE_COUNT_1_BIT;
+	state->depth_test_enable = VK_TRUE;
+	state->depth_write_enable = VK_TRUE;
+	state->depth_compare_op = VK_COMPARE_OP_LESS;
+}
+
+bool rawAddVulkanPipelineShaderStage(
+	RawVulkanPipelineState* state,
+	VkShaderStageFlagBits stage,
+	VkShaderModule module,
+	char const* entry_point) {
+
+	if (state->n_shader_stages == RAW_VULKAN_MAX_PIPELINE_SHADER_STAGES ||
+		strlen(entry_point) >= RAW_VULKAN_MAX_PIPELINE_ENTRY_POINT_NAME_SIZE) {
+		RAW_LOG_ERROR("Shader stage doesn't fit the pipeline state!");
+		return false;
+	}
+
+	RawVulkanPipelineShaderStage* shader_stage =
+		&state->shader_stages[state->n_shader_stages++];
+
+	shader_stage->stage = stage;
+	shader_stage->module = module;
+	strcpy(shader_stage->entry_point, entry_point);
+
+	return true;
+}
+
+bool rawSetVulkanPipelineSpecializationConstant(
+	RawVulkanPipelineState* state,
+	uint32_t constant_id,
+	void const* data,
+	uint32_t size) {
+
+	uint32_t index = 0u;
+
+	while (index < state->n_specialization_constants &&
+		state->specialization_constants[index].constantID < constant_id)
+		++index;
+
+	VkSpecializationMapEntry* constants = state->specialization_constants;
+
+	if (index < state->n_specialization_constants &&
+		constants[index].constantID == constant_id) {
+
+		if (constants[index].size != size) {
+			RAW_LOG_ERROR("Specialization constant %" PRIu32
+				" changed size!", constant_id);
+			return false;
+		}
+
+		memcpy(state->specialization_data + constants[index].offset,
+			data, size);
+
+		return true;
+	}
+
+	if (state->n_specialization_constants ==
+		RAW_VULKAN_MAX_PIPELINE_SPECIALIZATION_CONSTANTS ||
+		state->specialization_data_size + size >
+		RAW_VULKAN_MAX_PIPELINE_SPECIALIZATION_DATA_SIZE) {
+		RAW_LOG_ERROR("Specialization constant doesn't fit "
+			"the pipeline state!");
+		return false;
+	}
+
+	// Data is laid out in id order too, so it is canonical as well
+	uint32_t offset = index < state->n_specialization_constants ?
+		constants[index].offset : state->specialization_data_size;
+
+	memmove(state->specialization_data + offset + size,
+		state->specialization_data + offset,
+		state->specialization_data_size - offset);
+
+	for (uint32_t i = index; i < state->n_specialization_constants; ++i)
+		constants[i].offset += size;
+
+	memmove(constants + index + 1u, constants + index,
+		(state->n_specialization_constants - index) *
+		sizeof(VkSpecializationMapEntry));
+
+	constants[index].constantID = constant_id;
+	constants[index].offset = offset;
+	constants[index].size = size;
+
+	memcpy(state->specialization_data + offset, data, size);
+
+	state->specialization_data_size += size;
+	++state->n_specialization_constants;
+
+	return true;
+}
+
+uint64_t rawHashVulkanPipelineState(
+	RawVulkanPipelineState const* const state) {
+	return rawHashBytes(RAW_HASH_FNV1A_OFFSET_BASIS,
+		state, sizeof(RawVulkanPipelineState));
+}
+
+void rawFillVulkanGraphicsPipelineCreateInfo(
+	RawVulkanPipelineState const* const state,
+	RawVulkanGraphicsPipelineCreateInfo* create_info) {
+
+	memset(create_info, 0, sizeof(RawVulkanGraphicsPipelineCreateInfo));
+
+	create_info->specialization_info =
+		(VkSpecializationInfo){
+			.mapEntryCount = state->n_specialization_constants,
+			.pMapEntries = state->specialization_constants,
+			.dataSize = state->specialization_data_size,
+			.pData = state->specialization_data
+		};
+
+	for (uint32_t i = 0; i < state->n_shader_stages; ++i) {
+		create_info->shader_stages[i] = (VkPipelineShaderStageCreateInfo){
+			.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
+			.pNext = RAW_NULL_PTR,
+			.flags = 0,
+			.stage = state->shader_stages[i].stage,
+			.module = state->shader_stages[i].module,
+			.pName = state->shader_stages[i].entry_point,
+			.pSpecializationInfo = state->n_specialization_constants > 0u ?
+				&create_info->specialization_info : RAW_NULL_PTR
+		};
+	}
+
+	create_info->vertex_input_state = (VkPipelineVertexInputStateCreateInfo){
+		.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = 0,
+		.vertexBindingDescriptionCount = state->n_vertex_bindings,
+		.pVertexBindingDescriptions = state->vertex_bindings,
+		.vertexAttributeDescriptionCount = state->n_vertex_attributes,
+		.pVertexAttributeDescriptions = state->vertex_attributes
+	};
+
+	create_info->input_assembly_state =
+		(VkPipelineInputAssemblyStateCreateInfo){
+			.sType =
+				VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO,
+			.pNext = RAW_NULL_PTR,
+			.flags = 0,
+			.topology = state->topology,
+			.primitiveRestartEnable = state->primitive_restart_enable
+		};
+
+	create_info->viewport_state = (VkPipelineViewportStateCreateInfo){
+		.sType = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = 0,
+		.viewportCount = 1u,
+		.pViewports = RAW_NULL_PTR,
+		.scissorCount = 1u,
+		.pScissors = RAW_NULL_PTR
+	};
+
+	create_info->rasterization_state =
+		(VkPipelineRasterizationStateCreateInfo){
+			.sType =
+				VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO,
+			.pNext = RAW_NULL_PTR,
+			.flags = 0,
+			.depthClampEnable = VK_FALSE,
+			.rasterizerDiscardEnable = VK_FALSE,
+			.polygonMode = state->polygon_mode,
+			.cullMode = state->cull_mode,
+			.frontFace = state->front_face,
+			.depthBiasEnable = state->depth_bias_enable,
+			.depthBiasConstantFactor = state->depth_bias_constant_factor,
+			.depthBiasClamp = 0.0f,
+			.depthBiasSlopeFactor = state->depth_bias_slope_factor,
+			.lineWidth = state->line_width
+		};
+
+	create_info->multisample_state = (VkPipelineMultisampleStateCreateInfo){
+		.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = 0,
+		.rasterizationSamples = state->samples,
+		.sampleShadingEnable = VK_FALSE,
+		.minSampleShading = 1.0f,
+		.pSampleMask = RAW_NULL_PTR,
+		.alphaToCoverageEnable = VK_FALSE,
+		.alphaToOneEnable = VK_FALSE
+	};
+
+	create_info->depth_stencil_state =
+		(VkPipelineDepthStencilStateCreateInfo){
+			.sType =
+				VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO,
+			.pNext = RAW_NULL_PTR,
+			.flags = 0,
+			.depthTestEnable = state->depth_test_enable,
+			.depthWriteEnable = state->depth_write_enable,
+			.depthCompareOp = state->depth_compare_op,
+			.depthBoundsTestEnable = VK_FALSE,
+			.stencilTestEnable = state->stencil_test_enable,
+			.front = state->stencil_front,
+			.back = state->stencil_back,
+			.minDepthBounds = 0.0f,
+			.maxDepthBounds = 1.0f
+		};
+
+	create_info->color_blend_state = (VkPipelineColorBlendStateCreateInfo){
+		.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = 0,
+		.logicOpEnable = VK_FALSE,
+		.logicOp = VK_LOGIC_OP_COPY,
+		.attachmentCount = state->n_color_attachments,
+		.pAttachments = state->color_attachments,
+		.blendConstants = { 0.0f, 0.0f, 0.0f, 0.0f }
+	};
+
+	create_info->dynamic_states[0] = VK_DYNAMIC_STATE_VIEWPORT;
+	create_info->dynamic_states[1] = VK_DYNAMIC_STATE_SCISSOR;
+
+	create_info->dynamic_state = (VkPipelineDynamicStateCreateInfo){
+		.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = 0,
+		.dynamicStateCount = 2u,
+		.pDynamicStates = create_info->dynamic_states
+	};
+
+	create_info->create_info = (VkGraphicsPipelineCreateInfo){
+		.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = 0,
+		.stageCount = state->n_shader_stages,
+		.pStages = create_info->shader_stages,
+		.pVertexInputState = &create_info->vertex_input_state,
+		.pInputAssemblyState = &create_info->input_assembly_state,
+		.pTessellationState = RAW_NULL_PTR,
+		.pViewportState = &create_info->viewport_state,
+		.pRasterizationState = &create_info->rasterization_state,
+		.pMultisampleState = &create_info->multisample_state,
+		.pDepthStencilState = &create_info->depth_stencil_state,
+		.pColorBlendState = &create_info->color_blend_state,
+		.pDynamicState = &create_info->dynamic_state,
+		.layout = state->layout,
+		.renderPass = state->render_pass,
+		.subpass = state->subpass,
+		.basePipelineHandle = VK_NULL_HANDLE,
+		.basePipelineIndex = -1
+	};
+}
+
+void rawFillVulkanComputePipelineCreateInfo(
+	RawVulkanPipelineState const* const state,
+	RawVulkanComputePipelineCreateInfo* create_info) {
+
+	memset(create_info, 0, sizeof(RawVulkanComputePipelineCreateInfo));
+
+	create_info->specialization_info =
+		(VkSpecializationInfo){
+			.mapEntryCount = state->n_specialization_constants,
+			.pMapEntries = state->specialization_constants,
+			.dataSize = state->specialization_data_size,
+			.pData = state->specialization_data
+		};
+
+	create_info->create_info = (VkComputePipelineCreateInfo){
+		.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = 0,
+		.stage = {
+			.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
+			.pNext = RAW_NULL_PTR,
+			.flags = 0,
+			.stage = VK_SHADER_STAGE_COMPUTE_BIT,
+			.module = state->shader_stages[0].module,
+			.pName = state->shader_stages[0].entry_point,
+			.pSpecializationInfo = state->n_specialization_constants > 0u ?
+				&create_info->specialization_info : RAW_NULL_PTR
+		},
+		.layout = state->layout,
+		.basePipelineHandle = VK_NULL_HANDLE,
+		.basePipelineIndex = -1
+	};
+}
+
+bool rawCreateVulkanPipelineMap(
+	uint32_t max_pipelines,
+	RawVulkanPipelineMap* pipeline_map) {
+
+	memset(pipeline_map, 0, sizeof(RawVulkanPipelineMap));
+
+	// Power of two, so probing wraps with a mask
+	uint32_t capacity = 16u;
+
+	while (capacity / 4u * 3u < max_pipelines)
+		capacity *= 2u;
+
+	pipeline_map->capacity = capacity;
+
+	RAW_MEM_ALLOC(pipeline_map->entries,
+		(uint64_t)capacity, sizeof(RawVulkanPipelineMapEntry));
+
+	if (!pipeline_map->entries) {
+		RAW_LOG_ERROR("RAW_MEM_ALLOC failed on rawCreateVulkanPipelineMap!");
+		return false;
+	}
+
+	memset(pipeline_map->entries, 0,
+		capacity * sizeof(RawVulkanPipelineMapEntry));
+
+	RAW_MEM_ALLOC(pipeline_map->states,
+		(uint64_t)capacity, sizeof(RawVulkanPipelineState));
+
+	if (!pipeline_map->states) {
+		RAW_LOG_ERROR("RAW_MEM_ALLOC failed on rawCreateVulkanPipelineMap!");
+		rawDestroyVulkanPipelineMap(VK_NULL_HANDLE, pipeline_map);
+		return false;
+	}
+
+	return true;
+}
+
+void rawDestroyVulkanPipelineMap(
+	VkDevice logical_device,
+	RawVulkanPipelineMap* pipeline_map) {
+
+	if (pipeline_map->entries) {
+		for (uint32_t i = 0; i < pipeline_map->capacity; ++i) {
+			if (pipeline_map->entries[i].pipeline != VK_NULL_HANDLE)
+				// TODO: Pass allocation callback
+				vkDestroyPipeline(logical_device,
+					pipeline_map->entries[i].pipeline, RAW_NULL_PTR);
+		}
+
+		RAW_MEM_FREE(pipeline_map->entries);
+	}
+
+	if (pipeline_map->states)
+		RAW_MEM_FREE(pipeline_map->states);
+
+	memset(pipeline_map, 0, sizeof(RawVulkanPipelineMap));
+}
+
+// Slot holding @state_hash, or the empty slot where it would go
+static uint32_t rawProbeVulkanPipelineMap(
+	RawVulkanPipelineMap const* const pipeline_map,
+	uint64_t state_hash) {
+
+	uint32_t mask = pipeline_map->capacity - 1u;
+	uint32_t slot = (uint32_t)state_hash & mask;
+
+	// Never full, so an empty slot always ends the probe
+	while (pipeline_map->entries[slot].pipeline != VK_NULL_HANDLE &&
+		pipeline_map->entries[slot].state_hash != state_hash)
+		slot = (slot + 1u) & mask;
+
+	return slot;
+}
+
+VkPipeline rawFindVulkanPipeline(
+	RawVulkanPipelineMap const* const pipeline_map,
+	uint64_t state_hash) {
+
+	return pipeline_map->entries[
+		rawProbeVulkanPipelineMap(pipeline_map, state_hash)].pipeline;
+}
+
+bool rawGetVulkanGraphicsPipeline(
+	VkDevice logical_device,
+	RawVulkanPipelineMap* pipeline_map,
+	VkPipelineCache pipeline_cache,
+	RawVulkanPipelineState const* const state,
+	uint64_t state_hash,
+	VkPipeline* pipeline) {
+
+	uint32_t slot = rawProbeVulkanPipelineMap(pipeline_map, state_hash);
+	RawVulkanPipelineMapEntry* entry = &pipeline_map->entries[slot];
+
+	if (entry->pipeline != VK_NULL_HANDLE) {
+		if (memcmp(&pipeline_map->states[slot], state,
+			sizeof(RawVulkanPipelineState)) != 0) {
+			RAW_LOG_ERROR("Pipeline state hash collision!");
+			return false;
+		}
+
+		*pipeline = entry->pipeline;
+		return true;
+	}
+
+	if ((pipeline_map->n_pipelines + 1u) * 4u > pipeline_map->capacity * 3u) {
+		RAW_LOG_ERROR("Pipeline map is full!");
+		return false;
+	}
+
+	RawVulkanGraphicsPipelineCreateInfo create_info;
+	rawFillVulkanGraphicsPipelineCreateInfo(state, &create_info);
+
+	// TODO: Pass allocation callback
+	VkResult result = vkCreateGraphicsPipelines(logical_device,
+		pipeline_cache, 1u, &create_info.create_info,
+		RAW_NULL_PTR, &entry->pipeline);
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("vkCreateGraphicsPipelines failed!");
+		entry->pipeline = VK_NULL_HANDLE;
+		return false;
+	}
+
+	entry->state_hash = state_hash;
+	pipeline_map->states[slot] = *state;
+	++pipeline_map->n_pipelines;
+
+	*pipeline = entry->pipeline;
+
+	return true;
+}
@@ -0,0 +1,230 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanPipelineState.h"
+ *
+ * Canonical graphics pipeline state
+ *
+ * Everything that makes graphics pipelines different, in one flat struct
+ * without pointers, so it can be hashed and compared bytewise. Identical
+ * states across materials resolve to a single VkPipeline through an
+ * open addressing map, which the draw loop probes by hash in O(1).
+ *
+ * Viewport and scissor are always dynamic.
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+
+#ifndef RAW_VULKAN_PIPELINE_STATE_H
+#define RAW_VULKAN_PIPELINE_STATE_H
+
+#include <engine/vulkan/rawVulkan.h>
+
+#include <inttypes.h>
+#include <stdbool.h>
+
+#define RAW_VULKAN_MAX_PIPELINE_SHADER_STAGES 5u
+#define RAW_VULKAN_MAX_PIPELINE_ENTRY_POINT_NAME_SIZE 32u
+#define RAW_VULKAN_MAX_PIPELINE_VERTEX_BINDINGS 8u
+#define RAW_VULKAN_MAX_PIPELINE_VERTEX_ATTRIBUTES 16u
+#define RAW_VULKAN_MAX_PIPELINE_COLOR_ATTACHMENTS 8u
+#define RAW_VULKAN_MAX_PIPELINE_SPECIALIZATION_CONSTANTS 16u
+#define RAW_VULKAN_MAX_PIPELINE_SPECIALIZATION_DATA_SIZE 128u
+
+typedef struct {
+	VkShaderStageFlagBits stage;
+	VkShaderModule module;
+	char entry_point[RAW_VULKAN_MAX_PIPELINE_ENTRY_POINT_NAME_SIZE];
+} RawVulkanPipelineShaderStage;
+
+/*
+ * Must be initialized with rawInitVulkanPipelineState, since unused
+ * array elements and padding take part in hashing and comparison.
+ */
+typedef struct {
+	RawVulkanPipelineShaderStage shader_stages[
+		RAW_VULKAN_MAX_PIPELINE_SHADER_STAGES];
+	uint32_t n_shader_stages;
+
+	// Shared by every stage, constants a stage lacks are ignored
+	VkSpecializationMapEntry specialization_constants[
+		RAW_VULKAN_MAX_PIPELINE_SPECIALIZATION_CONSTANTS];
+	uint32_t n_specialization_constants;
+	uint32_t specialization_data_size;
+	uint8_t specialization_data[
+		RAW_VULKAN_MAX_PIPELINE_SPECIALIZATION_DATA_SIZE];
+
+	VkVertexInputBindingDescription vertex_bindings[
+		RAW_VULKAN_MAX_PIPELINE_VERTEX_BINDINGS];
+	uint32_t n_vertex_bindings;
+	VkVertexInputAttributeDescription vertex_attributes[
+		RAW_VULKAN_MAX_PIPELINE_VERTEX_ATTRIBUTES];
+	uint32_t n_vertex_attributes;
+
+	VkPrimitiveTopology topology;
+	VkBool32 primitive_restart_enable;
+
+	VkPolygonMode polygon_mode;
+	VkCullModeFlags cull_mode;
+	VkFrontFace front_face;
+	VkBool32 depth_bias_enable;
+	float depth_bias_constant_factor;
+	float depth_bias_slope_factor;
+	float line_width;
+
+	VkSampleCountFlagBits samples;
+
+	VkBool32 depth_test_enable;
+	VkBool32 depth_write_enable;
+	VkCompareOp depth_compare_op;
+	VkBool32 stencil_test_enable;
+	VkStencilOpState stencil_front;
+	VkStencilOpState stencil_back;
+
+	VkPipelineColorBlendAttachmentState color_attachments[
+		RAW_VULKAN_MAX_PIPELINE_COLOR_ATTACHMENTS];
+	uint32_t n_color_attachments;
+
+	// Handles from the layout and render pass caches, so equal handles
+	// mean equal layouts and compatible render passes
+	VkPipelineLayout layout;
+	VkRenderPass render_pass;
+	uint32_t subpass;
+} RawVulkanPipelineState;
+
+/*
+ * Holds the create info of a state and every struct it points to.
+ * It points into the state, so the state must outlive it.
+ */
+typedef struct {
+	VkPipelineShaderStageCreateInfo shader_stages[
+		RAW_VULKAN_MAX_PIPELINE_SHADER_STAGES];
+	VkSpecializationInfo specialization_info;
+	VkPipelineVertexInputStateCreateInfo vertex_input_state;
+	VkPipelineInputAssemblyStateCreateInfo input_assembly_state;
+	VkPipelineViewportStateCreateInfo viewport_state;
+	VkPipelineRasterizationStateCreateInfo rasterization_state;
+	VkPipelineMultisampleStateCreateInfo multisample_state;
+	VkPipelineDepthStencilStateCreateInfo depth_stencil_state;
+	VkPipelineColorBlendStateCreateInfo color_blend_state;
+	VkDynamicState dynamic_states[2];
+	VkPipelineDynamicStateCreateInfo dynamic_state;
+	VkGraphicsPipelineCreateInfo create_info;
+} RawVulkanGraphicsPipelineCreateInfo;
+
+/*
+ * Compute counterpart, built from the first shader stage of a state.
+ */
+typedef struct {
+	VkSpecializationInfo specialization_info;
+	VkComputePipelineCreateInfo create_info;
+} RawVulkanComputePipelineCreateInfo;
+
+typedef struct {
+	uint64_t state_hash;
+
+	// VK_NULL_HANDLE marks an empty slot
+	VkPipeline pipeline;
+} RawVulkanPipelineMapEntry;
+
+typedef struct {
+	RawVulkanPipelineMapEntry* entries;
+
+	// Full states, to tell hash collisions apart
+	RawVulkanPipelineState* states;
+
+	uint32_t capacity;
+	uint32_t n_pipelines;
+} RawVulkanPipelineMap;
+
+/*
+ * Zeroes @state and sets opaque, back face culled, depth tested
+ * triangle lists without multisampling.
+ */
+void rawInitVulkanPipelineState(RawVulkanPipelineState* state);
+
+bool rawAddVulkanPipelineShaderStage(
+	RawVulkanPipelineState* state,
+	VkShaderStageFlagBits stage,
+	VkShaderModule module,
+	char const* entry_point);
+
+/*
+ * Sets the value of specialization constant @constant_id, appending it
+ * if it is new. Constants are kept sorted by id, so the order they are
+ * set in doesn't change the hash.
+ */
+bool rawSetVulkanPipelineSpecializationConstant(
+	RawVulkanPipelineState* state,
+	uint32_t constant_id,
+	void const* data,
+	uint32_t size);
+
+uint64_t rawHashVulkanPipelineState(
+	RawVulkanPipelineState const* const state);
+
+void rawFillVulkanGraphicsPipelineCreateInfo(
+	RawVulkanPipelineState const* const state,
+	RawVulkanGraphicsPipelineCreateInfo* create_info);
+
+void rawFillVulkanComputePipelineCreateInfo(
+	RawVulkanPipelineState const* const state,
+	RawVulkanComputePipelineCreateInfo* create_info);
+
+/*
+ * @max_pipelines is rounded up so the map is at most 3/4 full.
+ */
+bool rawCreateVulkanPipelineMap(
+	uint32_t max_pipelines,
+	RawVulkanPipelineMap* pipeline_map);
+
+// Destroys every pipeline in the map
+void rawDestroyVulkanPipelineMap(
+	VkDevice logical_device,
+	RawVulkanPipelineMap* pipeline_map);
+
+/*
+ * The pipeline of @state_hash, or VK_NULL_HANDLE. Meant for the draw
+ * loop, with hashes computed once per material.
+ */
+VkPipeline rawFindVulkanPipeline(
+	RawVulkanPipelineMap const* const pipeline_map,
+	uint64_t state_hash);
+
+/*
+ * Returns the pipeline of an identical state, creating it through
+ * @pipeline_cache on a miss. @state_hash must be the hash of @state.
+ */
+bool rawGetVulkanGraphicsPipeline(
+	VkDevice logical_device,
+	RawVulkanPipelineMap* pipeline_map,
+	VkPipelineCache pipeline_cache,
+	RawVulkanPipelineState const* const state,
+	uint64_t state_hash,
+	VkPipeline* pipeline);
+
+#endif // RAW_VULKAN_PIPELINE_STATE_H
@@ -28,13 +28,15 @@
  *
  * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
  * Created: 08/04/2020
- * Last modified: 16/06/2020
+ * Last modified: 19/10/2026
  */
 
 #include <engine/vulkan/rawVulkanPresentation.h>
 #include <engine/platform/rawMemory.h>
 #include <engine/utils/rawLogger.h>
 
+#include <string.h>
+
 bool rawCreateVulkanPresentationSurface(
 	VkInstance instance,
 	RAW_VULKAN_SURFACE_DISPLAY display,
@@ -98,19 +100,16 @@ bool rawGetAvailableVulkanPresentModes(
 	return true;
 }
 
-bool rawCreateVulkanSwapchain(
+/*
+ * Picks the first of @ranked_present_modes the surface supports,
+ * falling back to FIFO, which is always available
+ */
+static bool rawChooseVulkanPresentMode(
 	VkPhysicalDevice physical_device,
-	VkDevice logical_device,
 	VkSurfaceKHR presentation_surface,
-	VkPresentModeKHR desired_present_mode,
-	VkImageUsageFlags desired_image_usage,
-	VkSurfaceTransformFlagBitsKHR desired_transformation,
-	uint32_t* swapchain_width,
-	uint32_t* swapchain_height,
-	VkSwapchainKHR* previous_swapchain,
-	VkSwapchainKHR* current_swapchain,
-	VkImage** swapchain_images,
-	uint32_t* n_swapchain_images) {
+	VkPresentModeKHR const* const ranked_present_modes,
+	uint32_t n_ranked_present_modes,
+	VkPresentModeKHR* present_mode) {
 
 	VkPresentModeKHR* available_present_modes;
 	uint32_t n_available_present_modes;
@@ -122,145 +121,389 @@ bool rawCreateVulkanSwapchain(
 		return false;
 	}
 
-	bool present_mode_supported = false;
+	*present_mode = VK_PRESENT_MODE_FIFO_KHR;
 
-	for (uint32_t i = 0; i < n_available_present_modes; ++i) {
-		if (available_present_modes[i] == desired_present_mode) {
-			present_mode_supported = true;
-			break;
+	bool present_mode_found = false;
+
+	for (uint32_t i = 0; i < n_ranked_present_modes &&
+		!present_mode_found; ++i) {
+		for (uint32_t j = 0; j < n_available_present_modes; ++j) {
+			if (available_present_modes[j] == ranked_present_modes[i]) {
+				*present_mode = ranked_present_modes[i];
+				present_mode_found = true;
+				break;
+			}
 		}
 	}
 
 	RAW_MEM_FREE(available_present_modes);
 
-	// TODO: Fallback to default present mode
-	if (!present_mode_supported) {
-		RAW_LOG_ERROR("Desired presentation mode is not supported!");
-		return false;
-	}
-
-	VkSurfaceCapabilitiesKHR surface_capabilities;
+	if (!present_mode_found)
+		RAW_LOG_WARNING("Desired presentation modes are not supported, "
+			"falling back to FIFO!");
 
-	VkResult result = vkGetPhysicalDeviceSurfaceCapabilitiesKHR(
-		physical_device, presentation_surface, &surface_capabilities);
+	return true;
+}
 
-	if (result != VK_SUCCESS) {
-		RAW_LOG_ERROR("Could not retrieve device surface capabilities!");
-		return false;
-	}
+static bool rawCheckVulkanSurfaceCapabilities(
+	VkSurfaceCapabilitiesKHR const* const surface_capabilities,
+	VkImageUsageFlags desired_image_usage,
+	VkSurfaceTransformFlagBitsKHR desired_transformation) {
 
-	if ((desired_image_usage & surface_capabilities.supportedUsageFlags)
+	if ((desired_image_usage & surface_capabilities->supportedUsageFlags)
 		!= desired_image_usage) {
 		RAW_LOG_ERROR("The surface doesn't support the desired image usage!");
 		return false;
 	}
 
-	if ((desired_transformation & surface_capabilities.supportedTransforms)
+	if ((desired_transformation & surface_capabilities->supportedTransforms)
 		!= desired_transformation) {
 		RAW_LOG_ERROR("The surface doesn't support "
 			"the desired transformation!");
 		return false;
 	}
 
-	*n_swapchain_images = surface_capabilities.minImageCount + 1u;
+	return true;
+}
 
-	if ((surface_capabilities.maxImageCount != 0) &&
-		(*n_swapchain_images > surface_capabilities.maxImageCount))
-		*n_swapchain_images = surface_capabilities.maxImageCount;
+static uint32_t rawChooseVulkanSwapchainImageCount(
+	VkSurfaceCapabilitiesKHR const* const surface_capabilities,
+	uint32_t n_extra_images) {
 
-	VkExtent2D image_size;
+	uint32_t n_images = surface_capabilities->minImageCount + n_extra_images;
 
-	if (surface_capabilities.currentExtent.width == 0xFFFFFFFF) {
-		if (*swapchain_width == 0u)
-			*swapchain_width = 1024u;
+	if ((surface_capabilities->maxImageCount != 0) &&
+		(n_images > surface_capabilities->maxImageCount))
+		n_images = surface_capabilities->maxImageCount;
 
-		image_size.width = *swapchain_width;
+	return n_images;
+}
 
-		if (*swapchain_height == 0u)
-			*swapchain_height = 768u;
+/*
+ * Surfaces that don't define their extent take
+ * @width x @height, clamped to the supported range
+ */
+static VkExtent2D rawChooseVulkanSwapchainExtent(
+	VkSurfaceCapabilitiesKHR const* const surface_capabilities,
+	uint32_t width,
+	uint32_t height) {
 
-		image_size.height = *swapchain_height;
-
-		/// Clamping the dimensions
-		if (image_size.width <
-			surface_capabilities.minImageExtent.width)
-			image_size.width =
-				surface_capabilities.minImageExtent.width;
-		else if (image_size.width >
-			surface_capabilities.minImageExtent.width)
-			image_size.width =
-				surface_capabilities.minImageExtent.width;
-
-		if (image_size.height <
-			surface_capabilities.minImageExtent.height)
-			image_size.height =
-				surface_capabilities.minImageExtent.height;
-		else if (image_size.height >
-			surface_capabilities.minImageExtent.height)
-			image_size.height =
-				surface_capabilities.minImageExtent.height;
-	}
-	else {
-		image_size = surface_capabilities.currentExtent;
-		*swapchain_width = image_size.width;
-		*swapchain_height = image_size.height;
-	}
+	if (surface_capabilities->currentExtent.width != 0xFFFFFFFF)
+		return surface_capabilities->currentExtent;
 
-	uint32_t n_formats;
+	VkExtent2D image_size = { width, height };
 
-	result = vkGetPhysicalDeviceSurfaceFormatsKHR(physical_device,
-		presentation_surface, &n_formats, RAW_NULL_PTR);
+	if (image_size.width < surface_capabilities->minImageExtent.width)
+		image_size.width = surface_capabilities->minImageExtent.width;
+	else if (image_size.width > surface_capabilities->maxImageExtent.width)
+		image_size.width = surface_capabilities->maxImageExtent.width;
+
+	if (image_size.height < surface_capabilities->minImageExtent.height)
+		image_size.height = surface_capabilities->minImageExtent.height;
+	else if (image_size.height > surface_capabilities->maxImageExtent.height)
+		image_size.height = surface_capabilities->maxImageExtent.height;
+
+	return image_size;
+}
 
-	if ((result != VK_SUCCESS) || (n_formats == 0u)) {
+/*
+ * If successful, the function will allocate memory for:
+ *     @*surface_formats
+ */
+static bool rawGetAvailableVulkanSurfaceFormats(
+	VkPhysicalDevice physical_device,
+	VkSurfaceKHR presentation_surface,
+	VkSurfaceFormatKHR** surface_formats,
+	uint32_t* n_surface_formats) {
+
+	VkResult result = vkGetPhysicalDeviceSurfaceFormatsKHR(physical_device,
+		presentation_surface, n_surface_formats, RAW_NULL_PTR);
+
+	if ((result != VK_SUCCESS) || (*n_surface_formats == 0u)) {
 		RAW_LOG_ERROR("vkGetPhysicalDeviceSurfaceFormatsKHR failed!");
 		return false;
 	}
 
-	VkSurfaceFormatKHR* surface_formats;
+	*surface_formats = RAW_NULL_PTR;
 
-	RAW_MEM_ALLOC(surface_formats,
-		(uint64_t)n_formats, sizeof(VkSurfaceFormatKHR));
+	RAW_MEM_ALLOC(*surface_formats,
+		(uint64_t)*n_surface_formats, sizeof(VkSurfaceFormatKHR));
 
-	if (!surface_formats) {
-		RAW_LOG_ERROR("RAW_MEM_ALLOC failed on rawCreateSwapchain");
+	if (!*surface_formats) {
+		RAW_LOG_ERROR("RAW_MEM_ALLOC failed on "
+			"rawGetAvailableVulkanSurfaceFormats");
 		return false;
 	}
 
 	result = vkGetPhysicalDeviceSurfaceFormatsKHR(physical_device,
-		presentation_surface, &n_formats, surface_formats);
+		presentation_surface, n_surface_formats, *surface_formats);
 
-	if ((result != VK_SUCCESS) || (n_formats == 0u)) {
+	if ((result != VK_SUCCESS) || (*n_surface_formats == 0u)) {
 		RAW_LOG_ERROR("vkGetPhysicalDeviceSurfaceFormatsKHR failed!");
-		RAW_MEM_FREE(surface_formats);
+		RAW_MEM_FREE(*surface_formats);
 		return false;
 	}
 
-	// TODO: make generic choice
-	int32_t surface_format_id = -1;
+	return true;
+}
+
+/*
+ * Picks the first of @ranked_surface_formats the surface supports,
+ * falling back to the first format it reports
+ */
+static void rawChooseVulkanSurfaceFormat(
+	VkSurfaceFormatKHR const* const surface_formats,
+	uint32_t n_surface_formats,
+	VkSurfaceFormatKHR const* const ranked_surface_formats,
+	uint32_t n_ranked_surface_formats,
+	VkSurfaceFormatKHR* surface_format) {
+
+	// The surface has no preferred format
+	if (n_surface_formats == 1u &&
+		surface_formats[0].format == VK_FORMAT_UNDEFINED &&
+		n_ranked_surface_formats > 0u) {
+		*surface_format = ranked_surface_formats[0];
+		return;
+	}
 
-	for (uint32_t i = 0; i < n_formats; ++i) {
-		if (surface_formats[i].format == VK_FORMAT_B8G8R8A8_SRGB &&
-			surface_formats[i].colorSpace ==
-				VK_COLOR_SPACE_SRGB_NONLINEAR_KHR) {
-			surface_format_id = (int32_t)i;
-			break;
+	for (uint32_t i = 0; i < n_ranked_surface_formats; ++i) {
+		for (uint32_t j = 0; j < n_surface_formats; ++j) {
+			if (surface_formats[j].format ==
+					ranked_surface_formats[i].format &&
+				surface_formats[j].colorSpace ==
+					ranked_surface_formats[i].colorSpace) {
+				*surface_format = surface_formats[j];
+				return;
+			}
 		}
 	}
 
-	if (surface_format_id == -1) {
-		RAW_LOG_ERROR("The required surface format is not present!");
-		RAW_MEM_FREE(surface_formats);
+	RAW_LOG_WARNING("Desired surface formats are not supported, "
+		"falling back to the first available one!");
+
+	*surface_format = surface_formats[0];
+}
+
+void rawGetVulkanPresentPolicy(
+	RawVulkanPresentPolicyPreset preset,
+	RawVulkanPresentPolicy* present_policy) {
+
+	// sRGB first, as shaders write linear color
+	static VkSurfaceFormatKHR const ranked_surface_formats[] = {
+		{ VK_FORMAT_B8G8R8A8_SRGB, VK_COLOR_SPACE_SRGB_NONLINEAR_KHR },
+		{ VK_FORMAT_R8G8B8A8_SRGB, VK_COLOR_SPACE_SRGB_NONLINEAR_KHR },
+		{ VK_FORMAT_B8G8R8A8_UNORM, VK_COLOR_SPACE_SRGB_NONLINEAR_KHR },
+		{ VK_FORMAT_R8G8B8A8_UNORM, VK_COLOR_SPACE_SRGB_NONLINEAR_KHR }
+	};
+
+	memset(present_policy, 0, sizeof(RawVulkanPresentPolicy));
+
+	memcpy(present_policy->surface_formats, ranked_surface_formats,
+		sizeof(ranked_surface_formats));
+	present_policy->n_surface_formats = 4u;
+
+	VkPresentModeKHR* present_modes = present_policy->present_modes;
+
+	switch (preset) {
+		// Newest frame shown at the next vblank, without queuing
+		case RAW_VULKAN_PRESENT_POLICY_LOW_LATENCY:
+			present_modes[0] = VK_PRESENT_MODE_MAILBOX_KHR;
+			present_modes[1] = VK_PRESENT_MODE_IMMEDIATE_KHR;
+			present_modes[2] = VK_PRESENT_MODE_FIFO_RELAXED_KHR;
+			present_modes[3] = VK_PRESENT_MODE_FIFO_KHR;
+			present_policy->n_present_modes = 4u;
+			present_policy->n_extra_images = 1u;
+			break;
+
+		// Never waits for vblank, extra images keep the GPU busy
+		case RAW_VULKAN_PRESENT_POLICY_MAX_THROUGHPUT:
+			present_modes[0] = VK_PRESENT_MODE_IMMEDIATE_KHR;
+			present_modes[1] = VK_PRESENT_MODE_MAILBOX_KHR;
+			present_modes[2] = VK_PRESENT_MODE_FIFO_RELAXED_KHR;
+			present_modes[3] = VK_PRESENT_MODE_FIFO_KHR;
+			present_policy->n_present_modes = 4u;
+			present_policy->n_extra_images = 2u;
+			break;
+
+		// Rendering throttled to the refresh rate, minimum images
+		case RAW_VULKAN_PRESENT_POLICY_POWER_SAVING:
+			present_modes[0] = VK_PRESENT_MODE_FIFO_KHR;
+			present_policy->n_present_modes = 1u;
+			present_policy->n_extra_images = 0u;
+			break;
+
+		case RAW_VULKAN_PRESENT_POLICY_TEAR_FREE:
+		default:
+			present_modes[0] = VK_PRESENT_MODE_MAILBOX_KHR;
+			present_modes[1] = VK_PRESENT_MODE_FIFO_KHR;
+			present_policy->n_present_modes = 2u;
+			present_policy->n_extra_images = 1u;
+			break;
+	}
+}
+
+bool rawResolveVulkanPresentPolicy(
+	VkPhysicalDevice physical_device,
+	VkSurfaceKHR presentation_surface,
+	RawVulkanPresentPolicy const* const present_policy,
+	VkPresentModeKHR* present_mode,
+	VkSurfaceFormatKHR* surface_format,
+	uint32_t* n_images) {
+
+	if (!rawChooseVulkanPresentMode(physical_device, presentation_surface,
+		present_policy->present_modes, present_policy->n_present_modes,
+		present_mode))
+		return false;
+
+	VkSurfaceCapabilitiesKHR surface_capabilities;
+
+	VkResult result = vkGetPhysicalDeviceSurfaceCapabilitiesKHR(
+		physical_device, presentation_surface, &surface_capabilities);
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("Could not retrieve device surface capabilities!");
 		return false;
 	}
 
+	*n_images = rawChooseVulkanSwapchainImageCount(
+		&surface_capabilities, present_policy->n_extra_images);
+
+	VkSurfaceFormatKHR* surface_formats;
+	uint32_t n_surface_formats;
+
+	if (!rawGetAvailableVulkanSurfaceFormats(physical_device,
+		presentation_surface, &surface_formats, &n_surface_formats))
+		return false;
+
+	rawChooseVulkanSurfaceFormat(surface_formats, n_surface_formats,
+		present_policy->surface_formats, present_policy->n_surface_formats,
+		surface_format);
+
+	RAW_MEM_FREE(surface_formats);
+
+	return true;
+}
+
+/*
+ * If successful, the function will allocate memory for:
+ *     @*swapchain_images
+ */
+static bool rawGetVulkanSwapchainImages(
+	VkDevice logical_device,
+	VkSwapchainKHR swapchain,
+	VkImage** swapchain_images,
+	uint32_t* n_swapchain_images) {
+
+	VkResult result = vkGetSwapchainImagesKHR(logical_device,
+		swapchain, n_swapchain_images, RAW_NULL_PTR);
+
+	if ((result != VK_SUCCESS) || (*n_swapchain_images == 0)) {
+		RAW_LOG_ERROR("vkGetSwapchainImagesKHR failed!");
+		return false;
+	}
+
+	*swapchain_images = RAW_NULL_PTR;
+
+	RAW_MEM_ALLOC(*swapchain_images,
+		(uint64_t)*n_swapchain_images, sizeof(VkImage));
+
+	if (!*swapchain_images) {
+		RAW_LOG_ERROR("RAW_MEM_ALLOC failed on raw CreateSwapchain!");
+		return false;
+	}
+
+	result = vkGetSwapchainImagesKHR(logical_device,
+		swapchain, n_swapchain_images, *swapchain_images);
+
+	if ((result != VK_SUCCESS) || (*n_swapchain_images == 0)) {
+		RAW_LOG_ERROR("vkGetSwapchainImagesKHR failed!");
+		RAW_MEM_FREE(*swapchain_images);
+		return false;
+	}
+
+	return true;
+}
+
+bool rawCreateVulkanSwapchain(
+	VkPhysicalDevice physical_device,
+	VkDevice logical_device,
+	VkSurfaceKHR presentation_surface,
+	VkPresentModeKHR desired_present_mode,
+	VkImageUsageFlags desired_image_usage,
+	VkSurfaceTransformFlagBitsKHR desired_transformation,
+	uint32_t* swapchain_width,
+	uint32_t* swapchain_height,
+	VkSwapchainKHR* previous_swapchain,
+	VkSwapchainKHR* current_swapchain,
+	VkImage** swapchain_images,
+	uint32_t* n_swapchain_images) {
+
+	VkPresentModeKHR present_mode;
+
+	if (!rawChooseVulkanPresentMode(physical_device, presentation_surface,
+		&desired_present_mode, 1u, &present_mode))
+		return false;
+
+	VkSurfaceCapabilitiesKHR surface_capabilities;
+
+	VkResult result = vkGetPhysicalDeviceSurfaceCapabilitiesKHR(
+		physical_device, presentation_surface, &surface_capabilities);
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("Could not retrieve device surface capabilities!");
+		return false;
+	}
+
+	if (!rawCheckVulkanSurfaceCapabilities(&surface_capabilities,
+		desired_image_usage, desired_transformation))
+		return false;
+
+	*n_swapchain_images =
+		rawChooseVulkanSwapchainImageCount(&surface_capabilities, 1u);
+
+	if (surface_capabilities.currentExtent.width == 0xFFFFFFFF) {
+		if (*swapchain_width == 0u)
+			*swapchain_width = 1024u;
+
+		if (*swapchain_height == 0u)
+			*swapchain_height = 768u;
+	}
+
+	VkExtent2D image_size = rawChooseVulkanSwapchainExtent(
+		&surface_capabilities, *swapchain_width, *swapchain_height);
+
+	if (surface_capabilities.currentExtent.width != 0xFFFFFFFF) {
+		*swapchain_width = image_size.width;
+		*swapchain_height = image_size.height;
+	}
+
+	VkSurfaceFormatKHR* surface_formats;
+	uint32_t n_formats;
+
+	if (!rawGetAvailableVulkanSurfaceFormats(physical_device,
+		presentation_surface, &surface_formats, &n_formats))
+		return false;
+
+	RawVulkanPresentPolicy default_policy;
+	rawGetVulkanPresentPolicy(
+		RAW_VULKAN_PRESENT_POLICY_TEAR_FREE, &default_policy);
+
+	VkSurfaceFormatKHR surface_format;
+
+	rawChooseVulkanSurfaceFormat(surface_formats, n_formats,
+		default_policy.surface_formats, default_policy.n_surface_formats,
+		&surface_format);
+
+	RAW_MEM_FREE(surface_formats);
+
 	VkSwapchainCreateInfoKHR swapchain_create_info = {
 		.sType = VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR,
 		.pNext = RAW_NULL_PTR,
 		.flags = 0,
 		.surface = presentation_surface,
 		.minImageCount = *n_swapchain_images,
-		.imageFormat = surface_formats[surface_format_id].format,
-		.imageColorSpace = surface_formats[surface_format_id].colorSpace,
+		.imageFormat = surface_format.format,
+		.imageColorSpace = surface_format.colorSpace,
 		.imageExtent = image_size,
 		.imageArrayLayers = 1,
 		.imageUsage = desired_image_usage,
@@ -269,13 +512,11 @@ bool rawCreateVulkanSwapchain(
 		.pQueueFamilyIndices = RAW_NULL_PTR,
 		.preTransform = desired_transformation,
 		.compositeAlpha = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR,
-		.presentMode = desired_present_mode,
+		.presentMode = present_mode,
 		.clipped = VK_TRUE,
 		.oldSwapchain = *previous_swapchain
 	};
 
-	RAW_MEM_FREE(surface_formats);
-
 	// TODO: Pass allocation callback
 	result = vkCreateSwapchainKHR(logical_device,
 		&swapchain_create_info, RAW_NULL_PTR, current_swapchain);
@@ -292,47 +533,500 @@ bool rawCreateVulkanSwapchain(
 		*previous_swapchain = VK_NULL_HANDLE;
 	}
 
+	return rawGetVulkanSwapchainImages(logical_device,
+		*current_swapchain, swapchain_images, n_swapchain_images);
+}
+
+void rawDestroyVulkanSwapchain(
+	VkDevice logical_device,
+	VkSwapchainKHR* swapchain) {
+
+	if (swapchain) {
+		// TODO: Pass allocation callback
+		vkDestroySwapchainKHR(logical_device, *swapchain, RAW_NULL_PTR);
+		*swapchain = VK_NULL_HANDLE;
+	}
+	else
+		RAW_LOG_WARNING("Attempting to destroy "
+			"NULL Vulkan swapchain!");
+}
+
+static void rawDestroyVulkanSwapchainImageObjects(
+	VkDevice logical_device,
+	VkImageView* image_views,
+	VkFramebuffer* framebuffers,
+	VkSemaphore* render_finished_semaphores,
+	uint32_t n_images) {
+
+	for (uint32_t i = 0; i < n_images; ++i) {
+		// TODO: Pass allocation callback
+		if (framebuffers[i] != VK_NULL_HANDLE)
+			vkDestroyFramebuffer(logical_device,
+				framebuffers[i], RAW_NULL_PTR);
+
+		// TODO: Pass allocation callback
+		if (image_views[i] != VK_NULL_HANDLE)
+			vkDestroyImageView(logical_device,
+				image_views[i], RAW_NULL_PTR);
+
+		// TODO: Pass allocation callback
+		if (render_finished_semaphores[i] != VK_NULL_HANDLE)
+			vkDestroySemaphore(logical_device,
+				render_finished_semaphores[i], RAW_NULL_PTR);
+	}
+}
+
+static void rawDestroyVulkanRetiredSwapchain(
+	VkDevice logical_device,
+	RawVulkanRetiredSwapchain* retired_swapchain) {
+
+	rawDestroyVulkanSwapchainImageObjects(logical_device,
+		retired_swapchain->image_views, retired_swapchain->framebuffers,
+		retired_swapchain->render_finished_semaphores,
+		retired_swapchain->n_images);
+
+	rawDestroyVulkanSwapchain(logical_device, &retired_swapchain->swapchain);
+
+	RAW_MEM_FREE(retired_swapchain->render_finished_semaphores);
+	RAW_MEM_FREE(retired_swapchain->framebuffers);
+	RAW_MEM_FREE(retired_swapchain->image_views);
+	RAW_MEM_FREE(retired_swapchain->images);
+}
+
+/*
+ * Whether the frames submitted before the retirement are done, and so is
+ * the first one submitted after it. Frame fences don't cover the
+ * presents' semaphore waits, so that extra frame is the slack given to
+ * the presentation engine: its submission was queued after the last
+ * present of the retired swapchain, and its completion is taken as the
+ * end of those presents. Exact present completion would need
+ * VK_EXT_swapchain_maintenance1 present fences.
+ *
+ * Frames older than the last @n_frames already had their slot reused,
+ * so only the fences of the most recent ones are checked.
+ */
+static bool rawIsVulkanRetiredSwapchainIdle(
+	VkDevice logical_device,
+	RawVulkanFrameManager const* const frame_manager,
+	RawVulkanRetiredSwapchain const* const retired_swapchain) {
+
+	uint64_t last_frame = retired_swapchain->retire_frame_number;
+
+	if (frame_manager->frame_number <= last_frame)
+		return false;
+
+	uint64_t first_frame = 0u;
+
+	if (frame_manager->frame_number > frame_manager->n_frames)
+		first_frame = frame_manager->frame_number - frame_manager->n_frames;
+
+	for (uint64_t i = first_frame; i <= last_frame; ++i) {
+		VkFence fence = frame_manager->frames[
+			i % frame_manager->n_frames].in_flight_fence;
+
+		if (vkGetFenceStatus(logical_device, fence) != VK_SUCCESS)
+			return false;
+	}
+
+	return true;
+}
+
+/*
+ * Creates a new swapchain from the cached surface data, replacing
+ * the current one, which is moved to the retired list
+ */
+static bool rawRecreateVulkanSwapchain(
+	VkDevice logical_device,
+	RawVulkanFrameManager const* const frame_manager,
+	uint32_t width,
+	uint32_t height,
+	RawVulkanSwapchain* swapchain) {
+
+	VkExtent2D extent = rawChooseVulkanSwapchainExtent(
+		&swapchain->surface_capabilities, width, height);
+
+	if (extent.width == 0u || extent.height == 0u) {
+		swapchain->out_of_date = true;
+		return true;
+	}
+
+	if (swapchain->n_retired_swapchains ==
+		RAW_VULKAN_MAX_RETIRED_SWAPCHAINS) {
+		RAW_LOG_WARNING("Too many retired swapchains, waiting for the "
+			"device to be idle!");
+
+		vkDeviceWaitIdle(logical_device);
+
+		for (uint32_t i = 0; i < swapchain->n_retired_swapchains; ++i)
+			rawDestroyVulkanRetiredSwapchain(logical_device,
+				&swapchain->retired_swapchains[i]);
+
+		swapchain->n_retired_swapchains = 0u;
+	}
+
+	VkSwapchainCreateInfoKHR swapchain_create_info = {
+		.sType = VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR,
+		.pNext = RAW_NULL_PTR,
+		.flags = 0,
+		.surface = swapchain->presentation_surface,
+		.minImageCount = rawChooseVulkanSwapchainImageCount(
+			&swapchain->surface_capabilities, swapchain->n_extra_images),
+		.imageFormat = swapchain->surface_format.format,
+		.imageColorSpace = swapchain->surface_format.colorSpace,
+		.imageExtent = extent,
+		.imageArrayLayers = 1,
+		.imageUsage = swapchain->image_usage,
+		.imageSharingMode = VK_SHARING_MODE_EXCLUSIVE,
+		.queueFamilyIndexCount = 0,
+		.pQueueFamilyIndices = RAW_NULL_PTR,
+		.preTransform = swapchain->transformation,
+		.compositeAlpha = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR,
+		.presentMode = swapchain->present_mode,
+		.clipped = VK_TRUE,
+		.oldSwapchain = swapchain->swapchain
+	};
+
+	VkSwapchainKHR new_swapchain = VK_NULL_HANDLE;
+
 	// TODO: Pass allocation callback
-	result = vkGetSwapchainImagesKHR(logical_device,
-		*current_swapchain, n_swapchain_images, RAW_NULL_PTR);
+	VkResult result = vkCreateSwapchainKHR(logical_device,
+		&swapchain_create_info, RAW_NULL_PTR, &new_swapchain);
 
-	if ((result != VK_SUCCESS) || (*n_swapchain_images == 0)) {
-		RAW_LOG_ERROR("vkGetSwapchainImagesKHR failed!");
+	if ((result != VK_SUCCESS) || (new_swapchain == VK_NULL_HANDLE)) {
+		RAW_LOG_ERROR("Could not create swapchain!");
 		return false;
 	}
 
-	RAW_MEM_ALLOC(*swapchain_images,
-		(uint64_t)*n_swapchain_images, sizeof(VkImage));
+	VkImage* images = RAW_NULL_PTR;
+	uint32_t n_images;
 
-	if (!*swapchain_images) {
-		RAW_LOG_ERROR("RAW_MEM_ALLOC failed on raw CreateSwapchain!");
+	if (!rawGetVulkanSwapchainImages(logical_device,
+		new_swapchain, &images, &n_images)) {
+		rawDestroyVulkanSwapchain(logical_device, &new_swapchain);
 		return false;
 	}
 
-	result = vkGetSwapchainImagesKHR(logical_device,
-		*current_swapchain, n_swapchain_images, *swapchain_images);
+	VkImageView* image_views = RAW_NULL_PTR;
+	VkFramebuffer* framebuffers = RAW_NULL_PTR;
+	VkSemaphore* render_finished_semaphores = RAW_NULL_PTR;
+
+	RAW_MEM_ALLOC(image_views, (uint64_t)n_images, sizeof(VkImageView));
+	RAW_MEM_ALLOC(framebuffers, (uint64_t)n_images, sizeof(VkFramebuffer));
+	RAW_MEM_ALLOC(render_finished_semaphores,
+		(uint64_t)n_images, sizeof(VkSemaphore));
+
+	if (!image_views || !framebuffers || !render_finished_semaphores) {
+		RAW_LOG_ERROR("RAW_MEM_ALLOC failed on rawRecreateVulkanSwapchain!");
+
+		if (image_views)
+			RAW_MEM_FREE(image_views);
+
+		if (framebuffers)
+			RAW_MEM_FREE(framebuffers);
+
+		if (render_finished_semaphores)
+			RAW_MEM_FREE(render_finished_semaphores);
+
+		RAW_MEM_FREE(images);
+		rawDestroyVulkanSwapchain(logical_device, &new_swapchain);
 
-	if ((result != VK_SUCCESS) || (*n_swapchain_images == 0)) {
-		RAW_LOG_ERROR("vkGetSwapchainImagesKHR failed!");
-		RAW_MEM_FREE(*swapchain_images);
 		return false;
 	}
 
+	for (uint32_t i = 0; i < n_images; ++i) {
+		image_views[i] = VK_NULL_HANDLE;
+		framebuffers[i] = VK_NULL_HANDLE;
+		render_finished_semaphores[i] = VK_NULL_HANDLE;
+	}
+
+	VkSemaphoreCreateInfo semaphore_create_info = {
+		.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = 0
+	};
+
+	for (uint32_t i = 0; i < n_images; ++i) {
+		// TODO: Pass allocation callback
+		result = vkCreateSemaphore(logical_device, &semaphore_create_info,
+			RAW_NULL_PTR, &render_finished_semaphores[i]);
+
+		if (result != VK_SUCCESS) {
+			RAW_LOG_ERROR("vkCreateSemaphore failed!");
+
+			rawDestroyVulkanSwapchainImageObjects(logical_device,
+				image_views, framebuffers, render_finished_semaphores,
+				n_images);
+
+			RAW_MEM_FREE(render_finished_semaphores);
+			RAW_MEM_FREE(framebuffers);
+			RAW_MEM_FREE(image_views);
+			RAW_MEM_FREE(images);
+			rawDestroyVulkanSwapchain(logical_device, &new_swapchain);
+
+			return false;
+		}
+	}
+
+	// The old swapchain may still be presenting, so it's only retired
+	if (swapchain->swapchain != VK_NULL_HANDLE) {
+		swapchain->retired_swapchains[swapchain->n_retired_swapchains++] =
+			(RawVulkanRetiredSwapchain) {
+				.swapchain = swapchain->swapchain,
+				.images = swapchain->images,
+				.image_views = swapchain->image_views,
+				.framebuffers = swapchain->framebuffers,
+				.render_finished_semaphores =
+					swapchain->render_finished_semaphores,
+				.n_images = swapchain->n_images,
+				.retire_frame_number =
+					frame_manager ? frame_manager->frame_number : 0u
+			};
+	}
+
+	swapchain->swapchain = new_swapchain;
+	swapchain->extent = extent;
+	swapchain->images = images;
+	swapchain->n_images = n_images;
+	swapchain->image_views = image_views;
+	swapchain->framebuffers = framebuffers;
+	swapchain->render_finished_semaphores = render_finished_semaphores;
+	swapchain->out_of_date = false;
+	++swapchain->generation;
+
 	return true;
 }
 
-void rawDestroyVulkanSwapchain(
+bool rawCreateVulkanResizableSwapchain(
+	VkPhysicalDevice physical_device,
 	VkDevice logical_device,
-	VkSwapchainKHR* swapchain) {
+	VkSurfaceKHR presentation_surface,
+	RawVulkanPresentPolicy const* const present_policy,
+	VkImageUsageFlags desired_image_usage,
+	VkSurfaceTransformFlagBitsKHR desired_transformation,
+	uint32_t width,
+	uint32_t height,
+	RawVulkanSwapchain* swapchain) {
+
+	memset(swapchain, 0, sizeof(RawVulkanSwapchain));
+
+	swapchain->physical_device = physical_device;
+	swapchain->presentation_surface = presentation_surface;
+	swapchain->image_usage = desired_image_usage;
+	swapchain->transformation = desired_transformation;
+	swapchain->n_extra_images = present_policy->n_extra_images;
+
+	if (!rawChooseVulkanPresentMode(physical_device, presentation_surface,
+		present_policy->present_modes, present_policy->n_present_modes,
+		&swapchain->present_mode))
+		return false;
+
+	VkResult result = vkGetPhysicalDeviceSurfaceCapabilitiesKHR(
+		physical_device, presentation_surface,
+		&swapchain->surface_capabilities);
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("Could not retrieve device surface capabilities!");
+		return false;
+	}
+
+	if (!rawCheckVulkanSurfaceCapabilities(&swapchain->surface_capabilities,
+		desired_image_usage, desired_transformation))
+		return false;
+
+	if (!rawGetAvailableVulkanSurfaceFormats(physical_device,
+		presentation_surface, &swapchain->surface_formats,
+		&swapchain->n_surface_formats))
+		return false;
+
+	rawChooseVulkanSurfaceFormat(
+		swapchain->surface_formats, swapchain->n_surface_formats,
+		present_policy->surface_formats, present_policy->n_surface_formats,
+		&swapchain->surface_format);
+
+	if (!rawRecreateVulkanSwapchain(logical_device, RAW_NULL_PTR,
+		width, height, swapchain)) {
+		RAW_MEM_FREE(swapchain->surface_formats);
+		return false;
+	}
+
+	RAW_LOG_INFO("Swapchain present mode: %d, format: %d, images: %d",
+		swapchain->present_mode, swapchain->surface_format.format,
+		swapchain->n_images);
+
+	return true;
+}
+
+void rawDestroyVulkanResizableSwapchain(
+	VkDevice logical_device,
+	RawVulkanSwapchain* swapchain) {
+
+	for (uint32_t i = 0; i < swapchain->n_retired_swapchains; ++i)
+		rawDestroyVulkanRetiredSwapchain(logical_device,
+			&swapchain->retired_swapchains[i]);
+
+	swapchain->n_retired_swapchains = 0u;
+
+	if (swapchain->swapchain != VK_NULL_HANDLE) {
+		rawDestroyVulkanSwapchainImageObjects(logical_device,
+			swapchain->image_views, swapchain->framebuffers,
+			swapchain->render_finished_semaphores, swapchain->n_images);
+
+		rawDestroyVulkanSwapchain(logical_device, &swapchain->swapchain);
+
+		RAW_MEM_FREE(swapchain->render_finished_semaphores);
+		RAW_MEM_FREE(swapchain->framebuffers);
+		RAW_MEM_FREE(swapchain->image_views);
+		RAW_MEM_FREE(swapchain->images);
+	}
+
+	if (swapchain->surface_formats)
+		RAW_MEM_FREE(swapchain->surface_formats);
+}
+
+bool rawResizeVulkanSwapchain(
+	VkDevice logical_device,
+	RawVulkanFrameManager const* const frame_manager,
+	uint32_t width,
+	uint32_t height,
+	RawVulkanSwapchain* swapchain) {
+
+	rawReleaseRetiredVulkanSwapchains(logical_device,
+		frame_manager, swapchain);
+
+	// The extent changes with the window, the rest stays cached
+	VkResult result = vkGetPhysicalDeviceSurfaceCapabilitiesKHR(
+		swapchain->physical_device, swapchain->presentation_surface,
+		&swapchain->surface_capabilities);
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("Could not retrieve device surface capabilities!");
+		return false;
+	}
+
+	return rawRecreateVulkanSwapchain(logical_device,
+		frame_manager, width, height, swapchain);
+}
+
+void rawReleaseRetiredVulkanSwapchains(
+	VkDevice logical_device,
+	RawVulkanFrameManager const* const frame_manager,
+	RawVulkanSwapchain* swapchain) {
+
+	uint32_t n_retired_swapchains = 0u;
+
+	for (uint32_t i = 0; i < swapchain->n_retired_swapchains; ++i) {
+		RawVulkanRetiredSwapchain* retired_swapchain =
+			&swapchain->retired_swapchains[i];
+
+		if (rawIsVulkanRetiredSwapchainIdle(logical_device,
+			frame_manager, retired_swapchain))
+			rawDestroyVulkanRetiredSwapchain(
+				logical_device, retired_swapchain);
+		else
+			swapchain->retired_swapchains[n_retired_swapchains++] =
+				*retired_swapchain;
+	}
+
+	swapchain->n_retired_swapchains = n_retired_swapchains;
+}
+
+bool rawGetVulkanSwapchainImageView(
+	VkDevice logical_device,
+	RawVulkanSwapchain* swapchain,
+	uint32_t image_index,
+	VkImageView* image_view) {
+
+	if (image_index >= swapchain->n_images) {
+		RAW_LOG_ERROR("Invalid swapchain image index!");
+		return false;
+	}
+
+	if (swapchain->image_views[image_index] == VK_NULL_HANDLE) {
+		VkImageViewCreateInfo image_view_create_info = {
+			.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
+			.pNext = RAW_NULL_PTR,
+			.flags = 0,
+			.image = swapchain->images[image_index],
+			.viewType = VK_IMAGE_VIEW_TYPE_2D,
+			.format = swapchain->surface_format.format,
+			.components = {
+				VK_COMPONENT_SWIZZLE_IDENTITY,
+				VK_COMPONENT_SWIZZLE_IDENTITY,
+				VK_COMPONENT_SWIZZLE_IDENTITY,
+				VK_COMPONENT_SWIZZLE_IDENTITY
+			},
+			.subresourceRange = {
+				VK_IMAGE_ASPECT_COLOR_BIT, 0u, 1u, 0u, 1u
+			}
+		};
 
-	if (swapchain) {
 		// TODO: Pass allocation callback
-		vkDestroySwapchainKHR(logical_device, *swapchain, RAW_NULL_PTR);
-		*swapchain = VK_NULL_HANDLE;
+		VkResult result = vkCreateImageView(logical_device,
+			&image_view_create_info, RAW_NULL_PTR,
+			&swapchain->image_views[image_index]);
+
+		if (result != VK_SUCCESS) {
+			RAW_LOG_ERROR("Could not create swapchain image view!");
+			swapchain->image_views[image_index] = VK_NULL_HANDLE;
+			return false;
+		}
 	}
-	else
-		RAW_LOG_WARNING("Attempting to destroy "
-			"NULL Vulkan swapchain!");
+
+	*image_view = swapchain->image_views[image_index];
+
+	return true;
+}
+
+bool rawGetVulkanSwapchainFramebuffer(
+	VkDevice logical_device,
+	RawVulkanSwapchain* swapchain,
+	VkRenderPass render_pass,
+	uint32_t image_index,
+	VkFramebuffer* framebuffer) {
+
+	if (swapchain->framebuffer_render_pass != VK_NULL_HANDLE &&
+		swapchain->framebuffer_render_pass != render_pass) {
+		RAW_LOG_ERROR("Swapchain framebuffers belong to "
+			"another render pass!");
+		return false;
+	}
+
+	VkImageView image_view;
+
+	if (!rawGetVulkanSwapchainImageView(logical_device,
+		swapchain, image_index, &image_view))
+		return false;
+
+	if (swapchain->framebuffers[image_index] == VK_NULL_HANDLE) {
+		VkFramebufferCreateInfo framebuffer_create_info = {
+			.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO,
+			.pNext = RAW_NULL_PTR,
+			.flags = 0,
+			.renderPass = render_pass,
+			.attachmentCount = 1u,
+			.pAttachments = &image_view,
+			.width = swapchain->extent.width,
+			.height = swapchain->extent.height,
+			.layers = 1u
+		};
+
+		// TODO: Pass allocation callback
+		VkResult result = vkCreateFramebuffer(logical_device,
+			&framebuffer_create_info, RAW_NULL_PTR,
+			&swapchain->framebuffers[image_index]);
+
+		if (result != VK_SUCCESS) {
+			RAW_LOG_ERROR("Could not create swapchain framebuffer!");
+			swapchain->framebuffers[image_index] = VK_NULL_HANDLE;
+			return false;
+		}
+
+		swapchain->framebuffer_render_pass = render_pass;
+	}
+
+	*framebuffer = swapchain->framebuffers[image_index];
+
+	return true;
 }
 
 void rawDestroyVulkanPresentationSurface(
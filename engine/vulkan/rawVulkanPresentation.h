@@ -28,7 +28,7 @@
  *
  * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
  * Created: 08/04/2020
- * Last modified: 16/06/2020
+ * Last modified: 19/10/2026
  */
 
 #ifndef RAW_VULKAN_PRESENTATION_H
@@ -36,6 +36,7 @@
 
 #include <engine/platform/rawPlatform.h>
 #include <engine/vulkan/rawVulkan.h>
+#include <engine/vulkan/rawVulkanFrame.h>
 
 #include <inttypes.h>
 #include <stdbool.h>
@@ -87,8 +88,8 @@ bool rawGetAvailableVulkanPresentModes(
  * It's the caller's responsibility to free that
  * memory through a call to RAW_MEM_FREE
  *
- * The swapchain image format is fixed for now
- * TODO: make swapchain image format dynamic
+ * Falls back to FIFO if @desired_present_mode isn't supported. The
+ * image format is chosen from the formats of the tear-free policy.
  */
 bool rawCreateVulkanSwapchain(
 	VkPhysicalDevice physical_device,
@@ -108,6 +109,193 @@ void rawDestroyVulkanSwapchain(
 	VkDevice logical_device,
 	VkSwapchainKHR* swapchain);
 
+#define RAW_VULKAN_MAX_POLICY_PRESENT_MODES 4u
+#define RAW_VULKAN_MAX_POLICY_SURFACE_FORMATS 4u
+
+typedef enum {
+	// MAILBOX > IMMEDIATE > FIFO_RELAXED > FIFO, minimum images + 1
+	RAW_VULKAN_PRESENT_POLICY_LOW_LATENCY,
+
+	// IMMEDIATE > MAILBOX > FIFO_RELAXED > FIFO, minimum images + 2
+	RAW_VULKAN_PRESENT_POLICY_MAX_THROUGHPUT,
+
+	// FIFO, minimum images
+	RAW_VULKAN_PRESENT_POLICY_POWER_SAVING,
+
+	// MAILBOX > FIFO, minimum images + 1
+	RAW_VULKAN_PRESENT_POLICY_TEAR_FREE
+} RawVulkanPresentPolicyPreset;
+
+/*
+ * Ranked swapchain preferences. The first present mode and surface
+ * format supported by the surface are chosen. FIFO, always supported,
+ * is the fallback present mode, the first format reported by the
+ * surface the fallback format. The image count is the surface minimum
+ * plus @n_extra_images, clamped to the surface maximum.
+ */
+typedef struct {
+	VkPresentModeKHR present_modes[RAW_VULKAN_MAX_POLICY_PRESENT_MODES];
+	uint32_t n_present_modes;
+
+	VkSurfaceFormatKHR surface_formats[
+		RAW_VULKAN_MAX_POLICY_SURFACE_FORMATS];
+	uint32_t n_surface_formats;
+
+	uint32_t n_extra_images;
+} RawVulkanPresentPolicy;
+
+/*
+ * Fills @present_policy with one of the presets, which can
+ * then be tweaked before creating the swapchain
+ */
+void rawGetVulkanPresentPolicy(
+	RawVulkanPresentPolicyPreset preset,
+	RawVulkanPresentPolicy* present_policy);
+
+// Choices @present_policy leads to on @presentation_surface
+bool rawResolveVulkanPresentPolicy(
+	VkPhysicalDevice physical_device,
+	VkSurfaceKHR presentation_surface,
+	RawVulkanPresentPolicy const* const present_policy,
+	VkPresentModeKHR* present_mode,
+	VkSurfaceFormatKHR* surface_format,
+	uint32_t* n_images);
+
+// Max. swapchains waiting for their frames in flight to finish
+#define RAW_VULKAN_MAX_RETIRED_SWAPCHAINS 4u
+
+/*
+ * A swapchain replaced by a resize. It's kept alive until the frames
+ * submitted before @retire_frame_number are done with its images, and
+ * one more frame is done so its last presents are over.
+ */
+typedef struct {
+	VkSwapchainKHR swapchain;
+	VkImage* images;
+	VkImageView* image_views;
+	VkFramebuffer* framebuffers;
+	VkSemaphore* render_finished_semaphores;
+	uint32_t n_images;
+	uint64_t retire_frame_number;
+} RawVulkanRetiredSwapchain;
+
+typedef struct {
+	VkPhysicalDevice physical_device;
+	VkSurfaceKHR presentation_surface;
+
+	// Queried once, on creation
+	VkSurfaceFormatKHR* surface_formats;
+	uint32_t n_surface_formats;
+
+	// Queried on creation and on every resize
+	VkSurfaceCapabilitiesKHR surface_capabilities;
+
+	VkSurfaceFormatKHR surface_format;
+	VkPresentModeKHR present_mode;
+	uint32_t n_extra_images;
+	VkImageUsageFlags image_usage;
+	VkSurfaceTransformFlagBitsKHR transformation;
+
+	VkSwapchainKHR swapchain;
+	VkExtent2D extent;
+	VkImage* images;
+	uint32_t n_images;
+
+	// Created on first use of each image
+	VkImageView* image_views;
+	VkFramebuffer* framebuffers;
+	VkRenderPass framebuffer_render_pass;
+
+	/*
+	 * Signaled by the frame rendering to an image and waited by its
+	 * present, see rawEndVulkanFrame. An image is only acquired again
+	 * once its previous present is done, so a semaphore is never
+	 * signaled while a present still waits on it.
+	 */
+	VkSemaphore* render_finished_semaphores;
+
+	// Incremented on every recreation
+	uint32_t generation;
+
+	// Set while the surface has no area (minimized window)
+	bool out_of_date;
+
+	RawVulkanRetiredSwapchain retired_swapchains[
+		RAW_VULKAN_MAX_RETIRED_SWAPCHAINS];
+	uint32_t n_retired_swapchains;
+} RawVulkanSwapchain;
+
+/*
+ * Creates a swapchain that can be resized without stalling the GPU.
+ * Surface formats and capabilities are cached, image views and
+ * framebuffers are created on demand. @width and @height are only
+ * used if the surface doesn't define its own extent. Present mode,
+ * image count and format follow @present_policy.
+ */
+bool rawCreateVulkanResizableSwapchain(
+	VkPhysicalDevice physical_device,
+	VkDevice logical_device,
+	VkSurfaceKHR presentation_surface,
+	RawVulkanPresentPolicy const* const present_policy,
+	VkImageUsageFlags desired_image_usage,
+	VkSurfaceTransformFlagBitsKHR desired_transformation,
+	uint32_t width,
+	uint32_t height,
+	RawVulkanSwapchain* swapchain);
+
+/*
+ * Destroys the swapchain and every retired one.
+ * It's the caller's responsibility to guarantee the GPU
+ * and the presentation engine are done with them.
+ */
+void rawDestroyVulkanResizableSwapchain(
+	VkDevice logical_device,
+	RawVulkanSwapchain* swapchain);
+
+/*
+ * Recreates the swapchain with the current surface extent, passing the
+ * old one as oldSwapchain. The old swapchain is retired instead of
+ * destroyed, so no vkDeviceWaitIdle is needed. Must be called between
+ * frames of @frame_manager.
+ *
+ * If the surface has no area, nothing is recreated and
+ * @swapchain->out_of_date stays set until a later resize succeeds.
+ */
+bool rawResizeVulkanSwapchain(
+	VkDevice logical_device,
+	RawVulkanFrameManager const* const frame_manager,
+	uint32_t width,
+	uint32_t height,
+	RawVulkanSwapchain* swapchain);
+
+/*
+ * Destroys the retired swapchains whose frames in flight are done,
+ * checked through the frame fences. Fences don't cover presentation,
+ * so a retired swapchain also waits for the first frame submitted
+ * after its retirement to be done. Doesn't block.
+ */
+void rawReleaseRetiredVulkanSwapchains(
+	VkDevice logical_device,
+	RawVulkanFrameManager const* const frame_manager,
+	RawVulkanSwapchain* swapchain);
+
+bool rawGetVulkanSwapchainImageView(
+	VkDevice logical_device,
+	RawVulkanSwapchain* swapchain,
+	uint32_t image_index,
+	VkImageView* image_view);
+
+/*
+ * Framebuffers have the image view as their single attachment.
+ * All of them must be requested with the same @render_pass.
+ */
+bool rawGetVulkanSwapchainFramebuffer(
+	VkDevice logical_device,
+	RawVulkanSwapchain* swapchain,
+	VkRenderPass render_pass,
+	uint32_t image_index,
+	VkFramebuffer* framebuffer);
+
 void rawDestroyVulkanPresentationSurface(
 	VkInstance instance,
 	VkSurfaceKHR* presentation_surface);
@@ -0,0 +1,478 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanReadback.c"
+ *
+ * Asynchronous GPU readback
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+
+#include <engine/vulkan/rawVulkanReadback.h>
+#include <engine/vulkan/rawVulkanMemory.h>
+#include <engine/platform/rawMemory.h>
+#include <engine/utils/rawLogger.h>
+
+#include <string.h>
+
+bool rawCreateVulkanReadbackQueue(
+	VkDevice logical_device,
+	VkPhysicalDeviceMemoryProperties const* const memory_properties,
+	uint32_t n_slots,
+	VkDeviceSize slot_size,
+	RawVulkanReadbackQueue* readback_queue) {
+
+	memset(readback_queue, 0, sizeof(RawVulkanReadbackQueue));
+
+	readback_queue->n_slots = n_slots;
+	readback_queue->slot_size = slot_size;
+
+	RAW_MEM_ALLOC(readback_queue->slots,
+		(uint64_t)n_slots, sizeof(RawVulkanReadbackSlot));
+	RAW_MEM_ALLOC(readback_queue->free_slots,
+		(uint64_t)n_slots, sizeof(uint32_t));
+
+	if (!readback_queue->slots || !readback_queue->free_slots) {
+		RAW_LOG_ERROR("RAW_MEM_ALLOC failed on "
+			"rawCreateVulkanReadbackQueue!");
+		rawDestroyVulkanReadbackQueue(logical_device, readback_queue);
+		return false;
+	}
+
+	memset(readback_queue->slots, 0,
+		n_slots * sizeof(RawVulkanReadbackSlot));
+
+	VkBufferCreateInfo buffer_create_info = {
+		.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = 0,
+		.size = slot_size,
+		.usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+		.sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+		.queueFamilyIndexCount = 0u,
+		.pQueueFamilyIndices = RAW_NULL_PTR
+	};
+
+	for (uint32_t i = 0; i < n_slots; ++i) {
+		RawVulkanReadbackSlot* slot = &readback_queue->slots[i];
+
+		// TODO: Pass allocation callback
+		VkResult result = vkCreateBuffer(logical_device,
+			&buffer_create_info, RAW_NULL_PTR, &slot->buffer);
+
+		if (result != VK_SUCCESS) {
+			RAW_LOG_ERROR("vkCreateBuffer failed!");
+			rawDestroyVulkanReadbackQueue(logical_device, readback_queue);
+			return false;
+		}
+
+		VkMemoryRequirements memory_requirements;
+
+		vkGetBufferMemoryRequirements(logical_device,
+			slot->buffer, &memory_requirements);
+
+		VkMemoryPropertyFlags memory_type_properties;
+
+		// Cached memory makes host reads much faster
+		if (!rawAllocateVulkanMemory(logical_device, memory_properties,
+			&memory_requirements, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT,
+			VK_MEMORY_PROPERTY_HOST_CACHED_BIT, &memory_type_properties,
+			&slot->memory)) {
+			RAW_LOG_ERROR("rawAllocateVulkanMemory failed!");
+			rawDestroyVulkanReadbackQueue(logical_device, readback_queue);
+			return false;
+		}
+
+		readback_queue->coherent = (memory_type_properties &
+			VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) != 0;
+
+		result = vkBindBufferMemory(logical_device,
+			slot->buffer, slot->memory, 0u);
+
+		if (result == VK_SUCCESS) {
+			result = vkMapMemory(logical_device, slot->memory,
+				0u, VK_WHOLE_SIZE, 0, &slot->data);
+		}
+
+		if (result != VK_SUCCESS) {
+			RAW_LOG_ERROR("Readback staging buffer setup failed!");
+			slot->data = RAW_NULL_PTR;
+			rawDestroyVulkanReadbackQueue(logical_device, readback_queue);
+			return false;
+		}
+
+		// Lower slots are handed out first
+		readback_queue->free_slots[n_slots - 1u - i] = i;
+	}
+
+	readback_queue->n_free_slots = n_slots;
+
+	return true;
+}
+
+void rawDestroyVulkanReadbackQueue(
+	VkDevice logical_device,
+	RawVulkanReadbackQueue* readback_queue) {
+
+	if (readback_queue->slots) {
+		for (uint32_t i = 0; i < readback_queue->n_slots; ++i) {
+			RawVulkanReadbackSlot* slot = &readback_queue->slots[i];
+
+			if (slot->state == RAW_VULKAN_READBACK_SUBMITTED) {
+				rawWaitVulkanQueueTimeline(logical_device,
+					slot->completion.timeline, slot->completion.value,
+					UINT64_MAX);
+			}
+
+			if (slot->data)
+				vkUnmapMemory(logical_device, slot->memory);
+
+			if (slot->buffer != VK_NULL_HANDLE) {
+				// TODO: Pass allocation callback
+				vkDestroyBuffer(logical_device, slot->buffer, RAW_NULL_PTR);
+			}
+
+			if (slot->memory != VK_NULL_HANDLE)
+				rawFreeVulkanMemory(logical_device, &slot->memory);
+		}
+
+		RAW_MEM_FREE(readback_queue->slots);
+	}
+
+	if (readback_queue->free_slots)
+		RAW_MEM_FREE(readback_queue->free_slots);
+
+	readback_queue->n_free_slots = 0u;
+}
+
+static void rawFreeVulkanReadbackSlot(
+	RawVulkanReadbackQueue* readback_queue,
+	uint32_t slot_index) {
+
+	RawVulkanReadbackSlot* slot = &readback_queue->slots[slot_index];
+
+	slot->state = RAW_VULKAN_READBACK_FREE;
+	slot->released = false;
+	++slot->generation;
+
+	readback_queue->free_slots[readback_queue->n_free_slots++] = slot_index;
+}
+
+static bool rawIsVulkanReadbackCompleted(
+	VkDevice logical_device,
+	RawVulkanReadbackSlot const* const slot) {
+
+	return slot->state == RAW_VULKAN_READBACK_SUBMITTED &&
+		rawIsVulkanTimelinePointCompleted(logical_device, &slot->completion);
+}
+
+/*
+ * Takes a free staging buffer, reclaiming the released ones whose
+ * copies completed if there are none. Returns UINT32_MAX if all
+ * of them are in use.
+ */
+static uint32_t rawAcquireVulkanReadbackSlot(
+	VkDevice logical_device,
+	RawVulkanReadbackQueue* readback_queue,
+	VkDeviceSize size) {
+
+	if (size == 0u || size > readback_queue->slot_size) {
+		RAW_LOG_ERROR("Readback of %" PRIu64 " bytes doesn't fit in "
+			"%" PRIu64 " bytes slots!", (uint64_t)size,
+			(uint64_t)readback_queue->slot_size);
+		return UINT32_MAX;
+	}
+
+	if (readback_queue->n_free_slots == 0u) {
+		for (uint32_t i = 0; i < readback_queue->n_slots; ++i) {
+			RawVulkanReadbackSlot* slot = &readback_queue->slots[i];
+
+			if (slot->released &&
+				rawIsVulkanReadbackCompleted(logical_device, slot))
+				rawFreeVulkanReadbackSlot(readback_queue, i);
+		}
+	}
+
+	if (readback_queue->n_free_slots == 0u) {
+		RAW_LOG_WARNING("Every readback staging buffer is in use!");
+		return UINT32_MAX;
+	}
+
+	uint32_t slot_index =
+		readback_queue->free_slots[--readback_queue->n_free_slots];
+
+	RawVulkanReadbackSlot* slot = &readback_queue->slots[slot_index];
+
+	slot->state = RAW_VULKAN_READBACK_RECORDED;
+	slot->size = size;
+	slot->invalidated = false;
+
+	return slot_index;
+}
+
+// Makes the staging buffer writes visible to the host once executed
+static void rawCmdVulkanReadbackHostBarrier(
+	VkCommandBuffer command_buffer,
+	RawVulkanReadbackSlot const* const slot) {
+
+	VkBufferMemoryBarrier barrier = {
+		.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+		.pNext = RAW_NULL_PTR,
+		.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+		.dstAccessMask = VK_ACCESS_HOST_READ_BIT,
+		.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+		.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+		.buffer = slot->buffer,
+		.offset = 0u,
+		.size = slot->size
+	};
+
+	vkCmdPipelineBarrier(command_buffer,
+		VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0,
+		0u, RAW_NULL_PTR, 1u, &barrier, 0u, RAW_NULL_PTR);
+}
+
+bool rawRecordVulkanBufferReadback(
+	VkDevice logical_device,
+	RawVulkanReadbackQueue* readback_queue,
+	VkCommandBuffer command_buffer,
+	VkBuffer buffer,
+	VkDeviceSize offset,
+	VkDeviceSize size,
+	VkPipelineStageFlags src_stages,
+	VkAccessFlags src_access,
+	RawVulkanReadbackFuture* future) {
+
+	uint32_t slot_index = rawAcquireVulkanReadbackSlot(
+		logical_device, readback_queue, size);
+
+	if (slot_index == UINT32_MAX)
+		return false;
+
+	RawVulkanReadbackSlot* slot = &readback_queue->slots[slot_index];
+
+	VkBufferMemoryBarrier barrier = {
+		.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+		.pNext = RAW_NULL_PTR,
+		.srcAccessMask = src_access,
+		.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT,
+		.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+		.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+		.buffer = buffer,
+		.offset = offset,
+		.size = size
+	};
+
+	vkCmdPipelineBarrier(command_buffer,
+		src_stages, VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
+		0u, RAW_NULL_PTR, 1u, &barrier, 0u, RAW_NULL_PTR);
+
+	VkBufferCopy region = {
+		.srcOffset = offset,
+		.dstOffset = 0u,
+		.size = size
+	};
+
+	vkCmdCopyBuffer(command_buffer, buffer, slot->buffer, 1u, &region);
+
+	rawCmdVulkanReadbackHostBarrier(command_buffer, slot);
+
+	future->slot = slot_index;
+	future->generation = slot->generation;
+
+	return true;
+}
+
+bool rawRecordVulkanImageReadback(
+	VkDevice logical_device,
+	RawVulkanReadbackQueue* readback_queue,
+	VkCommandBuffer command_buffer,
+	VkImage image,
+	VkImageLayout image_layout,
+	VkImageSubresourceLayers const* const subresource,
+	VkOffset3D offset,
+	VkExtent3D extent,
+	uint32_t texel_size,
+	VkPipelineStageFlags src_stages,
+	VkAccessFlags src_access,
+	RawVulkanReadbackFuture* future) {
+
+	VkDeviceSize size = (VkDeviceSize)texel_size * extent.width *
+		extent.height * extent.depth * subresource->layerCount;
+
+	uint32_t slot_index = rawAcquireVulkanReadbackSlot(
+		logical_device, readback_queue, size);
+
+	if (slot_index == UINT32_MAX)
+		return false;
+
+	RawVulkanReadbackSlot* slot = &readback_queue->slots[slot_index];
+
+	// Same layout on both ends, only the previous writes are waited
+	VkImageMemoryBarrier barrier = {
+		.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+		.pNext = RAW_NULL_PTR,
+		.srcAccessMask = src_access,
+		.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT,
+		.oldLayout = image_layout,
+		.newLayout = image_layout,
+		.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+		.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+		.image = image,
+		.subresourceRange = {
+			.aspectMask = subresource->aspectMask,
+			.baseMipLevel = subresource->mipLevel,
+			.levelCount = 1u,
+			.baseArrayLayer = subresource->baseArrayLayer,
+			.layerCount = subresource->layerCount
+		}
+	};
+
+	vkCmdPipelineBarrier(command_buffer,
+		src_stages, VK_PIPELINE_STAGE_TRANSFER_BIT, 0,
+		0u, RAW_NULL_PTR, 0u, RAW_NULL_PTR, 1u, &barrier);
+
+	VkBufferImageCopy region = {
+		.bufferOffset = 0u,
+		.bufferRowLength = 0u,
+		.bufferImageHeight = 0u,
+		.imageSubresource = *subresource,
+		.imageOffset = offset,
+		.imageExtent = extent
+	};
+
+	vkCmdCopyImageToBuffer(command_buffer, image, image_layout,
+		slot->buffer, 1u, &region);
+
+	rawCmdVulkanReadbackHostBarrier(command_buffer, slot);
+
+	future->slot = slot_index;
+	future->generation = slot->generation;
+
+	return true;
+}
+
+void rawSubmitVulkanReadbacks(
+	RawVulkanReadbackQueue* readback_queue,
+	RawVulkanTimelinePoint const* const completion) {
+
+	for (uint32_t i = 0; i < readback_queue->n_slots; ++i) {
+		RawVulkanReadbackSlot* slot = &readback_queue->slots[i];
+
+		if (slot->state == RAW_VULKAN_READBACK_RECORDED) {
+			slot->state = RAW_VULKAN_READBACK_SUBMITTED;
+			slot->completion = *completion;
+		}
+	}
+}
+
+static RawVulkanReadbackSlot* rawGetVulkanReadbackSlot(
+	RawVulkanReadbackQueue* readback_queue,
+	RawVulkanReadbackFuture const* const future) {
+
+	if (future->slot >= readback_queue->n_slots)
+		return RAW_NULL_PTR;
+
+	RawVulkanReadbackSlot* slot = &readback_queue->slots[future->slot];
+
+	if (slot->state == RAW_VULKAN_READBACK_FREE || slot->released ||
+		slot->generation != future->generation)
+		return RAW_NULL_PTR;
+
+	return slot;
+}
+
+bool rawPollVulkanReadback(
+	VkDevice logical_device,
+	RawVulkanReadbackQueue* readback_queue,
+	RawVulkanReadbackFuture const* const future,
+	bool* ready,
+	void const** data,
+	VkDeviceSize* size) {
+
+	*ready = false;
+
+	RawVulkanReadbackSlot* slot =
+		rawGetVulkanReadbackSlot(readback_queue, future);
+
+	if (!slot) {
+		RAW_LOG_ERROR("Polling a released readback!");
+		return false;
+	}
+
+	if (!rawIsVulkanReadbackCompleted(logical_device, slot))
+		return true;
+
+	if (!readback_queue->coherent && !slot->invalidated) {
+		VkMappedMemoryRange memory_range = {
+			.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE,
+			.pNext = RAW_NULL_PTR,
+			.memory = slot->memory,
+			.offset = 0u,
+			.size = VK_WHOLE_SIZE
+		};
+
+		VkResult result = vkInvalidateMappedMemoryRanges(logical_device,
+			1u, &memory_range);
+
+		if (result != VK_SUCCESS) {
+			RAW_LOG_ERROR("vkInvalidateMappedMemoryRanges failed!");
+			return false;
+		}
+
+		slot->invalidated = true;
+	}
+
+	*ready = true;
+	*data = slot->data;
+	*size = slot->size;
+
+	return true;
+}
+
+void rawReleaseVulkanReadback(
+	VkDevice logical_device,
+	RawVulkanReadbackQueue* readback_queue,
+	RawVulkanReadbackFuture const* const future) {
+
+	RawVulkanReadbackSlot* slot =
+		rawGetVulkanReadbackSlot(readback_queue, future);
+
+	if (!slot) {
+		RAW_LOG_WARNING("Attempting to release a released readback!");
+		return;
+	}
+
+	// The GPU may still write to it
+	if (slot->state == RAW_VULKAN_READBACK_RECORDED ||
+		!rawIsVulkanReadbackCompleted(logical_device, slot)) {
+		slot->released = true;
+		return;
+	}
+
+	rawFreeVulkanReadbackSlot(readback_queue, future->slot);
+}
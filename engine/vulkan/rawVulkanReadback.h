@@ -0,0 +1,175 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanReadback.h"
+ *
+ * Asynchronous GPU readback
+ *
+ * Copies of buffers and images are recorded into the caller's command
+ * buffers, targeting a pool of persistently mapped, preferably host
+ * cached, staging buffers. Each copy returns a future, tied to the queue
+ * timeline point of its submission and polled frames later, so reading
+ * GPU results back never waits for the queue to go idle.
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+
+#ifndef RAW_VULKAN_READBACK_H
+#define RAW_VULKAN_READBACK_H
+
+#include <engine/vulkan/rawVulkan.h>
+#include <engine/vulkan/rawVulkanSync.h>
+
+#include <inttypes.h>
+#include <stdbool.h>
+
+typedef enum {
+	RAW_VULKAN_READBACK_FREE,
+
+	// Copy recorded, but its submission wasn't reported yet
+	RAW_VULKAN_READBACK_RECORDED,
+
+	RAW_VULKAN_READBACK_SUBMITTED
+} RawVulkanReadbackState;
+
+typedef struct {
+	VkBuffer buffer;
+	VkDeviceMemory memory;
+	void* data;
+
+	// Bytes copied by the current request
+	VkDeviceSize size;
+
+	RawVulkanReadbackState state;
+	RawVulkanTimelinePoint completion;
+
+	// Incremented on every reuse, so stale futures are detected
+	uint32_t generation;
+
+	// The owner released the future before the copy completed
+	bool released;
+	bool invalidated;
+} RawVulkanReadbackSlot;
+
+typedef struct {
+	RawVulkanReadbackSlot* slots;
+	uint32_t n_slots;
+	VkDeviceSize slot_size;
+
+	bool coherent;
+
+	uint32_t* free_slots;
+	uint32_t n_free_slots;
+} RawVulkanReadbackQueue;
+
+typedef struct {
+	uint32_t slot;
+	uint32_t generation;
+} RawVulkanReadbackFuture;
+
+/*
+ * Creates @n_slots staging buffers of @slot_size bytes each, which
+ * bounds the size of a single readback and how many can be pending
+ */
+bool rawCreateVulkanReadbackQueue(
+	VkDevice logical_device,
+	VkPhysicalDeviceMemoryProperties const* const memory_properties,
+	uint32_t n_slots,
+	VkDeviceSize slot_size,
+	RawVulkanReadbackQueue* readback_queue);
+
+// Waits for the readbacks in flight before destroying the buffers
+void rawDestroyVulkanReadbackQueue(
+	VkDevice logical_device,
+	RawVulkanReadbackQueue* readback_queue);
+
+/*
+ * Records a copy of @size bytes of @buffer, last accessed with
+ * @src_access at @src_stages, into a staging buffer. Fails if no
+ * staging buffer is free or @size is larger than the slot size.
+ */
+bool rawRecordVulkanBufferReadback(
+	VkDevice logical_device,
+	RawVulkanReadbackQueue* readback_queue,
+	VkCommandBuffer command_buffer,
+	VkBuffer buffer,
+	VkDeviceSize offset,
+	VkDeviceSize size,
+	VkPipelineStageFlags src_stages,
+	VkAccessFlags src_access,
+	RawVulkanReadbackFuture* future);
+
+/*
+ * Records a copy of a region of @image, in @image_layout (either
+ * TRANSFER_SRC_OPTIMAL or GENERAL), into a staging buffer. Rows are
+ * tightly packed, @texel_size being the size of a texel in bytes.
+ */
+bool rawRecordVulkanImageReadback(
+	VkDevice logical_device,
+	RawVulkanReadbackQueue* readback_queue,
+	VkCommandBuffer command_buffer,
+	VkImage image,
+	VkImageLayout image_layout,
+	VkImageSubresourceLayers const* const subresource,
+	VkOffset3D offset,
+	VkExtent3D extent,
+	uint32_t texel_size,
+	VkPipelineStageFlags src_stages,
+	VkAccessFlags src_access,
+	RawVulkanReadbackFuture* future);
+
+/*
+ * Ties every readback recorded since the last call to @completion,
+ * the timeline point of the submission carrying their command buffers
+ */
+void rawSubmitVulkanReadbacks(
+	RawVulkanReadbackQueue* readback_queue,
+	RawVulkanTimelinePoint const* const completion);
+
+/*
+ * Resolves @future without blocking. @ready is set once the copy
+ * has completed, with its bytes in @data and @size. They are valid
+ * until the future is released.
+ */
+bool rawPollVulkanReadback(
+	VkDevice logical_device,
+	RawVulkanReadbackQueue* readback_queue,
+	RawVulkanReadbackFuture const* const future,
+	bool* ready,
+	void const** data,
+	VkDeviceSize* size);
+
+/*
+ * Gives the staging buffer of @future back to the pool. If the copy
+ * is still in flight, the buffer is only reused once it completes.
+ */
+void rawReleaseVulkanReadback(
+	VkDevice logical_device,
+	RawVulkanReadbackQueue* readback_queue,
+	RawVulkanReadbackFuture const* const future);
+
+#endif // RAW_VULKAN_READBACK_H
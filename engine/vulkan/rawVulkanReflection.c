@@ -0,0 +1,702 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanReflection.c"
+ *
+ * SPIR-V reflection
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+
+#include <engine/vulkan/rawVulkanReflection.h>
+#include <engine/platform/rawMemory.h>
+#include <engine/utils/rawLogger.h>
+
+#include <string.h>
+
+// From the SPIR-V specification
+#define RAW_SPIRV_MAGIC 0x07230203u
+#define RAW_SPIRV_HEADER_SIZE 5u
+
+#define RAW_SPIRV_OP_ENTRY_POINT 15u
+#define RAW_SPIRV_OP_TYPE_INT 21u
+#define RAW_SPIRV_OP_TYPE_FLOAT 22u
+#define RAW_SPIRV_OP_TYPE_VECTOR 23u
+#define RAW_SPIRV_OP_TYPE_MATRIX 24u
+#define RAW_SPIRV_OP_TYPE_IMAGE 25u
+#define RAW_SPIRV_OP_TYPE_SAMPLER 26u
+#define RAW_SPIRV_OP_TYPE_SAMPLED_IMAGE 27u
+#define RAW_SPIRV_OP_TYPE_ARRAY 28u
+#define RAW_SPIRV_OP_TYPE_RUNTIME_ARRAY 29u
+#define RAW_SPIRV_OP_TYPE_STRUCT 30u
+#define RAW_SPIRV_OP_TYPE_POINTER 32u
+#define RAW_SPIRV_OP_CONSTANT 43u
+#define RAW_SPIRV_OP_VARIABLE 59u
+#define RAW_SPIRV_OP_DECORATE 71u
+#define RAW_SPIRV_OP_MEMBER_DECORATE 72u
+
+#define RAW_SPIRV_DECORATION_BLOCK 2u
+#define RAW_SPIRV_DECORATION_BUFFER_BLOCK 3u
+#define RAW_SPIRV_DECORATION_ARRAY_STRIDE 6u
+#define RAW_SPIRV_DECORATION_MATRIX_STRIDE 7u
+#define RAW_SPIRV_DECORATION_BUILT_IN 11u
+#define RAW_SPIRV_DECORATION_LOCATION 30u
+#define RAW_SPIRV_DECORATION_BINDING 33u
+#define RAW_SPIRV_DECORATION_DESCRIPTOR_SET 34u
+#define RAW_SPIRV_DECORATION_OFFSET 35u
+
+#define RAW_SPIRV_STORAGE_CLASS_UNIFORM_CONSTANT 0u
+#define RAW_SPIRV_STORAGE_CLASS_INPUT 1u
+#define RAW_SPIRV_STORAGE_CLASS_UNIFORM 2u
+#define RAW_SPIRV_STORAGE_CLASS_PUSH_CONSTANT 9u
+#define RAW_SPIRV_STORAGE_CLASS_STORAGE_BUFFER 12u
+
+#define RAW_SPIRV_DIM_BUFFER 5u
+#define RAW_SPIRV_DIM_SUBPASS_DATA 6u
+
+// Nested types deeper than this are treated as malformed
+#define RAW_SPIRV_MAX_TYPE_DEPTH 16u
+
+typedef struct {
+	// Word index of the defining instruction, 0 if undefined
+	uint32_t instruction;
+
+	uint32_t set;
+	uint32_t binding;
+	uint32_t location;
+	uint32_t array_stride;
+
+	bool has_set;
+	bool has_binding;
+	bool has_location;
+	bool built_in;
+	bool block;
+	bool buffer_block;
+} RawSpirvId;
+
+typedef struct {
+	uint32_t const* code;
+	uint32_t n_words;
+	RawSpirvId* ids;
+	uint32_t bound;
+} RawSpirvModule;
+
+static uint32_t rawGetSpirvOpcode(uint32_t const* instruction) {
+	return instruction[0] & 0xffffu;
+}
+
+// Operands past the end of the instruction read as 0
+static uint32_t rawGetSpirvOperand(
+	uint32_t const* instruction,
+	uint32_t index) {
+	return index < (instruction[0] >> 16) ? instruction[index] : 0u;
+}
+
+static uint32_t const* rawGetSpirvDefinition(
+	RawSpirvModule const* const module,
+	uint32_t id) {
+
+	if (id >= module->bound || module->ids[id].instruction == 0u)
+		return RAW_NULL_PTR;
+
+	return module->code + module->ids[id].instruction;
+}
+
+static bool rawGetSpirvMemberDecoration(
+	RawSpirvModule const* const module,
+	uint32_t struct_id,
+	uint32_t member,
+	uint32_t decoration,
+	uint32_t* value) {
+
+	for (uint32_t i = RAW_SPIRV_HEADER_SIZE; i < module->n_words;
+		i += module->code[i] >> 16) {
+
+		uint32_t const* instruction = module->code + i;
+
+		if (rawGetSpirvOpcode(instruction) == RAW_SPIRV_OP_MEMBER_DECORATE &&
+			rawGetSpirvOperand(instruction, 1u) == struct_id &&
+			rawGetSpirvOperand(instruction, 2u) == member &&
+			rawGetSpirvOperand(instruction, 3u) == decoration) {
+			*value = rawGetSpirvOperand(instruction, 4u);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+// Size in bytes of @type_id, as laid out in a block
+static uint32_t rawGetSpirvTypeSize(
+	RawSpirvModule const* const module,
+	uint32_t type_id,
+	uint32_t matrix_stride,
+	uint32_t depth) {
+
+	uint32_t const* type = rawGetSpirvDefinition(module, type_id);
+
+	if (!type || depth == RAW_SPIRV_MAX_TYPE_DEPTH)
+		return 0u;
+
+	switch (rawGetSpirvOpcode(type)) {
+	case RAW_SPIRV_OP_TYPE_INT:
+	case RAW_SPIRV_OP_TYPE_FLOAT:
+		return rawGetSpirvOperand(type, 2u) / 8u;
+
+	case RAW_SPIRV_OP_TYPE_VECTOR:
+		return rawGetSpirvOperand(type, 3u) * rawGetSpirvTypeSize(module,
+			rawGetSpirvOperand(type, 2u), 0u, depth + 1u);
+
+	case RAW_SPIRV_OP_TYPE_MATRIX: {
+		uint32_t column_size = matrix_stride > 0u ? matrix_stride :
+			rawGetSpirvTypeSize(module,
+				rawGetSpirvOperand(type, 2u), 0u, depth + 1u);
+
+		return rawGetSpirvOperand(type, 3u) * column_size;
+	}
+
+	case RAW_SPIRV_OP_TYPE_ARRAY: {
+		uint32_t const* length = rawGetSpirvDefinition(
+			module, rawGetSpirvOperand(type, 3u));
+
+		if (!length || rawGetSpirvOpcode(length) != RAW_SPIRV_OP_CONSTANT)
+			return 0u;
+
+		uint32_t stride = module->ids[type_id].array_stride;
+
+		if (stride == 0u)
+			stride = rawGetSpirvTypeSize(module,
+				rawGetSpirvOperand(type, 2u), matrix_stride, depth + 1u);
+
+		return rawGetSpirvOperand(length, 3u) * stride;
+	}
+
+	case RAW_SPIRV_OP_TYPE_STRUCT: {
+		uint32_t size = 0u;
+		uint32_t n_members = (type[0] >> 16) - 2u;
+
+		for (uint32_t i = 0; i < n_members; ++i) {
+			uint32_t offset = 0u;
+			uint32_t member_matrix_stride = 0u;
+
+			rawGetSpirvMemberDecoration(module, type_id,
+				i, RAW_SPIRV_DECORATION_OFFSET, &offset);
+			rawGetSpirvMemberDecoration(module, type_id,
+				i, RAW_SPIRV_DECORATION_MATRIX_STRIDE, &member_matrix_stride);
+
+			uint32_t end = offset + rawGetSpirvTypeSize(module,
+				type[2u + i], member_matrix_stride, depth + 1u);
+
+			if (end > size)
+				size = end;
+		}
+
+		return size;
+	}
+
+	default:
+		return 0u;
+	}
+}
+
+static bool rawAddVulkanReflectedBinding(
+	RawVulkanShaderReflection* reflection,
+	RawVulkanReflectedBinding const* const binding) {
+
+	for (uint32_t i = 0; i < reflection->n_bindings; ++i) {
+		RawVulkanReflectedBinding* existing = &reflection->bindings[i];
+
+		if (existing->set != binding->set ||
+			existing->binding != binding->binding)
+			continue;
+
+		if (existing->descriptor_type != binding->descriptor_type) {
+			RAW_LOG_ERROR("Binding %" PRIu32 " of set %" PRIu32
+				" has conflicting types!", binding->binding, binding->set);
+			return false;
+		}
+
+		if (existing->descriptor_count < binding->descriptor_count)
+			existing->descriptor_count = binding->descriptor_count;
+
+		existing->stage_flags |= binding->stage_flags;
+
+		return true;
+	}
+
+	if (reflection->n_bindings == RAW_VULKAN_MAX_REFLECTED_BINDINGS) {
+		RAW_LOG_ERROR("Too many descriptor bindings to reflect!");
+		return false;
+	}
+
+	reflection->bindings[reflection->n_bindings++] = *binding;
+
+	return true;
+}
+
+static bool rawReflectSpirvDescriptor(
+	RawSpirvModule const* const module,
+	uint32_t variable_id,
+	uint32_t type_id,
+	uint32_t storage_class,
+	RawVulkanShaderReflection* reflection) {
+
+	RawSpirvId const* variable = &module->ids[variable_id];
+
+	// Not a descriptor, or not reachable from a layout
+	if (!variable->has_set || !variable->has_binding)
+		return true;
+
+	RawVulkanReflectedBinding binding = {
+		.set = variable->set,
+		.binding = variable->binding,
+		.descriptor_count = 1u,
+		.stage_flags = reflection->stage_flags
+	};
+
+	uint32_t const* type = rawGetSpirvDefinition(module, type_id);
+
+	for (uint32_t depth = 0u; type && depth < RAW_SPIRV_MAX_TYPE_DEPTH &&
+		(rawGetSpirvOpcode(type) == RAW_SPIRV_OP_TYPE_ARRAY ||
+		rawGetSpirvOpcode(type) == RAW_SPIRV_OP_TYPE_RUNTIME_ARRAY);
+		++depth) {
+
+		if (rawGetSpirvOpcode(type) == RAW_SPIRV_OP_TYPE_RUNTIME_ARRAY) {
+			binding.descriptor_count = 0u;
+		}
+		else {
+			uint32_t const* length = rawGetSpirvDefinition(
+				module, rawGetSpirvOperand(type, 3u));
+
+			if (!length || rawGetSpirvOpcode(length) != RAW_SPIRV_OP_CONSTANT)
+				return false;
+
+			binding.descriptor_count *= rawGetSpirvOperand(length, 3u);
+		}
+
+		type_id = rawGetSpirvOperand(type, 2u);
+		type = rawGetSpirvDefinition(module, type_id);
+	}
+
+	if (!type)
+		return false;
+
+	uint32_t const* image = type;
+
+	switch (rawGetSpirvOpcode(type)) {
+	case RAW_SPIRV_OP_TYPE_SAMPLER:
+		binding.descriptor_type = VK_DESCRIPTOR_TYPE_SAMPLER;
+		break;
+
+	case RAW_SPIRV_OP_TYPE_SAMPLED_IMAGE:
+		image = rawGetSpirvDefinition(module, rawGetSpirvOperand(type, 2u));
+
+		if (!image)
+			return false;
+
+		binding.descriptor_type =
+			rawGetSpirvOperand(image, 3u) == RAW_SPIRV_DIM_BUFFER ?
+			VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER :
+			VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+		break;
+
+	case RAW_SPIRV_OP_TYPE_IMAGE: {
+		// Sampled 2 means read and written without a sampler
+		bool storage = rawGetSpirvOperand(image, 7u) == 2u;
+
+		if (rawGetSpirvOperand(image, 3u) == RAW_SPIRV_DIM_SUBPASS_DATA)
+			binding.descriptor_type = VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT;
+		else if (rawGetSpirvOperand(image, 3u) == RAW_SPIRV_DIM_BUFFER)
+			binding.descriptor_type = storage ?
+				VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER :
+				VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER;
+		else
+			binding.descriptor_type = storage ?
+				VK_DESCRIPTOR_TYPE_STORAGE_IMAGE :
+				VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
+		break;
+	}
+
+	case RAW_SPIRV_OP_TYPE_STRUCT:
+		// Before SPIR-V 1.3 storage buffers were BufferBlock uniforms
+		binding.descriptor_type =
+			storage_class == RAW_SPIRV_STORAGE_CLASS_STORAGE_BUFFER ||
+			module->ids[type_id].buffer_block ?
+			VK_DESCRIPTOR_TYPE_STORAGE_BUFFER :
+			VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+		break;
+
+	default:
+		RAW_LOG_ERROR("Unsupported descriptor type in SPIR-V!");
+		return false;
+	}
+
+	return rawAddVulkanReflectedBinding(reflection, &binding);
+}
+
+static bool rawReflectSpirvVertexInput(
+	RawSpirvModule const* const module,
+	uint32_t variable_id,
+	uint32_t type_id,
+	RawVulkanShaderReflection* reflection) {
+
+	RawSpirvId const* variable = &module->ids[variable_id];
+
+	if (variable->built_in || !variable->has_location)
+		return true;
+
+	uint32_t const* type = rawGetSpirvDefinition(module, type_id);
+	uint32_t n_components = 1u;
+
+	if (type && rawGetSpirvOpcode(type) == RAW_SPIRV_OP_TYPE_VECTOR) {
+		n_components = rawGetSpirvOperand(type, 3u);
+		type = rawGetSpirvDefinition(module, rawGetSpirvOperand(type, 2u));
+	}
+
+	static VkFormat const float_formats[] = {
+		VK_FORMAT_R32_SFLOAT, VK_FORMAT_R32G32_SFLOAT,
+		VK_FORMAT_R32G32B32_SFLOAT, VK_FORMAT_R32G32B32A32_SFLOAT
+	};
+
+	static VkFormat const sint_formats[] = {
+		VK_FORMAT_R32_SINT, VK_FORMAT_R32G32_SINT,
+		VK_FORMAT_R32G32B32_SINT, VK_FORMAT_R32G32B32A32_SINT
+	};
+
+	static VkFormat const uint_formats[] = {
+		VK_FORMAT_R32_UINT, VK_FORMAT_R32G32_UINT,
+		VK_FORMAT_R32G32B32_UINT, VK_FORMAT_R32G32B32A32_UINT
+	};
+
+	VkFormat const* formats = RAW_NULL_PTR;
+
+	if (type && rawGetSpirvOperand(type, 2u) == 32u) {
+		if (rawGetSpirvOpcode(type) == RAW_SPIRV_OP_TYPE_FLOAT)
+			formats = float_formats;
+		else if (rawGetSpirvOpcode(type) == RAW_SPIRV_OP_TYPE_INT)
+			formats = rawGetSpirvOperand(type, 3u) ?
+				sint_formats : uint_formats;
+	}
+
+	if (!formats || n_components == 0u || n_components > 4u) {
+		RAW_LOG_ERROR("Unsupported vertex input at location %" PRIu32,
+			variable->location);
+		return false;
+	}
+
+	if (reflection->n_vertex_inputs == RAW_VULKAN_MAX_REFLECTED_VERTEX_INPUTS) {
+		RAW_LOG_ERROR("Too many vertex inputs to reflect!");
+		return false;
+	}
+
+	reflection->vertex_inputs[reflection->n_vertex_inputs++] =
+		(RawVulkanReflectedVertexInput){
+			.location = variable->location,
+			.format = formats[n_components - 1u]
+		};
+
+	return true;
+}
+
+static bool rawReflectSpirvPushConstants(
+	RawSpirvModule const* const module,
+	uint32_t type_id,
+	RawVulkanShaderReflection* reflection) {
+
+	uint32_t const* type = rawGetSpirvDefinition(module, type_id);
+
+	if (!type || rawGetSpirvOpcode(type) != RAW_SPIRV_OP_TYPE_STRUCT)
+		return false;
+
+	uint32_t n_members = (type[0] >> 16) - 2u;
+	uint32_t offset = UINT32_MAX;
+
+	for (uint32_t i = 0; i < n_members; ++i) {
+		uint32_t member_offset = 0u;
+
+		rawGetSpirvMemberDecoration(module, type_id,
+			i, RAW_SPIRV_DECORATION_OFFSET, &member_offset);
+
+		if (member_offset < offset)
+			offset = member_offset;
+	}
+
+	uint32_t end = rawGetSpirvTypeSize(module, type_id, 0u, 0u);
+
+	if (n_members == 0u || end <= offset)
+		return false;
+
+	reflection->push_constant_range = (VkPushConstantRange){
+		.stageFlags = reflection->stage_flags,
+		.offset = offset,
+		.size = end - offset
+	};
+
+	return true;
+}
+
+static bool rawReflectSpirvModule(
+	RawSpirvModule* module,
+	RawVulkanShaderReflection* reflection) {
+
+	static VkShaderStageFlagBits const stages[] = {
+		VK_SHADER_STAGE_VERTEX_BIT,
+		VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT,
+		VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT,
+		VK_SHADER_STAGE_GEOMETRY_BIT,
+		VK_SHADER_STAGE_FRAGMENT_BIT,
+		VK_SHADER_STAGE_COMPUTE_BIT
+	};
+
+	uint32_t const* code = module->code;
+
+	// Decorations and definitions
+	for (uint32_t i = RAW_SPIRV_HEADER_SIZE; i < module->n_words;) {
+		uint32_t const* instruction = code + i;
+		uint32_t n_instruction_words = instruction[0] >> 16;
+
+		if (n_instruction_words == 0u ||
+			n_instruction_words > module->n_words - i)
+			return false;
+
+		uint32_t opcode = rawGetSpirvOpcode(instruction);
+		uint32_t result_id = 0u;
+
+		switch (opcode) {
+		case RAW_SPIRV_OP_ENTRY_POINT: {
+			uint32_t execution_model = rawGetSpirvOperand(instruction, 1u);
+
+			if (reflection->stage_flags == 0u && execution_model < 6u)
+				reflection->stage_flags = stages[execution_model];
+			break;
+		}
+
+		case RAW_SPIRV_OP_DECORATE: {
+			uint32_t target = rawGetSpirvOperand(instruction, 1u);
+			uint32_t value = rawGetSpirvOperand(instruction, 3u);
+
+			if (target >= module->bound)
+				return false;
+
+			RawSpirvId* id = &module->ids[target];
+
+			switch (rawGetSpirvOperand(instruction, 2u)) {
+			case RAW_SPIRV_DECORATION_BLOCK:
+				id->block = true;
+				break;
+			case RAW_SPIRV_DECORATION_BUFFER_BLOCK:
+				id->buffer_block = true;
+				break;
+			case RAW_SPIRV_DECORATION_ARRAY_STRIDE:
+				id->array_stride = value;
+				break;
+			case RAW_SPIRV_DECORATION_BUILT_IN:
+				id->built_in = true;
+				break;
+			case RAW_SPIRV_DECORATION_LOCATION:
+				id->location = value;
+				id->has_location = true;
+				break;
+			case RAW_SPIRV_DECORATION_BINDING:
+				id->binding = value;
+				id->has_binding = true;
+				break;
+			case RAW_SPIRV_DECORATION_DESCRIPTOR_SET:
+				id->set = value;
+				id->has_set = true;
+				break;
+			}
+			break;
+		}
+
+		case RAW_SPIRV_OP_TYPE_INT:
+		case RAW_SPIRV_OP_TYPE_FLOAT:
+		case RAW_SPIRV_OP_TYPE_VECTOR:
+		case RAW_SPIRV_OP_TYPE_MATRIX:
+		case RAW_SPIRV_OP_TYPE_IMAGE:
+		case RAW_SPIRV_OP_TYPE_SAMPLER:
+		case RAW_SPIRV_OP_TYPE_SAMPLED_IMAGE:
+		case RAW_SPIRV_OP_TYPE_ARRAY:
+		case RAW_SPIRV_OP_TYPE_RUNTIME_ARRAY:
+		case RAW_SPIRV_OP_TYPE_STRUCT:
+		case RAW_SPIRV_OP_TYPE_POINTER:
+			result_id = rawGetSpirvOperand(instruction, 1u);
+			break;
+
+		case RAW_SPIRV_OP_CONSTANT:
+		case RAW_SPIRV_OP_VARIABLE:
+			result_id = rawGetSpirvOperand(instruction, 2u);
+			break;
+		}
+
+		if (result_id != 0u) {
+			if (result_id >= module->bound)
+				return false;
+
+			module->ids[result_id].instruction = i;
+		}
+
+		i += n_instruction_words;
+	}
+
+	if (reflection->stage_flags == 0u)
+		return false;
+
+	// Interface variables
+	for (uint32_t id = 1u; id < module->bound; ++id) {
+		uint32_t const* variable = rawGetSpirvDefinition(module, id);
+
+		if (!variable || rawGetSpirvOpcode(variable) != RAW_SPIRV_OP_VARIABLE)
+			continue;
+
+		uint32_t const* pointer = rawGetSpirvDefinition(
+			module, rawGetSpirvOperand(variable, 1u));
+
+		if (!pointer || rawGetSpirvOpcode(pointer) != RAW_SPIRV_OP_TYPE_POINTER)
+			return false;
+
+		uint32_t type_id = rawGetSpirvOperand(pointer, 3u);
+		uint32_t storage_class = rawGetSpirvOperand(variable, 3u);
+		bool result = true;
+
+		switch (storage_class) {
+		case RAW_SPIRV_STORAGE_CLASS_UNIFORM_CONSTANT:
+		case RAW_SPIRV_STORAGE_CLASS_UNIFORM:
+		case RAW_SPIRV_STORAGE_CLASS_STORAGE_BUFFER:
+			result = rawReflectSpirvDescriptor(
+				module, id, type_id, storage_class, reflection);
+			break;
+
+		case RAW_SPIRV_STORAGE_CLASS_PUSH_CONSTANT:
+			result = rawReflectSpirvPushConstants(
+				module, type_id, reflection);
+			break;
+
+		case RAW_SPIRV_STORAGE_CLASS_INPUT:
+			if (reflection->stage_flags == VK_SHADER_STAGE_VERTEX_BIT)
+				result = rawReflectSpirvVertexInput(
+					module, id, type_id, reflection);
+			break;
+		}
+
+		if (!result)
+			return false;
+	}
+
+	return true;
+}
+
+bool rawReflectSpirv(
+	uint32_t const* code,
+	uint64_t size,
+	RawVulkanShaderReflection* reflection) {
+
+	memset(reflection, 0, sizeof(RawVulkanShaderReflection));
+
+	uint64_t alignment = size & 3u;
+
+	if (alignment != 0u || size < RAW_SPIRV_HEADER_SIZE * sizeof(uint32_t) ||
+		size / sizeof(uint32_t) > UINT32_MAX || code[0] != RAW_SPIRV_MAGIC ||
+		code[3] == 0u) {
+		RAW_LOG_ERROR("Invalid SPIR-V header!");
+		return false;
+	}
+
+	RawSpirvModule module = {
+		.code = code,
+		.n_words = (uint32_t)(size / sizeof(uint32_t)),
+		.ids = RAW_NULL_PTR,
+		.bound = code[3]
+	};
+
+	RAW_MEM_ALLOC(module.ids, (uint64_t)module.bound, sizeof(RawSpirvId));
+
+	if (!module.ids) {
+		RAW_LOG_ERROR("RAW_MEM_ALLOC failed on rawReflectSpirv!");
+		return false;
+	}
+
+	memset(module.ids, 0, module.bound * sizeof(RawSpirvId));
+
+	bool result = rawReflectSpirvModule(&module, reflection);
+
+	if (!result)
+		RAW_LOG_ERROR("SPIR-V reflection failed!");
+
+	RAW_MEM_FREE(module.ids);
+
+	return result;
+}
+
+bool rawMergeVulkanShaderReflections(
+	RawVulkanShaderReflection const* reflections,
+	uint32_t n_reflections,
+	RawVulkanShaderReflection* merged_reflection) {
+
+	memset(merged_reflection, 0, sizeof(RawVulkanShaderReflection));
+
+	VkPushConstantRange* range = &merged_reflection->push_constant_range;
+
+	for (uint32_t i = 0; i < n_reflections; ++i) {
+		RawVulkanShaderReflection const* reflection = &reflections[i];
+
+		merged_reflection->stage_flags |= reflection->stage_flags;
+
+		for (uint32_t j = 0; j < reflection->n_bindings; ++j) {
+			if (!rawAddVulkanReflectedBinding(
+				merged_reflection, &reflection->bindings[j]))
+				return false;
+		}
+
+		VkPushConstantRange const* stage_range =
+			&reflection->push_constant_range;
+
+		if (stage_range->size > 0u) {
+			uint32_t end = range->offset + range->size;
+			uint32_t stage_end = stage_range->offset + stage_range->size;
+
+			if (range->size == 0u || stage_range->offset < range->offset)
+				range->offset = stage_range->offset;
+
+			if (stage_end > end)
+				end = stage_end;
+
+			range->size = end - range->offset;
+			range->stageFlags |= stage_range->stageFlags;
+		}
+
+		if (reflection->n_vertex_inputs > 0u) {
+			memcpy(merged_reflection->vertex_inputs,
+				reflection->vertex_inputs,
+				sizeof(reflection->vertex_inputs));
+			merged_reflection->n_vertex_inputs =
+				reflection->n_vertex_inputs;
+		}
+	}
+
+	return true;
+}
@@ -0,0 +1,103 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanReflection.h"
+ *
+ * SPIR-V reflection
+ *
+ * Extracts the resource interface of a shader straight from its SPIR-V:
+ * descriptor bindings, the push constant range and vertex inputs, so
+ * descriptor set and pipeline layouts never have to be written by hand.
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+
+#ifndef RAW_VULKAN_REFLECTION_H
+#define RAW_VULKAN_REFLECTION_H
+
+#include <engine/vulkan/rawVulkan.h>
+
+#include <inttypes.h>
+#include <stdbool.h>
+
+// The minimum maxBoundDescriptorSets every device supports
+#define RAW_VULKAN_MAX_DESCRIPTOR_SETS 4u
+#define RAW_VULKAN_MAX_REFLECTED_BINDINGS 32u
+#define RAW_VULKAN_MAX_REFLECTED_VERTEX_INPUTS 16u
+
+typedef struct {
+	uint32_t set;
+	uint32_t binding;
+	VkDescriptorType descriptor_type;
+
+	// 0 for runtime sized arrays
+	uint32_t descriptor_count;
+
+	VkShaderStageFlags stage_flags;
+} RawVulkanReflectedBinding;
+
+typedef struct {
+	uint32_t location;
+	VkFormat format;
+} RawVulkanReflectedVertexInput;
+
+typedef struct {
+	// Single stage for a shader, several once merged
+	VkShaderStageFlags stage_flags;
+
+	RawVulkanReflectedBinding bindings[RAW_VULKAN_MAX_REFLECTED_BINDINGS];
+	uint32_t n_bindings;
+
+	// Zero sized if the shader has no push constants
+	VkPushConstantRange push_constant_range;
+
+	// Only filled for vertex shaders
+	RawVulkanReflectedVertexInput vertex_inputs[
+		RAW_VULKAN_MAX_REFLECTED_VERTEX_INPUTS];
+	uint32_t n_vertex_inputs;
+} RawVulkanShaderReflection;
+
+/*
+ * Reflects the first entry point of @code. Fails on malformed SPIR-V
+ * and on interfaces exceeding the limits above.
+ */
+bool rawReflectSpirv(
+	uint32_t const* code,
+	uint64_t size,
+	RawVulkanShaderReflection* reflection);
+
+/*
+ * Combines the stages of a pipeline: bindings seen by several stages
+ * are merged, and push constant ranges become one covering them all.
+ * Fails if stages disagree on the type of a binding.
+ */
+bool rawMergeVulkanShaderReflections(
+	RawVulkanShaderReflection const* reflections,
+	uint32_t n_reflections,
+	RawVulkanShaderReflection* merged_reflection);
+
+#endif // RAW_VULKAN_REFLECTION_H
@@ -0,0 +1,1072 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanRenderGraph.c"
+ *
+ * Frame render graph
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+
+#include <engine/vulkan/rawVulkanRenderGraph.h>
+#include <engine/vulkan/rawVulkanMemory.h>
+#include <engine/vulkan/rawVulkanResourceState.h>
+#include <engine/platform/rawMemory.h>
+#include <engine/utils/rawLogger.h>
+
+#include <string.h>
+
+#define RAW_VULKAN_RENDER_GRAPH_INITIAL_CAPACITY 16u
+
+// Synchronization state of a resource while barriers are computed
+typedef struct {
+	bool initialized;
+	VkImageLayout layout;
+	VkPipelineStageFlags write_stages;
+	VkAccessFlags write_access;
+	VkPipelineStageFlags read_stages;
+
+	// Stages and accesses the last write was already made visible to
+	VkPipelineStageFlags visible_stages;
+	VkAccessFlags visible_access;
+} RawVulkanRenderGraphResourceState;
+
+static bool rawReserveVulkanRenderGraphArray(
+	void** array,
+	uint32_t* max_elements,
+	uint32_t n_elements,
+	uint32_t n_needed,
+	size_t element_size) {
+
+	if (n_needed <= *max_elements)
+		return true;
+
+	uint32_t new_max_elements = *max_elements > 0u ?
+		*max_elements : RAW_VULKAN_RENDER_GRAPH_INITIAL_CAPACITY;
+
+	while (new_max_elements < n_needed)
+		new_max_elements *= 2u;
+
+	void* new_array = RAW_NULL_PTR;
+
+	RAW_MEM_ALLOC(new_array, (uint64_t)new_max_elements, element_size);
+
+	if (!new_array) {
+		RAW_LOG_ERROR("RAW_MEM_ALLOC failed on "
+			"rawReserveVulkanRenderGraphArray!");
+		return false;
+	}
+
+	if (*array) {
+		memcpy(new_array, *array, n_elements * element_size);
+		RAW_MEM_FREE(*array);
+	}
+
+	*array = new_array;
+	*max_elements = new_max_elements;
+
+	return true;
+}
+
+static RawVulkanRenderGraphResource* rawAddVulkanRenderGraphResource(
+	RawVulkanRenderGraph* render_graph,
+	RawVulkanRenderGraphResourceType type,
+	uint32_t* resource) {
+
+	if (render_graph->compiled) {
+		RAW_LOG_ERROR("Render graph already compiled!");
+		return RAW_NULL_PTR;
+	}
+
+	if (!rawReserveVulkanRenderGraphArray(
+		(void**)&render_graph->resources, &render_graph->max_resources,
+		render_graph->n_resources, render_graph->n_resources + 1u,
+		sizeof(RawVulkanRenderGraphResource)))
+		return RAW_NULL_PTR;
+
+	*resource = render_graph->n_resources++;
+
+	RawVulkanRenderGraphResource* new_resource =
+		&render_graph->resources[*resource];
+
+	memset(new_resource, 0, sizeof(RawVulkanRenderGraphResource));
+
+	new_resource->type = type;
+	new_resource->memory_block = RAW_VULKAN_RENDER_GRAPH_NONE;
+	new_resource->alias_predecessor = RAW_VULKAN_RENDER_GRAPH_NONE;
+	new_resource->first_use = RAW_VULKAN_RENDER_GRAPH_NONE;
+
+	return new_resource;
+}
+
+static inline bool rawIsVulkanRenderGraphWrite(
+	RawVulkanRenderGraphAccess const* const access) {
+	return (access->access & RAW_VULKAN_WRITE_ACCESS_MASK) != 0;
+}
+
+static inline bool rawIsVulkanRenderGraphRead(
+	RawVulkanRenderGraphAccess const* const access) {
+	return (access->access & ~RAW_VULKAN_WRITE_ACCESS_MASK) != 0;
+}
+
+void rawCreateVulkanRenderGraph(RawVulkanRenderGraph* render_graph) {
+	memset(render_graph, 0, sizeof(RawVulkanRenderGraph));
+}
+
+void rawResetVulkanRenderGraph(
+	VkDevice logical_device,
+	RawVulkanRenderGraph* render_graph) {
+
+	for (uint32_t i = 0; i < render_graph->n_resources; ++i) {
+		RawVulkanRenderGraphResource* resource = &render_graph->resources[i];
+
+		if (resource->imported)
+			continue;
+
+		// TODO: Pass allocation callback
+		if (resource->image_view != VK_NULL_HANDLE)
+			vkDestroyImageView(logical_device,
+				resource->image_view, RAW_NULL_PTR);
+
+		if (resource->image != VK_NULL_HANDLE)
+			vkDestroyImage(logical_device, resource->image, RAW_NULL_PTR);
+
+		if (resource->buffer != VK_NULL_HANDLE)
+			vkDestroyBuffer(logical_device, resource->buffer, RAW_NULL_PTR);
+	}
+
+	for (uint32_t i = 0; i < render_graph->n_memory_blocks; ++i)
+		rawFreeVulkanMemory(logical_device,
+			&render_graph->memory_blocks[i].memory);
+
+	if (render_graph->memory_blocks)
+		RAW_MEM_FREE(render_graph->memory_blocks);
+
+	if (render_graph->execution_order)
+		RAW_MEM_FREE(render_graph->execution_order);
+
+	render_graph->n_resources = 0u;
+	render_graph->n_passes = 0u;
+	render_graph->n_accesses = 0u;
+	render_graph->n_executed_passes = 0u;
+	render_graph->n_image_barriers = 0u;
+	render_graph->n_memory_blocks = 0u;
+	render_graph->final_src_stages = 0;
+	render_graph->first_final_barrier = 0u;
+	render_graph->n_final_barriers = 0u;
+	render_graph->compiled = false;
+}
+
+void rawDestroyVulkanRenderGraph(
+	VkDevice logical_device,
+	RawVulkanRenderGraph* render_graph) {
+
+	rawResetVulkanRenderGraph(logical_device, render_graph);
+
+	if (render_graph->resources)
+		RAW_MEM_FREE(render_graph->resources);
+
+	if (render_graph->passes)
+		RAW_MEM_FREE(render_graph->passes);
+
+	if (render_graph->accesses)
+		RAW_MEM_FREE(render_graph->accesses);
+
+	if (render_graph->image_barriers)
+		RAW_MEM_FREE(render_graph->image_barriers);
+
+	render_graph->max_resources = 0u;
+	render_graph->max_passes = 0u;
+	render_graph->max_accesses = 0u;
+	render_graph->max_image_barriers = 0u;
+}
+
+bool rawImportVulkanRenderGraphImage(
+	RawVulkanRenderGraph* render_graph,
+	VkImage image,
+	VkImageView image_view,
+	VkImageSubresourceRange const* const subresource_range,
+	VkImageLayout initial_layout,
+	VkPipelineStageFlags initial_stages,
+	VkAccessFlags initial_access,
+	VkImageLayout final_layout,
+	uint32_t* resource) {
+
+	RawVulkanRenderGraphResource* new_resource =
+		rawAddVulkanRenderGraphResource(render_graph,
+			RAW_VULKAN_RENDER_GRAPH_IMAGE, resource);
+
+	if (!new_resource)
+		return false;
+
+	new_resource->imported = true;
+	new_resource->image = image;
+	new_resource->image_view = image_view;
+	new_resource->subresource_range = *subresource_range;
+	new_resource->initial_layout = initial_layout;
+	new_resource->initial_stages = initial_stages;
+	new_resource->initial_access = initial_access;
+	new_resource->final_layout = final_layout;
+
+	return true;
+}
+
+bool rawImportVulkanRenderGraphBuffer(
+	RawVulkanRenderGraph* render_graph,
+	VkBuffer buffer,
+	VkPipelineStageFlags initial_stages,
+	VkAccessFlags initial_access,
+	uint32_t* resource) {
+
+	RawVulkanRenderGraphResource* new_resource =
+		rawAddVulkanRenderGraphResource(render_graph,
+			RAW_VULKAN_RENDER_GRAPH_BUFFER, resource);
+
+	if (!new_resource)
+		return false;
+
+	new_resource->imported = true;
+	new_resource->buffer = buffer;
+	new_resource->initial_stages = initial_stages;
+	new_resource->initial_access = initial_access;
+
+	return true;
+}
+
+bool rawCreateVulkanRenderGraphTransientImage(
+	RawVulkanRenderGraph* render_graph,
+	VkImageCreateInfo const* const image_create_info,
+	VkImageSubresourceRange const* const subresource_range,
+	uint32_t* resource) {
+
+	RawVulkanRenderGraphResource* new_resource =
+		rawAddVulkanRenderGraphResource(render_graph,
+			RAW_VULKAN_RENDER_GRAPH_IMAGE, resource);
+
+	if (!new_resource)
+		return false;
+
+	new_resource->image_create_info = *image_create_info;
+	new_resource->image_create_info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+	new_resource->subresource_range = *subresource_range;
+	new_resource->initial_layout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+	return true;
+}
+
+bool rawCreateVulkanRenderGraphTransientBuffer(
+	RawVulkanRenderGraph* render_graph,
+	VkDeviceSize size,
+	VkBufferUsageFlags usage,
+	uint32_t* resource) {
+
+	RawVulkanRenderGraphResource* new_resource =
+		rawAddVulkanRenderGraphResource(render_graph,
+			RAW_VULKAN_RENDER_GRAPH_BUFFER, resource);
+
+	if (!new_resource)
+		return false;
+
+	new_resource->buffer_create_info = (VkBufferCreateInfo) {
+		.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = 0,
+		.size = size,
+		.usage = usage,
+		.sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+		.queueFamilyIndexCount = 0u,
+		.pQueueFamilyIndices = RAW_NULL_PTR
+	};
+
+	return true;
+}
+
+bool rawAddVulkanRenderGraphPass(
+	RawVulkanRenderGraph* render_graph,
+	char const* name,
+	RawVulkanRenderGraphAccess const* const accesses,
+	uint32_t n_accesses,
+	RawVulkanRenderGraphRecordFunction record_function,
+	void* user_data,
+	bool side_effects,
+	uint32_t* pass) {
+
+	if (render_graph->compiled) {
+		RAW_LOG_ERROR("Render graph already compiled!");
+		return false;
+	}
+
+	for (uint32_t i = 0; i < n_accesses; ++i) {
+		if (accesses[i].resource >= render_graph->n_resources) {
+			RAW_LOG_ERROR("Render graph pass %s accesses "
+				"an unknown resource!", name);
+			return false;
+		}
+
+		for (uint32_t j = 0; j < i; ++j) {
+			if (accesses[j].resource == accesses[i].resource) {
+				RAW_LOG_ERROR("Render graph pass %s declares "
+					"a resource more than once!", name);
+				return false;
+			}
+		}
+	}
+
+	if (!rawReserveVulkanRenderGraphArray(
+		(void**)&render_graph->accesses, &render_graph->max_accesses,
+		render_graph->n_accesses, render_graph->n_accesses + n_accesses,
+		sizeof(RawVulkanRenderGraphAccess)))
+		return false;
+
+	if (!rawReserveVulkanRenderGraphArray(
+		(void**)&render_graph->passes, &render_graph->max_passes,
+		render_graph->n_passes, render_graph->n_passes + 1u,
+		sizeof(RawVulkanRenderGraphPass)))
+		return false;
+
+	*pass = render_graph->n_passes++;
+
+	RawVulkanRenderGraphPass* new_pass = &render_graph->passes[*pass];
+
+	memset(new_pass, 0, sizeof(RawVulkanRenderGraphPass));
+
+	new_pass->name = name;
+	new_pass->first_access = render_graph->n_accesses;
+	new_pass->n_accesses = n_accesses;
+	new_pass->record_function = record_function;
+	new_pass->user_data = user_data;
+	new_pass->side_effects = side_effects;
+
+	if (n_accesses > 0u)
+		memcpy(render_graph->accesses + render_graph->n_accesses,
+			accesses, n_accesses * sizeof(RawVulkanRenderGraphAccess));
+
+	render_graph->n_accesses += n_accesses;
+
+	return true;
+}
+
+/*
+ * Walking backwards from passes with side effects or writing imported
+ * resources, marks the passes that produced what the kept ones read.
+ * Declaration order defines the producer of each read.
+ */
+static bool rawCullVulkanRenderGraphPasses(
+	RawVulkanRenderGraph* render_graph) {
+
+	uint32_t* last_writers = RAW_NULL_PTR;
+	uint32_t* producers = RAW_NULL_PTR;
+	bool* needed = RAW_NULL_PTR;
+
+	RAW_MEM_ALLOC(last_writers,
+		(uint64_t)render_graph->n_resources + 1u, sizeof(uint32_t));
+	RAW_MEM_ALLOC(producers,
+		(uint64_t)render_graph->n_accesses + 1u, sizeof(uint32_t));
+	RAW_MEM_ALLOC(needed,
+		(uint64_t)render_graph->n_passes + 1u, sizeof(bool));
+
+	if (!last_writers || !producers || !needed) {
+		RAW_LOG_ERROR("RAW_MEM_ALLOC failed on "
+			"rawCullVulkanRenderGraphPasses!");
+
+		if (last_writers)
+			RAW_MEM_FREE(last_writers);
+
+		if (producers)
+			RAW_MEM_FREE(producers);
+
+		if (needed)
+			RAW_MEM_FREE(needed);
+
+		return false;
+	}
+
+	for (uint32_t i = 0; i < render_graph->n_resources; ++i)
+		last_writers[i] = RAW_VULKAN_RENDER_GRAPH_NONE;
+
+	for (uint32_t i = 0; i < render_graph->n_passes; ++i) {
+		RawVulkanRenderGraphPass* pass = &render_graph->passes[i];
+		RawVulkanRenderGraphAccess* accesses =
+			render_graph->accesses + pass->first_access;
+
+		needed[i] = pass->side_effects;
+
+		for (uint32_t j = 0; j < pass->n_accesses; ++j)
+			producers[pass->first_access + j] =
+				last_writers[accesses[j].resource];
+
+		for (uint32_t j = 0; j < pass->n_accesses; ++j) {
+			if (!rawIsVulkanRenderGraphWrite(&accesses[j]))
+				continue;
+
+			last_writers[accesses[j].resource] = i;
+
+			if (render_graph->resources[accesses[j].resource].imported)
+				needed[i] = true;
+		}
+	}
+
+	for (uint32_t i = render_graph->n_passes; i-- > 0u;) {
+		RawVulkanRenderGraphPass* pass = &render_graph->passes[i];
+
+		pass->culled = !needed[i];
+
+		if (pass->culled)
+			continue;
+
+		for (uint32_t j = 0; j < pass->n_accesses; ++j) {
+			uint32_t access_index = pass->first_access + j;
+
+			if (rawIsVulkanRenderGraphRead(
+					&render_graph->accesses[access_index]) &&
+				producers[access_index] != RAW_VULKAN_RENDER_GRAPH_NONE)
+				needed[producers[access_index]] = true;
+		}
+	}
+
+	RAW_MEM_FREE(needed);
+	RAW_MEM_FREE(producers);
+	RAW_MEM_FREE(last_writers);
+
+	return true;
+}
+
+static bool rawVulkanRenderGraphPassesConflict(
+	RawVulkanRenderGraph const* const render_graph,
+	RawVulkanRenderGraphPass const* const first,
+	RawVulkanRenderGraphPass const* const second) {
+
+	for (uint32_t i = 0; i < first->n_accesses; ++i) {
+		RawVulkanRenderGraphAccess const* a =
+			&render_graph->accesses[first->first_access + i];
+
+		for (uint32_t j = 0; j < second->n_accesses; ++j) {
+			RawVulkanRenderGraphAccess const* b =
+				&render_graph->accesses[second->first_access + j];
+
+			if (a->resource != b->resource)
+				continue;
+
+			// Different layouts mean a transition, which is a write
+			if (rawIsVulkanRenderGraphWrite(a) ||
+				rawIsVulkanRenderGraphWrite(b) ||
+				(render_graph->resources[a->resource].type ==
+					RAW_VULKAN_RENDER_GRAPH_IMAGE && a->layout != b->layout))
+				return true;
+		}
+	}
+
+	return false;
+}
+
+/*
+ * Topological sort of the kept passes. Passes sharing a resource keep
+ * their declaration order. Among the passes ready to run, the ones not
+ * depending on the pass just scheduled go first, so dependent passes
+ * are spread apart and their barriers have work in between.
+ */
+static bool rawOrderVulkanRenderGraphPasses(
+	RawVulkanRenderGraph* render_graph) {
+
+	uint32_t n_passes = render_graph->n_passes;
+
+	bool* edges = RAW_NULL_PTR;
+	uint32_t* n_dependencies = RAW_NULL_PTR;
+	bool* scheduled = RAW_NULL_PTR;
+
+	RAW_MEM_ALLOC(edges, (uint64_t)n_passes * n_passes + 1u, sizeof(bool));
+	RAW_MEM_ALLOC(n_dependencies, (uint64_t)n_passes + 1u, sizeof(uint32_t));
+	RAW_MEM_ALLOC(scheduled, (uint64_t)n_passes + 1u, sizeof(bool));
+
+	// Left over by a previous compilation which failed
+	if (render_graph->execution_order)
+		RAW_MEM_FREE(render_graph->execution_order);
+
+	RAW_MEM_ALLOC(render_graph->execution_order,
+		(uint64_t)n_passes + 1u, sizeof(uint32_t));
+
+	if (!edges || !n_dependencies || !scheduled ||
+		!render_graph->execution_order) {
+		RAW_LOG_ERROR("RAW_MEM_ALLOC failed on "
+			"rawOrderVulkanRenderGraphPasses!");
+
+		if (edges)
+			RAW_MEM_FREE(edges);
+
+		if (n_dependencies)
+			RAW_MEM_FREE(n_dependencies);
+
+		if (scheduled)
+			RAW_MEM_FREE(scheduled);
+
+		return false;
+	}
+
+	memset(edges, 0, (size_t)n_passes * n_passes * sizeof(bool));
+
+	uint32_t n_kept_passes = 0u;
+
+	for (uint32_t j = 0; j < n_passes; ++j) {
+		n_dependencies[j] = 0u;
+		scheduled[j] = render_graph->passes[j].culled;
+
+		if (render_graph->passes[j].culled)
+			continue;
+
+		++n_kept_passes;
+
+		for (uint32_t i = 0; i < j; ++i) {
+			if (render_graph->passes[i].culled ||
+				!rawVulkanRenderGraphPassesConflict(render_graph,
+					&render_graph->passes[i], &render_graph->passes[j]))
+				continue;
+
+			edges[i * n_passes + j] = true;
+			++n_dependencies[j];
+		}
+	}
+
+	uint32_t last_scheduled = RAW_VULKAN_RENDER_GRAPH_NONE;
+
+	for (uint32_t n = 0; n < n_kept_passes; ++n) {
+		uint32_t chosen = RAW_VULKAN_RENDER_GRAPH_NONE;
+
+		for (uint32_t i = 0; i < n_passes; ++i) {
+			if (scheduled[i] || n_dependencies[i] > 0u)
+				continue;
+
+			if (chosen == RAW_VULKAN_RENDER_GRAPH_NONE)
+				chosen = i;
+
+			if (last_scheduled == RAW_VULKAN_RENDER_GRAPH_NONE ||
+				!edges[last_scheduled * n_passes + i]) {
+				chosen = i;
+				break;
+			}
+		}
+
+		// Edges only go forward in declaration order, so there is no cycle
+		scheduled[chosen] = true;
+		render_graph->execution_order[n] = chosen;
+		last_scheduled = chosen;
+
+		for (uint32_t j = 0; j < n_passes; ++j) {
+			if (edges[chosen * n_passes + j])
+				--n_dependencies[j];
+		}
+	}
+
+	render_graph->n_executed_passes = n_kept_passes;
+
+	RAW_MEM_FREE(scheduled);
+	RAW_MEM_FREE(n_dependencies);
+	RAW_MEM_FREE(edges);
+
+	return true;
+}
+
+static bool rawCreateVulkanRenderGraphTransientResources(
+	VkDevice logical_device,
+	VkPhysicalDeviceMemoryProperties const* const memory_properties,
+	RawVulkanRenderGraph* render_graph) {
+
+	for (uint32_t i = 0; i < render_graph->n_executed_passes; ++i) {
+		RawVulkanRenderGraphPass* pass =
+			&render_graph->passes[render_graph->execution_order[i]];
+
+		for (uint32_t j = 0; j < pass->n_accesses; ++j) {
+			RawVulkanRenderGraphResource* resource = &render_graph->resources[
+				render_graph->accesses[pass->first_access + j].resource];
+
+			if (resource->first_use == RAW_VULKAN_RENDER_GRAPH_NONE)
+				resource->first_use = i;
+
+			resource->last_use = i;
+		}
+	}
+
+	/*
+	 * Resources are placed in order of first use. Each one reuses the
+	 * memory block whose residents are all dead by then, preferring the
+	 * smallest block big enough. Lifetimes are intervals, so this
+	 * greedy placement needs as many blocks as the maximum number of
+	 * transient resources alive at the same time.
+	 */
+	uint32_t n_transients = 0u;
+
+	for (uint32_t i = 0; i < render_graph->n_resources; ++i) {
+		if (!render_graph->resources[i].imported &&
+			render_graph->resources[i].first_use !=
+				RAW_VULKAN_RENDER_GRAPH_NONE)
+			++n_transients;
+	}
+
+	if (n_transients == 0u)
+		return true;
+
+	RAW_MEM_ALLOC(render_graph->memory_blocks, (uint64_t)n_transients,
+		sizeof(RawVulkanRenderGraphMemoryBlock));
+
+	if (!render_graph->memory_blocks) {
+		RAW_LOG_ERROR("RAW_MEM_ALLOC failed on "
+			"rawCreateVulkanRenderGraphTransientResources!");
+		return false;
+	}
+
+	for (uint32_t position = 0; position < render_graph->n_executed_passes;
+		++position) {
+		for (uint32_t i = 0; i < render_graph->n_resources; ++i) {
+			RawVulkanRenderGraphResource* resource =
+				&render_graph->resources[i];
+
+			if (resource->imported || resource->first_use != position)
+				continue;
+
+			VkResult result;
+
+			// TODO: Pass allocation callback
+			if (resource->type == RAW_VULKAN_RENDER_GRAPH_IMAGE) {
+				result = vkCreateImage(logical_device,
+					&resource->image_create_info, RAW_NULL_PTR,
+					&resource->image);
+
+				if (result == VK_SUCCESS)
+					vkGetImageMemoryRequirements(logical_device,
+						resource->image, &resource->memory_requirements);
+			}
+			else {
+				result = vkCreateBuffer(logical_device,
+					&resource->buffer_create_info, RAW_NULL_PTR,
+					&resource->buffer);
+
+				if (result == VK_SUCCESS)
+					vkGetBufferMemoryRequirements(logical_device,
+						resource->buffer, &resource->memory_requirements);
+			}
+
+			if (result != VK_SUCCESS) {
+				RAW_LOG_ERROR("Render graph transient "
+					"resource creation failed!");
+				return false;
+			}
+
+			VkMemoryRequirements* requirements =
+				&resource->memory_requirements;
+
+			uint32_t chosen_block = RAW_VULKAN_RENDER_GRAPH_NONE;
+			uint32_t memory_type_index;
+
+			for (uint32_t b = 0; b < render_graph->n_memory_blocks; ++b) {
+				RawVulkanRenderGraphMemoryBlock* block =
+					&render_graph->memory_blocks[b];
+
+				if (render_graph->resources[block->last_resident].last_use >=
+					position)
+					continue;
+
+				uint32_t memory_type_bits = requirements->memoryTypeBits &
+					block->memory_requirements.memoryTypeBits;
+
+				if (!rawGetVulkanMemoryTypeIndex(memory_properties,
+					memory_type_bits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+					0, &memory_type_index))
+					continue;
+
+				if (chosen_block == RAW_VULKAN_RENDER_GRAPH_NONE) {
+					chosen_block = b;
+					continue;
+				}
+
+				VkDeviceSize block_size = block->memory_requirements.size;
+				VkDeviceSize chosen_size = render_graph->memory_blocks[
+					chosen_block].memory_requirements.size;
+
+				bool fits = block_size >= requirements->size;
+				bool chosen_fits = chosen_size >= requirements->size;
+
+				// Smallest block that fits, otherwise the biggest one
+				if ((fits && (!chosen_fits || block_size < chosen_size)) ||
+					(!fits && !chosen_fits && block_size > chosen_size))
+					chosen_block = b;
+			}
+
+			if (chosen_block == RAW_VULKAN_RENDER_GRAPH_NONE) {
+				chosen_block = render_graph->n_memory_blocks++;
+
+				RawVulkanRenderGraphMemoryBlock* block =
+					&render_graph->memory_blocks[chosen_block];
+
+				block->memory = VK_NULL_HANDLE;
+				block->memory_requirements = *requirements;
+			}
+			else {
+				RawVulkanRenderGraphMemoryBlock* block =
+					&render_graph->memory_blocks[chosen_block];
+				VkMemoryRequirements* block_requirements =
+					&block->memory_requirements;
+
+				resource->alias_predecessor = block->last_resident;
+
+				if (requirements->size > block_requirements->size)
+					block_requirements->size = requirements->size;
+
+				if (requirements->alignment > block_requirements->alignment)
+					block_requirements->alignment = requirements->alignment;
+
+				block_requirements->memoryTypeBits &=
+					requirements->memoryTypeBits;
+			}
+
+			resource->memory_block = chosen_block;
+			render_graph->memory_blocks[chosen_block].last_resident = i;
+		}
+	}
+
+	for (uint32_t b = 0; b < render_graph->n_memory_blocks; ++b) {
+		if (!rawAllocateVulkanMemory(logical_device, memory_properties,
+			&render_graph->memory_blocks[b].memory_requirements,
+			VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, 0, RAW_NULL_PTR,
+			&render_graph->memory_blocks[b].memory)) {
+			RAW_LOG_ERROR("rawAllocateVulkanMemory failed!");
+			return false;
+		}
+	}
+
+	for (uint32_t i = 0; i < render_graph->n_resources; ++i) {
+		RawVulkanRenderGraphResource* resource = &render_graph->resources[i];
+
+		if (resource->memory_block == RAW_VULKAN_RENDER_GRAPH_NONE)
+			continue;
+
+		VkDeviceMemory memory =
+			render_graph->memory_blocks[resource->memory_block].memory;
+
+		// Lifetimes sharing a block don't overlap, so all start at 0
+		VkResult result = resource->type == RAW_VULKAN_RENDER_GRAPH_IMAGE ?
+			vkBindImageMemory(logical_device, resource->image, memory, 0) :
+			vkBindBufferMemory(logical_device, resource->buffer, memory, 0);
+
+		if (result != VK_SUCCESS) {
+			RAW_LOG_ERROR("Render graph transient "
+				"resource memory binding failed!");
+			return false;
+		}
+
+		if (resource->type != RAW_VULKAN_RENDER_GRAPH_IMAGE)
+			continue;
+
+		VkImageViewCreateInfo image_view_create_info = {
+			.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
+			.pNext = RAW_NULL_PTR,
+			.flags = 0,
+			.image = resource->image,
+			.viewType = resource->image_create_info.imageType ==
+				VK_IMAGE_TYPE_3D ? VK_IMAGE_VIEW_TYPE_3D :
+				resource->subresource_range.layerCount > 1u ?
+					VK_IMAGE_VIEW_TYPE_2D_ARRAY : VK_IMAGE_VIEW_TYPE_2D,
+			.format = resource->image_create_info.format,
+			.components = {
+				VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY,
+				VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY
+			},
+			.subresourceRange = resource->subresource_range
+		};
+
+		// TODO: Pass allocation callback
+		result = vkCreateImageView(logical_device,
+			&image_view_create_info, RAW_NULL_PTR, &resource->image_view);
+
+		if (result != VK_SUCCESS) {
+			RAW_LOG_ERROR("vkCreateImageView failed!");
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static bool rawPushVulkanRenderGraphImageBarrier(
+	RawVulkanRenderGraph* render_graph,
+	RawVulkanRenderGraphResource const* const resource,
+	VkAccessFlags src_access,
+	VkAccessFlags dst_access,
+	VkImageLayout old_layout,
+	VkImageLayout new_layout) {
+
+	if (!rawReserveVulkanRenderGraphArray(
+		(void**)&render_graph->image_barriers,
+		&render_graph->max_image_barriers, render_graph->n_image_barriers,
+		render_graph->n_image_barriers + 1u, sizeof(VkImageMemoryBarrier)))
+		return false;
+
+	render_graph->image_barriers[render_graph->n_image_barriers++] =
+		(VkImageMemoryBarrier) {
+			.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+			.pNext = RAW_NULL_PTR,
+			.srcAccessMask = src_access,
+			.dstAccessMask = dst_access,
+			.oldLayout = old_layout,
+			.newLayout = new_layout,
+			.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+			.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+			.image = resource->image,
+			.subresourceRange = resource->subresource_range
+		};
+
+	return true;
+}
+
+/*
+ * Simulates the execution to find the hazards of every pass against
+ * the previous ones, merging all of them into the pass barrier
+ */
+static bool rawComputeVulkanRenderGraphBarriers(
+	RawVulkanRenderGraph* render_graph) {
+
+	RawVulkanRenderGraphResourceState* states = RAW_NULL_PTR;
+
+	RAW_MEM_ALLOC(states, (uint64_t)render_graph->n_resources + 1u,
+		sizeof(RawVulkanRenderGraphResourceState));
+
+	if (!states) {
+		RAW_LOG_ERROR("RAW_MEM_ALLOC failed on "
+			"rawComputeVulkanRenderGraphBarriers!");
+		return false;
+	}
+
+	memset(states, 0, (render_graph->n_resources + 1u) *
+		sizeof(RawVulkanRenderGraphResourceState));
+
+	for (uint32_t i = 0; i < render_graph->n_executed_passes; ++i) {
+		RawVulkanRenderGraphPass* pass =
+			&render_graph->passes[render_graph->execution_order[i]];
+
+		pass->first_image_barrier = render_graph->n_image_barriers;
+
+		for (uint32_t j = 0; j < pass->n_accesses; ++j) {
+			RawVulkanRenderGraphAccess* access =
+				&render_graph->accesses[pass->first_access + j];
+			RawVulkanRenderGraphResource* resource =
+				&render_graph->resources[access->resource];
+			RawVulkanRenderGraphResourceState* state =
+				&states[access->resource];
+
+			if (!state->initialized) {
+				state->initialized = true;
+				state->layout = resource->initial_layout;
+				state->write_stages = resource->initial_stages;
+				state->write_access = resource->initial_access;
+
+				// The previous resident of aliased memory must be done
+				if (resource->alias_predecessor !=
+					RAW_VULKAN_RENDER_GRAPH_NONE) {
+					RawVulkanRenderGraphResourceState* predecessor =
+						&states[resource->alias_predecessor];
+
+					state->write_stages = predecessor->write_stages |
+						predecessor->read_stages;
+					state->write_access = predecessor->write_access;
+				}
+			}
+
+			bool write = rawIsVulkanRenderGraphWrite(access);
+			bool transition =
+				resource->type == RAW_VULKAN_RENDER_GRAPH_IMAGE &&
+				state->layout != access->layout;
+
+			if (transition) {
+				if (!rawPushVulkanRenderGraphImageBarrier(render_graph,
+					resource, state->write_access, access->access,
+					state->layout, access->layout)) {
+					RAW_MEM_FREE(states);
+					return false;
+				}
+
+				pass->src_stages |= state->write_stages | state->read_stages;
+				pass->dst_stages |= access->stages;
+
+				// Later accesses must be ordered after the transition
+				state->layout = access->layout;
+				state->write_stages = access->stages;
+				state->write_access = write ? access->access : 0;
+				state->read_stages = write ? 0 : access->stages;
+				state->visible_stages = access->stages;
+				state->visible_access = access->access;
+			}
+			else if (write) {
+				// Write after write and write after read hazards
+				if (state->write_stages | state->read_stages) {
+					pass->src_stages |=
+						state->write_stages | state->read_stages;
+					pass->src_access |= state->write_access;
+					pass->dst_stages |= access->stages;
+					pass->dst_access |= access->access;
+				}
+
+				state->write_stages = access->stages;
+				state->write_access = access->access;
+				state->read_stages = 0;
+				state->visible_stages = 0;
+				state->visible_access = 0;
+			}
+			else {
+				// Read after write, unless already made visible
+				if (state->write_stages &&
+					((access->stages & ~state->visible_stages) ||
+					(access->access & ~state->visible_access))) {
+					pass->src_stages |= state->write_stages;
+					pass->src_access |= state->write_access;
+					pass->dst_stages |= access->stages;
+					pass->dst_access |= access->access;
+
+					state->visible_stages |= access->stages;
+					state->visible_access |= access->access;
+				}
+
+				state->read_stages |= access->stages;
+			}
+		}
+
+		pass->n_image_barriers =
+			render_graph->n_image_barriers - pass->first_image_barrier;
+	}
+
+	// Imported images are handed back in the layout the caller expects
+	render_graph->first_final_barrier = render_graph->n_image_barriers;
+
+	for (uint32_t i = 0; i < render_graph->n_resources; ++i) {
+		RawVulkanRenderGraphResource* resource = &render_graph->resources[i];
+		RawVulkanRenderGraphResourceState* state = &states[i];
+
+		if (!resource->imported || !state->initialized ||
+			resource->type != RAW_VULKAN_RENDER_GRAPH_IMAGE ||
+			resource->final_layout == VK_IMAGE_LAYOUT_UNDEFINED ||
+			resource->final_layout == state->layout)
+			continue;
+
+		if (!rawPushVulkanRenderGraphImageBarrier(render_graph, resource,
+			state->write_access, 0, state->layout, resource->final_layout)) {
+			RAW_MEM_FREE(states);
+			return false;
+		}
+
+		render_graph->final_src_stages |=
+			state->write_stages | state->read_stages;
+	}
+
+	render_graph->n_final_barriers =
+		render_graph->n_image_barriers - render_graph->first_final_barrier;
+
+	RAW_MEM_FREE(states);
+
+	return true;
+}
+
+bool rawCompileVulkanRenderGraph(
+	VkDevice logical_device,
+	VkPhysicalDeviceMemoryProperties const* const memory_properties,
+	RawVulkanRenderGraph* render_graph) {
+
+	if (render_graph->compiled) {
+		RAW_LOG_ERROR("Render graph already compiled!");
+		return false;
+	}
+
+	if (!rawCullVulkanRenderGraphPasses(render_graph)) {
+		RAW_LOG_ERROR("rawCullVulkanRenderGraphPasses failed!");
+		return false;
+	}
+
+	if (!rawOrderVulkanRenderGraphPasses(render_graph)) {
+		RAW_LOG_ERROR("rawOrderVulkanRenderGraphPasses failed!");
+		return false;
+	}
+
+	if (!rawCreateVulkanRenderGraphTransientResources(
+		logical_device, memory_properties, render_graph)) {
+		RAW_LOG_ERROR("rawCreateVulkanRenderGraphTransientResources failed!");
+		return false;
+	}
+
+	if (!rawComputeVulkanRenderGraphBarriers(render_graph)) {
+		RAW_LOG_ERROR("rawComputeVulkanRenderGraphBarriers failed!");
+		return false;
+	}
+
+	render_graph->compiled = true;
+
+	return true;
+}
+
+void rawCmdExecuteVulkanRenderGraph(
+	RawVulkanRenderGraph const* const render_graph,
+	VkCommandBuffer command_buffer) {
+
+	for (uint32_t i = 0; i < render_graph->n_executed_passes; ++i) {
+		RawVulkanRenderGraphPass const* pass =
+			&render_graph->passes[render_graph->execution_order[i]];
+
+		if (pass->dst_stages != 0) {
+			VkMemoryBarrier memory_barrier = {
+				.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+				.pNext = RAW_NULL_PTR,
+				.srcAccessMask = pass->src_access,
+				.dstAccessMask = pass->dst_access
+			};
+
+			bool has_memory_barrier =
+				pass->src_access != 0 || pass->dst_access != 0;
+
+			// Nothing to wait for, only the layout transitions
+			VkPipelineStageFlags src_stages = pass->src_stages != 0 ?
+				pass->src_stages : VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+
+			vkCmdPipelineBarrier(command_buffer,
+				src_stages, pass->dst_stages, 0,
+				has_memory_barrier ? 1u : 0u, &memory_barrier,
+				0u, RAW_NULL_PTR,
+				pass->n_image_barriers,
+				render_graph->image_barriers + pass->first_image_barrier);
+		}
+
+		if (pass->record_function)
+			pass->record_function(command_buffer, pass->user_data);
+	}
+
+	if (render_graph->n_final_barriers > 0u) {
+		VkPipelineStageFlags src_stages =
+			render_graph->final_src_stages != 0 ?
+				render_graph->final_src_stages :
+				VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+
+		vkCmdPipelineBarrier(command_buffer,
+			src_stages, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0,
+			0u, RAW_NULL_PTR, 0u, RAW_NULL_PTR,
+			render_graph->n_final_barriers,
+			render_graph->image_barriers + render_graph->first_final_barrier);
+	}
+}
@@ -0,0 +1,251 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanRenderGraph.h"
+ *
+ * Frame render graph
+ *
+ * Passes declare how they access buffers and images. Compiling the graph
+ * culls passes whose results are never used, orders the remaining ones,
+ * computes a single merged pipeline barrier per pass and places transient
+ * resources with disjoint lifetimes in the same memory.
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+
+#ifndef RAW_VULKAN_RENDER_GRAPH_H
+#define RAW_VULKAN_RENDER_GRAPH_H
+
+#include <engine/vulkan/rawVulkan.h>
+
+#include <inttypes.h>
+#include <stdbool.h>
+
+#define RAW_VULKAN_RENDER_GRAPH_NONE UINT32_MAX
+
+typedef enum {
+	RAW_VULKAN_RENDER_GRAPH_IMAGE,
+	RAW_VULKAN_RENDER_GRAPH_BUFFER
+} RawVulkanRenderGraphResourceType;
+
+/*
+ * How a pass uses a resource. Each resource may be declared only once
+ * per pass, so read-modify-write accesses combine their access masks.
+ * @layout is ignored for buffers.
+ */
+typedef struct {
+	uint32_t resource;
+	VkPipelineStageFlags stages;
+	VkAccessFlags access;
+	VkImageLayout layout;
+} RawVulkanRenderGraphAccess;
+
+typedef struct {
+	RawVulkanRenderGraphResourceType type;
+	bool imported;
+
+	VkImage image;
+	VkImageView image_view;
+	VkImageSubresourceRange subresource_range;
+	VkBuffer buffer;
+
+	// Transient resources are created by rawCompileVulkanRenderGraph
+	VkImageCreateInfo image_create_info;
+	VkBufferCreateInfo buffer_create_info;
+	VkMemoryRequirements memory_requirements;
+	uint32_t memory_block;
+
+	// Resource that used the same memory right before this one
+	uint32_t alias_predecessor;
+
+	// Imported resources state before and after the graph
+	VkPipelineStageFlags initial_stages;
+	VkAccessFlags initial_access;
+	VkImageLayout initial_layout;
+	VkImageLayout final_layout;
+
+	// First and last positions in the execution order
+	uint32_t first_use;
+	uint32_t last_use;
+} RawVulkanRenderGraphResource;
+
+typedef void (*RawVulkanRenderGraphRecordFunction)(
+	VkCommandBuffer command_buffer,
+	void* user_data);
+
+typedef struct {
+	char const* name;
+	uint32_t first_access;
+	uint32_t n_accesses;
+	RawVulkanRenderGraphRecordFunction record_function;
+	void* user_data;
+
+	// Passes with side effects are never culled
+	bool side_effects;
+	bool culled;
+
+	// Barrier recorded before the pass
+	VkPipelineStageFlags src_stages;
+	VkPipelineStageFlags dst_stages;
+	VkAccessFlags src_access;
+	VkAccessFlags dst_access;
+	uint32_t first_image_barrier;
+	uint32_t n_image_barriers;
+} RawVulkanRenderGraphPass;
+
+typedef struct {
+	VkDeviceMemory memory;
+	VkMemoryRequirements memory_requirements;
+	uint32_t last_resident;
+} RawVulkanRenderGraphMemoryBlock;
+
+typedef struct {
+	RawVulkanRenderGraphResource* resources;
+	uint32_t n_resources;
+	uint32_t max_resources;
+
+	RawVulkanRenderGraphPass* passes;
+	uint32_t n_passes;
+	uint32_t max_passes;
+
+	RawVulkanRenderGraphAccess* accesses;
+	uint32_t n_accesses;
+	uint32_t max_accesses;
+
+	// Indices of the passes not culled, in execution order
+	uint32_t* execution_order;
+	uint32_t n_executed_passes;
+
+	VkImageMemoryBarrier* image_barriers;
+	uint32_t n_image_barriers;
+	uint32_t max_image_barriers;
+
+	RawVulkanRenderGraphMemoryBlock* memory_blocks;
+	uint32_t n_memory_blocks;
+
+	// Transitions of imported images to their final layouts
+	VkPipelineStageFlags final_src_stages;
+	uint32_t first_final_barrier;
+	uint32_t n_final_barriers;
+
+	bool compiled;
+} RawVulkanRenderGraph;
+
+void rawCreateVulkanRenderGraph(RawVulkanRenderGraph* render_graph);
+
+void rawDestroyVulkanRenderGraph(
+	VkDevice logical_device,
+	RawVulkanRenderGraph* render_graph);
+
+/*
+ * Destroys the transient resources and removes every pass and
+ * resource, so the graph can be built again for the next frame.
+ *
+ * It's the caller's responsibility to guarantee the GPU is done
+ * with the command buffers the graph was executed on.
+ */
+void rawResetVulkanRenderGraph(
+	VkDevice logical_device,
+	RawVulkanRenderGraph* render_graph);
+
+/*
+ * Imports an image owned by the caller, in @initial_layout and last
+ * accessed with @initial_stages and @initial_access. Once the graph is
+ * executed, the image is left in @final_layout, unless it is
+ * VK_IMAGE_LAYOUT_UNDEFINED. Passes writing imported resources are
+ * never culled.
+ */
+bool rawImportVulkanRenderGraphImage(
+	RawVulkanRenderGraph* render_graph,
+	VkImage image,
+	VkImageView image_view,
+	VkImageSubresourceRange const* const subresource_range,
+	VkImageLayout initial_layout,
+	VkPipelineStageFlags initial_stages,
+	VkAccessFlags initial_access,
+	VkImageLayout final_layout,
+	uint32_t* resource);
+
+bool rawImportVulkanRenderGraphBuffer(
+	RawVulkanRenderGraph* render_graph,
+	VkBuffer buffer,
+	VkPipelineStageFlags initial_stages,
+	VkAccessFlags initial_access,
+	uint32_t* resource);
+
+/*
+ * Declares an image that only lives during the graph execution.
+ * The image and a view of @subresource_range are created on
+ * compilation, in memory possibly shared with other transient
+ * resources. Its contents are undefined on the first access.
+ */
+bool rawCreateVulkanRenderGraphTransientImage(
+	RawVulkanRenderGraph* render_graph,
+	VkImageCreateInfo const* const image_create_info,
+	VkImageSubresourceRange const* const subresource_range,
+	uint32_t* resource);
+
+bool rawCreateVulkanRenderGraphTransientBuffer(
+	RawVulkanRenderGraph* render_graph,
+	VkDeviceSize size,
+	VkBufferUsageFlags usage,
+	uint32_t* resource);
+
+/*
+ * Adds a pass accessing @accesses. @record_function is called with
+ * @user_data when the graph is executed, after the pass barrier.
+ * Declaration order defines which write each read observes.
+ */
+bool rawAddVulkanRenderGraphPass(
+	RawVulkanRenderGraph* render_graph,
+	char const* name,
+	RawVulkanRenderGraphAccess const* const accesses,
+	uint32_t n_accesses,
+	RawVulkanRenderGraphRecordFunction record_function,
+	void* user_data,
+	bool side_effects,
+	uint32_t* pass);
+
+/*
+ * Culls passes that don't contribute to side effects or imported
+ * resources, orders the remaining ones, computes their barriers and
+ * creates the transient resources.
+ */
+bool rawCompileVulkanRenderGraph(
+	VkDevice logical_device,
+	VkPhysicalDeviceMemoryProperties const* const memory_properties,
+	RawVulkanRenderGraph* render_graph);
+
+/*
+ * Records every pass of the compiled graph into @command_buffer.
+ * Render passes, if any, are begun and ended by the passes themselves.
+ */
+void rawCmdExecuteVulkanRenderGraph(
+	RawVulkanRenderGraph const* const render_graph,
+	VkCommandBuffer command_buffer);
+
+#endif // RAW_VULKAN_RENDER_GRAPH_H
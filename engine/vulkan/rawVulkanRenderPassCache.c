@@ -0,0 +1,649 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanRenderPassCache.c"
+ *
+ * Render pass and framebuffer caches
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+
+#include <engine/vulkan/rawVulkanRenderPassCache.h>
+#include <engine/platform/rawMemory.h>
+#include <engine/utils/rawHash.h>
+#include <engine/utils/rawLogger.h>
+
+#include <string.h>
+
+// Power of two with room for @max_entries at a 3/4 load factor
+static uint32_t rawGetVulkanCacheCapacity(uint32_t max_entries) {
+	uint32_t capacity = 1u;
+
+	while (capacity * 3u < max_entries * 4u)
+		capacity <<= 1u;
+
+	return capacity;
+}
+
+static bool rawIsVulkanDepthStencilFormat(VkFormat format) {
+	return format == VK_FORMAT_D16_UNORM ||
+		format == VK_FORMAT_X8_D24_UNORM_PACK32 ||
+		format == VK_FORMAT_D32_SFLOAT ||
+		format == VK_FORMAT_S8_UINT ||
+		format == VK_FORMAT_D16_UNORM_S8_UINT ||
+		format == VK_FORMAT_D24_UNORM_S8_UINT ||
+		format == VK_FORMAT_D32_SFLOAT_S8_UINT;
+}
+
+void rawInitVulkanRenderPassKey(RawVulkanRenderPassKey* key) {
+	memset(key, 0, sizeof(RawVulkanRenderPassKey));
+
+	for (uint32_t i = 0; i < RAW_VULKAN_MAX_RENDER_PASS_SUBPASSES; ++i)
+		key->subpasses[i].depth_stencil_attachment =
+			RAW_VULKAN_RENDER_PASS_NO_ATTACHMENT;
+}
+
+bool rawCreateVulkanRenderPassCache(
+	uint32_t max_render_passes,
+	RawVulkanRenderPassCache* render_pass_cache) {
+
+	memset(render_pass_cache, 0, sizeof(RawVulkanRenderPassCache));
+
+	uint32_t capacity = rawGetVulkanCacheCapacity(max_render_passes);
+
+	RAW_MEM_ALLOC(render_pass_cache->entries, (uint64_t)capacity,
+		sizeof(RawVulkanRenderPassEntry));
+
+	if (!render_pass_cache->entries) {
+		RAW_LOG_ERROR("RAW_MEM_ALLOC failed on "
+			"rawCreateVulkanRenderPassCache!");
+		return false;
+	}
+
+	memset(render_pass_cache->entries, 0,
+		capacity * sizeof(RawVulkanRenderPassEntry));
+
+	render_pass_cache->capacity = capacity;
+	render_pass_cache->max_render_passes = max_render_passes;
+
+	return true;
+}
+
+void rawDestroyVulkanRenderPassCache(
+	VkDevice logical_device,
+	RawVulkanRenderPassCache* render_pass_cache) {
+
+	if (!render_pass_cache->entries) {
+		RAW_LOG_WARNING("Attempting to destroy "
+			"NULL Vulkan render pass cache!");
+		return;
+	}
+
+	for (uint32_t i = 0; i < render_pass_cache->capacity; ++i)
+		if (render_pass_cache->entries[i].render_pass != VK_NULL_HANDLE)
+			// TODO: Pass allocation callback
+			vkDestroyRenderPass(logical_device,
+				render_pass_cache->entries[i].render_pass, RAW_NULL_PTR);
+
+	RAW_MEM_FREE(render_pass_cache->entries);
+
+	memset(render_pass_cache, 0, sizeof(RawVulkanRenderPassCache));
+}
+
+static bool rawValidateVulkanRenderPassKey(
+	RawVulkanRenderPassKey const* const key) {
+
+	if (key->n_attachments > RAW_VULKAN_MAX_RENDER_PASS_ATTACHMENTS ||
+		key->n_subpasses == 0u ||
+		key->n_subpasses > RAW_VULKAN_MAX_RENDER_PASS_SUBPASSES)
+		return false;
+
+	for (uint32_t i = 0; i < key->n_subpasses; ++i) {
+		RawVulkanSubpassLayout const* subpass = &key->subpasses[i];
+
+		if (subpass->n_color_attachments >
+			RAW_VULKAN_MAX_RENDER_PASS_ATTACHMENTS ||
+			subpass->n_input_attachments >
+			RAW_VULKAN_MAX_RENDER_PASS_ATTACHMENTS)
+			return false;
+
+		for (uint32_t j = 0; j < subpass->n_color_attachments; ++j)
+			if (subpass->color_attachments[j] >= key->n_attachments)
+				return false;
+
+		for (uint32_t j = 0; j < subpass->n_input_attachments; ++j)
+			if (subpass->input_attachments[j] >= key->n_attachments)
+				return false;
+
+		if (subpass->depth_stencil_attachment !=
+			RAW_VULKAN_RENDER_PASS_NO_ATTACHMENT &&
+			subpass->depth_stencil_attachment >= key->n_attachments)
+			return false;
+	}
+
+	return true;
+}
+
+static bool rawUsesVulkanSubpassAttachment(
+	RawVulkanSubpassLayout const* const subpass,
+	uint32_t attachment) {
+
+	for (uint32_t i = 0; i < subpass->n_color_attachments; ++i)
+		if (subpass->color_attachments[i] == attachment)
+			return true;
+
+	for (uint32_t i = 0; i < subpass->n_input_attachments; ++i)
+		if (subpass->input_attachments[i] == attachment)
+			return true;
+
+	return subpass->depth_stencil_attachment == attachment;
+}
+
+static bool rawCreateVulkanRenderPassFromKey(
+	VkDevice logical_device,
+	RawVulkanRenderPassKey const* const key,
+	VkRenderPass* render_pass) {
+
+	VkAttachmentReference color_references[
+		RAW_VULKAN_MAX_RENDER_PASS_SUBPASSES][
+		RAW_VULKAN_MAX_RENDER_PASS_ATTACHMENTS];
+	VkAttachmentReference input_references[
+		RAW_VULKAN_MAX_RENDER_PASS_SUBPASSES][
+		RAW_VULKAN_MAX_RENDER_PASS_ATTACHMENTS];
+	VkAttachmentReference depth_stencil_references[
+		RAW_VULKAN_MAX_RENDER_PASS_SUBPASSES];
+	uint32_t preserve_attachments[
+		RAW_VULKAN_MAX_RENDER_PASS_SUBPASSES][
+		RAW_VULKAN_MAX_RENDER_PASS_ATTACHMENTS];
+
+	VkSubpassDescription subpasses[RAW_VULKAN_MAX_RENDER_PASS_SUBPASSES];
+
+	// External, between consecutive subpasses and external again
+	VkSubpassDependency dependencies[RAW_VULKAN_MAX_RENDER_PASS_SUBPASSES + 1u];
+
+	VkPipelineStageFlags const attachment_stages =
+		VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT |
+		VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT |
+		VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+	VkAccessFlags const attachment_writes =
+		VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT |
+		VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+
+	for (uint32_t i = 0; i < key->n_subpasses; ++i) {
+		RawVulkanSubpassLayout const* layout = &key->subpasses[i];
+
+		for (uint32_t j = 0; j < layout->n_color_attachments; ++j)
+			color_references[i][j] = (VkAttachmentReference){
+				.attachment = layout->color_attachments[j],
+				.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL
+			};
+
+		for (uint32_t j = 0; j < layout->n_input_attachments; ++j) {
+			uint32_t attachment = layout->input_attachments[j];
+
+			input_references[i][j] = (VkAttachmentReference){
+				.attachment = attachment,
+				.layout = rawIsVulkanDepthStencilFormat(
+					key->attachments[attachment].format) ?
+					VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL :
+					VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL
+			};
+		}
+
+		depth_stencil_references[i] = (VkAttachmentReference){
+			.attachment = layout->depth_stencil_attachment,
+			.layout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL
+		};
+
+		// Contents written before the subpass and read after it
+		uint32_t n_preserve_attachments = 0u;
+
+		for (uint32_t a = 0; a < key->n_attachments; ++a) {
+			if (rawUsesVulkanSubpassAttachment(layout, a))
+				continue;
+
+			bool used_before = false;
+			bool used_after = false;
+
+			for (uint32_t s = 0; s < i; ++s)
+				used_before |=
+					rawUsesVulkanSubpassAttachment(&key->subpasses[s], a);
+
+			for (uint32_t s = i + 1u; s < key->n_subpasses; ++s)
+				used_after |=
+					rawUsesVulkanSubpassAttachment(&key->subpasses[s], a);
+
+			if (used_before && used_after)
+				preserve_attachments[i][n_preserve_attachments++] = a;
+		}
+
+		subpasses[i] = (VkSubpassDescription){
+			.flags = 0,
+			.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS,
+			.inputAttachmentCount = layout->n_input_attachments,
+			.pInputAttachments = input_references[i],
+			.colorAttachmentCount = layout->n_color_attachments,
+			.pColorAttachments = color_references[i],
+			.pResolveAttachments = RAW_NULL_PTR,
+			.pDepthStencilAttachment = layout->depth_stencil_attachment ==
+				RAW_VULKAN_RENDER_PASS_NO_ATTACHMENT ?
+				RAW_NULL_PTR : &depth_stencil_references[i],
+			.preserveAttachmentCount = n_preserve_attachments,
+			.pPreserveAttachments = preserve_attachments[i]
+		};
+
+		// Previous attachment writes, e.g. swapchain acquisition waits
+		dependencies[i] = (VkSubpassDependency){
+			.srcSubpass = i == 0u ? VK_SUBPASS_EXTERNAL : i - 1u,
+			.dstSubpass = i,
+			.srcStageMask = attachment_stages,
+			.dstStageMask = attachment_stages |
+				VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+			.srcAccessMask = attachment_writes,
+			.dstAccessMask = attachment_writes |
+				VK_ACCESS_COLOR_ATTACHMENT_READ_BIT |
+				VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT |
+				VK_ACCESS_INPUT_ATTACHMENT_READ_BIT,
+			.dependencyFlags = i == 0u ? 0 : VK_DEPENDENCY_BY_REGION_BIT
+		};
+	}
+
+	// Results sampled or copied by later passes
+	dependencies[key->n_subpasses] = (VkSubpassDependency){
+		.srcSubpass = key->n_subpasses - 1u,
+		.dstSubpass = VK_SUBPASS_EXTERNAL,
+		.srcStageMask = attachment_stages,
+		.dstStageMask = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT |
+			VK_PIPELINE_STAGE_TRANSFER_BIT,
+		.srcAccessMask = attachment_writes,
+		.dstAccessMask = VK_ACCESS_SHADER_READ_BIT |
+			VK_ACCESS_TRANSFER_READ_BIT,
+		.dependencyFlags = 0
+	};
+
+	VkRenderPassCreateInfo create_info = {
+		.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = 0,
+		.attachmentCount = key->n_attachments,
+		.pAttachments = key->attachments,
+		.subpassCount = key->n_subpasses,
+		.pSubpasses = subpasses,
+		.dependencyCount = key->n_subpasses + 1u,
+		.pDependencies = dependencies
+	};
+
+	// TODO: Pass allocation callback
+	VkResult result = vkCreateRenderPass(logical_device,
+		&create_info, RAW_NULL_PTR, render_pass);
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("vkCreateRenderPass failed!");
+		return false;
+	}
+
+	return true;
+}
+
+bool rawGetVulkanRenderPass(
+	VkDevice logical_device,
+	RawVulkanRenderPassCache* render_pass_cache,
+	RawVulkanRenderPassKey const* const key,
+	VkRenderPass* render_pass) {
+
+	if (!rawValidateVulkanRenderPassKey(key)) {
+		RAW_LOG_ERROR("Invalid render pass key!");
+		return false;
+	}
+
+	uint64_t key_hash = rawHashBytes(RAW_HASH_FNV1A_OFFSET_BASIS,
+		key, sizeof(RawVulkanRenderPassKey));
+
+	uint32_t mask = render_pass_cache->capacity - 1u;
+	uint32_t slot = (uint32_t)key_hash & mask;
+
+	while (render_pass_cache->entries[slot].render_pass != VK_NULL_HANDLE) {
+		RawVulkanRenderPassEntry const* entry =
+			&render_pass_cache->entries[slot];
+
+		if (entry->key_hash == key_hash && memcmp(&entry->key, key,
+			sizeof(RawVulkanRenderPassKey)) == 0) {
+			*render_pass = entry->render_pass;
+			return true;
+		}
+
+		slot = (slot + 1u) & mask;
+	}
+
+	if (render_pass_cache->n_render_passes ==
+		render_pass_cache->max_render_passes) {
+		RAW_LOG_ERROR("Render pass cache is full!");
+		return false;
+	}
+
+	RawVulkanRenderPassEntry* entry = &render_pass_cache->entries[slot];
+
+	if (!rawCreateVulkanRenderPassFromKey(
+		logical_device, key, &entry->render_pass)) {
+		entry->render_pass = VK_NULL_HANDLE;
+		return false;
+	}
+
+	entry->key_hash = key_hash;
+	entry->key = *key;
+
+	++render_pass_cache->n_render_passes;
+
+	*render_pass = entry->render_pass;
+
+	return true;
+}
+
+bool rawCreateVulkanFramebufferCache(
+	uint32_t max_framebuffers,
+	RawVulkanFramebufferCache* framebuffer_cache) {
+
+	memset(framebuffer_cache, 0, sizeof(RawVulkanFramebufferCache));
+
+	uint32_t capacity = rawGetVulkanCacheCapacity(max_framebuffers);
+
+	RAW_MEM_ALLOC(framebuffer_cache->entries, (uint64_t)capacity,
+		sizeof(RawVulkanFramebufferEntry));
+
+	if (!framebuffer_cache->entries) {
+		RAW_LOG_ERROR("RAW_MEM_ALLOC failed on "
+			"rawCreateVulkanFramebufferCache!");
+		return false;
+	}
+
+	memset(framebuffer_cache->entries, 0,
+		capacity * sizeof(RawVulkanFramebufferEntry));
+
+	framebuffer_cache->capacity = capacity;
+	framebuffer_cache->max_framebuffers = max_framebuffers;
+
+	RAW_MEM_ALLOC(framebuffer_cache->retired_framebuffers,
+		(uint64_t)max_framebuffers, sizeof(RawVulkanRetiredFramebuffer));
+
+	if (!framebuffer_cache->retired_framebuffers) {
+		RAW_LOG_ERROR("RAW_MEM_ALLOC failed on "
+			"rawCreateVulkanFramebufferCache!");
+		RAW_MEM_FREE(framebuffer_cache->entries);
+		memset(framebuffer_cache, 0, sizeof(RawVulkanFramebufferCache));
+		return false;
+	}
+
+	return true;
+}
+
+void rawDestroyVulkanFramebufferCache(
+	VkDevice logical_device,
+	RawVulkanFramebufferCache* framebuffer_cache) {
+
+	if (!framebuffer_cache->entries) {
+		RAW_LOG_WARNING("Attempting to destroy "
+			"NULL Vulkan framebuffer cache!");
+		return;
+	}
+
+	for (uint32_t i = 0; i < framebuffer_cache->capacity; ++i)
+		if (framebuffer_cache->entries[i].framebuffer != VK_NULL_HANDLE)
+			// TODO: Pass allocation callback
+			vkDestroyFramebuffer(logical_device,
+				framebuffer_cache->entries[i].framebuffer, RAW_NULL_PTR);
+
+	for (uint32_t i = 0; i < framebuffer_cache->n_retired_framebuffers; ++i)
+		// TODO: Pass allocation callback
+		vkDestroyFramebuffer(logical_device,
+			framebuffer_cache->retired_framebuffers[i].framebuffer,
+			RAW_NULL_PTR);
+
+	RAW_MEM_FREE(framebuffer_cache->retired_framebuffers);
+	RAW_MEM_FREE(framebuffer_cache->entries);
+
+	memset(framebuffer_cache, 0, sizeof(RawVulkanFramebufferCache));
+}
+
+void rawBeginVulkanFramebufferCacheFrame(
+	VkDevice logical_device,
+	RawVulkanFramebufferCache* framebuffer_cache,
+	uint64_t frame_number,
+	uint64_t oldest_pending_frame_number) {
+
+	framebuffer_cache->frame_number = frame_number;
+	framebuffer_cache->oldest_pending_frame_number =
+		oldest_pending_frame_number;
+
+	uint32_t n_retired_framebuffers = 0u;
+
+	for (uint32_t i = 0; i < framebuffer_cache->n_retired_framebuffers; ++i) {
+		RawVulkanRetiredFramebuffer const* retired =
+			&framebuffer_cache->retired_framebuffers[i];
+
+		if (retired->frame_number < oldest_pending_frame_number)
+			// TODO: Pass allocation callback
+			vkDestroyFramebuffer(logical_device,
+				retired->framebuffer, RAW_NULL_PTR);
+		else
+			framebuffer_cache->retired_framebuffers[
+				n_retired_framebuffers++] = *retired;
+	}
+
+	framebuffer_cache->n_retired_framebuffers = n_retired_framebuffers;
+}
+
+static uint64_t rawHashVulkanFramebufferKey(
+	VkRenderPass render_pass,
+	VkImageView const* const image_views,
+	uint32_t n_image_views,
+	VkExtent2D extent) {
+
+	uint64_t hash = rawHashBytes(RAW_HASH_FNV1A_OFFSET_BASIS,
+		&render_pass, sizeof(VkRenderPass));
+
+	hash = rawHashBytes(hash, image_views,
+		n_image_views * sizeof(VkImageView));
+	hash = rawHashU64(hash, n_image_views);
+	hash = rawHashU64(hash, extent.width);
+
+	return rawHashU64(hash, extent.height);
+}
+
+/*
+ * Retires the framebuffers using @image_view or, if it's VK_NULL_HANDLE,
+ * the ones over the images of a recreated swapchain. The table is then
+ * rebuilt without them, since linear probing can't just empty their
+ * slots.
+ */
+static bool rawRetireVulkanFramebuffers(
+	RawVulkanFramebufferCache* framebuffer_cache,
+	VkImageView image_view) {
+
+	RawVulkanFramebufferEntry* entries = RAW_NULL_PTR;
+	uint32_t capacity = framebuffer_cache->capacity;
+	uint32_t mask = capacity - 1u;
+
+	RAW_MEM_ALLOC(entries, (uint64_t)capacity,
+		sizeof(RawVulkanFramebufferEntry));
+
+	if (!entries) {
+		RAW_LOG_ERROR("RAW_MEM_ALLOC failed on "
+			"rawRetireVulkanFramebuffers!");
+		return false;
+	}
+
+	memset(entries, 0, capacity * sizeof(RawVulkanFramebufferEntry));
+
+	for (uint32_t i = 0; i < capacity; ++i) {
+		RawVulkanFramebufferEntry const* entry =
+			&framebuffer_cache->entries[i];
+
+		if (entry->framebuffer == VK_NULL_HANDLE)
+			continue;
+
+		bool retired = image_view == VK_NULL_HANDLE &&
+			entry->uses_swapchain_images;
+
+		for (uint32_t j = 0; image_view != VK_NULL_HANDLE &&
+			j < entry->n_image_views; ++j)
+			retired = retired || entry->image_views[j] == image_view;
+
+		if (retired) {
+			framebuffer_cache->retired_framebuffers[
+				framebuffer_cache->n_retired_framebuffers++] =
+				(RawVulkanRetiredFramebuffer){
+					.framebuffer = entry->framebuffer,
+					.frame_number = framebuffer_cache->frame_number
+				};
+
+			--framebuffer_cache->n_framebuffers;
+			continue;
+		}
+
+		uint32_t slot = (uint32_t)entry->key_hash & mask;
+
+		while (entries[slot].framebuffer != VK_NULL_HANDLE)
+			slot = (slot + 1u) & mask;
+
+		entries[slot] = *entry;
+	}
+
+	RAW_MEM_FREE(framebuffer_cache->entries);
+	framebuffer_cache->entries = entries;
+
+	return true;
+}
+
+bool rawGetVulkanFramebuffer(
+	VkDevice logical_device,
+	RawVulkanFramebufferCache* framebuffer_cache,
+	RawVulkanSwapchain const* const swapchain,
+	VkRenderPass render_pass,
+	VkImageView const* const image_views,
+	uint32_t n_image_views,
+	VkExtent2D extent,
+	VkFramebuffer* framebuffer) {
+
+	if (n_image_views > RAW_VULKAN_MAX_RENDER_PASS_ATTACHMENTS) {
+		RAW_LOG_ERROR("Too many framebuffer attachments!");
+		return false;
+	}
+
+	if (swapchain &&
+		swapchain->generation != framebuffer_cache->swapchain_generation) {
+		if (!rawRetireVulkanFramebuffers(framebuffer_cache, VK_NULL_HANDLE))
+			return false;
+
+		framebuffer_cache->swapchain_generation = swapchain->generation;
+	}
+
+	uint64_t key_hash = rawHashVulkanFramebufferKey(
+		render_pass, image_views, n_image_views, extent);
+
+	uint32_t mask = framebuffer_cache->capacity - 1u;
+	uint32_t slot = (uint32_t)key_hash & mask;
+
+	while (framebuffer_cache->entries[slot].framebuffer != VK_NULL_HANDLE) {
+		RawVulkanFramebufferEntry const* entry =
+			&framebuffer_cache->entries[slot];
+
+		if (entry->key_hash == key_hash &&
+			entry->render_pass == render_pass &&
+			entry->n_image_views == n_image_views &&
+			entry->extent.width == extent.width &&
+			entry->extent.height == extent.height &&
+			memcmp(entry->image_views, image_views,
+				n_image_views * sizeof(VkImageView)) == 0) {
+			*framebuffer = entry->framebuffer;
+			return true;
+		}
+
+		slot = (slot + 1u) & mask;
+	}
+
+	if (framebuffer_cache->n_framebuffers +
+		framebuffer_cache->n_retired_framebuffers ==
+		framebuffer_cache->max_framebuffers) {
+		RAW_LOG_ERROR("Framebuffer cache is full!");
+		return false;
+	}
+
+	RawVulkanFramebufferEntry* entry = &framebuffer_cache->entries[slot];
+
+	VkFramebufferCreateInfo create_info = {
+		.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = 0,
+		.renderPass = render_pass,
+		.attachmentCount = n_image_views,
+		.pAttachments = image_views,
+		.width = extent.width,
+		.height = extent.height,
+		.layers = 1u
+	};
+
+	// TODO: Pass allocation callback
+	VkResult result = vkCreateFramebuffer(logical_device,
+		&create_info, RAW_NULL_PTR, &entry->framebuffer);
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("vkCreateFramebuffer failed!");
+		entry->framebuffer = VK_NULL_HANDLE;
+		return false;
+	}
+
+	entry->key_hash = key_hash;
+	entry->render_pass = render_pass;
+	entry->n_image_views = n_image_views;
+	entry->extent = extent;
+	entry->uses_swapchain_images = false;
+
+	memcpy(entry->image_views, image_views,
+		n_image_views * sizeof(VkImageView));
+
+	for (uint32_t i = 0; swapchain && i < swapchain->n_images; ++i)
+		for (uint32_t j = 0; j < n_image_views; ++j)
+			if (swapchain->image_views[i] != VK_NULL_HANDLE &&
+				swapchain->image_views[i] == image_views[j])
+				entry->uses_swapchain_images = true;
+
+	++framebuffer_cache->n_framebuffers;
+
+	*framebuffer = entry->framebuffer;
+
+	return true;
+}
+
+bool rawEvictVulkanFramebuffersUsingImageView(
+	RawVulkanFramebufferCache* framebuffer_cache,
+	VkImageView image_view) {
+
+	if (image_view == VK_NULL_HANDLE)
+		return true;
+
+	return rawRetireVulkanFramebuffers(framebuffer_cache, image_view);
+}
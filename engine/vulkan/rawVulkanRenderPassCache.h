@@ -0,0 +1,229 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanRenderPassCache.h"
+ *
+ * Render pass and framebuffer caches
+ *
+ * Render passes are keyed by their attachment descriptions and subpass
+ * layout, framebuffers by their render pass, image views and extent.
+ * Both are open addressing tables, so passes recorded every frame fetch
+ * compatible objects with a hash lookup instead of creating them.
+ * Framebuffers over swapchain images are retired automatically once the
+ * swapchain is recreated. Other image views must be evicted through
+ * rawEvictVulkanFramebuffersUsingImageView before they're destroyed.
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+
+#ifndef RAW_VULKAN_RENDER_PASS_CACHE_H
+#define RAW_VULKAN_RENDER_PASS_CACHE_H
+
+#include <engine/vulkan/rawVulkan.h>
+#include <engine/vulkan/rawVulkanPresentation.h>
+
+#include <inttypes.h>
+#include <stdbool.h>
+
+#define RAW_VULKAN_MAX_RENDER_PASS_ATTACHMENTS 8u
+#define RAW_VULKAN_MAX_RENDER_PASS_SUBPASSES 4u
+
+// Marks an unused depth stencil attachment of a subpass
+#define RAW_VULKAN_RENDER_PASS_NO_ATTACHMENT UINT32_MAX
+
+/*
+ * Attachments of a graphics subpass, as indices into the render pass
+ * attachments. Layouts are implied by their use: color attachments are
+ * in COLOR_ATTACHMENT_OPTIMAL, the depth stencil one in
+ * DEPTH_STENCIL_ATTACHMENT_OPTIMAL and input attachments in
+ * SHADER_READ_ONLY_OPTIMAL (DEPTH_STENCIL_READ_ONLY_OPTIMAL for depth
+ * formats).
+ */
+typedef struct {
+	uint32_t color_attachments[RAW_VULKAN_MAX_RENDER_PASS_ATTACHMENTS];
+	uint32_t n_color_attachments;
+
+	uint32_t input_attachments[RAW_VULKAN_MAX_RENDER_PASS_ATTACHMENTS];
+	uint32_t n_input_attachments;
+
+	uint32_t depth_stencil_attachment;
+} RawVulkanSubpassLayout;
+
+/*
+ * Every field is 32 bits wide, so keys have no padding and are hashed
+ * and compared bytewise. Initialize them with rawInitVulkanRenderPassKey.
+ */
+typedef struct {
+	VkAttachmentDescription attachments[
+		RAW_VULKAN_MAX_RENDER_PASS_ATTACHMENTS];
+	uint32_t n_attachments;
+
+	RawVulkanSubpassLayout subpasses[RAW_VULKAN_MAX_RENDER_PASS_SUBPASSES];
+	uint32_t n_subpasses;
+} RawVulkanRenderPassKey;
+
+typedef struct {
+	uint64_t key_hash;
+	RawVulkanRenderPassKey key;
+
+	// VK_NULL_HANDLE marks an empty slot
+	VkRenderPass render_pass;
+} RawVulkanRenderPassEntry;
+
+/*
+ * Open addressing table with a power of two capacity,
+ * kept at most 3/4 full
+ */
+typedef struct {
+	RawVulkanRenderPassEntry* entries;
+	uint32_t capacity;
+	uint32_t n_render_passes;
+	uint32_t max_render_passes;
+} RawVulkanRenderPassCache;
+
+typedef struct {
+	uint64_t key_hash;
+
+	VkRenderPass render_pass;
+	VkImageView image_views[RAW_VULKAN_MAX_RENDER_PASS_ATTACHMENTS];
+	uint32_t n_image_views;
+	VkExtent2D extent;
+
+	// VK_NULL_HANDLE marks an empty slot
+	VkFramebuffer framebuffer;
+
+	// Some image view belongs to the tracked swapchain
+	bool uses_swapchain_images;
+} RawVulkanFramebufferEntry;
+
+typedef struct {
+	VkFramebuffer framebuffer;
+
+	// Frame in which the framebuffer was retired
+	uint64_t frame_number;
+} RawVulkanRetiredFramebuffer;
+
+typedef struct {
+	RawVulkanFramebufferEntry* entries;
+	uint32_t capacity;
+	uint32_t n_framebuffers;
+
+	// Live and retired framebuffers together stay under the maximum
+	uint32_t max_framebuffers;
+
+	RawVulkanRetiredFramebuffer* retired_framebuffers;
+	uint32_t n_retired_framebuffers;
+
+	// Generation of the swapchain images in use
+	uint32_t swapchain_generation;
+
+	// Frame being recorded and the oldest one the GPU may still be using
+	uint64_t frame_number;
+	uint64_t oldest_pending_frame_number;
+} RawVulkanFramebufferCache;
+
+/*
+ * Zeroes @key, with no depth stencil attachment in any subpass.
+ * Attachments and subpasses are then filled in place.
+ */
+void rawInitVulkanRenderPassKey(RawVulkanRenderPassKey* key);
+
+bool rawCreateVulkanRenderPassCache(
+	uint32_t max_render_passes,
+	RawVulkanRenderPassCache* render_pass_cache);
+
+// Destroys every render pass in the cache
+void rawDestroyVulkanRenderPassCache(
+	VkDevice logical_device,
+	RawVulkanRenderPassCache* render_pass_cache);
+
+/*
+ * The render pass described by @key, created on a miss. Subpasses
+ * run in order: each one waits for the attachment writes of the
+ * previous one, by region, before reading its input attachments.
+ * Attachments unused by a subpass but used around it are preserved.
+ */
+bool rawGetVulkanRenderPass(
+	VkDevice logical_device,
+	RawVulkanRenderPassCache* render_pass_cache,
+	RawVulkanRenderPassKey const* const key,
+	VkRenderPass* render_pass);
+
+bool rawCreateVulkanFramebufferCache(
+	uint32_t max_framebuffers,
+	RawVulkanFramebufferCache* framebuffer_cache);
+
+/*
+ * Destroys every framebuffer in the cache, retired or not.
+ * It's the caller's responsibility to guarantee the GPU is done with them.
+ */
+void rawDestroyVulkanFramebufferCache(
+	VkDevice logical_device,
+	RawVulkanFramebufferCache* framebuffer_cache);
+
+/*
+ * Destroys the retired framebuffers the GPU is done with, those retired
+ * before @oldest_pending_frame_number.
+ *
+ * With a RawVulkanFrameManager of n frames, after rawBeginVulkanFrame
+ * this is its frame_number and frame_number - n + 1 (or 0).
+ */
+void rawBeginVulkanFramebufferCacheFrame(
+	VkDevice logical_device,
+	RawVulkanFramebufferCache* framebuffer_cache,
+	uint64_t frame_number,
+	uint64_t oldest_pending_frame_number);
+
+/*
+ * The framebuffer of @render_pass over @image_views, created on a miss.
+ *
+ * If @swapchain is not NULL, framebuffers created over its images are
+ * tracked: once it's recreated, they're retired and destroyed after the
+ * frames in flight are done with them. The same swapchain must be
+ * passed on every call.
+ */
+bool rawGetVulkanFramebuffer(
+	VkDevice logical_device,
+	RawVulkanFramebufferCache* framebuffer_cache,
+	RawVulkanSwapchain const* const swapchain,
+	VkRenderPass render_pass,
+	VkImageView const* const image_views,
+	uint32_t n_image_views,
+	VkExtent2D extent,
+	VkFramebuffer* framebuffer);
+
+/*
+ * Retires every framebuffer using @image_view, destroyed once the
+ * frames in flight are done with them like those over swapchain images.
+ * Must be called before destroying the view: framebuffer keys hold raw
+ * handles, and a new view reusing the handle would match stale entries.
+ */
+bool rawEvictVulkanFramebuffersUsingImageView(
+	RawVulkanFramebufferCache* framebuffer_cache,
+	VkImageView image_view);
+
+#endif // RAW_VULKAN_RENDER_PASS_CACHE_H
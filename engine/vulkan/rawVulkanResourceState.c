@@ -0,0 +1,676 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanResourceState.c"
+ *
+ * Resource state tracking and barrier batching
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+
+#include <engine/vulkan/rawVulkanResourceState.h>
+#include <engine/platform/rawMemory.h>
+#include <engine/utils/rawLogger.h>
+
+#include <string.h>
+
+#define RAW_VULKAN_RESOURCE_STATE_INITIAL_CAPACITY 16u
+
+static bool rawReserveVulkanResourceStateArray(
+	void** array,
+	uint32_t* max_elements,
+	uint32_t n_elements,
+	uint32_t n_needed,
+	size_t element_size) {
+
+	if (n_needed <= *max_elements)
+		return true;
+
+	uint32_t new_max_elements = *max_elements > 0u ?
+		*max_elements : RAW_VULKAN_RESOURCE_STATE_INITIAL_CAPACITY;
+
+	while (new_max_elements < n_needed)
+		new_max_elements *= 2u;
+
+	void* new_array = RAW_NULL_PTR;
+
+	RAW_MEM_ALLOC(new_array, (uint64_t)new_max_elements, element_size);
+
+	if (!new_array) {
+		RAW_LOG_ERROR("RAW_MEM_ALLOC failed on "
+			"rawReserveVulkanResourceStateArray!");
+		return false;
+	}
+
+	if (*array) {
+		memcpy(new_array, *array, n_elements * element_size);
+		RAW_MEM_FREE(*array);
+	}
+
+	*array = new_array;
+	*max_elements = new_max_elements;
+
+	return true;
+}
+
+static void rawInitializeVulkanResourceState(
+	RawVulkanResourceState* state,
+	VkImageLayout layout) {
+
+	memset(state, 0, sizeof(RawVulkanResourceState));
+	state->layout = layout;
+}
+
+// The batch is not compared, as it only matters while a batch is pending
+static bool rawIsVulkanResourceStateEqual(
+	RawVulkanResourceState const* const a,
+	RawVulkanResourceState const* const b) {
+
+	return a->layout == b->layout &&
+		a->write_stages == b->write_stages &&
+		a->write_access == b->write_access &&
+		a->read_stages == b->read_stages &&
+		a->visible_stages == b->visible_stages &&
+		a->visible_access == b->visible_access;
+}
+
+/*
+ * Moves @state to the requested access. Returns whether a memory
+ * barrier is required. @src_stages is set to the stages the access
+ * must wait for, 0 if no dependency at all is required.
+ */
+static bool rawTransitionVulkanResourceState(
+	RawVulkanResourceState* state,
+	VkPipelineStageFlags stages,
+	VkAccessFlags access,
+	VkImageLayout layout,
+	VkPipelineStageFlags* src_stages,
+	VkAccessFlags* src_access) {
+
+	bool write = (access & RAW_VULKAN_WRITE_ACCESS_MASK) != 0;
+
+	*src_stages = 0;
+	*src_access = 0;
+
+	if (state->layout != layout) {
+		*src_stages = state->write_stages | state->read_stages;
+		*src_access = state->write_access;
+
+		// Later accesses must be ordered after the transition
+		state->layout = layout;
+		state->write_stages = stages;
+		state->write_access = write ? access : 0;
+		state->read_stages = write ? 0 : stages;
+		state->visible_stages = stages;
+		state->visible_access = access;
+
+		return true;
+	}
+
+	if (write) {
+		// Write after write and write after read hazards
+		*src_stages = state->write_stages | state->read_stages;
+		*src_access = state->write_access;
+
+		state->write_stages = stages;
+		state->write_access = access;
+		state->read_stages = 0;
+		state->visible_stages = 0;
+		state->visible_access = 0;
+
+		return *src_access != 0;
+	}
+
+	// Read after write, unless already made visible
+	if (state->write_stages &&
+		((stages & ~state->visible_stages) ||
+		(access & ~state->visible_access))) {
+		*src_stages = state->write_stages;
+		*src_access = state->write_access;
+
+		state->visible_stages |= stages;
+		state->visible_access |= access;
+	}
+
+	state->read_stages |= stages;
+
+	return *src_access != 0;
+}
+
+/*
+ * Whether the access needs a dependency on a state that already has a
+ * barrier waiting in the current batch
+ */
+static bool rawIsVulkanResourceStateConflicting(
+	RawVulkanResourceStateTracker const* const tracker,
+	RawVulkanResourceState const* const state,
+	VkPipelineStageFlags stages,
+	VkAccessFlags access,
+	VkImageLayout layout) {
+
+	if (state->batch != tracker->batch)
+		return false;
+
+	RawVulkanResourceState next_state = *state;
+	VkPipelineStageFlags src_stages;
+	VkAccessFlags src_access;
+
+	return rawTransitionVulkanResourceState(&next_state,
+		stages, access, layout, &src_stages, &src_access) || src_stages;
+}
+
+bool rawCreateVulkanTrackedImage(
+	VkImage image,
+	VkImageAspectFlags aspect_mask,
+	uint32_t n_mip_levels,
+	uint32_t n_array_layers,
+	VkImageLayout initial_layout,
+	RawVulkanTrackedImage* tracked_image) {
+
+	uint32_t n_subresources = n_mip_levels * n_array_layers;
+
+	if (n_subresources == 0u) {
+		RAW_LOG_ERROR("Tracked image must have at least one subresource!");
+		return false;
+	}
+
+	tracked_image->image = image;
+	tracked_image->aspect_mask = aspect_mask;
+	tracked_image->n_mip_levels = n_mip_levels;
+	tracked_image->n_array_layers = n_array_layers;
+	tracked_image->states = RAW_NULL_PTR;
+
+	RAW_MEM_ALLOC(tracked_image->states, (uint64_t)n_subresources,
+		sizeof(RawVulkanResourceState));
+
+	if (!tracked_image->states) {
+		RAW_LOG_ERROR("RAW_MEM_ALLOC failed on "
+			"rawCreateVulkanTrackedImage!");
+		return false;
+	}
+
+	for (uint32_t i = 0; i < n_subresources; ++i)
+		rawInitializeVulkanResourceState(
+			&tracked_image->states[i], initial_layout);
+
+	return true;
+}
+
+void rawDestroyVulkanTrackedImage(RawVulkanTrackedImage* tracked_image) {
+	if (!tracked_image->states) {
+		RAW_LOG_WARNING("Attempting to destroy NULL tracked image!");
+		return;
+	}
+
+	RAW_MEM_FREE(tracked_image->states);
+}
+
+bool rawCreateVulkanTrackedBuffer(
+	VkBuffer buffer,
+	VkDeviceSize size,
+	RawVulkanTrackedBuffer* tracked_buffer) {
+
+	tracked_buffer->buffer = buffer;
+	tracked_buffer->size = size;
+	tracked_buffer->ranges = RAW_NULL_PTR;
+	tracked_buffer->n_ranges = 0u;
+	tracked_buffer->max_ranges = 0u;
+
+	if (!rawReserveVulkanResourceStateArray(
+		(void**)&tracked_buffer->ranges, &tracked_buffer->max_ranges,
+		0u, 1u, sizeof(RawVulkanTrackedBufferRange)))
+		return false;
+
+	tracked_buffer->ranges[0].offset = 0u;
+	tracked_buffer->ranges[0].size = size;
+	rawInitializeVulkanResourceState(
+		&tracked_buffer->ranges[0].state, VK_IMAGE_LAYOUT_UNDEFINED);
+
+	tracked_buffer->n_ranges = 1u;
+
+	return true;
+}
+
+void rawDestroyVulkanTrackedBuffer(RawVulkanTrackedBuffer* tracked_buffer) {
+	if (!tracked_buffer->ranges) {
+		RAW_LOG_WARNING("Attempting to destroy NULL tracked buffer!");
+		return;
+	}
+
+	RAW_MEM_FREE(tracked_buffer->ranges);
+	tracked_buffer->n_ranges = 0u;
+	tracked_buffer->max_ranges = 0u;
+}
+
+void rawCreateVulkanResourceStateTracker(
+	RawVulkanResourceStateTracker* tracker) {
+
+	memset(tracker, 0, sizeof(RawVulkanResourceStateTracker));
+
+	// States start at batch 0, so they never conflict with a new tracker
+	tracker->batch = 1u;
+}
+
+void rawDestroyVulkanResourceStateTracker(
+	RawVulkanResourceStateTracker* tracker) {
+
+	if (tracker->image_barriers)
+		RAW_MEM_FREE(tracker->image_barriers);
+
+	if (tracker->buffer_barriers)
+		RAW_MEM_FREE(tracker->buffer_barriers);
+
+	memset(tracker, 0, sizeof(RawVulkanResourceStateTracker));
+}
+
+/*
+ * Queues an image barrier, extending the latest one instead when it
+ * covers the neighbouring mip level or array layers with the same
+ * transition
+ */
+static bool rawPushVulkanImageBarrier(
+	RawVulkanResourceStateTracker* tracker,
+	VkImage image,
+	VkImageAspectFlags aspect_mask,
+	uint32_t mip_level,
+	uint32_t array_layer,
+	VkAccessFlags src_access,
+	VkAccessFlags dst_access,
+	VkImageLayout old_layout,
+	VkImageLayout new_layout) {
+
+	if (tracker->n_image_barriers > 0u) {
+		VkImageMemoryBarrier* last =
+			&tracker->image_barriers[tracker->n_image_barriers - 1u];
+		VkImageSubresourceRange* range = &last->subresourceRange;
+
+		if (last->image == image &&
+			range->aspectMask == aspect_mask &&
+			last->srcAccessMask == src_access &&
+			last->dstAccessMask == dst_access &&
+			last->oldLayout == old_layout &&
+			last->newLayout == new_layout &&
+			range->baseArrayLayer == array_layer &&
+			range->layerCount == 1u &&
+			range->baseMipLevel + range->levelCount == mip_level) {
+			++range->levelCount;
+			return true;
+		}
+	}
+
+	if (!rawReserveVulkanResourceStateArray(
+		(void**)&tracker->image_barriers, &tracker->max_image_barriers,
+		tracker->n_image_barriers, tracker->n_image_barriers + 1u,
+		sizeof(VkImageMemoryBarrier)))
+		return false;
+
+	tracker->image_barriers[tracker->n_image_barriers++] =
+		(VkImageMemoryBarrier) {
+			.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+			.pNext = RAW_NULL_PTR,
+			.srcAccessMask = src_access,
+			.dstAccessMask = dst_access,
+			.oldLayout = old_layout,
+			.newLayout = new_layout,
+			.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+			.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+			.image = image,
+			.subresourceRange = {
+				.aspectMask = aspect_mask,
+				.baseMipLevel = mip_level,
+				.levelCount = 1u,
+				.baseArrayLayer = array_layer,
+				.layerCount = 1u
+			}
+		};
+
+	return true;
+}
+
+// Merges the two latest image barriers if they are consecutive layers
+static void rawMergeVulkanImageBarrierLayers(
+	RawVulkanResourceStateTracker* tracker) {
+
+	if (tracker->n_image_barriers < 2u)
+		return;
+
+	VkImageMemoryBarrier* previous =
+		&tracker->image_barriers[tracker->n_image_barriers - 2u];
+	VkImageMemoryBarrier* last =
+		&tracker->image_barriers[tracker->n_image_barriers - 1u];
+
+	VkImageSubresourceRange* previous_range = &previous->subresourceRange;
+	VkImageSubresourceRange* last_range = &last->subresourceRange;
+
+	if (previous->image == last->image &&
+		previous_range->aspectMask == last_range->aspectMask &&
+		previous->srcAccessMask == last->srcAccessMask &&
+		previous->dstAccessMask == last->dstAccessMask &&
+		previous->oldLayout == last->oldLayout &&
+		previous->newLayout == last->newLayout &&
+		previous_range->baseMipLevel == last_range->baseMipLevel &&
+		previous_range->levelCount == last_range->levelCount &&
+		previous_range->baseArrayLayer + previous_range->layerCount ==
+			last_range->baseArrayLayer) {
+		previous_range->layerCount += last_range->layerCount;
+		--tracker->n_image_barriers;
+	}
+}
+
+bool rawRequireVulkanImageState(
+	RawVulkanResourceStateTracker* tracker,
+	VkCommandBuffer command_buffer,
+	RawVulkanTrackedImage* tracked_image,
+	VkImageSubresourceRange const* const subresource_range,
+	VkPipelineStageFlags stages,
+	VkAccessFlags access,
+	VkImageLayout layout) {
+
+	uint32_t base_mip_level = subresource_range->baseMipLevel;
+	uint32_t n_mip_levels =
+		subresource_range->levelCount == VK_REMAINING_MIP_LEVELS ?
+		tracked_image->n_mip_levels - base_mip_level :
+		subresource_range->levelCount;
+
+	uint32_t base_array_layer = subresource_range->baseArrayLayer;
+	uint32_t n_array_layers =
+		subresource_range->layerCount == VK_REMAINING_ARRAY_LAYERS ?
+		tracked_image->n_array_layers - base_array_layer :
+		subresource_range->layerCount;
+
+	if (base_mip_level + n_mip_levels > tracked_image->n_mip_levels ||
+		base_array_layer + n_array_layers > tracked_image->n_array_layers) {
+		RAW_LOG_ERROR("Subresource range out of the tracked image bounds!");
+		return false;
+	}
+
+	++tracker->n_requests;
+
+	// Barriers of a single call are unordered, so conflicts go first
+	bool conflict = false;
+
+	for (uint32_t i = 0; i < n_array_layers && !conflict; ++i)
+		for (uint32_t j = 0; j < n_mip_levels && !conflict; ++j)
+			conflict = rawIsVulkanResourceStateConflicting(tracker,
+				&tracked_image->states[(base_array_layer + i) *
+				tracked_image->n_mip_levels + base_mip_level + j],
+				stages, access, layout);
+
+	if (conflict)
+		rawCmdFlushVulkanBarriers(tracker, command_buffer);
+
+	bool redundant = true;
+
+	for (uint32_t i = 0; i < n_array_layers; ++i) {
+		uint32_t array_layer = base_array_layer + i;
+
+		for (uint32_t j = 0; j < n_mip_levels; ++j) {
+			uint32_t mip_level = base_mip_level + j;
+
+			RawVulkanResourceState* state = &tracked_image->states[
+				array_layer * tracked_image->n_mip_levels + mip_level];
+
+			VkImageLayout old_layout = state->layout;
+			VkPipelineStageFlags src_stages;
+			VkAccessFlags src_access;
+
+			bool barrier = rawTransitionVulkanResourceState(state,
+				stages, access, layout, &src_stages, &src_access);
+
+			if (!barrier && !src_stages)
+				continue;
+
+			redundant = false;
+
+			tracker->src_stages |= src_stages;
+			tracker->dst_stages |= stages;
+			state->batch = tracker->batch;
+
+			if (barrier && !rawPushVulkanImageBarrier(tracker,
+				tracked_image->image, subresource_range->aspectMask,
+				mip_level, array_layer, src_access, access,
+				old_layout, layout))
+				return false;
+		}
+
+		rawMergeVulkanImageBarrierLayers(tracker);
+	}
+
+	if (redundant)
+		++tracker->n_redundant_requests;
+
+	return true;
+}
+
+// Splits the range containing @at so that a range starts at @at
+static bool rawSplitVulkanTrackedBuffer(
+	RawVulkanTrackedBuffer* tracked_buffer,
+	VkDeviceSize at) {
+
+	for (uint32_t i = 0; i < tracked_buffer->n_ranges; ++i) {
+		RawVulkanTrackedBufferRange* range = &tracked_buffer->ranges[i];
+
+		if (at <= range->offset || at >= range->offset + range->size)
+			continue;
+
+		if (!rawReserveVulkanResourceStateArray(
+			(void**)&tracked_buffer->ranges, &tracked_buffer->max_ranges,
+			tracked_buffer->n_ranges, tracked_buffer->n_ranges + 1u,
+			sizeof(RawVulkanTrackedBufferRange)))
+			return false;
+
+		range = &tracked_buffer->ranges[i];
+
+		memmove(&tracked_buffer->ranges[i + 2u],
+			&tracked_buffer->ranges[i + 1u],
+			(tracked_buffer->n_ranges - i - 1u) *
+			sizeof(RawVulkanTrackedBufferRange));
+
+		RawVulkanTrackedBufferRange* new_range =
+			&tracked_buffer->ranges[i + 1u];
+
+		new_range->offset = at;
+		new_range->size = range->offset + range->size - at;
+		new_range->state = range->state;
+
+		range->size = at - range->offset;
+
+		++tracked_buffer->n_ranges;
+
+		return true;
+	}
+
+	return true;
+}
+
+// Joins neighbouring ranges left in the same state
+static void rawMergeVulkanTrackedBufferRanges(
+	RawVulkanTrackedBuffer* tracked_buffer) {
+
+	uint32_t n_ranges = 1u;
+
+	for (uint32_t i = 1; i < tracked_buffer->n_ranges; ++i) {
+		RawVulkanTrackedBufferRange* last =
+			&tracked_buffer->ranges[n_ranges - 1u];
+		RawVulkanTrackedBufferRange* range = &tracked_buffer->ranges[i];
+
+		if (rawIsVulkanResourceStateEqual(&last->state, &range->state)) {
+			last->size += range->size;
+
+			if (range->state.batch > last->state.batch)
+				last->state.batch = range->state.batch;
+		}
+		else
+			tracked_buffer->ranges[n_ranges++] = *range;
+	}
+
+	tracked_buffer->n_ranges = n_ranges;
+}
+
+static bool rawPushVulkanBufferBarrier(
+	RawVulkanResourceStateTracker* tracker,
+	VkBuffer buffer,
+	VkDeviceSize offset,
+	VkDeviceSize size,
+	VkAccessFlags src_access,
+	VkAccessFlags dst_access) {
+
+	if (tracker->n_buffer_barriers > 0u) {
+		VkBufferMemoryBarrier* last =
+			&tracker->buffer_barriers[tracker->n_buffer_barriers - 1u];
+
+		if (last->buffer == buffer &&
+			last->srcAccessMask == src_access &&
+			last->dstAccessMask == dst_access &&
+			last->offset + last->size == offset) {
+			last->size += size;
+			return true;
+		}
+	}
+
+	if (!rawReserveVulkanResourceStateArray(
+		(void**)&tracker->buffer_barriers, &tracker->max_buffer_barriers,
+		tracker->n_buffer_barriers, tracker->n_buffer_barriers + 1u,
+		sizeof(VkBufferMemoryBarrier)))
+		return false;
+
+	tracker->buffer_barriers[tracker->n_buffer_barriers++] =
+		(VkBufferMemoryBarrier) {
+			.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+			.pNext = RAW_NULL_PTR,
+			.srcAccessMask = src_access,
+			.dstAccessMask = dst_access,
+			.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+			.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+			.buffer = buffer,
+			.offset = offset,
+			.size = size
+		};
+
+	return true;
+}
+
+bool rawRequireVulkanBufferState(
+	RawVulkanResourceStateTracker* tracker,
+	VkCommandBuffer command_buffer,
+	RawVulkanTrackedBuffer* tracked_buffer,
+	VkDeviceSize offset,
+	VkDeviceSize size,
+	VkPipelineStageFlags stages,
+	VkAccessFlags access) {
+
+	if (size == VK_WHOLE_SIZE)
+		size = tracked_buffer->size - offset;
+
+	if (size == 0u || offset + size > tracked_buffer->size) {
+		RAW_LOG_ERROR("Range out of the tracked buffer bounds!");
+		return false;
+	}
+
+	VkDeviceSize end = offset + size;
+
+	if (!rawSplitVulkanTrackedBuffer(tracked_buffer, offset) ||
+		!rawSplitVulkanTrackedBuffer(tracked_buffer, end))
+		return false;
+
+	++tracker->n_requests;
+
+	// Barriers of a single call are unordered, so conflicts go first
+	for (uint32_t i = 0; i < tracked_buffer->n_ranges; ++i) {
+		RawVulkanTrackedBufferRange* range = &tracked_buffer->ranges[i];
+
+		if (range->offset >= offset && range->offset < end &&
+			rawIsVulkanResourceStateConflicting(tracker, &range->state,
+			stages, access, VK_IMAGE_LAYOUT_UNDEFINED)) {
+			rawCmdFlushVulkanBarriers(tracker, command_buffer);
+			break;
+		}
+	}
+
+	bool redundant = true;
+
+	for (uint32_t i = 0; i < tracked_buffer->n_ranges; ++i) {
+		RawVulkanTrackedBufferRange* range = &tracked_buffer->ranges[i];
+
+		if (range->offset < offset || range->offset >= end)
+			continue;
+
+		VkPipelineStageFlags src_stages;
+		VkAccessFlags src_access;
+
+		bool barrier = rawTransitionVulkanResourceState(&range->state,
+			stages, access, VK_IMAGE_LAYOUT_UNDEFINED,
+			&src_stages, &src_access);
+
+		if (!barrier && !src_stages)
+			continue;
+
+		redundant = false;
+
+		tracker->src_stages |= src_stages;
+		tracker->dst_stages |= stages;
+		range->state.batch = tracker->batch;
+
+		if (barrier && !rawPushVulkanBufferBarrier(tracker,
+			tracked_buffer->buffer, range->offset, range->size,
+			src_access, access))
+			return false;
+	}
+
+	rawMergeVulkanTrackedBufferRanges(tracked_buffer);
+
+	if (redundant)
+		++tracker->n_redundant_requests;
+
+	return true;
+}
+
+void rawCmdFlushVulkanBarriers(
+	RawVulkanResourceStateTracker* tracker,
+	VkCommandBuffer command_buffer) {
+
+	if (!tracker->src_stages && !tracker->n_image_barriers &&
+		!tracker->n_buffer_barriers)
+		return;
+
+	vkCmdPipelineBarrier(command_buffer,
+		tracker->src_stages ?
+			tracker->src_stages : VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+		tracker->dst_stages ?
+			tracker->dst_stages : VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+		0, 0u, RAW_NULL_PTR,
+		tracker->n_buffer_barriers, tracker->buffer_barriers,
+		tracker->n_image_barriers, tracker->image_barriers);
+
+	tracker->src_stages = 0;
+	tracker->dst_stages = 0;
+	tracker->n_image_barriers = 0u;
+	tracker->n_buffer_barriers = 0u;
+
+	++tracker->batch;
+	++tracker->n_flushes;
+}
@@ -0,0 +1,185 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanResourceState.h"
+ *
+ * Resource state tracking and barrier batching
+ *
+ * Remembers the layout, stages and accesses of every image subresource
+ * and buffer range, so only the transitions that are really needed get
+ * recorded. Barriers requested between two commands are merged into a
+ * single vkCmdPipelineBarrier, flushed right before the next draw,
+ * dispatch or copy.
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+
+#ifndef RAW_VULKAN_RESOURCE_STATE_H
+#define RAW_VULKAN_RESOURCE_STATE_H
+
+#include <engine/vulkan/rawVulkan.h>
+
+#include <inttypes.h>
+#include <stdbool.h>
+
+#define RAW_VULKAN_WRITE_ACCESS_MASK             \
+	(VK_ACCESS_SHADER_WRITE_BIT |                \
+	VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT |       \
+	VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT | \
+	VK_ACCESS_TRANSFER_WRITE_BIT |               \
+	VK_ACCESS_HOST_WRITE_BIT |                   \
+	VK_ACCESS_MEMORY_WRITE_BIT)
+
+typedef struct {
+	VkImageLayout layout;
+
+	// Last write, and reads since then
+	VkPipelineStageFlags write_stages;
+	VkAccessFlags write_access;
+	VkPipelineStageFlags read_stages;
+
+	// Stages and accesses the last write was already made visible to
+	VkPipelineStageFlags visible_stages;
+	VkAccessFlags visible_access;
+
+	// Batch of the latest barrier involving this state
+	uint32_t batch;
+} RawVulkanResourceState;
+
+typedef struct {
+	VkImage image;
+	VkImageAspectFlags aspect_mask;
+	uint32_t n_mip_levels;
+	uint32_t n_array_layers;
+
+	// One state per subresource, array layer major
+	RawVulkanResourceState* states;
+} RawVulkanTrackedImage;
+
+typedef struct {
+	VkDeviceSize offset;
+	VkDeviceSize size;
+	RawVulkanResourceState state;
+} RawVulkanTrackedBufferRange;
+
+typedef struct {
+	VkBuffer buffer;
+	VkDeviceSize size;
+
+	// Sorted, disjoint ranges covering the whole buffer
+	RawVulkanTrackedBufferRange* ranges;
+	uint32_t n_ranges;
+	uint32_t max_ranges;
+} RawVulkanTrackedBuffer;
+
+typedef struct {
+	// Barriers waiting for the next flush
+	VkPipelineStageFlags src_stages;
+	VkPipelineStageFlags dst_stages;
+
+	VkImageMemoryBarrier* image_barriers;
+	uint32_t n_image_barriers;
+	uint32_t max_image_barriers;
+
+	VkBufferMemoryBarrier* buffer_barriers;
+	uint32_t n_buffer_barriers;
+	uint32_t max_buffer_barriers;
+
+	uint32_t batch;
+
+	// Statistics
+	uint32_t n_requests;
+	uint32_t n_redundant_requests;
+	uint32_t n_flushes;
+} RawVulkanResourceStateTracker;
+
+/*
+ * The image starts in @initial_layout with no pending accesses, so the
+ * caller must guarantee previous work on it is complete.
+ */
+bool rawCreateVulkanTrackedImage(
+	VkImage image,
+	VkImageAspectFlags aspect_mask,
+	uint32_t n_mip_levels,
+	uint32_t n_array_layers,
+	VkImageLayout initial_layout,
+	RawVulkanTrackedImage* tracked_image);
+
+void rawDestroyVulkanTrackedImage(RawVulkanTrackedImage* tracked_image);
+
+bool rawCreateVulkanTrackedBuffer(
+	VkBuffer buffer,
+	VkDeviceSize size,
+	RawVulkanTrackedBuffer* tracked_buffer);
+
+void rawDestroyVulkanTrackedBuffer(RawVulkanTrackedBuffer* tracked_buffer);
+
+void rawCreateVulkanResourceStateTracker(
+	RawVulkanResourceStateTracker* tracker);
+
+void rawDestroyVulkanResourceStateTracker(
+	RawVulkanResourceStateTracker* tracker);
+
+/*
+ * Declares that the next command accesses @subresource_range of the
+ * image with @stages and @access, in @layout. Required barriers are
+ * queued, redundant ones dropped. If a subresource already has a queued
+ * barrier, the pending batch is flushed into @command_buffer first, as
+ * barriers of the same vkCmdPipelineBarrier call are unordered.
+ */
+bool rawRequireVulkanImageState(
+	RawVulkanResourceStateTracker* tracker,
+	VkCommandBuffer command_buffer,
+	RawVulkanTrackedImage* tracked_image,
+	VkImageSubresourceRange const* const subresource_range,
+	VkPipelineStageFlags stages,
+	VkAccessFlags access,
+	VkImageLayout layout);
+
+/*
+ * Same as rawRequireVulkanImageState, for @size bytes of the buffer
+ * starting at @offset. @size may be VK_WHOLE_SIZE.
+ */
+bool rawRequireVulkanBufferState(
+	RawVulkanResourceStateTracker* tracker,
+	VkCommandBuffer command_buffer,
+	RawVulkanTrackedBuffer* tracked_buffer,
+	VkDeviceSize offset,
+	VkDeviceSize size,
+	VkPipelineStageFlags stages,
+	VkAccessFlags access);
+
+/*
+ * Records every queued barrier with a single vkCmdPipelineBarrier.
+ * Must be called before the draw, dispatch or copy the states were
+ * required for. Does nothing if no barrier is queued.
+ */
+void rawCmdFlushVulkanBarriers(
+	RawVulkanResourceStateTracker* tracker,
+	VkCommandBuffer command_buffer);
+
+#endif // RAW_VULKAN_RESOURCE_STATE_H
@@ -0,0 +1,435 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanSamplerCache.c"
+ *
+ * Shared sampler cache
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+
+#include <engine/vulkan/rawVulkanSamplerCache.h>
+#include <engine/platform/rawMemory.h>
+#include <engine/utils/rawHash.h>
+#include <engine/utils/rawLogger.h>
+
+#include <stddef.h>
+#include <string.h>
+
+/*
+ * Everything after the sType and pNext header, without trailing padding.
+ * Every field in that range is 32 bits wide, so there are no padding
+ * bytes inside it.
+ */
+#define RAW_VULKAN_SAMPLER_KEY_OFFSET \
+	offsetof(VkSamplerCreateInfo, flags)
+#define RAW_VULKAN_SAMPLER_KEY_SIZE                           \
+	(offsetof(VkSamplerCreateInfo, unnormalizedCoordinates) + \
+	sizeof(VkBool32) - RAW_VULKAN_SAMPLER_KEY_OFFSET)
+
+#define RAW_VULKAN_SAMPLER_CACHE_NONE UINT32_MAX
+
+bool rawCreateVulkanSamplerCache(
+	uint32_t max_samplers,
+	RawVulkanSamplerEvictionFunction eviction_function,
+	void* user_data,
+	RawVulkanSamplerCache* sampler_cache) {
+
+	memset(sampler_cache, 0, sizeof(RawVulkanSamplerCache));
+
+	sampler_cache->lru_head = RAW_VULKAN_SAMPLER_CACHE_NONE;
+	sampler_cache->lru_tail = RAW_VULKAN_SAMPLER_CACHE_NONE;
+	sampler_cache->free_head = RAW_VULKAN_SAMPLER_CACHE_NONE;
+
+	if (max_samplers == 0u) {
+		RAW_LOG_ERROR("Sampler cache must hold at least one sampler!");
+		return false;
+	}
+
+	uint32_t capacity = 1u;
+
+	while (capacity * 3u < max_samplers * 4u)
+		capacity <<= 1u;
+
+	RAW_MEM_ALLOC(sampler_cache->entries, (uint64_t)max_samplers,
+		sizeof(RawVulkanSamplerEntry));
+	RAW_MEM_ALLOC(sampler_cache->slots,
+		(uint64_t)capacity, sizeof(uint32_t));
+	RAW_MEM_ALLOC(sampler_cache->sampler_slots,
+		(uint64_t)capacity, sizeof(uint32_t));
+
+	if (!sampler_cache->entries || !sampler_cache->slots ||
+		!sampler_cache->sampler_slots) {
+		RAW_LOG_ERROR("RAW_MEM_ALLOC failed on rawCreateVulkanSamplerCache!");
+
+		if (sampler_cache->entries)
+			RAW_MEM_FREE(sampler_cache->entries);
+
+		if (sampler_cache->slots)
+			RAW_MEM_FREE(sampler_cache->slots);
+
+		if (sampler_cache->sampler_slots)
+			RAW_MEM_FREE(sampler_cache->sampler_slots);
+
+		memset(sampler_cache, 0, sizeof(RawVulkanSamplerCache));
+		return false;
+	}
+
+	memset(sampler_cache->entries, 0,
+		max_samplers * sizeof(RawVulkanSamplerEntry));
+
+	for (uint32_t i = 0; i < max_samplers; ++i) {
+		sampler_cache->entries[i].previous = RAW_VULKAN_SAMPLER_CACHE_NONE;
+		sampler_cache->entries[i].next = i + 1u < max_samplers ?
+			i + 1u : RAW_VULKAN_SAMPLER_CACHE_NONE;
+	}
+
+	memset(sampler_cache->slots, 0xff, capacity * sizeof(uint32_t));
+	memset(sampler_cache->sampler_slots, 0xff, capacity * sizeof(uint32_t));
+
+	sampler_cache->max_samplers = max_samplers;
+	sampler_cache->capacity = capacity;
+	sampler_cache->free_head = 0u;
+	sampler_cache->eviction_function = eviction_function;
+	sampler_cache->eviction_user_data = user_data;
+
+	return true;
+}
+
+void rawDestroyVulkanSamplerCache(
+	VkDevice logical_device,
+	RawVulkanSamplerCache* sampler_cache) {
+
+	if (!sampler_cache->entries) {
+		RAW_LOG_WARNING("Attempting to destroy NULL Vulkan sampler cache!");
+		return;
+	}
+
+	for (uint32_t i = 0; i < sampler_cache->max_samplers; ++i)
+		if (sampler_cache->entries[i].sampler != VK_NULL_HANDLE)
+			// TODO: Pass allocation callback
+			vkDestroySampler(logical_device,
+				sampler_cache->entries[i].sampler, RAW_NULL_PTR);
+
+	RAW_MEM_FREE(sampler_cache->sampler_slots);
+	RAW_MEM_FREE(sampler_cache->slots);
+	RAW_MEM_FREE(sampler_cache->entries);
+
+	memset(sampler_cache, 0, sizeof(RawVulkanSamplerCache));
+}
+
+void rawBeginVulkanSamplerCacheFrame(
+	RawVulkanSamplerCache* sampler_cache,
+	uint64_t frame_number,
+	uint64_t oldest_pending_frame_number) {
+
+	sampler_cache->frame_number = frame_number;
+	sampler_cache->oldest_pending_frame_number = oldest_pending_frame_number;
+}
+
+static uint64_t rawHashVulkanSamplerHandle(VkSampler sampler) {
+	return rawHashBytes(RAW_HASH_FNV1A_OFFSET_BASIS,
+		&sampler, sizeof(VkSampler));
+}
+
+// Home slot of @index in @slots, either table
+static uint32_t rawGetVulkanSamplerHomeSlot(
+	RawVulkanSamplerCache const* const sampler_cache,
+	uint32_t const* const slots,
+	uint32_t index) {
+
+	RawVulkanSamplerEntry const* entry = &sampler_cache->entries[index];
+
+	uint64_t hash = slots == sampler_cache->slots ?
+		entry->hash : rawHashVulkanSamplerHandle(entry->sampler);
+
+	return (uint32_t)hash & (sampler_cache->capacity - 1u);
+}
+
+static void rawInsertVulkanSamplerSlot(
+	RawVulkanSamplerCache* sampler_cache,
+	uint32_t* slots,
+	uint32_t index) {
+
+	uint32_t mask = sampler_cache->capacity - 1u;
+	uint32_t slot = rawGetVulkanSamplerHomeSlot(sampler_cache, slots, index);
+
+	while (slots[slot] != RAW_VULKAN_SAMPLER_CACHE_NONE)
+		slot = (slot + 1u) & mask;
+
+	slots[slot] = index;
+}
+
+/*
+ * Takes @index out of @slots.
+ * Linear probing with backward shift deletion, so no tombstones are left.
+ */
+static void rawRemoveVulkanSamplerSlot(
+	RawVulkanSamplerCache* sampler_cache,
+	uint32_t* slots,
+	uint32_t index) {
+
+	uint32_t mask = sampler_cache->capacity - 1u;
+	uint32_t slot = rawGetVulkanSamplerHomeSlot(sampler_cache, slots, index);
+
+	while (slots[slot] != index)
+		slot = (slot + 1u) & mask;
+
+	uint32_t next_slot = slot;
+
+	for (;;) {
+		next_slot = (next_slot + 1u) & mask;
+
+		uint32_t moved = slots[next_slot];
+
+		if (moved == RAW_VULKAN_SAMPLER_CACHE_NONE)
+			break;
+
+		uint32_t home =
+			rawGetVulkanSamplerHomeSlot(sampler_cache, slots, moved);
+
+		// Moves back entries whose probe sequence crosses the hole
+		if (((next_slot - home) & mask) >= ((next_slot - slot) & mask)) {
+			slots[slot] = moved;
+			slot = next_slot;
+		}
+	}
+
+	slots[slot] = RAW_VULKAN_SAMPLER_CACHE_NONE;
+}
+
+static void rawUnlinkVulkanSamplerCacheEntry(
+	RawVulkanSamplerCache* sampler_cache,
+	uint32_t index) {
+
+	RawVulkanSamplerEntry* entry = &sampler_cache->entries[index];
+
+	if (entry->previous != RAW_VULKAN_SAMPLER_CACHE_NONE)
+		sampler_cache->entries[entry->previous].next = entry->next;
+	else
+		sampler_cache->lru_head = entry->next;
+
+	if (entry->next != RAW_VULKAN_SAMPLER_CACHE_NONE)
+		sampler_cache->entries[entry->next].previous = entry->previous;
+	else
+		sampler_cache->lru_tail = entry->previous;
+
+	entry->previous = RAW_VULKAN_SAMPLER_CACHE_NONE;
+	entry->next = RAW_VULKAN_SAMPLER_CACHE_NONE;
+}
+
+// Makes @index the most recently released entry
+static void rawLinkVulkanSamplerCacheEntry(
+	RawVulkanSamplerCache* sampler_cache,
+	uint32_t index) {
+
+	RawVulkanSamplerEntry* entry = &sampler_cache->entries[index];
+
+	entry->previous = sampler_cache->lru_tail;
+	entry->next = RAW_VULKAN_SAMPLER_CACHE_NONE;
+
+	if (sampler_cache->lru_tail != RAW_VULKAN_SAMPLER_CACHE_NONE)
+		sampler_cache->entries[sampler_cache->lru_tail].next = index;
+	else
+		sampler_cache->lru_head = index;
+
+	sampler_cache->lru_tail = index;
+}
+
+/*
+ * Destroys the least recently released sampler,
+ * if the GPU is done with it, and frees its entry.
+ */
+static bool rawEvictVulkanSampler(
+	VkDevice logical_device,
+	RawVulkanSamplerCache* sampler_cache) {
+
+	uint32_t index = sampler_cache->lru_head;
+
+	if (index == RAW_VULKAN_SAMPLER_CACHE_NONE ||
+		sampler_cache->entries[index].frame_number >=
+		sampler_cache->oldest_pending_frame_number)
+		return false;
+
+	RawVulkanSamplerEntry* entry = &sampler_cache->entries[index];
+
+	rawRemoveVulkanSamplerSlot(sampler_cache, sampler_cache->slots, index);
+	rawRemoveVulkanSamplerSlot(
+		sampler_cache, sampler_cache->sampler_slots, index);
+	rawUnlinkVulkanSamplerCacheEntry(sampler_cache, index);
+
+	// Descriptors over the handle must go before it can be reused
+	if (sampler_cache->eviction_function)
+		sampler_cache->eviction_function(
+			entry->sampler, sampler_cache->eviction_user_data);
+
+	// TODO: Pass allocation callback
+	vkDestroySampler(logical_device, entry->sampler, RAW_NULL_PTR);
+
+	entry->sampler = VK_NULL_HANDLE;
+	entry->next = sampler_cache->free_head;
+	sampler_cache->free_head = index;
+
+	--sampler_cache->n_samplers;
+
+	return true;
+}
+
+static bool rawUsesVulkanSamplerBorderColor(
+	VkSamplerCreateInfo const* const create_info) {
+
+	return
+		create_info->addressModeU == VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_BORDER ||
+		create_info->addressModeV == VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_BORDER ||
+		create_info->addressModeW == VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_BORDER;
+}
+
+bool rawAcquireVulkanSampler(
+	VkDevice logical_device,
+	RawVulkanSamplerCache* sampler_cache,
+	VkSamplerCreateInfo const* const create_info,
+	VkSampler* sampler) {
+
+	if (create_info->pNext) {
+		RAW_LOG_ERROR("Cached samplers can't have chained structures!");
+		return false;
+	}
+
+	VkSamplerCreateInfo key = *create_info;
+
+	// Ignored state is cleared, so it doesn't split otherwise equal samplers
+	if (!key.anisotropyEnable)
+		key.maxAnisotropy = 1.0f;
+
+	if (!key.compareEnable)
+		key.compareOp = VK_COMPARE_OP_NEVER;
+
+	if (!rawUsesVulkanSamplerBorderColor(&key))
+		key.borderColor = VK_BORDER_COLOR_FLOAT_TRANSPARENT_BLACK;
+
+	uint8_t const* key_data =
+		(uint8_t const*)&key + RAW_VULKAN_SAMPLER_KEY_OFFSET;
+
+	uint64_t hash = rawHashBytes(RAW_HASH_FNV1A_OFFSET_BASIS,
+		key_data, RAW_VULKAN_SAMPLER_KEY_SIZE);
+
+	uint32_t mask = sampler_cache->capacity - 1u;
+	uint32_t slot = (uint32_t)hash & mask;
+
+	while (sampler_cache->slots[slot] != RAW_VULKAN_SAMPLER_CACHE_NONE) {
+		uint32_t index = sampler_cache->slots[slot];
+		RawVulkanSamplerEntry* entry = &sampler_cache->entries[index];
+
+		if (entry->hash == hash && memcmp(
+			(uint8_t const*)&entry->create_info +
+				RAW_VULKAN_SAMPLER_KEY_OFFSET,
+			key_data, RAW_VULKAN_SAMPLER_KEY_SIZE) == 0) {
+			if (entry->n_references++ == 0u)
+				rawUnlinkVulkanSamplerCacheEntry(sampler_cache, index);
+
+			*sampler = entry->sampler;
+			return true;
+		}
+
+		slot = (slot + 1u) & mask;
+	}
+
+	// Room is made first, so the cache never exceeds max_samplers
+	if (sampler_cache->n_samplers == sampler_cache->max_samplers &&
+		!rawEvictVulkanSampler(logical_device, sampler_cache)) {
+		RAW_LOG_ERROR("Sampler cache is full of samplers in use!");
+		return false;
+	}
+
+	VkSampler new_sampler;
+
+	// TODO: Pass allocation callback
+	VkResult result = vkCreateSampler(logical_device,
+		&key, RAW_NULL_PTR, &new_sampler);
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("vkCreateSampler failed!");
+		return false;
+	}
+
+	uint32_t index = sampler_cache->free_head;
+	RawVulkanSamplerEntry* entry = &sampler_cache->entries[index];
+
+	sampler_cache->free_head = entry->next;
+
+	entry->hash = hash;
+	entry->create_info = key;
+	entry->sampler = new_sampler;
+	entry->n_references = 1u;
+	entry->frame_number = sampler_cache->frame_number;
+	entry->previous = RAW_VULKAN_SAMPLER_CACHE_NONE;
+	entry->next = RAW_VULKAN_SAMPLER_CACHE_NONE;
+
+	rawInsertVulkanSamplerSlot(sampler_cache, sampler_cache->slots, index);
+	rawInsertVulkanSamplerSlot(
+		sampler_cache, sampler_cache->sampler_slots, index);
+
+	++sampler_cache->n_samplers;
+
+	*sampler = new_sampler;
+
+	return true;
+}
+
+bool rawReleaseVulkanSampler(
+	RawVulkanSamplerCache* sampler_cache,
+	VkSampler sampler) {
+
+	uint32_t mask = sampler_cache->capacity - 1u;
+	uint32_t slot = (uint32_t)rawHashVulkanSamplerHandle(sampler) & mask;
+
+	while (sampler_cache->sampler_slots[slot] !=
+		RAW_VULKAN_SAMPLER_CACHE_NONE) {
+		uint32_t index = sampler_cache->sampler_slots[slot];
+		RawVulkanSamplerEntry* entry = &sampler_cache->entries[index];
+
+		if (entry->sampler == sampler) {
+			if (entry->n_references == 0u) {
+				RAW_LOG_ERROR("Releasing an unreferenced sampler!");
+				return false;
+			}
+
+			// Frames up to this one may still sample with it
+			if (--entry->n_references == 0u) {
+				entry->frame_number = sampler_cache->frame_number;
+				rawLinkVulkanSamplerCacheEntry(sampler_cache, index);
+			}
+
+			return true;
+		}
+
+		slot = (slot + 1u) & mask;
+	}
+
+	RAW_LOG_ERROR("Releasing a sampler not in the cache!");
+	return false;
+}
@@ -0,0 +1,173 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanSamplerCache.h"
+ *
+ * Shared sampler cache
+ *
+ * Samplers are keyed by their whole VkSamplerCreateInfo and shared by
+ * reference count, so identical filtering declared by many materials maps
+ * to a single VkSampler. Devices cap the number of live samplers through
+ * maxSamplerAllocationCount, often at 4000.
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+
+#ifndef RAW_VULKAN_SAMPLER_CACHE_H
+#define RAW_VULKAN_SAMPLER_CACHE_H
+
+#include <engine/vulkan/rawVulkan.h>
+
+#include <inttypes.h>
+#include <stdbool.h>
+
+/*
+ * Called with each sampler the cache is about to destroy to make room,
+ * see rawAcquireVulkanSampler
+ */
+typedef void (*RawVulkanSamplerEvictionFunction)(
+	VkSampler sampler,
+	void* user_data);
+
+typedef struct {
+	uint64_t hash;
+
+	// Normalized, with the fields ignored by Vulkan cleared
+	VkSamplerCreateInfo create_info;
+
+	// VK_NULL_HANDLE marks an unused entry
+	VkSampler sampler;
+
+	/*
+	 * Unreferenced samplers are kept alive for later requests, and
+	 * only destroyed when their entry is needed for a new sampler
+	 */
+	uint32_t n_references;
+
+	// Frame in which the last reference was released
+	uint64_t frame_number;
+
+	/*
+	 * Least recently released list of unreferenced samplers. Unused
+	 * entries are chained through @next. UINT32_MAX ends both lists.
+	 */
+	uint32_t previous;
+	uint32_t next;
+} RawVulkanSamplerEntry;
+
+typedef struct {
+	RawVulkanSamplerEntry* entries;
+	uint32_t n_samplers;
+	uint32_t max_samplers;
+
+	/*
+	 * Open addressing tables of entry indices, by create info and by
+	 * sampler handle. UINT32_MAX marks an empty slot. The capacity is a
+	 * power of two, at least 4/3 of @max_samplers.
+	 */
+	uint32_t* slots;
+	uint32_t* sampler_slots;
+	uint32_t capacity;
+
+	// Least and most recently released unreferenced entries
+	uint32_t lru_head;
+	uint32_t lru_tail;
+	uint32_t free_head;
+
+	RawVulkanSamplerEvictionFunction eviction_function;
+	void* eviction_user_data;
+
+	// Frame being recorded and the oldest one the GPU may still be using
+	uint64_t frame_number;
+	uint64_t oldest_pending_frame_number;
+} RawVulkanSamplerCache;
+
+/*
+ * @max_samplers should leave room under the device's
+ * maxSamplerAllocationCount for samplers created elsewhere.
+ * @eviction_function, if not NULL, is called with @user_data.
+ */
+bool rawCreateVulkanSamplerCache(
+	uint32_t max_samplers,
+	RawVulkanSamplerEvictionFunction eviction_function,
+	void* user_data,
+	RawVulkanSamplerCache* sampler_cache);
+
+/*
+ * Destroys every sampler in the cache, referenced or not, without
+ * calling the eviction function. It's the caller's responsibility to
+ * guarantee the GPU is done with them.
+ */
+void rawDestroyVulkanSamplerCache(
+	VkDevice logical_device,
+	RawVulkanSamplerCache* sampler_cache);
+
+/*
+ * Starts tagging releases with @frame_number. Samplers released before
+ * @oldest_pending_frame_number are no longer used by the GPU and may be
+ * destroyed to make room for new ones.
+ *
+ * With a RawVulkanFrameManager of n frames, after rawBeginVulkanFrame
+ * this is its frame_number and frame_number - n + 1 (or 0).
+ */
+void rawBeginVulkanSamplerCacheFrame(
+	RawVulkanSamplerCache* sampler_cache,
+	uint64_t frame_number,
+	uint64_t oldest_pending_frame_number);
+
+/*
+ * A sampler for @create_info, shared with every other request of the
+ * same state, created on a miss. Chained structures (pNext) aren't
+ * supported. Each successful call must be paired with a call to
+ * rawReleaseVulkanSampler.
+ *
+ * When the cache is full, the least recently released sampler the GPU
+ * is done with is destroyed first, so the cache never holds more than
+ * @max_samplers. Fails if there's none.
+ *
+ * A new sampler may get the destroyed one's handle. So the eviction
+ * function is called right before the destruction, and must drop every
+ * use of the handle: rawEvictVulkanDescriptorSetsUsingSampler on each
+ * descriptor set cache, and rawReleaseVulkanBindlessIndex on any
+ * bindless slot it was registered into.
+ */
+bool rawAcquireVulkanSampler(
+	VkDevice logical_device,
+	RawVulkanSamplerCache* sampler_cache,
+	VkSamplerCreateInfo const* const create_info,
+	VkSampler* sampler);
+
+/*
+ * Drops a reference to @sampler. It may still be used by the frames in
+ * flight, it's only destroyed once they complete. Until then it stays
+ * cached, so descriptors using it may be kept for later requests.
+ */
+bool rawReleaseVulkanSampler(
+	RawVulkanSamplerCache* sampler_cache,
+	VkSampler sampler);
+
+#endif // RAW_VULKAN_SAMPLER_CACHE_H
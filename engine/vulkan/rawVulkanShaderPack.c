@@ -0,0 +1,358 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanShaderPack.c"
+ *
+ * Memory-mapped shader packs
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+
+#include <engine/vulkan/rawVulkanShaderPack.h>
+#include <engine/platform/rawMemory.h>
+#include <engine/utils/rawHash.h>
+#include <engine/utils/rawLogger.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+uint64_t rawHashSpirv(uint32_t const* code, uint64_t size) {
+	return rawHashBytes(RAW_HASH_FNV1A_OFFSET_BASIS, code, size);
+}
+
+static bool rawValidateVulkanShaderPack(
+	RawFileMapping const* const mapping) {
+
+	uint64_t size = mapping->size;
+
+	if (size < sizeof(RawVulkanShaderPackHeader))
+		return false;
+
+	RawVulkanShaderPackHeader const* header = mapping->data;
+
+	if (header->magic == RAW_VULKAN_SHADER_PACK_SWAPPED_MAGIC) {
+		RAW_LOG_ERROR("Shader pack was written with a different "
+			"byte order!");
+		return false;
+	}
+
+	if (header->magic != RAW_VULKAN_SHADER_PACK_MAGIC ||
+		header->version != RAW_VULKAN_SHADER_PACK_VERSION)
+		return false;
+
+	uint64_t index_end = sizeof(RawVulkanShaderPackHeader) +
+		(uint64_t)header->n_shaders * sizeof(RawVulkanShaderPackEntry);
+
+	if (index_end > size)
+		return false;
+
+	RawVulkanShaderPackEntry const* entries =
+		(RawVulkanShaderPackEntry const*)(header + 1);
+
+	for (uint32_t i = 0; i < header->n_shaders; ++i) {
+		RawVulkanShaderPackEntry const* entry = &entries[i];
+		uint64_t alignment = (entry->offset | entry->size) & 3u;
+
+		// Blobs can't overlap the index, and are searched in order
+		if (alignment != 0u || entry->size == 0u ||
+			entry->offset < index_end || entry->offset > size ||
+			entry->size > size - entry->offset ||
+			(i > 0u && entries[i - 1u].content_hash >= entry->content_hash))
+			return false;
+	}
+
+	return true;
+}
+
+bool rawOpenVulkanShaderPack(
+	char const* path,
+	RawVulkanShaderPack* shader_pack) {
+
+	memset(shader_pack, 0, sizeof(RawVulkanShaderPack));
+
+	if (!rawMapFile(path, &shader_pack->mapping)) {
+		RAW_LOG_ERROR("rawMapFile failed for \"%s\"!", path);
+		return false;
+	}
+
+	if (!rawValidateVulkanShaderPack(&shader_pack->mapping)) {
+		RAW_LOG_ERROR("\"%s\" isn't a valid shader pack!", path);
+		rawUnmapFile(&shader_pack->mapping);
+		return false;
+	}
+
+	RawVulkanShaderPackHeader const* header = shader_pack->mapping.data;
+
+	shader_pack->entries = (RawVulkanShaderPackEntry const*)(header + 1);
+	shader_pack->n_shaders = header->n_shaders;
+
+	if (shader_pack->n_shaders == 0u)
+		return true;
+
+	RAW_MEM_ALLOC(shader_pack->shader_modules,
+		(uint64_t)shader_pack->n_shaders, sizeof(VkShaderModule));
+
+	if (!shader_pack->shader_modules) {
+		RAW_LOG_ERROR("RAW_MEM_ALLOC failed on rawOpenVulkanShaderPack!");
+		rawUnmapFile(&shader_pack->mapping);
+		return false;
+	}
+
+	for (uint32_t i = 0; i < shader_pack->n_shaders; ++i)
+		shader_pack->shader_modules[i] = VK_NULL_HANDLE;
+
+	return true;
+}
+
+void rawCloseVulkanShaderPack(
+	VkDevice logical_device,
+	RawVulkanShaderPack* shader_pack) {
+
+	if (shader_pack->shader_modules) {
+		for (uint32_t i = 0; i < shader_pack->n_shaders; ++i) {
+			if (shader_pack->shader_modules[i] != VK_NULL_HANDLE)
+				// TODO: Pass allocation callback
+				vkDestroyShaderModule(logical_device,
+					shader_pack->shader_modules[i], RAW_NULL_PTR);
+		}
+
+		RAW_MEM_FREE(shader_pack->shader_modules);
+	}
+
+	rawUnmapFile(&shader_pack->mapping);
+
+	memset(shader_pack, 0, sizeof(RawVulkanShaderPack));
+}
+
+// Index of @content_hash, or n_shaders if it isn't in the pack
+static uint32_t rawSearchVulkanShaderPack(
+	RawVulkanShaderPack const* const shader_pack,
+	uint64_t content_hash) {
+
+	uint32_t first = 0u;
+	uint32_t last = shader_pack->n_shaders;
+
+	while (first < last) {
+		uint32_t middle = first + (last - first) / 2u;
+
+		if (shader_pack->entries[middle].content_hash < content_hash)
+			first = middle + 1u;
+		else
+			last = middle;
+	}
+
+	if (first < shader_pack->n_shaders &&
+		shader_pack->entries[first].content_hash == content_hash)
+		return first;
+
+	return shader_pack->n_shaders;
+}
+
+bool rawFindVulkanShaderCode(
+	RawVulkanShaderPack const* const shader_pack,
+	uint64_t content_hash,
+	uint32_t const** code,
+	uint64_t* size) {
+
+	uint32_t index = rawSearchVulkanShaderPack(shader_pack, content_hash);
+
+	if (index == shader_pack->n_shaders)
+		return false;
+
+	RawVulkanShaderPackEntry const* entry = &shader_pack->entries[index];
+
+	*code = (uint32_t const*)
+		((uint8_t const*)shader_pack->mapping.data + entry->offset);
+	*size = entry->size;
+
+	return true;
+}
+
+bool rawGetVulkanShaderModule(
+	VkDevice logical_device,
+	RawVulkanShaderPack* shader_pack,
+	uint64_t content_hash,
+	VkShaderModule* shader_module) {
+
+	uint32_t index = rawSearchVulkanShaderPack(shader_pack, content_hash);
+
+	if (index == shader_pack->n_shaders) {
+		RAW_LOG_ERROR("Shader %016" PRIx64 " isn't in the shader pack!",
+			content_hash);
+		return false;
+	}
+
+	if (shader_pack->shader_modules[index] != VK_NULL_HANDLE) {
+		*shader_module = shader_pack->shader_modules[index];
+		return true;
+	}
+
+	uint32_t const* code;
+	uint64_t size;
+	rawFindVulkanShaderCode(shader_pack, content_hash, &code, &size);
+
+	// Once per blob, and cheap next to the module creation
+	if (rawHashSpirv(code, size) != content_hash) {
+		RAW_LOG_ERROR("Shader %016" PRIx64 " is corrupted!", content_hash);
+		return false;
+	}
+
+	VkShaderModuleCreateInfo create_info = {
+		.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = 0,
+		.codeSize = (size_t)size,
+		.pCode = code
+	};
+
+	// TODO: Pass allocation callback
+	VkResult result = vkCreateShaderModule(logical_device,
+		&create_info, RAW_NULL_PTR, &shader_pack->shader_modules[index]);
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("vkCreateShaderModule failed!");
+		shader_pack->shader_modules[index] = VK_NULL_HANDLE;
+		return false;
+	}
+
+	++shader_pack->n_shader_modules;
+	*shader_module = shader_pack->shader_modules[index];
+
+	return true;
+}
+
+static int rawCompareVulkanShaderPackEntries(void const* a, void const* b) {
+	uint64_t hash_a = ((RawVulkanShaderPackEntry const*)a)->content_hash;
+	uint64_t hash_b = ((RawVulkanShaderPackEntry const*)b)->content_hash;
+
+	return (hash_a > hash_b) - (hash_a < hash_b);
+}
+
+bool rawWriteVulkanShaderPack(
+	char const* path,
+	uint32_t const* const* codes,
+	uint64_t const* sizes,
+	uint32_t n_shaders,
+	uint64_t* content_hashes) {
+
+	RawVulkanShaderPackEntry* entries = RAW_NULL_PTR;
+
+	if (n_shaders > 0u) {
+		RAW_MEM_ALLOC(entries,
+			(uint64_t)n_shaders, sizeof(RawVulkanShaderPackEntry));
+
+		if (!entries) {
+			RAW_LOG_ERROR("RAW_MEM_ALLOC failed on "
+				"rawWriteVulkanShaderPack!");
+			return false;
+		}
+	}
+
+	for (uint32_t i = 0; i < n_shaders; ++i) {
+		uint64_t alignment = sizes[i] & 3u;
+
+		if (sizes[i] == 0u || alignment != 0u) {
+			RAW_LOG_ERROR("Shader %" PRIu32 " isn't valid SPIR-V!", i);
+			RAW_MEM_FREE(entries);
+			return false;
+		}
+
+		// Offset holds the source blob until the layout is known
+		entries[i].content_hash = rawHashSpirv(codes[i], sizes[i]);
+		entries[i].offset = i;
+		entries[i].size = sizes[i];
+
+		if (content_hashes)
+			content_hashes[i] = entries[i].content_hash;
+	}
+
+	if (n_shaders > 0u)
+		qsort(entries, n_shaders, sizeof(RawVulkanShaderPackEntry),
+			rawCompareVulkanShaderPackEntries);
+
+	uint32_t n_unique_shaders = 0u;
+
+	for (uint32_t i = 0; i < n_shaders; ++i) {
+		if (n_unique_shaders == 0u || entries[i].content_hash !=
+			entries[n_unique_shaders - 1u].content_hash)
+			entries[n_unique_shaders++] = entries[i];
+	}
+
+	uint64_t pack_size = sizeof(RawVulkanShaderPackHeader) +
+		(uint64_t)n_unique_shaders * sizeof(RawVulkanShaderPackEntry);
+
+	for (uint32_t i = 0; i < n_unique_shaders; ++i)
+		pack_size += entries[i].size;
+
+	uint8_t* pack;
+	RAW_MEM_ALLOC(pack, pack_size, sizeof(uint8_t));
+
+	if (!pack) {
+		RAW_LOG_ERROR("RAW_MEM_ALLOC failed on rawWriteVulkanShaderPack!");
+
+		if (entries)
+			RAW_MEM_FREE(entries);
+
+		return false;
+	}
+
+	RawVulkanShaderPackHeader header = {
+		.magic = RAW_VULKAN_SHADER_PACK_MAGIC,
+		.version = RAW_VULKAN_SHADER_PACK_VERSION,
+		.n_shaders = n_unique_shaders,
+		.reserved = 0u
+	};
+
+	memcpy(pack, &header, sizeof(RawVulkanShaderPackHeader));
+
+	uint64_t offset = sizeof(RawVulkanShaderPackHeader) +
+		(uint64_t)n_unique_shaders * sizeof(RawVulkanShaderPackEntry);
+
+	for (uint32_t i = 0; i < n_unique_shaders; ++i) {
+		uint64_t source_index = entries[i].offset;
+
+		memcpy(pack + offset, codes[source_index], entries[i].size);
+		entries[i].offset = offset;
+		offset += entries[i].size;
+	}
+
+	if (n_unique_shaders > 0u)
+		memcpy(pack + sizeof(RawVulkanShaderPackHeader), entries,
+			n_unique_shaders * sizeof(RawVulkanShaderPackEntry));
+
+	bool result = rawWriteFileAtomic(path, pack, pack_size);
+
+	if (!result)
+		RAW_LOG_ERROR("rawWriteFileAtomic failed for \"%s\"!", path);
+
+	RAW_MEM_FREE(pack);
+
+	if (entries)
+		RAW_MEM_FREE(entries);
+
+	return result;
+}
@@ -0,0 +1,140 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanShaderPack.h"
+ *
+ * Memory-mapped shader packs
+ *
+ * A shader pack is one file holding every SPIR-V blob of the engine,
+ * mapped at startup instead of reading thousands of small files. Blobs
+ * are identified by the hash of their contents and listed in an index
+ * sorted by it, so lookups are binary searches. Shader modules are only
+ * created the first time a blob is asked for, and created once.
+ *
+ * Layout, in the byte order of the host that wrote the pack:
+ *     RawVulkanShaderPackHeader
+ *     RawVulkanShaderPackEntry[n_shaders], sorted by content_hash
+ *     SPIR-V blobs, 4 byte aligned
+ *
+ * The index and blobs are used in place, never byte swapped, so packs
+ * only load on hosts of the same endianness. The magic doubles as the
+ * endianness marker: a pack from the other byte order reads it swapped
+ * and is rejected.
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+
+#ifndef RAW_VULKAN_SHADER_PACK_H
+#define RAW_VULKAN_SHADER_PACK_H
+
+#include <engine/platform/rawFile.h>
+#include <engine/vulkan/rawVulkan.h>
+
+#include <inttypes.h>
+#include <stdbool.h>
+
+// "RSPK"
+#define RAW_VULKAN_SHADER_PACK_MAGIC 0x4b505352u
+
+// The magic as read from a pack written with the other byte order
+#define RAW_VULKAN_SHADER_PACK_SWAPPED_MAGIC 0x5253504bu
+#define RAW_VULKAN_SHADER_PACK_VERSION 1u
+
+typedef struct {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t n_shaders;
+	uint32_t reserved;
+} RawVulkanShaderPackHeader;
+
+typedef struct {
+	uint64_t content_hash;
+
+	// From the start of the file, in bytes
+	uint64_t offset;
+	uint64_t size;
+} RawVulkanShaderPackEntry;
+
+typedef struct {
+	RawFileMapping mapping;
+
+	RawVulkanShaderPackEntry const* entries;
+	uint32_t n_shaders;
+
+	// Parallel to entries, VK_NULL_HANDLE until first requested
+	VkShaderModule* shader_modules;
+	uint32_t n_shader_modules;
+} RawVulkanShaderPack;
+
+// Content hash of a SPIR-V blob
+uint64_t rawHashSpirv(uint32_t const* code, uint64_t size);
+
+/*
+ * Maps @path and validates its header and index. The pack stays mapped
+ * until closed, so blobs are never copied.
+ */
+bool rawOpenVulkanShaderPack(
+	char const* path,
+	RawVulkanShaderPack* shader_pack);
+
+// Destroys every shader module created from the pack
+void rawCloseVulkanShaderPack(
+	VkDevice logical_device,
+	RawVulkanShaderPack* shader_pack);
+
+/*
+ * The SPIR-V blob of @content_hash, pointing into the mapping.
+ */
+bool rawFindVulkanShaderCode(
+	RawVulkanShaderPack const* const shader_pack,
+	uint64_t content_hash,
+	uint32_t const** code,
+	uint64_t* size);
+
+/*
+ * The shader module of @content_hash, created on first use and shared
+ * afterwards. Not thread safe.
+ */
+bool rawGetVulkanShaderModule(
+	VkDevice logical_device,
+	RawVulkanShaderPack* shader_pack,
+	uint64_t content_hash,
+	VkShaderModule* shader_module);
+
+/*
+ * Builds a pack out of @n_shaders SPIR-V blobs and atomically writes it
+ * to @path. Identical blobs are stored once. @content_hashes, if not
+ * NULL, receives the hash of each blob.
+ */
+bool rawWriteVulkanShaderPack(
+	char const* path,
+	uint32_t const* const* codes,
+	uint64_t const* sizes,
+	uint32_t n_shaders,
+	uint64_t* content_hashes);
+
+#endif // RAW_VULKAN_SHADER_PACK_H
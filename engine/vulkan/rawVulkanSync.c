@@ -0,0 +1,520 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanSync.c"
+ *
+ * GPU/CPU synchronization
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+
+#include <engine/vulkan/rawVulkanSync.h>
+#include <engine/vulkan/rawVulkanPhysicalDevice.h>
+#include <engine/platform/rawMemory.h>
+#include <engine/utils/rawLogger.h>
+
+#include <string.h>
+
+#define RAW_VULKAN_INITIAL_TIMELINE_FENCES 4u
+
+static bool rawGrowVulkanQueueTimelineFences(
+	RawVulkanQueueTimeline* timeline) {
+
+	uint32_t max_fences = timeline->max_fences > 0u ?
+		timeline->max_fences * 2u : RAW_VULKAN_INITIAL_TIMELINE_FENCES;
+
+	VkFence* pending_fences = RAW_NULL_PTR;
+	uint64_t* pending_values = RAW_NULL_PTR;
+	VkFence* free_fences = RAW_NULL_PTR;
+
+	RAW_MEM_ALLOC(pending_fences, (uint64_t)max_fences, sizeof(VkFence));
+	RAW_MEM_ALLOC(pending_values, (uint64_t)max_fences, sizeof(uint64_t));
+	RAW_MEM_ALLOC(free_fences, (uint64_t)max_fences, sizeof(VkFence));
+
+	if (!pending_fences || !pending_values || !free_fences) {
+		RAW_LOG_ERROR("RAW_MEM_ALLOC failed on "
+			"rawGrowVulkanQueueTimelineFences!");
+
+		if (pending_fences)
+			RAW_MEM_FREE(pending_fences);
+
+		if (pending_values)
+			RAW_MEM_FREE(pending_values);
+
+		if (free_fences)
+			RAW_MEM_FREE(free_fences);
+
+		return false;
+	}
+
+	// The ring is unrolled so pending submissions start at 0
+	for (uint32_t i = 0; i < timeline->n_pending; ++i) {
+		uint32_t slot = (timeline->first_pending + i) % timeline->max_fences;
+		pending_fences[i] = timeline->pending_fences[slot];
+		pending_values[i] = timeline->pending_values[slot];
+	}
+
+	if (timeline->max_fences > 0u) {
+		memcpy(free_fences, timeline->free_fences,
+			timeline->n_free_fences * sizeof(VkFence));
+
+		RAW_MEM_FREE(timeline->pending_fences);
+		RAW_MEM_FREE(timeline->pending_values);
+		RAW_MEM_FREE(timeline->free_fences);
+	}
+
+	timeline->pending_fences = pending_fences;
+	timeline->pending_values = pending_values;
+	timeline->free_fences = free_fences;
+	timeline->first_pending = 0u;
+	timeline->max_fences = max_fences;
+
+	return true;
+}
+
+// Moves signaled fences, in submission order, back to the free list
+static bool rawRetireVulkanQueueTimelineFences(
+	VkDevice logical_device,
+	RawVulkanQueueTimeline* timeline) {
+
+	while (timeline->n_pending > 0u) {
+		VkFence fence = timeline->pending_fences[timeline->first_pending];
+
+		VkResult result = vkGetFenceStatus(logical_device, fence);
+
+		if (result == VK_NOT_READY)
+			break;
+
+		if (result != VK_SUCCESS) {
+			RAW_LOG_ERROR("vkGetFenceStatus failed!");
+			return false;
+		}
+
+		result = vkResetFences(logical_device, 1u, &fence);
+
+		if (result != VK_SUCCESS) {
+			RAW_LOG_ERROR("vkResetFences failed!");
+			return false;
+		}
+
+		timeline->last_completed_value =
+			timeline->pending_values[timeline->first_pending];
+
+		timeline->free_fences[timeline->n_free_fences++] = fence;
+		timeline->first_pending =
+			(timeline->first_pending + 1u) % timeline->max_fences;
+		--timeline->n_pending;
+	}
+
+	return true;
+}
+
+static bool rawAcquireVulkanQueueTimelineFence(
+	VkDevice logical_device,
+	RawVulkanQueueTimeline* timeline,
+	VkFence* fence) {
+
+	if (!rawRetireVulkanQueueTimelineFences(logical_device, timeline))
+		return false;
+
+	if (timeline->n_free_fences > 0u) {
+		*fence = timeline->free_fences[--timeline->n_free_fences];
+		return true;
+	}
+
+	// Every fence is in flight
+	if (timeline->n_pending == timeline->max_fences &&
+		!rawGrowVulkanQueueTimelineFences(timeline))
+		return false;
+
+	VkFenceCreateInfo fence_create_info = {
+		.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = 0
+	};
+
+	// TODO: Pass allocation callback
+	VkResult result = vkCreateFence(logical_device,
+		&fence_create_info, RAW_NULL_PTR, fence);
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("vkCreateFence failed!");
+		return false;
+	}
+
+	return true;
+}
+
+bool rawGetVulkanTimelineSemaphoreDeviceFeatures(
+	VkPhysicalDevice physical_device,
+	VkPhysicalDeviceTimelineSemaphoreFeaturesKHR* features) {
+
+	memset(features, 0, sizeof(VkPhysicalDeviceTimelineSemaphoreFeaturesKHR));
+
+	if (!vkGetPhysicalDeviceFeatures2KHR ||
+		!rawIsVulkanPhysicalDeviceExtensionSupported(physical_device,
+			VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME))
+		return false;
+
+	VkPhysicalDeviceTimelineSemaphoreFeaturesKHR supported = {
+		.sType =
+			VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR,
+		.pNext = RAW_NULL_PTR
+	};
+
+	VkPhysicalDeviceFeatures2KHR features2 = {
+		.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2_KHR,
+		.pNext = &supported
+	};
+
+	vkGetPhysicalDeviceFeatures2KHR(physical_device, &features2);
+
+	if (!supported.timelineSemaphore)
+		return false;
+
+	features->sType =
+		VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR;
+	features->pNext = RAW_NULL_PTR;
+	features->timelineSemaphore = VK_TRUE;
+
+	return true;
+}
+
+bool rawCreateVulkanQueueTimeline(
+	VkDevice logical_device,
+	VkQueue queue,
+	bool use_timeline_semaphore,
+	RawVulkanQueueTimeline* timeline) {
+
+	memset(timeline, 0, sizeof(RawVulkanQueueTimeline));
+
+	timeline->queue = queue;
+
+	if (use_timeline_semaphore &&
+		(!vkGetSemaphoreCounterValueKHR || !vkWaitSemaphoresKHR)) {
+		RAW_LOG_WARNING("VK_KHR_timeline_semaphore functions not loaded, "
+			"falling back to binary fences!");
+		use_timeline_semaphore = false;
+	}
+
+	timeline->timeline_semaphore_enabled = use_timeline_semaphore;
+
+	if (!use_timeline_semaphore)
+		return rawGrowVulkanQueueTimelineFences(timeline);
+
+	VkSemaphoreTypeCreateInfoKHR semaphore_type_create_info = {
+		.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO_KHR,
+		.pNext = RAW_NULL_PTR,
+		.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE_KHR,
+		.initialValue = 0u
+	};
+
+	VkSemaphoreCreateInfo semaphore_create_info = {
+		.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
+		.pNext = &semaphore_type_create_info,
+		.flags = 0
+	};
+
+	// TODO: Pass allocation callback
+	VkResult result = vkCreateSemaphore(logical_device,
+		&semaphore_create_info, RAW_NULL_PTR, &timeline->timeline_semaphore);
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("vkCreateSemaphore failed!");
+		return false;
+	}
+
+	return true;
+}
+
+void rawDestroyVulkanQueueTimeline(
+	VkDevice logical_device,
+	RawVulkanQueueTimeline* timeline) {
+
+	if (timeline->timeline_semaphore == VK_NULL_HANDLE &&
+		timeline->max_fences == 0u) {
+		RAW_LOG_WARNING("Attempting to destroy "
+			"NULL Vulkan queue timeline!");
+		return;
+	}
+
+	rawWaitVulkanQueueTimeline(logical_device, timeline,
+		timeline->last_submitted_value, UINT64_MAX);
+
+	if (timeline->timeline_semaphore != VK_NULL_HANDLE) {
+		// TODO: Pass allocation callback
+		vkDestroySemaphore(logical_device,
+			timeline->timeline_semaphore, RAW_NULL_PTR);
+		timeline->timeline_semaphore = VK_NULL_HANDLE;
+	}
+
+	if (timeline->max_fences > 0u) {
+		for (uint32_t i = 0; i < timeline->n_pending; ++i) {
+			uint32_t slot =
+				(timeline->first_pending + i) % timeline->max_fences;
+
+			// TODO: Pass allocation callback
+			vkDestroyFence(logical_device,
+				timeline->pending_fences[slot], RAW_NULL_PTR);
+		}
+
+		for (uint32_t i = 0; i < timeline->n_free_fences; ++i) {
+			// TODO: Pass allocation callback
+			vkDestroyFence(logical_device,
+				timeline->free_fences[i], RAW_NULL_PTR);
+		}
+
+		RAW_MEM_FREE(timeline->pending_fences);
+		RAW_MEM_FREE(timeline->pending_values);
+		RAW_MEM_FREE(timeline->free_fences);
+
+		timeline->max_fences = 0u;
+	}
+}
+
+bool rawSubmitVulkanQueueTimeline(
+	VkDevice logical_device,
+	RawVulkanQueueTimeline* timeline,
+	VkSubmitInfo const* const submit_info,
+	RawVulkanTimelinePoint const* const waits,
+	VkPipelineStageFlags const* const wait_stages,
+	uint32_t n_waits,
+	uint64_t* signaled_value) {
+
+	if (submit_info->waitSemaphoreCount + n_waits >
+			RAW_VULKAN_MAX_SUBMIT_SEMAPHORES ||
+		submit_info->signalSemaphoreCount + 1u >
+			RAW_VULKAN_MAX_SUBMIT_SEMAPHORES) {
+		RAW_LOG_ERROR("Too many semaphores on "
+			"rawSubmitVulkanQueueTimeline!");
+		return false;
+	}
+
+	VkSemaphore wait_semaphores[RAW_VULKAN_MAX_SUBMIT_SEMAPHORES];
+	uint64_t wait_values[RAW_VULKAN_MAX_SUBMIT_SEMAPHORES];
+	VkPipelineStageFlags wait_stage_masks[RAW_VULKAN_MAX_SUBMIT_SEMAPHORES];
+	uint32_t n_wait_semaphores = submit_info->waitSemaphoreCount;
+
+	VkSemaphore signal_semaphores[RAW_VULKAN_MAX_SUBMIT_SEMAPHORES];
+	uint64_t signal_values[RAW_VULKAN_MAX_SUBMIT_SEMAPHORES];
+	uint32_t n_signal_semaphores = submit_info->signalSemaphoreCount;
+
+	// Binary semaphores ignore their timeline values
+	for (uint32_t i = 0; i < n_wait_semaphores; ++i) {
+		wait_semaphores[i] = submit_info->pWaitSemaphores[i];
+		wait_values[i] = 0u;
+		wait_stage_masks[i] = submit_info->pWaitDstStageMask[i];
+	}
+
+	for (uint32_t i = 0; i < n_signal_semaphores; ++i) {
+		signal_semaphores[i] = submit_info->pSignalSemaphores[i];
+		signal_values[i] = 0u;
+	}
+
+	for (uint32_t i = 0; i < n_waits; ++i) {
+		RawVulkanQueueTimeline* wait_timeline = waits[i].timeline;
+
+		// Submissions to the same queue are already ordered
+		if (wait_timeline == timeline ||
+			waits[i].value <= wait_timeline->last_completed_value)
+			continue;
+
+		if (timeline->timeline_semaphore_enabled &&
+			wait_timeline->timeline_semaphore_enabled) {
+			wait_semaphores[n_wait_semaphores] =
+				wait_timeline->timeline_semaphore;
+			wait_values[n_wait_semaphores] = waits[i].value;
+			wait_stage_masks[n_wait_semaphores] = wait_stages[i];
+			++n_wait_semaphores;
+		}
+		else if (!rawWaitVulkanQueueTimeline(logical_device,
+			wait_timeline, waits[i].value, UINT64_MAX)) {
+			RAW_LOG_ERROR("rawWaitVulkanQueueTimeline failed!");
+			return false;
+		}
+	}
+
+	uint64_t value = timeline->last_submitted_value + 1u;
+
+	VkSubmitInfo timeline_submit_info = *submit_info;
+	timeline_submit_info.waitSemaphoreCount = n_wait_semaphores;
+	timeline_submit_info.pWaitSemaphores = wait_semaphores;
+	timeline_submit_info.pWaitDstStageMask = wait_stage_masks;
+
+	VkResult result;
+
+	if (timeline->timeline_semaphore_enabled) {
+		signal_semaphores[n_signal_semaphores] =
+			timeline->timeline_semaphore;
+		signal_values[n_signal_semaphores] = value;
+		++n_signal_semaphores;
+
+		VkTimelineSemaphoreSubmitInfoKHR semaphore_values = {
+			.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR,
+			.pNext = submit_info->pNext,
+			.waitSemaphoreValueCount = n_wait_semaphores,
+			.pWaitSemaphoreValues = wait_values,
+			.signalSemaphoreValueCount = n_signal_semaphores,
+			.pSignalSemaphoreValues = signal_values
+		};
+
+		timeline_submit_info.pNext = &semaphore_values;
+		timeline_submit_info.signalSemaphoreCount = n_signal_semaphores;
+		timeline_submit_info.pSignalSemaphores = signal_semaphores;
+
+		result = vkQueueSubmit(timeline->queue,
+			1u, &timeline_submit_info, VK_NULL_HANDLE);
+	}
+	else {
+		VkFence fence;
+
+		if (!rawAcquireVulkanQueueTimelineFence(
+			logical_device, timeline, &fence))
+			return false;
+
+		result = vkQueueSubmit(timeline->queue,
+			1u, &timeline_submit_info, fence);
+
+		if (result == VK_SUCCESS) {
+			uint32_t slot = (timeline->first_pending + timeline->n_pending) %
+				timeline->max_fences;
+
+			timeline->pending_fences[slot] = fence;
+			timeline->pending_values[slot] = value;
+			++timeline->n_pending;
+		}
+		else
+			timeline->free_fences[timeline->n_free_fences++] = fence;
+	}
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("vkQueueSubmit failed!");
+		return false;
+	}
+
+	timeline->last_submitted_value = value;
+
+	if (signaled_value)
+		*signaled_value = value;
+
+	return true;
+}
+
+uint64_t rawGetVulkanQueueTimelineCompletedValue(
+	VkDevice logical_device,
+	RawVulkanQueueTimeline* timeline) {
+
+	if (timeline->timeline_semaphore_enabled) {
+		uint64_t value;
+
+		VkResult result = vkGetSemaphoreCounterValueKHR(
+			logical_device, timeline->timeline_semaphore, &value);
+
+		if (result == VK_SUCCESS)
+			timeline->last_completed_value = value;
+		else
+			RAW_LOG_ERROR("vkGetSemaphoreCounterValueKHR failed!");
+	}
+	else if (!rawRetireVulkanQueueTimelineFences(logical_device, timeline))
+		RAW_LOG_ERROR("rawRetireVulkanQueueTimelineFences failed!");
+
+	return timeline->last_completed_value;
+}
+
+bool rawIsVulkanTimelinePointCompleted(
+	VkDevice logical_device,
+	RawVulkanTimelinePoint const* const point) {
+
+	if (point->value <= point->timeline->last_completed_value)
+		return true;
+
+	return point->value <=
+		rawGetVulkanQueueTimelineCompletedValue(
+			logical_device, point->timeline);
+}
+
+bool rawWaitVulkanQueueTimeline(
+	VkDevice logical_device,
+	RawVulkanQueueTimeline* timeline,
+	uint64_t value,
+	uint64_t timeout) {
+
+	if (value <= timeline->last_completed_value)
+		return true;
+
+	if (value > timeline->last_submitted_value) {
+		RAW_LOG_ERROR("Waiting for a timeline value "
+			"that was never submitted!");
+		return false;
+	}
+
+	VkResult result;
+
+	if (timeline->timeline_semaphore_enabled) {
+		VkSemaphoreWaitInfoKHR wait_info = {
+			.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO_KHR,
+			.pNext = RAW_NULL_PTR,
+			.flags = 0,
+			.semaphoreCount = 1u,
+			.pSemaphores = &timeline->timeline_semaphore,
+			.pValues = &value
+		};
+
+		result = vkWaitSemaphoresKHR(logical_device, &wait_info, timeout);
+
+		if (result == VK_SUCCESS)
+			timeline->last_completed_value = value;
+	}
+	else {
+		// Values are increasing, the first fence covering @value is enough
+		uint32_t i = 0u;
+		uint32_t slot = timeline->first_pending;
+
+		while (i < timeline->n_pending &&
+			timeline->pending_values[slot] < value) {
+			++i;
+			slot = (slot + 1u) % timeline->max_fences;
+		}
+
+		result = vkWaitForFences(logical_device, 1u,
+			&timeline->pending_fences[slot], VK_TRUE, timeout);
+
+		if (result == VK_SUCCESS &&
+			!rawRetireVulkanQueueTimelineFences(logical_device, timeline))
+			return false;
+	}
+
+	if (result == VK_TIMEOUT)
+		return false;
+
+	if (result != VK_SUCCESS) {
+		RAW_LOG_ERROR("Vulkan timeline wait failed!");
+		return false;
+	}
+
+	return true;
+}
@@ -0,0 +1,165 @@
+/*
+ * MIT License
+ * 
+ * Copyright (c) 2020 Marcelo de Matos Menezes
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Raw Rendering Engine - "engine/vulkan/rawVulkanSync.h"
+ *
+ * GPU/CPU synchronization
+ *
+ * Every queue gets a monotonically increasing timeline. Submissions
+ * signal the next value and resources remember the value of their last
+ * use, so reclaiming them is a single comparison. VK_KHR_timeline_semaphore
+ * is used when enabled, otherwise the timeline is emulated with a ring of
+ * binary fences.
+ *
+ * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
+ * Created: 19/10/2026
+ * Last modified: 19/10/2026
+ */
+
+
+#ifndef RAW_VULKAN_SYNC_H
+#define RAW_VULKAN_SYNC_H
+
+#include <engine/vulkan/rawVulkan.h>
+
+#include <inttypes.h>
+#include <stdbool.h>
+
+// Max. semaphores waited or signaled by a single timeline submission
+#define RAW_VULKAN_MAX_SUBMIT_SEMAPHORES 16u
+
+typedef struct {
+	VkQueue queue;
+	bool timeline_semaphore_enabled;
+
+	// Value signaled by the latest submission
+	uint64_t last_submitted_value;
+
+	// Latest value known to be reached by the GPU
+	uint64_t last_completed_value;
+
+	// VK_KHR_timeline_semaphore path
+	VkSemaphore timeline_semaphore;
+
+	/*
+	 * Binary fence emulation. Submissions in flight are kept in a
+	 * ring, in submission order, with the value each fence stands for.
+	 * Signaled fences are reset and kept for reuse.
+	 */
+	VkFence* pending_fences;
+	uint64_t* pending_values;
+	uint32_t first_pending;
+	uint32_t n_pending;
+	VkFence* free_fences;
+	uint32_t n_free_fences;
+	uint32_t max_fences;
+} RawVulkanQueueTimeline;
+
+/*
+ * A point in a queue timeline: the moment the GPU has finished every
+ * submission up to @value. Resources store the point of their last
+ * use to know when they can be reclaimed.
+ */
+typedef struct {
+	RawVulkanQueueTimeline* timeline;
+	uint64_t value;
+} RawVulkanTimelinePoint;
+
+/*
+ * Whether @physical_device supports VK_KHR_timeline_semaphore and its
+ * timelineSemaphore feature, queried through
+ * VK_KHR_get_physical_device_properties2. If so, @features is filled to
+ * be chained to VkDeviceCreateInfo::pNext. Otherwise it's zeroed and the
+ * timelines fall back to binary fences.
+ */
+bool rawGetVulkanTimelineSemaphoreDeviceFeatures(
+	VkPhysicalDevice physical_device,
+	VkPhysicalDeviceTimelineSemaphoreFeaturesKHR* features);
+
+/*
+ * @use_timeline_semaphore must only be true if
+ * VK_KHR_timeline_semaphore and its timelineSemaphore feature were
+ * enabled on @logical_device. Otherwise binary fences are used.
+ *
+ * Like VkQueue, a timeline must be externally synchronized.
+ */
+bool rawCreateVulkanQueueTimeline(
+	VkDevice logical_device,
+	VkQueue queue,
+	bool use_timeline_semaphore,
+	RawVulkanQueueTimeline* timeline);
+
+/*
+ * Waits for every submission of @timeline to
+ * complete before destroying its objects
+ */
+void rawDestroyVulkanQueueTimeline(
+	VkDevice logical_device,
+	RawVulkanQueueTimeline* timeline);
+
+/*
+ * Submits @submit_info to the timeline's queue, signaling the next
+ * timeline value, which is stored in @signaled_value.
+ *
+ * @submit_info may carry its own binary semaphores (swapchain
+ * acquisition and presentation, for instance). Its pNext chain
+ * is preserved.
+ *
+ * The submission waits on @waits at @wait_stages. Waits on other
+ * queues are resolved on the GPU when both timelines use timeline
+ * semaphores, otherwise the CPU blocks until they are reached.
+ */
+bool rawSubmitVulkanQueueTimeline(
+	VkDevice logical_device,
+	RawVulkanQueueTimeline* timeline,
+	VkSubmitInfo const* const submit_info,
+	RawVulkanTimelinePoint const* const waits,
+	VkPipelineStageFlags const* const wait_stages,
+	uint32_t n_waits,
+	uint64_t* signaled_value);
+
+// Polls the GPU for the latest completed value of @timeline
+uint64_t rawGetVulkanQueueTimelineCompletedValue(
+	VkDevice logical_device,
+	RawVulkanQueueTimeline* timeline);
+
+/*
+ * Cheap CPU side check. The GPU is only queried
+ * if the cached completed value isn't enough.
+ */
+bool rawIsVulkanTimelinePointCompleted(
+	VkDevice logical_device,
+	RawVulkanTimelinePoint const* const point);
+
+/*
+ * Blocks until @timeline reaches @value or @timeout
+ * nanoseconds pass. Returns false on timeout or error.
+ */
+bool rawWaitVulkanQueueTimeline(
+	VkDevice logical_device,
+	RawVulkanQueueTimeline* timeline,
+	uint64_t value,
+	uint64_t timeout);
+
+#endif // RAW_VULKAN_SYNC_H
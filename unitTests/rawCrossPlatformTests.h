@@ -28,21 +28,50 @@
  *
  * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
  * Created: 20/03/2020
- * Last modified: 23/05/2020
+ * Last modified: 19/10/2026
  */
 
 #ifndef RAW_CROSS_PLATFORM_TESTS
 #define RAW_CROSS_PLATFORM_TESTS
 
 #include <engine/platform/rawMemory.h>
+#include <engine/platform/rawFile.h>
 #include <engine/vulkan/rawVulkan.h>
 #include <engine/vulkan/rawVulkanInstance.h>
 #include <engine/vulkan/rawVulkanPhysicalDevice.h>
 #include <engine/vulkan/rawVulkanLogicalDevice.h>
 #include <engine/vulkan/rawVulkanPresentation.h>
+#include <engine/vulkan/rawVulkanMemory.h>
+#include <engine/vulkan/rawVulkanBuffer.h>
+#include <engine/vulkan/rawVulkanCommandAllocator.h>
+#include <engine/vulkan/rawVulkanParallelRecorder.h>
+#include <engine/vulkan/rawVulkanFrame.h>
+#include <engine/vulkan/rawVulkanSync.h>
+#include <engine/vulkan/rawVulkanRenderGraph.h>
+#include <engine/vulkan/rawVulkanResourceState.h>
+#include <engine/vulkan/rawVulkanAsyncCompute.h>
+#include <engine/vulkan/rawVulkanFramePacer.h>
+#include <engine/vulkan/rawVulkanOffscreenSwapchain.h>
+#include <engine/vulkan/rawVulkanReadback.h>
+#include <engine/vulkan/rawVulkanPipelineCache.h>
+#include <engine/vulkan/rawVulkanPipelineCompiler.h>
+#include <engine/vulkan/rawVulkanPipelineState.h>
+#include <engine/vulkan/rawVulkanShaderPack.h>
+#include <engine/vulkan/rawVulkanReflection.h>
+#include <engine/vulkan/rawVulkanLayoutCache.h>
+#include <engine/vulkan/rawVulkanPermutation.h>
+#include <engine/vulkan/rawVulkanDescriptorAllocator.h>
+#include <engine/vulkan/rawVulkanDescriptorCache.h>
+#include <engine/vulkan/rawVulkanBindless.h>
+#include <engine/vulkan/rawVulkanSamplerCache.h>
+#include <engine/vulkan/rawVulkanRenderPassCache.h>
+#include <engine/vulkan/rawVulkanDeferred.h>
 #include <engine/utils/rawLogger.h>
 #include <engine/utils/rawAssert.h>
 
+#include <stdio.h>
+#include <string.h>
+
 // Not exactly a unit test but useful anyways
 void testLoggingLibrary() {
 	RAW_LOG_CMSG(RAW_LOG_BLUE, "Running logging test...\n");
@@ -69,6 +98,20 @@ void testMemoryAllocation() {
 	RAW_LOG_CMSG(RAW_LOG_GREEN, "Test succeeded!\n\n");
 }
 
+void testPlatformClock() {
+	RAW_LOG_CMSG(RAW_LOG_BLUE, "Running platform clock test...\n");
+
+	uint64_t start_time = rawPlatformGetTime();
+
+	rawPlatformSleep(2000000u);
+
+	uint64_t elapsed_time = rawPlatformGetTime() - start_time;
+
+	RAW_ASSERT(elapsed_time >= 2000000u, "rawPlatformSleep woke up early!");
+
+	RAW_LOG_CMSG(RAW_LOG_GREEN, "Test succeeded!\n\n");
+}
+
 void testVulkanLibraryLoading() {
 	RAW_LOG_CMSG(RAW_LOG_BLUE, "Running Vulkan library loading test...\n");
 
@@ -470,7 +513,7 @@ void testVulkanLogicalDeviceCreationAndDestruction() {
 		physical_devices[physical_device_index],
 		queue_create_infos, n_queue_create_infos,
 		desired_device_extensions, n_desired_device_extensions,
-		&features, &logical_device);
+		&features, RAW_NULL_PTR, &logical_device);
 
 	RAW_ASSERT(result, "rawCreateVulkanLogicalDevice failed!");
 
@@ -495,5 +538,3451 @@ void testVulkanLogicalDeviceCreationAndDestruction() {
 	RAW_LOG_CMSG(RAW_LOG_GREEN, "Test succeeded!\n\n");
 }
 
+/*
+ * Instance, physical device and logical device shared by the tests
+ * of the modules built on top of the logical device
+ */
+typedef struct {
+	RAW_VULKAN_LIBRARY vulkan;
+	VkInstance instance;
+	VkPhysicalDevice* physical_devices;
+	VkPhysicalDevice physical_device;
+	VkPhysicalDeviceFeatures features;
+	VkPhysicalDeviceProperties properties;
+	VkPhysicalDeviceMemoryProperties memory_properties;
+	float* queue_priorities;
+	VkDeviceQueueCreateInfo* queue_create_infos;
+	uint32_t n_queue_create_infos;
+	uint32_t graphics_queue_family_index;
+	VkQueue graphics_queue;
+	uint32_t compute_queue_family_index;
+	VkQueue compute_queue;
+	VkDevice logical_device;
+	bool timeline_semaphore_enabled;
+	bool bindless_enabled;
+} RawTestVulkanContext;
+
+void createTestVulkanContext(RawTestVulkanContext* context) {
+	context->vulkan = RAW_NULL_PTR;
+	rawLoadVulkan(&context->vulkan);
+
+	VkLayerProperties* available_instance_layers = RAW_NULL_PTR;
+	uint32_t n_available_layers;
+
+	bool result = rawGetAvailableVulkanInstanceLayers(
+		&available_instance_layers, &n_available_layers);
+
+	RAW_ASSERT(result, "Vulkan layer enumeration failed!");
+
+	VkExtensionProperties* available_instance_extensions = RAW_NULL_PTR;
+	uint32_t n_available_instance_extensions;
+
+	result = rawGetAvailableVulkanInstanceExtensions(
+		&available_instance_extensions, &n_available_instance_extensions);
+
+	RAW_ASSERT(result, "Vulkan extension enumeration failed!");
+
+	char const* desired_instance_extensions[] = {
+		VK_KHR_SURFACE_EXTENSION_NAME,
+		RAW_VULKAN_PLATFORM_SURFACE_EXTENSION_NAME,
+		RAW_NULL_PTR
+	};
+
+	uint32_t n_desired_instance_extensions = 2u;
+
+	// Needed to query extension features, e.g. for the bindless heap
+	for (uint32_t i = 0; i < n_available_instance_extensions; ++i)
+		if (strcmp(available_instance_extensions[i].extensionName,
+			VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME) == 0)
+			desired_instance_extensions[n_desired_instance_extensions++] =
+				VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME;
+
+	context->instance = VK_NULL_HANDLE;
+
+	result = rawCreateVulkanInstance(&context->instance,
+		available_instance_layers, n_available_layers, RAW_NULL_PTR, 0u,
+		available_instance_extensions, n_available_instance_extensions,
+		desired_instance_extensions, n_desired_instance_extensions,
+		"rawTests", VK_MAKE_VERSION(1, 0, 0), RAW_NULL_PTR);
+
+	RAW_ASSERT(result, "Vulkan instance creation failed!");
+
+	RAW_MEM_FREE(available_instance_extensions);
+	RAW_MEM_FREE(available_instance_layers);
+
+	result = rawLoadVulkanInstanceLevelFunctions(context->instance,
+		desired_instance_extensions, n_desired_instance_extensions, false);
+
+	RAW_ASSERT(result, "rawLoadVulkanInstanceLevelFunctions failed!");
+
+	uint32_t n_physical_devices;
+
+	result = rawGetVulkanPhysicalDevices(context->instance,
+		&context->physical_devices, &n_physical_devices);
+
+	RAW_ASSERT(result, "rawGetVulkanPhysicalDevices failed!");
+
+	char const* desired_device_extensions[] = {
+		VK_KHR_SWAPCHAIN_EXTENSION_NAME
+	};
+
+	uint32_t n_desired_device_extensions = 1u;
+
+	VkQueueFlags desired_queue_capabilities[] = {
+		VK_QUEUE_GRAPHICS_BIT,
+		VK_QUEUE_COMPUTE_BIT
+	};
+
+	uint32_t n_queue_priorities;
+	uint32_t physical_device_index;
+
+	result = rawSelectVulkanPhysicalDeviceWithDesiredCharacteristics(
+		context->physical_devices, n_physical_devices,
+		desired_device_extensions, n_desired_device_extensions,
+		&context->features, &context->properties,
+		desired_queue_capabilities, 2u,
+		&context->queue_priorities, &n_queue_priorities,
+		&context->queue_create_infos, &context->n_queue_create_infos,
+		VK_NULL_HANDLE, RAW_NULL_PTR, &physical_device_index);
+
+	RAW_ASSERT(result,
+		"rawSelectVulkanPhysicalDeviceWithDesiredCharacteristics failed!");
+
+	context->physical_device =
+		context->physical_devices[physical_device_index];
+
+	// Same queue families the selection picked
+	VkQueueFamilyProperties* queue_families = RAW_NULL_PTR;
+	uint32_t n_queue_families;
+
+	vkGetPhysicalDeviceQueueFamilyProperties(
+		context->physical_device, &n_queue_families, RAW_NULL_PTR);
+
+	RAW_MEM_ALLOC(queue_families, (uint64_t)n_queue_families,
+		sizeof(VkQueueFamilyProperties));
+
+	RAW_ASSERT(queue_families, "RAW_MEM_ALLOC failed!");
+
+	vkGetPhysicalDeviceQueueFamilyProperties(
+		context->physical_device, &n_queue_families, queue_families);
+
+	result = rawGetVulkanPhysicalDeviceDedicatedQueueFamilyIndex(
+			queue_families, n_queue_families, VK_QUEUE_GRAPHICS_BIT,
+			&context->graphics_queue_family_index) &&
+		rawGetVulkanPhysicalDeviceDedicatedQueueFamilyIndex(
+			queue_families, n_queue_families, VK_QUEUE_COMPUTE_BIT,
+			&context->compute_queue_family_index);
+
+	RAW_ASSERT(result,
+		"rawGetVulkanPhysicalDeviceDedicatedQueueFamilyIndex failed!");
+
+	RAW_MEM_FREE(queue_families);
+
+	vkGetPhysicalDeviceMemoryProperties(
+		context->physical_device, &context->memory_properties);
+
+	// Optional extensions exercise both paths of the modules using them
+	char const* enabled_device_extensions[] = {
+		VK_KHR_SWAPCHAIN_EXTENSION_NAME,
+		RAW_NULL_PTR,
+		RAW_NULL_PTR,
+		RAW_NULL_PTR
+	};
+
+	uint32_t n_enabled_device_extensions = 1u;
+
+	void* features_chain = RAW_NULL_PTR;
+
+	// The extension alone isn't enough, the feature must be supported
+	VkPhysicalDeviceTimelineSemaphoreFeaturesKHR timeline_features;
+
+	context->timeline_semaphore_enabled =
+		rawGetVulkanTimelineSemaphoreDeviceFeatures(
+			context->physical_device, &timeline_features);
+
+	if (context->timeline_semaphore_enabled) {
+		enabled_device_extensions[n_enabled_device_extensions++] =
+			VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME;
+		features_chain = &timeline_features;
+	}
+
+	VkPhysicalDeviceDescriptorIndexingFeaturesEXT descriptor_indexing_features;
+
+	context->bindless_enabled = rawGetVulkanBindlessDeviceFeatures(
+		context->physical_device, &descriptor_indexing_features);
+
+	if (context->bindless_enabled) {
+		enabled_device_extensions[n_enabled_device_extensions++] =
+			VK_KHR_MAINTENANCE3_EXTENSION_NAME;
+		enabled_device_extensions[n_enabled_device_extensions++] =
+			VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME;
+		descriptor_indexing_features.pNext = features_chain;
+		features_chain = &descriptor_indexing_features;
+	}
+
+	result = rawCreateVulkanLogicalDevice(context->physical_device,
+		context->queue_create_infos, context->n_queue_create_infos,
+		enabled_device_extensions, n_enabled_device_extensions,
+		&context->features, features_chain, &context->logical_device);
+
+	RAW_ASSERT(result, "rawCreateVulkanLogicalDevice failed!");
+
+	result = rawLoadVulkanDeviceLevelFunctions(context->logical_device,
+		enabled_device_extensions, n_enabled_device_extensions);
+
+	RAW_ASSERT(result, "rawLoadVulkanDeviceLevelFunctions failed!");
+
+	vkGetDeviceQueue(context->logical_device,
+		context->graphics_queue_family_index, 0u,
+		&context->graphics_queue);
+
+	// Compute gets the second queue of a shared family, if there is one
+	uint32_t compute_queue_index = 0u;
+
+	for (uint32_t i = 0; i < context->n_queue_create_infos; ++i)
+		if (context->queue_create_infos[i].queueFamilyIndex ==
+			context->compute_queue_family_index)
+			compute_queue_index =
+				context->queue_create_infos[i].queueCount - 1u;
+
+	vkGetDeviceQueue(context->logical_device,
+		context->compute_queue_family_index, compute_queue_index,
+		&context->compute_queue);
+}
+
+void destroyTestVulkanContext(RawTestVulkanContext* context) {
+	rawDestroyVulkanLogicalDevice(&context->logical_device);
+
+	RAW_MEM_FREE(context->queue_create_infos);
+	RAW_MEM_FREE(context->queue_priorities);
+	RAW_MEM_FREE(context->physical_devices);
+
+	rawDestroyVulkanInstance(&context->instance);
+
+	rawReleaseVulkan(&context->vulkan);
+}
+
+void testVulkanMegaBufferSuballocation() {
+	RAW_LOG_CMSG(RAW_LOG_BLUE,
+		"Running RAW Vulkan mega-buffer suballocation test...\n");
+
+	RawTestVulkanContext context;
+	createTestVulkanContext(&context);
+
+	RawVulkanMegaBuffer vertex_buffer;
+
+	bool result = rawCreateVulkanMegaBuffer(context.logical_device,
+		&context.properties, &context.memory_properties,
+		RAW_VULKAN_BUFFER_USAGE_CLASS_VERTEX, 1u << 20,
+		VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, &vertex_buffer);
+
+	RAW_ASSERT(result, "rawCreateVulkanMegaBuffer failed!");
+	RAW_ASSERT(vertex_buffer.mapped_data, "Mega-buffer was not mapped!");
+
+	// Two meshes with different vertex strides
+	RawVulkanBufferAllocation first_mesh;
+	RawVulkanBufferAllocation second_mesh;
+
+	result = rawAllocateVulkanMegaBuffer(
+		&vertex_buffer, 100u * 12u, 12u, &first_mesh);
+
+	RAW_ASSERT(result, "rawAllocateVulkanMegaBuffer failed!");
+
+	result = rawAllocateVulkanMegaBuffer(
+		&vertex_buffer, 100u * 20u, 20u, &second_mesh);
+
+	RAW_ASSERT(result, "rawAllocateVulkanMegaBuffer failed!");
+	RAW_ASSERT(first_mesh.buffer == second_mesh.buffer,
+		"Allocations don't share the same VkBuffer!");
+	bool stride_aligned = (second_mesh.offset % 20u) == 0u;
+
+	RAW_ASSERT(stride_aligned,
+		"Allocation offset is not a multiple of the vertex stride!");
+	RAW_ASSERT(second_mesh.offset >= first_mesh.offset + first_mesh.size,
+		"Allocations overlap!");
+
+	rawFreeVulkanMegaBuffer(&vertex_buffer, &first_mesh);
+	rawFreeVulkanMegaBuffer(&vertex_buffer, &second_mesh);
+
+	RAW_ASSERT(vertex_buffer.n_free_ranges == 1u &&
+		vertex_buffer.free_ranges[0].size == vertex_buffer.capacity,
+		"Free ranges were not merged back!");
+
+	rawDestroyVulkanMegaBuffer(context.logical_device, &vertex_buffer);
+
+	destroyTestVulkanContext(&context);
+
+	RAW_LOG_CMSG(RAW_LOG_GREEN, "Test succeeded!\n\n");
+}
+
+void testVulkanCommandAllocator() {
+	RAW_LOG_CMSG(RAW_LOG_BLUE,
+		"Running RAW Vulkan command allocator test...\n");
+
+	RawTestVulkanContext context;
+	createTestVulkanContext(&context);
+
+	RawVulkanCommandAllocator command_allocator;
+
+	bool result = rawCreateVulkanCommandAllocator(context.logical_device,
+		context.graphics_queue_family_index, 2u, 2u, &command_allocator);
+
+	RAW_ASSERT(result, "rawCreateVulkanCommandAllocator failed!");
+
+	VkCommandBuffer first_frame_buffers[8];
+
+	for (uint32_t i = 0u; i < 8u; ++i) {
+		result = rawAllocateVulkanCommandBuffer(context.logical_device,
+			&command_allocator, 0u, i % 2u,
+			VK_COMMAND_BUFFER_LEVEL_PRIMARY, &first_frame_buffers[i]);
+
+		RAW_ASSERT(result, "rawAllocateVulkanCommandBuffer failed!");
+	}
+
+	result = rawResetVulkanCommandAllocatorFrame(context.logical_device,
+		&command_allocator, 0u, VK_NULL_HANDLE);
+
+	RAW_ASSERT(result, "rawResetVulkanCommandAllocatorFrame failed!");
+
+	// After the reset, the same handles must be handed out again
+	VkCommandBuffer reused_buffer;
+
+	result = rawAllocateVulkanCommandBuffer(context.logical_device,
+		&command_allocator, 0u, 0u,
+		VK_COMMAND_BUFFER_LEVEL_PRIMARY, &reused_buffer);
+
+	RAW_ASSERT(result && reused_buffer == first_frame_buffers[0],
+		"Command buffer was not reused after the frame reset!");
+
+	rawDestroyVulkanCommandAllocator(
+		context.logical_device, &command_allocator);
+
+	destroyTestVulkanContext(&context);
+
+	RAW_LOG_CMSG(RAW_LOG_GREEN, "Test succeeded!\n\n");
+}
+
+/*
+ * Single color attachment render pass and framebuffer,
+ * for tests that need to record inside a render pass
+ */
+typedef struct {
+	VkImage image;
+	VkDeviceMemory memory;
+	VkImageView image_view;
+	VkRenderPass render_pass;
+	VkFramebuffer framebuffer;
+	uint32_t width;
+	uint32_t height;
+} RawTestRenderTarget;
+
+void createTestRenderTarget(RawTestVulkanContext* context,
+	uint32_t width, uint32_t height, RawTestRenderTarget* target) {
+
+	target->width = width;
+	target->height = height;
+
+	VkImageCreateInfo image_create_info = {
+		.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = 0,
+		.imageType = VK_IMAGE_TYPE_2D,
+		.format = VK_FORMAT_R8G8B8A8_UNORM,
+		.extent = { width, height, 1u },
+		.mipLevels = 1u,
+		.arrayLayers = 1u,
+		.samples = VK_SAMPLE_COUNT_1_BIT,
+		.tiling = VK_IMAGE_TILING_OPTIMAL,
+		.usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT |
+			VK_IMAGE_USAGE_TRANSFER_SRC_BIT |
+			VK_IMAGE_USAGE_TRANSFER_DST_BIT,
+		.sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+		.queueFamilyIndexCount = 0u,
+		.pQueueFamilyIndices = RAW_NULL_PTR,
+		.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED
+	};
+
+	VkResult result = vkCreateImage(context->logical_device,
+		&image_create_info, RAW_NULL_PTR, &target->image);
+
+	RAW_ASSERT(result == VK_SUCCESS, "vkCreateImage failed!");
+
+	VkMemoryRequirements memory_requirements;
+	vkGetImageMemoryRequirements(context->logical_device,
+		target->image, &memory_requirements);
+
+	bool allocated = rawAllocateVulkanMemory(context->logical_device,
+		&context->memory_properties, &memory_requirements,
+		VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, 0, RAW_NULL_PTR,
+		&target->memory);
+
+	RAW_ASSERT(allocated, "rawAllocateVulkanMemory failed!");
+
+	result = vkBindImageMemory(context->logical_device,
+		target->image, target->memory, 0);
+
+	RAW_ASSERT(result == VK_SUCCESS, "vkBindImageMemory failed!");
+
+	VkImageViewCreateInfo image_view_create_info = {
+		.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = 0,
+		.image = target->image,
+		.viewType = VK_IMAGE_VIEW_TYPE_2D,
+		.format = VK_FORMAT_R8G8B8A8_UNORM,
+		.components = {
+			VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY,
+			VK_COMPONENT_SWIZZLE_IDENTITY, VK_COMPONENT_SWIZZLE_IDENTITY
+		},
+		.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0u, 1u, 0u, 1u }
+	};
+
+	result = vkCreateImageView(context->logical_device,
+		&image_view_create_info, RAW_NULL_PTR, &target->image_view);
+
+	RAW_ASSERT(result == VK_SUCCESS, "vkCreateImageView failed!");
+
+	VkAttachmentDescription attachment = {
+		.flags = 0,
+		.format = VK_FORMAT_R8G8B8A8_UNORM,
+		.samples = VK_SAMPLE_COUNT_1_BIT,
+		.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR,
+		.storeOp = VK_ATTACHMENT_STORE_OP_STORE,
+		.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE,
+		.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE,
+		.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+		.finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL
+	};
+
+	VkAttachmentReference color_reference = {
+		.attachment = 0u,
+		.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL
+	};
+
+	VkSubpassDescription subpass = {
+		.flags = 0,
+		.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS,
+		.inputAttachmentCount = 0u,
+		.pInputAttachments = RAW_NULL_PTR,
+		.colorAttachmentCount = 1u,
+		.pColorAttachments = &color_reference,
+		.pResolveAttachments = RAW_NULL_PTR,
+		.pDepthStencilAttachment = RAW_NULL_PTR,
+		.preserveAttachmentCount = 0u,
+		.pPreserveAttachments = RAW_NULL_PTR
+	};
+
+	VkRenderPassCreateInfo render_pass_create_info = {
+		.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = 0,
+		.attachmentCount = 1u,
+		.pAttachments = &attachment,
+		.subpassCount = 1u,
+		.pSubpasses = &subpass,
+		.dependencyCount = 0u,
+		.pDependencies = RAW_NULL_PTR
+	};
+
+	result = vkCreateRenderPass(context->logical_device,
+		&render_pass_create_info, RAW_NULL_PTR, &target->render_pass);
+
+	RAW_ASSERT(result == VK_SUCCESS, "vkCreateRenderPass failed!");
+
+	VkFramebufferCreateInfo framebuffer_create_info = {
+		.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = 0,
+		.renderPass = target->render_pass,
+		.attachmentCount = 1u,
+		.pAttachments = &target->image_view,
+		.width = width,
+		.height = height,
+		.layers = 1u
+	};
+
+	result = vkCreateFramebuffer(context->logical_device,
+		&framebuffer_create_info, RAW_NULL_PTR, &target->framebuffer);
+
+	RAW_ASSERT(result == VK_SUCCESS, "vkCreateFramebuffer failed!");
+}
+
+void destroyTestRenderTarget(RawTestVulkanContext* context,
+	RawTestRenderTarget* target) {
+	vkDestroyFramebuffer(context->logical_device,
+		target->framebuffer, RAW_NULL_PTR);
+	vkDestroyRenderPass(context->logical_device,
+		target->render_pass, RAW_NULL_PTR);
+	vkDestroyImageView(context->logical_device,
+		target->image_view, RAW_NULL_PTR);
+	vkDestroyImage(context->logical_device, target->image, RAW_NULL_PTR);
+	rawFreeVulkanMemory(context->logical_device, &target->memory);
+}
+
+// Host visible buffer GPU results are copied to
+void createTestReadbackBuffer(RawTestVulkanContext* context,
+	VkDeviceSize size, VkBuffer* buffer, VkDeviceMemory* memory) {
+	VkBufferCreateInfo buffer_create_info = {
+		.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = 0,
+		.size = size,
+		.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT |
+			VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+		.sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+		.queueFamilyIndexCount = 0u,
+		.pQueueFamilyIndices = RAW_NULL_PTR
+	};
+
+	VkResult vk_result = vkCreateBuffer(context->logical_device,
+		&buffer_create_info, RAW_NULL_PTR, buffer);
+
+	RAW_ASSERT(vk_result == VK_SUCCESS, "vkCreateBuffer failed!");
+
+	VkMemoryRequirements memory_requirements;
+	vkGetBufferMemoryRequirements(context->logical_device,
+		*buffer, &memory_requirements);
+
+	bool result = rawAllocateVulkanMemory(context->logical_device,
+		&context->memory_properties, &memory_requirements,
+		VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+		VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, 0, RAW_NULL_PTR, memory);
+
+	RAW_ASSERT(result, "rawAllocateVulkanMemory failed!");
+
+	vkBindBufferMemory(context->logical_device, *buffer, *memory, 0u);
+}
+
+void destroyTestReadbackBuffer(RawTestVulkanContext* context,
+	VkBuffer* buffer, VkDeviceMemory* memory) {
+	vkDestroyBuffer(context->logical_device, *buffer, RAW_NULL_PTR);
+	rawFreeVulkanMemory(context->logical_device, memory);
+}
+
+#define RAW_TEST_PARALLEL_RECORDING_DRAWS 50000u
+
+void testRecordDraws(VkCommandBuffer command_buffer,
+	uint32_t first_draw, uint32_t n_draws,
+	uint32_t thread_index, void* user_data) {
+	(void)command_buffer;
+
+	uint32_t* recording_threads = user_data;
+
+	// Chunks are disjoint, so no two threads write the same entry
+	for (uint32_t i = first_draw; i < first_draw + n_draws; ++i)
+		recording_threads[i] = thread_index + 1u;
+}
+
+#define RAW_TEST_PARALLEL_RECORDING_CALLS 256u
+
+void testRecordCountedDraws(VkCommandBuffer command_buffer,
+	uint32_t first_draw, uint32_t n_draws,
+	uint32_t thread_index, void* user_data) {
+	(void)command_buffer;
+	(void)first_draw;
+	(void)thread_index;
+
+	atomic_fetch_add((atomic_uint*)user_data, n_draws);
+}
+
+void testVulkanParallelRecording() {
+	RAW_LOG_CMSG(RAW_LOG_BLUE,
+		"Running RAW Vulkan parallel recording test...\n");
+
+	RawTestVulkanContext context;
+	createTestVulkanContext(&context);
+
+	RawTestRenderTarget target;
+	createTestRenderTarget(&context, 4u, 4u, &target);
+
+	uint32_t n_worker_threads = 3u;
+
+	RawVulkanCommandAllocator command_allocator;
+
+	bool result = rawCreateVulkanCommandAllocator(context.logical_device,
+		context.graphics_queue_family_index, n_worker_threads + 1u, 1u,
+		&command_allocator);
+
+	RAW_ASSERT(result, "rawCreateVulkanCommandAllocator failed!");
+
+	RawVulkanParallelRecorder recorder;
+
+	result = rawCreateVulkanParallelRecorder(context.logical_device,
+		&command_allocator, n_worker_threads, &recorder);
+
+	RAW_ASSERT(result, "rawCreateVulkanParallelRecorder failed!");
+
+	VkCommandBuffer primary_command_buffer;
+
+	result = rawAllocateVulkanCommandBuffer(context.logical_device,
+		&command_allocator, 0u, 0u, VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+		&primary_command_buffer);
+
+	RAW_ASSERT(result, "rawAllocateVulkanCommandBuffer failed!");
+
+	VkCommandBufferBeginInfo begin_info = {
+		.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
+		.pInheritanceInfo = RAW_NULL_PTR
+	};
+
+	VkResult vk_result =
+		vkBeginCommandBuffer(primary_command_buffer, &begin_info);
+
+	RAW_ASSERT(vk_result == VK_SUCCESS, "vkBeginCommandBuffer failed!");
+
+	VkClearValue clear_value = { .color = { .float32 = { 0.0f } } };
+
+	VkRenderPassBeginInfo render_pass_begin_info = {
+		.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO,
+		.pNext = RAW_NULL_PTR,
+		.renderPass = target.render_pass,
+		.framebuffer = target.framebuffer,
+		.renderArea = { { 0, 0 }, { target.width, target.height } },
+		.clearValueCount = 1u,
+		.pClearValues = &clear_value
+	};
+
+	vkCmdBeginRenderPass(primary_command_buffer, &render_pass_begin_info,
+		VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
+
+	uint32_t* recording_threads = RAW_NULL_PTR;
+
+	RAW_MEM_ALLOC(recording_threads,
+		(uint64_t)RAW_TEST_PARALLEL_RECORDING_DRAWS, sizeof(uint32_t));
+
+	memset(recording_threads, 0,
+		RAW_TEST_PARALLEL_RECORDING_DRAWS * sizeof(uint32_t));
+
+	result = rawCmdRecordVulkanDrawsInParallel(&recorder, 0u,
+		primary_command_buffer, target.render_pass, 0u,
+		target.framebuffer, RAW_TEST_PARALLEL_RECORDING_DRAWS, 256u,
+		testRecordDraws, recording_threads);
+
+	RAW_ASSERT(result, "rawCmdRecordVulkanDrawsInParallel failed!");
+
+	/*
+	 * Alternates multi chunk and single chunk calls, each one counting
+	 * its own draws. A worker recording a previous call's job after it
+	 * returned would push that call's count past its draws.
+	 */
+	atomic_uint* n_recorded_draws = RAW_NULL_PTR;
+
+	RAW_MEM_ALLOC(n_recorded_draws,
+		(uint64_t)RAW_TEST_PARALLEL_RECORDING_CALLS, sizeof(atomic_uint));
+
+	for (uint32_t i = 0u; i < RAW_TEST_PARALLEL_RECORDING_CALLS; ++i)
+		atomic_init(&n_recorded_draws[i], 0u);
+
+	for (uint32_t i = 0u; i < RAW_TEST_PARALLEL_RECORDING_CALLS; ++i) {
+		uint32_t n_draws = i % 2u == 0u ? 1024u : 8u;
+
+		result = rawCmdRecordVulkanDrawsInParallel(&recorder, 0u,
+			primary_command_buffer, target.render_pass, 0u,
+			target.framebuffer, n_draws, 16u,
+			testRecordCountedDraws, &n_recorded_draws[i]);
+
+		RAW_ASSERT(result, "rawCmdRecordVulkanDrawsInParallel failed!");
+		RAW_ASSERT(atomic_load(&n_recorded_draws[i]) == n_draws,
+			"Draws were not recorded exactly once!");
+	}
+
+	vkCmdEndRenderPass(primary_command_buffer);
+
+	vk_result = vkEndCommandBuffer(primary_command_buffer);
+
+	RAW_ASSERT(vk_result == VK_SUCCESS, "vkEndCommandBuffer failed!");
+
+	// Every draw must have been recorded by some thread
+	for (uint32_t i = 0u; i < RAW_TEST_PARALLEL_RECORDING_DRAWS; ++i)
+		RAW_ASSERT(recording_threads[i] != 0u, "Draw was not recorded!");
+
+	RAW_MEM_FREE(recording_threads);
+
+	rawDestroyVulkanParallelRecorder(&recorder);
+
+	// Workers are joined, no stale recording can happen anymore
+	for (uint32_t i = 0u; i < RAW_TEST_PARALLEL_RECORDING_CALLS; ++i) {
+		uint32_t n_draws = i % 2u == 0u ? 1024u : 8u;
+
+		RAW_ASSERT(atomic_load(&n_recorded_draws[i]) == n_draws,
+			"Stale job was recorded after its call returned!");
+	}
+
+	RAW_MEM_FREE(n_recorded_draws);
+
+	rawDestroyVulkanCommandAllocator(
+		context.logical_device, &command_allocator);
+
+	destroyTestRenderTarget(&context, &target);
+	destroyTestVulkanContext(&context);
+
+	RAW_LOG_CMSG(RAW_LOG_GREEN, "Test succeeded!\n\n");
+}
+
+void testVulkanQueueTimeline() {
+	RAW_LOG_CMSG(RAW_LOG_BLUE,
+		"Running RAW Vulkan queue timeline test...\n");
+
+	RawTestVulkanContext context;
+	createTestVulkanContext(&context);
+
+	RawVulkanCommandAllocator command_allocator;
+
+	bool result = rawCreateVulkanCommandAllocator(context.logical_device,
+		context.graphics_queue_family_index, 1u, 1u, &command_allocator);
+
+	RAW_ASSERT(result, "rawCreateVulkanCommandAllocator failed!");
+
+	VkCommandBuffer command_buffer;
+
+	result = rawAllocateVulkanCommandBuffer(context.logical_device,
+		&command_allocator, 0u, 0u, VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+		&command_buffer);
+
+	RAW_ASSERT(result, "rawAllocateVulkanCommandBuffer failed!");
+
+	VkCommandBufferBeginInfo begin_info = {
+		.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT,
+		.pInheritanceInfo = RAW_NULL_PTR
+	};
+
+	vkBeginCommandBuffer(command_buffer, &begin_info);
+	vkEndCommandBuffer(command_buffer);
+
+	VkSubmitInfo submit_info = {
+		.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+		.pNext = RAW_NULL_PTR,
+		.waitSemaphoreCount = 0u,
+		.pWaitSemaphores = RAW_NULL_PTR,
+		.pWaitDstStageMask = RAW_NULL_PTR,
+		.commandBufferCount = 1u,
+		.pCommandBuffers = &command_buffer,
+		.signalSemaphoreCount = 0u,
+		.pSignalSemaphores = RAW_NULL_PTR
+	};
+
+	// The binary fence fallback is always tested
+	bool timeline_paths[] = { false, context.timeline_semaphore_enabled };
+
+	for (uint32_t path = 0u; path < 2u; ++path) {
+		RawVulkanQueueTimeline timeline;
+
+		result = rawCreateVulkanQueueTimeline(context.logical_device,
+			context.graphics_queue, timeline_paths[path], &timeline);
+
+		RAW_ASSERT(result, "rawCreateVulkanQueueTimeline failed!");
+
+		RawVulkanTimelinePoint last_use = { &timeline, 0u };
+
+		// Enough submissions to recycle and grow the fence ring
+		for (uint32_t i = 0u; i < 16u; ++i) {
+			RawVulkanTimelinePoint previous = last_use;
+			VkPipelineStageFlags wait_stage =
+				VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+
+			result = rawSubmitVulkanQueueTimeline(context.logical_device,
+				&timeline, &submit_info, &previous, &wait_stage, 1u,
+				&last_use.value);
+
+			RAW_ASSERT(result, "rawSubmitVulkanQueueTimeline failed!");
+			RAW_ASSERT(last_use.value == i + 1u,
+				"Timeline values must increase by one per submission!");
+		}
+
+		result = rawWaitVulkanQueueTimeline(context.logical_device,
+			&timeline, last_use.value, UINT64_MAX);
+
+		RAW_ASSERT(result, "rawWaitVulkanQueueTimeline failed!");
+
+		result = rawIsVulkanTimelinePointCompleted(
+			context.logical_device, &last_use);
+
+		RAW_ASSERT(result, "Waited timeline point is not completed!");
+
+		rawDestroyVulkanQueueTimeline(context.logical_device, &timeline);
+	}
+
+	rawDestroyVulkanCommandAllocator(
+		context.logical_device, &command_allocator);
+
+	destroyTestVulkanContext(&context);
+
+	RAW_LOG_CMSG(RAW_LOG_GREEN, "Test succeeded!\n\n");
+}
+
+typedef struct {
+	RawVulkanRenderGraph* render_graph;
+	uint32_t image;
+	uint32_t buffer;
+} RawTestRenderGraphResources;
+
+void testRenderGraphClear(VkCommandBuffer command_buffer, void* user_data) {
+	RawTestRenderGraphResources* resources = user_data;
+	RawVulkanRenderGraphResource* image =
+		&resources->render_graph->resources[resources->image];
+
+	VkClearColorValue color = { .float32 = { 1.0f, 0.0f, 1.0f, 1.0f } };
+
+	vkCmdClearColorImage(command_buffer, image->image,
+		VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, &color,
+		1u, &image->subresource_range);
+}
+
+void testRenderGraphCopy(VkCommandBuffer command_buffer, void* user_data) {
+	RawTestRenderGraphResources* resources = user_data;
+	RawVulkanRenderGraphResource* image =
+		&resources->render_graph->resources[resources->image];
+	RawVulkanRenderGraphResource* buffer =
+		&resources->render_graph->resources[resources->buffer];
+
+	VkBufferImageCopy region = {
+		.bufferOffset = 0u,
+		.bufferRowLength = 0u,
+		.bufferImageHeight = 0u,
+		.imageSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, 0u, 0u, 1u },
+		.imageOffset = { 0, 0, 0 },
+		.imageExtent = image->image_create_info.extent
+	};
+
+	vkCmdCopyImageToBuffer(command_buffer, image->image,
+		VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, buffer->buffer, 1u, &region);
+}
+
+void testVulkanRenderGraph() {
+	RAW_LOG_CMSG(RAW_LOG_BLUE,
+		"Running RAW Vulkan render graph test...\n");
+
+	RawTestVulkanContext context;
+	createTestVulkanContext(&context);
+
+	VkBuffer readback_buffer;
+	VkDeviceMemory readback_memory;
+
+	createTestReadbackBuffer(&context, 4u * 4u * 4u,
+		&readback_buffer, &readback_memory);
+
+	// Graph: clear -> copy to the imported buffer, plus an unused pass
+	RawVulkanRenderGraph render_graph;
+	rawCreateVulkanRenderGraph(&render_graph);
+
+	RawTestRenderGraphResources resources = { &render_graph, 0u, 0u };
+
+	VkImageCreateInfo image_create_info = {
+		.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = 0,
+		.imageType = VK_IMAGE_TYPE_2D,
+		.format = VK_FORMAT_R8G8B8A8_UNORM,
+		.extent = { 4u, 4u, 1u },
+		.mipLevels = 1u,
+		.arrayLayers = 1u,
+		.samples = VK_SAMPLE_COUNT_1_BIT,
+		.tiling = VK_IMAGE_TILING_OPTIMAL,
+		.usage = VK_IMAGE_USAGE_TRANSFER_SRC_BIT |
+			VK_IMAGE_USAGE_TRANSFER_DST_BIT,
+		.sharingMode = VK_SHARING_MODE_EXCLUSIVE,
+		.queueFamilyIndexCount = 0u,
+		.pQueueFamilyIndices = RAW_NULL_PTR,
+		.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED
+	};
+
+	VkImageSubresourceRange subresource_range = {
+		VK_IMAGE_ASPECT_COLOR_BIT, 0u, 1u, 0u, 1u
+	};
+
+	uint32_t unused_image;
+
+	bool result = rawCreateVulkanRenderGraphTransientImage(&render_graph,
+			&image_create_info, &subresource_range, &resources.image) &&
+		rawCreateVulkanRenderGraphTransientImage(&render_graph,
+			&image_create_info, &subresource_range, &unused_image) &&
+		rawImportVulkanRenderGraphBuffer(&render_graph, readback_buffer,
+			0, 0, &resources.buffer);
+
+	RAW_ASSERT(result, "Render graph resource declaration failed!");
+
+	RawVulkanRenderGraphAccess clear_accesses[] = {
+		{ resources.image, VK_PIPELINE_STAGE_TRANSFER_BIT,
+			VK_ACCESS_TRANSFER_WRITE_BIT,
+			VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL }
+	};
+
+	RawVulkanRenderGraphAccess unused_accesses[] = {
+		{ unused_image, VK_PIPELINE_STAGE_TRANSFER_BIT,
+			VK_ACCESS_TRANSFER_WRITE_BIT,
+			VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL }
+	};
+
+	RawVulkanRenderGraphAccess copy_accesses[] = {
+		{ resources.image, VK_PIPELINE_STAGE_TRANSFER_BIT,
+			VK_ACCESS_TRANSFER_READ_BIT,
+			VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL },
+		{ resources.buffer, VK_PIPELINE_STAGE_TRANSFER_BIT,
+			VK_ACCESS_TRANSFER_WRITE_BIT, VK_IMAGE_LAYOUT_UNDEFINED }
+	};
+
+	RawVulkanRenderGraphAccess host_accesses[] = {
+		{ resources.buffer, VK_PIPELINE_STAGE_HOST_BIT,
+			VK_ACCESS_HOST_READ_BIT, VK_IMAGE_LAYOUT_UNDEFINED }
+	};
+
+	uint32_t clear_pass, unused_pass, copy_pass, host_pass;
+
+	result = rawAddVulkanRenderGraphPass(&render_graph, "clear",
+			clear_accesses, 1u, testRenderGraphClear, &resources,
+			false, &clear_pass) &&
+		rawAddVulkanRenderGraphPass(&render_graph, "unused",
+			unused_accesses, 1u, testRenderGraphClear, &resources,
+			false, &unused_pass) &&
+		rawAddVulkanRenderGraphPass(&render_graph, "copy",
+			copy_accesses, 2u, testRenderGraphCopy, &resources,
+			false, &copy_pass) &&
+		rawAddVulkanRenderGraphPass(&render_graph, "host",
+			host_accesses, 1u, RAW_NULL_PTR, RAW_NULL_PTR,
+			true, &host_pass);
+
+	RAW_ASSERT(result, "rawAddVulkanRenderGraphPass failed!");
+
+	result = rawCompileVulkanRenderGraph(context.logical_device,
+		&context.memory_properties, &render_graph);
+
+	RAW_ASSERT(result, "rawCompileVulkanRenderGraph failed!");
+
+	RAW_ASSERT(render_graph.passes[unused_pass].culled,
+		"Pass with unused results was not culled!");
+	RAW_ASSERT(!render_graph.passes[clear_pass].culled &&
+		!render_graph.passes[copy_pass].culled,
+		"Pass with used results was culled!");
+
+	RawVulkanCommandAllocator command_allocator;
+
+	result = rawCreateVulkanCommandAllocator(context.logical_device,
+		context.graphics_queue_family_index, 1u, 1u, &command_allocator);
+
+	RAW_ASSERT(result, "rawCreateVulkanCommandAllocator failed!");
+
+	VkCommandBuffer command_buffer;
+
+	result = rawAllocateVulkanCommandBuffer(context.logical_device,
+		&command_allocator, 0u, 0u, VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+		&command_buffer);
+
+	RAW_ASSERT(result, "rawAllocateVulkanCommandBuffer failed!");
+
+	VkCommandBufferBeginInfo begin_info = {
+		.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
+		.pInheritanceInfo = RAW_NULL_PTR
+	};
+
+	vkBeginCommandBuffer(command_buffer, &begin_info);
+	rawCmdExecuteVulkanRenderGraph(&render_graph, command_buffer);
+	vkEndCommandBuffer(command_buffer);
+
+	VkSubmitInfo submit_info = {
+		.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+		.pNext = RAW_NULL_PTR,
+		.waitSemaphoreCount = 0u,
+		.pWaitSemaphores = RAW_NULL_PTR,
+		.pWaitDstStageMask = RAW_NULL_PTR,
+		.commandBufferCount = 1u,
+		.pCommandBuffers = &command_buffer,
+		.signalSemaphoreCount = 0u,
+		.pSignalSemaphores = RAW_NULL_PTR
+	};
+
+	VkResult vk_result = vkQueueSubmit(context.graphics_queue,
+		1u, &submit_info, VK_NULL_HANDLE);
+
+	RAW_ASSERT(vk_result == VK_SUCCESS, "vkQueueSubmit failed!");
+
+	vkQueueWaitIdle(context.graphics_queue);
+
+	uint8_t* texels;
+
+	vk_result = vkMapMemory(context.logical_device, readback_memory,
+		0u, VK_WHOLE_SIZE, 0, (void**)&texels);
+
+	RAW_ASSERT(vk_result == VK_SUCCESS, "vkMapMemory failed!");
+
+	RAW_ASSERT(texels[0] == 255u && texels[1] == 0u &&
+		texels[2] == 255u && texels[3] == 255u,
+		"Render graph result doesn't match the clear color!");
+
+	vkUnmapMemory(context.logical_device, readback_memory);
+
+	rawDestroyVulkanCommandAllocator(
+		context.logical_device, &command_allocator);
+
+	rawDestroyVulkanRenderGraph(context.logical_device, &render_graph);
+
+	destroyTestReadbackBuffer(&context, &readback_buffer, &readback_memory);
+
+	destroyTestVulkanContext(&context);
+
+	RAW_LOG_CMSG(RAW_LOG_GREEN, "Test succeeded!\n\n");
+}
+
+void testVulkanResourceStateTracker() {
+	RAW_LOG_CMSG(RAW_LOG_BLUE,
+		"Running RAW Vulkan resource state tracker test...\n");
+
+	RawTestVulkanContext context;
+	createTestVulkanContext(&context);
+
+	RawTestRenderTarget target;
+	createTestRenderTarget(&context, 4u, 4u, &target);
+
+	VkBuffer readback_buffer;
+	VkDeviceMemory readback_memory;
+
+	createTestReadbackBuffer(&context, 4u * 4u * 4u,
+		&readback_buffer, &readback_memory);
+
+	RawVulkanTrackedImage tracked_image;
+	RawVulkanTrackedBuffer tracked_buffer;
+
+	bool result = rawCreateVulkanTrackedImage(target.image,
+			VK_IMAGE_ASPECT_COLOR_BIT, 1u, 1u, VK_IMAGE_LAYOUT_UNDEFINED,
+			&tracked_image) &&
+		rawCreateVulkanTrackedBuffer(readback_buffer, 4u * 4u * 4u,
+			&tracked_buffer);
+
+	RAW_ASSERT(result, "Tracked resource creation failed!");
+
+	RawVulkanResourceStateTracker tracker;
+	rawCreateVulkanResourceStateTracker(&tracker);
+
+	RawVulkanCommandAllocator command_allocator;
+
+	result = rawCreateVulkanCommandAllocator(context.logical_device,
+		context.graphics_queue_family_index, 1u, 1u, &command_allocator);
+
+	RAW_ASSERT(result, "rawCreateVulkanCommandAllocator failed!");
+
+	VkCommandBuffer command_buffer;
+
+	result = rawAllocateVulkanCommandBuffer(context.logical_device,
+		&command_allocator, 0u, 0u, VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+		&command_buffer);
+
+	RAW_ASSERT(result, "rawAllocateVulkanCommandBuffer failed!");
+
+	VkCommandBufferBeginInfo begin_info = {
+		.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
+		.pInheritanceInfo = RAW_NULL_PTR
+	};
+
+	vkBeginCommandBuffer(command_buffer, &begin_info);
+
+	VkImageSubresourceRange subresource_range = {
+		VK_IMAGE_ASPECT_COLOR_BIT, 0u, 1u, 0u, 1u
+	};
+
+	// Clear
+	rawRequireVulkanImageState(&tracker, command_buffer, &tracked_image,
+		&subresource_range, VK_PIPELINE_STAGE_TRANSFER_BIT,
+		VK_ACCESS_TRANSFER_WRITE_BIT, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+	rawCmdFlushVulkanBarriers(&tracker, command_buffer);
+
+	VkClearColorValue color = { .float32 = { 0.0f, 1.0f, 1.0f, 1.0f } };
+
+	vkCmdClearColorImage(command_buffer, target.image,
+		VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, &color,
+		1u, &subresource_range);
+
+	// Copy, with both barriers batched
+	rawRequireVulkanImageState(&tracker, command_buffer, &tracked_image,
+		&subresource_range, VK_PIPELINE_STAGE_TRANSFER_BIT,
+		VK_ACCESS_TRANSFER_READ_BIT, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
+	rawRequireVulkanBufferState(&tracker, command_buffer, &tracked_buffer,
+		0u, VK_WHOLE_SIZE, VK_PIPELINE_STAGE_TRANSFER_BIT,
+		VK_ACCESS_TRANSFER_WRITE_BIT);
+	rawCmdFlushVulkanBarriers(&tracker, command_buffer);
+
+	VkBufferImageCopy region = {
+		.bufferOffset = 0u,
+		.bufferRowLength = 0u,
+		.bufferImageHeight = 0u,
+		.imageSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, 0u, 0u, 1u },
+		.imageOffset = { 0, 0, 0 },
+		.imageExtent = { 4u, 4u, 1u }
+	};
+
+	vkCmdCopyImageToBuffer(command_buffer, target.image,
+		VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, readback_buffer, 1u, &region);
+
+	// The image is already readable by transfers
+	rawRequireVulkanImageState(&tracker, command_buffer, &tracked_image,
+		&subresource_range, VK_PIPELINE_STAGE_TRANSFER_BIT,
+		VK_ACCESS_TRANSFER_READ_BIT, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
+	rawRequireVulkanBufferState(&tracker, command_buffer, &tracked_buffer,
+		0u, VK_WHOLE_SIZE, VK_PIPELINE_STAGE_HOST_BIT,
+		VK_ACCESS_HOST_READ_BIT);
+	rawCmdFlushVulkanBarriers(&tracker, command_buffer);
+
+	vkEndCommandBuffer(command_buffer);
+
+	RAW_ASSERT(tracker.n_requests == 5u, "Unexpected request count!");
+	RAW_ASSERT(tracker.n_redundant_requests == 2u,
+		"Redundant transitions weren't eliminated!");
+	RAW_ASSERT(tracker.n_flushes == 3u, "Barriers weren't batched!");
+
+	VkSubmitInfo submit_info = {
+		.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+		.pNext = RAW_NULL_PTR,
+		.waitSemaphoreCount = 0u,
+		.pWaitSemaphores = RAW_NULL_PTR,
+		.pWaitDstStageMask = RAW_NULL_PTR,
+		.commandBufferCount = 1u,
+		.pCommandBuffers = &command_buffer,
+		.signalSemaphoreCount = 0u,
+		.pSignalSemaphores = RAW_NULL_PTR
+	};
+
+	VkResult vk_result = vkQueueSubmit(context.graphics_queue,
+		1u, &submit_info, VK_NULL_HANDLE);
+
+	RAW_ASSERT(vk_result == VK_SUCCESS, "vkQueueSubmit failed!");
+
+	vkQueueWaitIdle(context.graphics_queue);
+
+	uint8_t* texels;
+
+	vk_result = vkMapMemory(context.logical_device, readback_memory,
+		0u, VK_WHOLE_SIZE, 0, (void**)&texels);
+
+	RAW_ASSERT(vk_result == VK_SUCCESS, "vkMapMemory failed!");
+
+	RAW_ASSERT(texels[0] == 0u && texels[1] == 255u &&
+		texels[2] == 255u && texels[3] == 255u,
+		"Copied texels don't match the clear color!");
+
+	vkUnmapMemory(context.logical_device, readback_memory);
+
+	rawDestroyVulkanCommandAllocator(
+		context.logical_device, &command_allocator);
+
+	rawDestroyVulkanResourceStateTracker(&tracker);
+	rawDestroyVulkanTrackedBuffer(&tracked_buffer);
+	rawDestroyVulkanTrackedImage(&tracked_image);
+
+	destroyTestReadbackBuffer(&context, &readback_buffer, &readback_memory);
+	destroyTestRenderTarget(&context, &target);
+	destroyTestVulkanContext(&context);
+
+	RAW_LOG_CMSG(RAW_LOG_GREEN, "Test succeeded!\n\n");
+}
+
+void testVulkanAsyncCompute() {
+	RAW_LOG_CMSG(RAW_LOG_BLUE,
+		"Running RAW Vulkan async compute test...\n");
+
+	RawTestVulkanContext context;
+	createTestVulkanContext(&context);
+
+	RawVulkanQueueTimeline graphics_timeline;
+
+	bool result = rawCreateVulkanQueueTimeline(context.logical_device,
+		context.graphics_queue, context.timeline_semaphore_enabled,
+		&graphics_timeline);
+
+	RAW_ASSERT(result, "rawCreateVulkanQueueTimeline failed!");
+
+	RawVulkanAsyncCompute async_compute;
+
+	result = rawCreateVulkanAsyncCompute(context.logical_device,
+		context.graphics_queue_family_index, &graphics_timeline,
+		context.compute_queue_family_index, context.compute_queue,
+		context.timeline_semaphore_enabled, &async_compute);
+
+	RAW_ASSERT(result, "rawCreateVulkanAsyncCompute failed!");
+	RAW_ASSERT(async_compute.separate_queue ==
+		(context.compute_queue != context.graphics_queue),
+		"Async compute queue mismatch!");
+
+	RAW_LOG_INFO("Async compute: separate queue %d, "
+		"ownership transfer %d", async_compute.separate_queue,
+		async_compute.ownership_transfer);
+
+	RawVulkanCommandAllocator graphics_allocator;
+	RawVulkanCommandAllocator compute_allocator;
+
+	result = rawCreateVulkanCommandAllocator(context.logical_device,
+			context.graphics_queue_family_index, 1u, 1u,
+			&graphics_allocator) &&
+		rawCreateVulkanCommandAllocator(context.logical_device,
+			context.compute_queue_family_index, 1u, 1u,
+			&compute_allocator);
+
+	RAW_ASSERT(result, "rawCreateVulkanCommandAllocator failed!");
+
+	VkCommandBuffer graphics_command_buffer;
+	VkCommandBuffer compute_command_buffer;
+
+	result = rawAllocateVulkanCommandBuffer(context.logical_device,
+			&graphics_allocator, 0u, 0u, VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+			&graphics_command_buffer) &&
+		rawAllocateVulkanCommandBuffer(context.logical_device,
+			&compute_allocator, 0u, 0u, VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+			&compute_command_buffer);
+
+	RAW_ASSERT(result, "rawAllocateVulkanCommandBuffer failed!");
+
+	VkBuffer compute_buffer;
+	VkDeviceMemory compute_memory;
+	VkBuffer readback_buffer;
+	VkDeviceMemory readback_memory;
+
+	createTestReadbackBuffer(&context, 256u,
+		&compute_buffer, &compute_memory);
+	createTestReadbackBuffer(&context, 256u,
+		&readback_buffer, &readback_memory);
+
+	RawVulkanQueueTransfer transfer = {
+		.buffer = compute_buffer,
+		.offset = 0u,
+		.size = VK_WHOLE_SIZE,
+		.image = VK_NULL_HANDLE,
+		.src_stages = VK_PIPELINE_STAGE_TRANSFER_BIT,
+		.src_access = VK_ACCESS_TRANSFER_WRITE_BIT,
+		.dst_stages = VK_PIPELINE_STAGE_TRANSFER_BIT,
+		.dst_access = VK_ACCESS_TRANSFER_READ_BIT
+	};
+
+	VkCommandBufferBeginInfo begin_info = {
+		.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
+		.pInheritanceInfo = RAW_NULL_PTR
+	};
+
+	// Compute produces the data and hands the buffer to graphics
+	vkBeginCommandBuffer(compute_command_buffer, &begin_info);
+
+	vkCmdFillBuffer(compute_command_buffer, compute_buffer,
+		0u, VK_WHOLE_SIZE, 0xa5a5a5a5u);
+
+	result = rawCmdReleaseVulkanQueueOwnership(&async_compute,
+		compute_command_buffer, RAW_VULKAN_COMPUTE_TO_GRAPHICS,
+		&transfer, 1u);
+
+	RAW_ASSERT(result, "rawCmdReleaseVulkanQueueOwnership failed!");
+
+	vkEndCommandBuffer(compute_command_buffer);
+
+	VkSubmitInfo submit_info = {
+		.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+		.pNext = RAW_NULL_PTR,
+		.waitSemaphoreCount = 0u,
+		.pWaitSemaphores = RAW_NULL_PTR,
+		.pWaitDstStageMask = RAW_NULL_PTR,
+		.commandBufferCount = 1u,
+		.pCommandBuffers = &compute_command_buffer,
+		.signalSemaphoreCount = 0u,
+		.pSignalSemaphores = RAW_NULL_PTR
+	};
+
+	RawVulkanTimelinePoint compute_done;
+
+	result = rawSubmitVulkanAsyncCompute(context.logical_device,
+		&async_compute, &submit_info, RAW_NULL_PTR, RAW_NULL_PTR, 0u,
+		&compute_done);
+
+	RAW_ASSERT(result, "rawSubmitVulkanAsyncCompute failed!");
+
+	// Graphics consumes it
+	vkBeginCommandBuffer(graphics_command_buffer, &begin_info);
+
+	result = rawCmdAcquireVulkanQueueOwnership(&async_compute,
+		graphics_command_buffer, RAW_VULKAN_COMPUTE_TO_GRAPHICS,
+		&transfer, 1u);
+
+	RAW_ASSERT(result, "rawCmdAcquireVulkanQueueOwnership failed!");
+
+	VkBufferCopy region = { 0u, 0u, 256u };
+
+	vkCmdCopyBuffer(graphics_command_buffer, compute_buffer,
+		readback_buffer, 1u, &region);
+
+	VkMemoryBarrier host_barrier = {
+		.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER,
+		.pNext = RAW_NULL_PTR,
+		.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+		.dstAccessMask = VK_ACCESS_HOST_READ_BIT
+	};
+
+	vkCmdPipelineBarrier(graphics_command_buffer,
+		VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT, 0,
+		1u, &host_barrier, 0u, RAW_NULL_PTR, 0u, RAW_NULL_PTR);
+
+	vkEndCommandBuffer(graphics_command_buffer);
+
+	submit_info.pCommandBuffers = &graphics_command_buffer;
+
+	VkPipelineStageFlags wait_stage = VK_PIPELINE_STAGE_TRANSFER_BIT;
+	uint64_t graphics_done;
+
+	result = rawSubmitVulkanQueueTimeline(context.logical_device,
+		&graphics_timeline, &submit_info, &compute_done, &wait_stage, 1u,
+		&graphics_done);
+
+	RAW_ASSERT(result, "rawSubmitVulkanQueueTimeline failed!");
+
+	result = rawWaitVulkanQueueTimeline(context.logical_device,
+		&graphics_timeline, graphics_done, UINT64_MAX);
+
+	RAW_ASSERT(result, "rawWaitVulkanQueueTimeline failed!");
+	RAW_ASSERT(rawIsVulkanTimelinePointCompleted(
+		context.logical_device, &compute_done),
+		"Graphics finished before the compute work it waited on!");
+
+	uint32_t* data;
+
+	VkResult vk_result = vkMapMemory(context.logical_device,
+		readback_memory, 0u, VK_WHOLE_SIZE, 0, (void**)&data);
+
+	RAW_ASSERT(vk_result == VK_SUCCESS, "vkMapMemory failed!");
+
+	for (uint32_t i = 0; i < 256u / sizeof(uint32_t); ++i)
+		RAW_ASSERT(data[i] == 0xa5a5a5a5u,
+			"Graphics didn't see the compute results!");
+
+	vkUnmapMemory(context.logical_device, readback_memory);
+
+	destroyTestReadbackBuffer(&context, &readback_buffer, &readback_memory);
+	destroyTestReadbackBuffer(&context, &compute_buffer, &compute_memory);
+
+	rawDestroyVulkanCommandAllocator(
+		context.logical_device, &compute_allocator);
+	rawDestroyVulkanCommandAllocator(
+		context.logical_device, &graphics_allocator);
+
+	rawDestroyVulkanAsyncCompute(context.logical_device, &async_compute);
+	rawDestroyVulkanQueueTimeline(context.logical_device, &graphics_timeline);
+
+	destroyTestVulkanContext(&context);
+
+	RAW_LOG_CMSG(RAW_LOG_GREEN, "Test succeeded!\n\n");
+}
+
+void testVulkanOffscreenSwapchain() {
+	RAW_LOG_CMSG(RAW_LOG_BLUE,
+		"Running RAW Vulkan offscreen swapchain test...\n");
+
+	RawTestVulkanContext context;
+	createTestVulkanContext(&context);
+
+	RawVulkanOffscreenSwapchain swapchain;
+
+	bool result = rawCreateVulkanOffscreenSwapchain(context.physical_device,
+		context.logical_device, context.graphics_queue_family_index,
+		context.graphics_queue, VK_FORMAT_R8G8B8A8_UNORM,
+		VK_IMAGE_USAGE_TRANSFER_DST_BIT,
+		VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, 16u, 16u, 3u, true,
+		&swapchain);
+
+	RAW_ASSERT(result, "rawCreateVulkanOffscreenSwapchain failed!");
+
+	RawVulkanCommandAllocator command_allocator;
+
+	result = rawCreateVulkanCommandAllocator(context.logical_device,
+		context.graphics_queue_family_index, 1u, 3u, &command_allocator);
+
+	RAW_ASSERT(result, "rawCreateVulkanCommandAllocator failed!");
+
+	VkSemaphoreCreateInfo semaphore_create_info = {
+		.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = 0
+	};
+
+	// One pair per image, free again once the image is reacquired
+	VkSemaphore image_acquired_semaphores[3];
+	VkSemaphore render_finished_semaphores[3];
+
+	for (uint32_t i = 0; i < 3u; ++i) {
+		VkResult vk_result = vkCreateSemaphore(context.logical_device,
+			&semaphore_create_info, RAW_NULL_PTR,
+			&image_acquired_semaphores[i]);
+
+		vk_result |= vkCreateSemaphore(context.logical_device,
+			&semaphore_create_info, RAW_NULL_PTR,
+			&render_finished_semaphores[i]);
+
+		RAW_ASSERT(vk_result == VK_SUCCESS, "vkCreateSemaphore failed!");
+	}
+
+	uint32_t n_frames_read = 0u;
+	uint64_t next_frame_number = 0u;
+
+	for (uint32_t i = 0; i <= 6u; ++i) {
+		uint32_t image_index = 0u;
+		bool image_acquired = true;
+
+		if (i < 6u) {
+			result = rawAcquireNextVulkanOffscreenImage(
+				context.logical_device, &swapchain, UINT64_MAX,
+				image_acquired_semaphores[i % 3u], VK_NULL_HANDLE,
+				&image_index, &image_acquired);
+
+			RAW_ASSERT(result && image_acquired,
+				"rawAcquireNextVulkanOffscreenImage failed!");
+			uint32_t expected_image_index = i % 3u;
+
+			RAW_ASSERT(image_index == expected_image_index,
+				"Offscreen images acquired out of order!");
+		}
+		else
+			vkDeviceWaitIdle(context.logical_device);
+
+		// Frames are polled without ever waiting for the GPU
+		RawVulkanOffscreenFrame frame;
+		bool frame_read = true;
+
+		while (frame_read) {
+			result = rawReadVulkanOffscreenFrame(context.logical_device,
+				&swapchain, &frame, &frame_read);
+
+			RAW_ASSERT(result, "rawReadVulkanOffscreenFrame failed!");
+
+			if (!frame_read)
+				continue;
+
+			RAW_ASSERT(frame.frame_number == next_frame_number,
+				"Offscreen frames read out of order!");
+			RAW_ASSERT(frame.size == 16u * 16u * 4u &&
+				frame.row_pitch == 16u * 4u, "Unexpected frame size!");
+
+			uint8_t const* texels = frame.data;
+
+			for (uint32_t j = 0; j < frame.size; j += 4u)
+				RAW_ASSERT(texels[j] == 16u * (frame.frame_number + 1u),
+					"Offscreen frame has wrong contents!");
+
+			++next_frame_number;
+			++n_frames_read;
+		}
+
+		if (i == 6u)
+			break;
+
+		result = rawResetVulkanCommandAllocatorFrame(context.logical_device,
+			&command_allocator, image_index, VK_NULL_HANDLE);
+
+		RAW_ASSERT(result, "rawResetVulkanCommandAllocatorFrame failed!");
+
+		VkCommandBuffer command_buffer;
+
+		result = rawAllocateVulkanCommandBuffer(context.logical_device,
+			&command_allocator, image_index, 0u,
+			VK_COMMAND_BUFFER_LEVEL_PRIMARY, &command_buffer);
+
+		RAW_ASSERT(result, "rawAllocateVulkanCommandBuffer failed!");
+
+		VkCommandBufferBeginInfo begin_info = {
+			.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+			.pNext = RAW_NULL_PTR,
+			.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
+			.pInheritanceInfo = RAW_NULL_PTR
+		};
+
+		vkBeginCommandBuffer(command_buffer, &begin_info);
+
+		VkImageSubresourceRange subresource_range = {
+			VK_IMAGE_ASPECT_COLOR_BIT, 0u, 1u, 0u, 1u
+		};
+
+		VkImageMemoryBarrier barrier = {
+			.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+			.pNext = RAW_NULL_PTR,
+			.srcAccessMask = 0,
+			.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+			.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+			.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+			.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+			.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+			.image = swapchain.images[image_index],
+			.subresourceRange = subresource_range
+		};
+
+		vkCmdPipelineBarrier(command_buffer,
+			VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+			0, 0u, RAW_NULL_PTR, 0u, RAW_NULL_PTR, 1u, &barrier);
+
+		// k / 255 is stored exactly as k in UNORM
+		float value = (float)(16u * (i + 1u)) / 255.0f;
+		VkClearColorValue color = {
+			.float32 = { value, value, value, 1.0f }
+		};
+
+		vkCmdClearColorImage(command_buffer, swapchain.images[image_index],
+			VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, &color,
+			1u, &subresource_range);
+
+		barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+		barrier.dstAccessMask = 0;
+		barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+		barrier.newLayout = swapchain.present_layout;
+
+		vkCmdPipelineBarrier(command_buffer,
+			VK_PIPELINE_STAGE_TRANSFER_BIT,
+			VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+			0, 0u, RAW_NULL_PTR, 0u, RAW_NULL_PTR, 1u, &barrier);
+
+		vkEndCommandBuffer(command_buffer);
+
+		VkPipelineStageFlags wait_stage = VK_PIPELINE_STAGE_TRANSFER_BIT;
+
+		VkSubmitInfo submit_info = {
+			.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+			.pNext = RAW_NULL_PTR,
+			.waitSemaphoreCount = 1u,
+			.pWaitSemaphores = &image_acquired_semaphores[image_index],
+			.pWaitDstStageMask = &wait_stage,
+			.commandBufferCount = 1u,
+			.pCommandBuffers = &command_buffer,
+			.signalSemaphoreCount = 1u,
+			.pSignalSemaphores = &render_finished_semaphores[image_index]
+		};
+
+		VkResult vk_result = vkQueueSubmit(context.graphics_queue,
+			1u, &submit_info, VK_NULL_HANDLE);
+
+		RAW_ASSERT(vk_result == VK_SUCCESS, "vkQueueSubmit failed!");
+
+		result = rawQueuePresentVulkanOffscreen(context.logical_device,
+			&swapchain, &render_finished_semaphores[image_index], 1u,
+			image_index);
+
+		RAW_ASSERT(result, "rawQueuePresentVulkanOffscreen failed!");
+	}
+
+	// Each acquisition finished the frame read right before presenting
+	RAW_ASSERT(n_frames_read == 6u && swapchain.n_dropped_frames == 0u,
+		"Offscreen frames were lost!");
+
+	for (uint32_t i = 0; i < 3u; ++i) {
+		vkDestroySemaphore(context.logical_device,
+			image_acquired_semaphores[i], RAW_NULL_PTR);
+		vkDestroySemaphore(context.logical_device,
+			render_finished_semaphores[i], RAW_NULL_PTR);
+	}
+
+	rawDestroyVulkanCommandAllocator(
+		context.logical_device, &command_allocator);
+	rawDestroyVulkanOffscreenSwapchain(context.logical_device, &swapchain);
+
+	destroyTestVulkanContext(&context);
+
+	RAW_LOG_CMSG(RAW_LOG_GREEN, "Test succeeded!\n\n");
+}
+
+void testVulkanReadbackQueue() {
+	RAW_LOG_CMSG(RAW_LOG_BLUE,
+		"Running RAW Vulkan readback queue test...\n");
+
+	RawTestVulkanContext context;
+	createTestVulkanContext(&context);
+
+	RawVulkanQueueTimeline timeline;
+
+	bool result = rawCreateVulkanQueueTimeline(context.logical_device,
+		context.graphics_queue, context.timeline_semaphore_enabled,
+		&timeline);
+
+	RAW_ASSERT(result, "rawCreateVulkanQueueTimeline failed!");
+
+	RawVulkanReadbackQueue readback_queue;
+
+	result = rawCreateVulkanReadbackQueue(context.logical_device,
+		&context.memory_properties, 2u, 1024u, &readback_queue);
+
+	RAW_ASSERT(result, "rawCreateVulkanReadbackQueue failed!");
+
+	RawVulkanCommandAllocator command_allocator;
+
+	result = rawCreateVulkanCommandAllocator(context.logical_device,
+		context.graphics_queue_family_index, 1u, 1u, &command_allocator);
+
+	RAW_ASSERT(result, "rawCreateVulkanCommandAllocator failed!");
+
+	VkCommandBuffer command_buffer;
+
+	result = rawAllocateVulkanCommandBuffer(context.logical_device,
+		&command_allocator, 0u, 0u, VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+		&command_buffer);
+
+	RAW_ASSERT(result, "rawAllocateVulkanCommandBuffer failed!");
+
+	VkBuffer buffer;
+	VkDeviceMemory buffer_memory;
+
+	createTestReadbackBuffer(&context, 256u, &buffer, &buffer_memory);
+
+	RawTestRenderTarget target;
+	createTestRenderTarget(&context, 4u, 4u, &target);
+
+	VkCommandBufferBeginInfo begin_info = {
+		.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
+		.pInheritanceInfo = RAW_NULL_PTR
+	};
+
+	vkBeginCommandBuffer(command_buffer, &begin_info);
+
+	vkCmdFillBuffer(command_buffer, buffer, 0u, VK_WHOLE_SIZE, 0x12345678u);
+
+	RawVulkanReadbackFuture buffer_future;
+
+	result = rawRecordVulkanBufferReadback(context.logical_device,
+		&readback_queue, command_buffer, buffer, 64u, 128u,
+		VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT,
+		&buffer_future);
+
+	RAW_ASSERT(result, "rawRecordVulkanBufferReadback failed!");
+
+	VkImageSubresourceRange subresource_range = {
+		VK_IMAGE_ASPECT_COLOR_BIT, 0u, 1u, 0u, 1u
+	};
+
+	VkImageMemoryBarrier barrier = {
+		.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+		.pNext = RAW_NULL_PTR,
+		.srcAccessMask = 0,
+		.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+		.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+		.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+		.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+		.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+		.image = target.image,
+		.subresourceRange = subresource_range
+	};
+
+	vkCmdPipelineBarrier(command_buffer,
+		VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+		0, 0u, RAW_NULL_PTR, 0u, RAW_NULL_PTR, 1u, &barrier);
+
+	VkClearColorValue color = { .float32 = { 0.0f, 1.0f, 0.0f, 1.0f } };
+
+	vkCmdClearColorImage(command_buffer, target.image,
+		VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, &color,
+		1u, &subresource_range);
+
+	barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+	barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+	barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+	barrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+
+	vkCmdPipelineBarrier(command_buffer,
+		VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+		0, 0u, RAW_NULL_PTR, 0u, RAW_NULL_PTR, 1u, &barrier);
+
+	VkImageSubresourceLayers subresource = {
+		VK_IMAGE_ASPECT_COLOR_BIT, 0u, 0u, 1u
+	};
+
+	RawVulkanReadbackFuture image_future;
+
+	result = rawRecordVulkanImageReadback(context.logical_device,
+		&readback_queue, command_buffer, target.image,
+		VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, &subresource,
+		(VkOffset3D){ 0, 0, 0 }, (VkExtent3D){ 4u, 4u, 1u }, 4u,
+		VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT,
+		&image_future);
+
+	RAW_ASSERT(result, "rawRecordVulkanImageReadback failed!");
+
+	// Every staging buffer is taken
+	RawVulkanReadbackFuture extra_future;
+
+	result = rawRecordVulkanBufferReadback(context.logical_device,
+		&readback_queue, command_buffer, buffer, 0u, 4u,
+		VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT,
+		&extra_future);
+
+	RAW_ASSERT(!result, "Readback queue handed out too many buffers!");
+
+	vkEndCommandBuffer(command_buffer);
+
+	VkSubmitInfo submit_info = {
+		.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+		.pNext = RAW_NULL_PTR,
+		.waitSemaphoreCount = 0u,
+		.pWaitSemaphores = RAW_NULL_PTR,
+		.pWaitDstStageMask = RAW_NULL_PTR,
+		.commandBufferCount = 1u,
+		.pCommandBuffers = &command_buffer,
+		.signalSemaphoreCount = 0u,
+		.pSignalSemaphores = RAW_NULL_PTR
+	};
+
+	RawVulkanTimelinePoint completion = { &timeline, 0u };
+
+	result = rawSubmitVulkanQueueTimeline(context.logical_device,
+		&timeline, &submit_info, RAW_NULL_PTR, RAW_NULL_PTR, 0u,
+		&completion.value);
+
+	RAW_ASSERT(result, "rawSubmitVulkanQueueTimeline failed!");
+
+	rawSubmitVulkanReadbacks(&readback_queue, &completion);
+
+	// Polled like a frame loop would, never waiting on the queue
+	bool buffer_ready = false;
+	bool image_ready = false;
+	void const* buffer_data = RAW_NULL_PTR;
+	void const* image_data = RAW_NULL_PTR;
+	VkDeviceSize buffer_size = 0u;
+	VkDeviceSize image_size = 0u;
+
+	while (!buffer_ready || !image_ready) {
+		result = rawPollVulkanReadback(context.logical_device,
+				&readback_queue, &buffer_future, &buffer_ready,
+				&buffer_data, &buffer_size) &&
+			rawPollVulkanReadback(context.logical_device,
+				&readback_queue, &image_future, &image_ready,
+				&image_data, &image_size);
+
+		RAW_ASSERT(result, "rawPollVulkanReadback failed!");
+
+		if (!buffer_ready || !image_ready)
+			rawPlatformSleep(100000u);
+	}
+
+	RAW_ASSERT(buffer_size == 128u && image_size == 64u,
+		"Unexpected readback sizes!");
+
+	uint32_t const* words = buffer_data;
+
+	for (uint32_t i = 0; i < 128u / sizeof(uint32_t); ++i)
+		RAW_ASSERT(words[i] == 0x12345678u, "Buffer readback mismatch!");
+
+	uint8_t const* texels = image_data;
+
+	for (uint32_t i = 0; i < 64u; i += 4u) {
+		RAW_ASSERT(texels[i] == 0u && texels[i + 1u] == 255u &&
+			texels[i + 2u] == 0u && texels[i + 3u] == 255u,
+			"Image readback mismatch!");
+	}
+
+	rawReleaseVulkanReadback(context.logical_device,
+		&readback_queue, &buffer_future);
+	rawReleaseVulkanReadback(context.logical_device,
+		&readback_queue, &image_future);
+
+	RAW_ASSERT(readback_queue.n_free_slots == 2u,
+		"Readback staging buffers weren't released!");
+
+	destroyTestRenderTarget(&context, &target);
+	destroyTestReadbackBuffer(&context, &buffer, &buffer_memory);
+
+	rawDestroyVulkanCommandAllocator(
+		context.logical_device, &command_allocator);
+	rawDestroyVulkanReadbackQueue(context.logical_device, &readback_queue);
+	rawDestroyVulkanQueueTimeline(context.logical_device, &timeline);
+
+	destroyTestVulkanContext(&context);
+
+	RAW_LOG_CMSG(RAW_LOG_GREEN, "Test succeeded!\n\n");
+}
+
+void testVulkanPipelineCacheStore() {
+	RAW_LOG_CMSG(RAW_LOG_BLUE,
+		"Running RAW Vulkan pipeline cache store test...\n");
+
+	char const* path = "rawTestPipelineCache.bin";
+	remove(path);
+
+	RawTestVulkanContext context;
+	createTestVulkanContext(&context);
+
+	RawVulkanPipelineCacheStore store;
+
+	// Missing file, starts empty
+	bool result = rawCreateVulkanPipelineCacheStore(context.physical_device,
+		context.logical_device, path, 2u, &store);
+
+	RAW_ASSERT(result, "rawCreateVulkanPipelineCacheStore failed!");
+	RAW_ASSERT(!store.loaded_from_disk && store.n_thread_caches == 2u,
+		"Unexpected pipeline cache store state!");
+
+	result = rawSaveVulkanPipelineCacheStore(
+		context.logical_device, &store, path);
+
+	RAW_ASSERT(result, "rawSaveVulkanPipelineCacheStore failed!");
+
+	rawDestroyVulkanPipelineCacheStore(context.logical_device, &store);
+
+	// The saved file belongs to this device
+	result = rawCreateVulkanPipelineCacheStore(context.physical_device,
+		context.logical_device, path, 0u, &store);
+
+	RAW_ASSERT(result, "rawCreateVulkanPipelineCacheStore failed!");
+	RAW_ASSERT(store.loaded_from_disk, "Saved pipeline cache was rejected!");
+
+	RawFileMapping mapping;
+	result = rawMapFile(path, &mapping);
+
+	RAW_ASSERT(result && rawValidateVulkanPipelineCacheHeader(
+		&store, mapping.data, mapping.size), "Invalid saved header!");
+
+	// Same file, as if written by another device
+	uint8_t header[RAW_VULKAN_PIPELINE_CACHE_HEADER_SIZE];
+	memcpy(header, mapping.data, sizeof(header));
+	rawUnmapFile(&mapping);
+
+	header[12] ^= 0xffu;
+
+	RAW_ASSERT(!rawValidateVulkanPipelineCacheHeader(
+		&store, header, sizeof(header)), "Foreign header was accepted!");
+	RAW_ASSERT(!rawValidateVulkanPipelineCacheHeader(
+		&store, header, 16u), "Truncated header was accepted!");
+
+	result = rawWriteFileAtomic(path, header, sizeof(header));
+
+	RAW_ASSERT(result, "rawWriteFileAtomic failed!");
+
+	rawDestroyVulkanPipelineCacheStore(context.logical_device, &store);
+
+	// Rejected, but still usable
+	result = rawCreateVulkanPipelineCacheStore(context.physical_device,
+		context.logical_device, path, 1u, &store);
+
+	RAW_ASSERT(result, "rawCreateVulkanPipelineCacheStore failed!");
+	RAW_ASSERT(!store.loaded_from_disk, "Foreign pipeline cache was loaded!");
+
+	rawDestroyVulkanPipelineCacheStore(context.logical_device, &store);
+
+	destroyTestVulkanContext(&context);
+
+	remove(path);
+
+	RAW_LOG_CMSG(RAW_LOG_GREEN, "Test succeeded!\n\n");
+}
+
+/*
+ * Empty compute shader with a 1x1x1 workgroup
+ *
+ *     OpCapability Shader
+ *     OpMemoryModel Logical GLSL450
+ *     OpEntryPoint GLCompute %main "main"
+ *     OpExecutionMode %main LocalSize 1 1 1
+ */
+static uint32_t const test_compute_shader_code[] = {
+	0x07230203u, 0x00010000u, 0x00000000u, 0x00000005u, 0x00000000u,
+	0x00020011u, 0x00000001u,
+	0x0003000eu, 0x00000000u, 0x00000001u,
+	0x0005000fu, 0x00000005u, 0x00000003u, 0x6e69616du, 0x00000000u,
+	0x00060010u, 0x00000003u, 0x00000011u, 0x00000001u, 0x00000001u,
+	0x00000001u,
+	0x00020013u, 0x00000001u,
+	0x00030021u, 0x00000002u, 0x00000001u,
+	0x00050036u, 0x00000001u, 0x00000003u, 0x00000000u, 0x00000002u,
+	0x000200f8u, 0x00000004u,
+	0x000100fdu,
+	0x00010038u
+};
+
+void testVulkanPipelineCompiler() {
+	RAW_LOG_CMSG(RAW_LOG_BLUE,
+		"Running RAW Vulkan pipeline compiler test...\n");
+
+	char const* path = "rawTestPipelineCompilerCache.bin";
+	remove(path);
+
+	RawTestVulkanContext context;
+	createTestVulkanContext(&context);
+
+	RawVulkanPipelineCacheStore store;
+
+	bool result = rawCreateVulkanPipelineCacheStore(context.physical_device,
+		context.logical_device, path, 2u, &store);
+
+	RAW_ASSERT(result, "rawCreateVulkanPipelineCacheStore failed!");
+
+	RawVulkanPipelineCompiler compiler;
+
+	result = rawCreateVulkanPipelineCompiler(
+		context.logical_device, &store, 2u, 8u, &compiler);
+
+	RAW_ASSERT(result, "rawCreateVulkanPipelineCompiler failed!");
+
+	VkShaderModuleCreateInfo shader_module_create_info = {
+		.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = 0,
+		.codeSize = sizeof(test_compute_shader_code),
+		.pCode = test_compute_shader_code
+	};
+
+	VkShaderModule shader_module;
+
+	VkResult vk_result = vkCreateShaderModule(context.logical_device,
+		&shader_module_create_info, RAW_NULL_PTR, &shader_module);
+
+	RAW_ASSERT(vk_result == VK_SUCCESS, "vkCreateShaderModule failed!");
+
+	VkPipelineLayoutCreateInfo layout_create_info = {
+		.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = 0,
+		.setLayoutCount = 0u,
+		.pSetLayouts = RAW_NULL_PTR,
+		.pushConstantRangeCount = 0u,
+		.pPushConstantRanges = RAW_NULL_PTR
+	};
+
+	VkPipelineLayout pipeline_layout;
+
+	vk_result = vkCreatePipelineLayout(context.logical_device,
+		&layout_create_info, RAW_NULL_PTR, &pipeline_layout);
+
+	RAW_ASSERT(vk_result == VK_SUCCESS, "vkCreatePipelineLayout failed!");
+
+	VkComputePipelineCreateInfo create_info = {
+		.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = 0,
+		.stage = {
+			.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO,
+			.pNext = RAW_NULL_PTR,
+			.flags = 0,
+			.stage = VK_SHADER_STAGE_COMPUTE_BIT,
+			.module = shader_module,
+			.pName = "main",
+			.pSpecializationInfo = RAW_NULL_PTR
+		},
+		.layout = pipeline_layout,
+		.basePipelineHandle = VK_NULL_HANDLE,
+		.basePipelineIndex = -1
+	};
+
+	RawVulkanPipelineHandle handles[3];
+
+	for (uint32_t i = 0; i < 3u; ++i) {
+		// Two distinct states, the last one requested twice
+		result = rawRequestVulkanComputePipeline(&compiler,
+			i == 0u ? 0x1111u : 0x2222u, &create_info, &handles[i]);
+
+		RAW_ASSERT(result, "rawRequestVulkanComputePipeline failed!");
+	}
+
+	RAW_ASSERT(handles[0] != handles[1] && handles[1] == handles[2] &&
+		compiler.n_requests == 2u, "Pipeline requests weren't deduplicated!");
+
+	// Whatever the workers' progress, this must not block
+	VkPipeline pipeline = rawGetVulkanPipeline(
+		&compiler, handles[0], VK_NULL_HANDLE);
+
+	rawWaitVulkanPipelineCompilerIdle(&compiler);
+
+	for (uint32_t i = 0; i < 2u; ++i) {
+		RAW_ASSERT(rawGetVulkanPipelineStatus(&compiler, handles[i]) ==
+			RAW_VULKAN_PIPELINE_READY, "Pipeline compilation failed!");
+	}
+
+	pipeline = rawGetVulkanPipeline(&compiler, handles[0], VK_NULL_HANDLE);
+
+	RAW_ASSERT(pipeline != VK_NULL_HANDLE &&
+		pipeline != rawGetVulkanPipeline(&compiler, handles[1],
+			VK_NULL_HANDLE), "Unexpected compiled pipelines!");
+	RAW_ASSERT(rawGetVulkanPipeline(&compiler,
+		RAW_VULKAN_INVALID_PIPELINE_HANDLE, VK_NULL_HANDLE) ==
+		VK_NULL_HANDLE, "Invalid handle didn't use the fallback!");
+
+	// Merges the workers' caches
+	result = rawSaveVulkanPipelineCacheStore(
+		context.logical_device, &store, path);
+
+	RAW_ASSERT(result, "rawSaveVulkanPipelineCacheStore failed!");
+
+	rawDestroyVulkanPipelineCompiler(&compiler);
+
+	vkDestroyPipelineLayout(context.logical_device,
+		pipeline_layout, RAW_NULL_PTR);
+	vkDestroyShaderModule(context.logical_device,
+		shader_module, RAW_NULL_PTR);
+
+	rawDestroyVulkanPipelineCacheStore(context.logical_device, &store);
+
+	destroyTestVulkanContext(&context);
+
+	remove(path);
+
+	RAW_LOG_CMSG(RAW_LOG_GREEN, "Test succeeded!\n\n");
+}
+
+// Empty vertex shader, OpEntryPoint Vertex %main "main"
+static uint32_t const test_vertex_shader_code[] = {
+	0x07230203u, 0x00010000u, 0x00000000u, 0x00000005u, 0x00000000u,
+	0x00020011u, 0x00000001u,
+	0x0003000eu, 0x00000000u, 0x00000001u,
+	0x0005000fu, 0x00000000u, 0x00000003u, 0x6e69616du, 0x00000000u,
+	0x00020013u, 0x00000001u,
+	0x00030021u, 0x00000002u, 0x00000001u,
+	0x00050036u, 0x00000001u, 0x00000003u, 0x00000000u, 0x00000002u,
+	0x000200f8u, 0x00000004u,
+	0x000100fdu,
+	0x00010038u
+};
+
+/*
+ * Empty fragment shader
+ *
+ *     OpEntryPoint Fragment %main "main"
+ *     OpExecutionMode %main OriginUpperLeft
+ */
+static uint32_t const test_fragment_shader_code[] = {
+	0x07230203u, 0x00010000u, 0x00000000u, 0x00000005u, 0x00000000u,
+	0x00020011u, 0x00000001u,
+	0x0003000eu, 0x00000000u, 0x00000001u,
+	0x0005000fu, 0x00000004u, 0x00000003u, 0x6e69616du, 0x00000000u,
+	0x00030010u, 0x00000003u, 0x00000007u,
+	0x00020013u, 0x00000001u,
+	0x00030021u, 0x00000002u, 0x00000001u,
+	0x00050036u, 0x00000001u, 0x00000003u, 0x00000000u, 0x00000002u,
+	0x000200f8u, 0x00000004u,
+	0x000100fdu,
+	0x00010038u
+};
+
+VkShaderModule createTestShaderModule(RawTestVulkanContext* context,
+	uint32_t const* code, size_t code_size) {
+
+	VkShaderModuleCreateInfo create_info = {
+		.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = 0,
+		.codeSize = code_size,
+		.pCode = code
+	};
+
+	VkShaderModule shader_module;
+
+	VkResult result = vkCreateShaderModule(context->logical_device,
+		&create_info, RAW_NULL_PTR, &shader_module);
+
+	RAW_ASSERT(result == VK_SUCCESS, "vkCreateShaderModule failed!");
+
+	return shader_module;
+}
+
+void testVulkanPipelineStateMap() {
+	RAW_LOG_CMSG(RAW_LOG_BLUE,
+		"Running RAW Vulkan pipeline state map test...\n");
+
+	RawTestVulkanContext context;
+	createTestVulkanContext(&context);
+
+	RawTestRenderTarget target;
+	createTestRenderTarget(&context, 4u, 4u, &target);
+
+	VkShaderModule vertex_shader = createTestShaderModule(&context,
+		test_vertex_shader_code, sizeof(test_vertex_shader_code));
+	VkShaderModule fragment_shader = createTestShaderModule(&context,
+		test_fragment_shader_code, sizeof(test_fragment_shader_code));
+
+	VkPipelineLayoutCreateInfo layout_create_info = {
+		.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = 0,
+		.setLayoutCount = 0u,
+		.pSetLayouts = RAW_NULL_PTR,
+		.pushConstantRangeCount = 0u,
+		.pPushConstantRanges = RAW_NULL_PTR
+	};
+
+	VkPipelineLayout pipeline_layout;
+
+	VkResult vk_result = vkCreatePipelineLayout(context.logical_device,
+		&layout_create_info, RAW_NULL_PTR, &pipeline_layout);
+
+	RAW_ASSERT(vk_result == VK_SUCCESS, "vkCreatePipelineLayout failed!");
+
+	RawVulkanPipelineState states[3];
+
+	for (uint32_t i = 0; i < 3u; ++i) {
+		RawVulkanPipelineState* state = &states[i];
+		rawInitVulkanPipelineState(state);
+
+		bool result = rawAddVulkanPipelineShaderStage(state,
+			VK_SHADER_STAGE_VERTEX_BIT, vertex_shader, "main") &&
+			rawAddVulkanPipelineShaderStage(state,
+			VK_SHADER_STAGE_FRAGMENT_BIT, fragment_shader, "main");
+
+		RAW_ASSERT(result, "rawAddVulkanPipelineShaderStage failed!");
+
+		uint32_t sample_count = 4u;
+		float radius = 0.5f;
+
+		// The first two states only differ in the order constants are set
+		if (i == 0u)
+			result = rawSetVulkanPipelineSpecializationConstant(
+				state, 1u, &radius, sizeof(float)) &&
+				rawSetVulkanPipelineSpecializationConstant(
+				state, 0u, &sample_count, sizeof(uint32_t));
+		else
+			result = rawSetVulkanPipelineSpecializationConstant(
+				state, 0u, &sample_count, sizeof(uint32_t)) &&
+				rawSetVulkanPipelineSpecializationConstant(
+				state, 1u, &radius, sizeof(float));
+
+		RAW_ASSERT(result,
+			"rawSetVulkanPipelineSpecializationConstant failed!");
+
+		state->color_attachments[0].colorWriteMask =
+			VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT |
+			VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
+		state->n_color_attachments = 1u;
+		state->layout = pipeline_layout;
+		state->render_pass = target.render_pass;
+		state->subpass = 0u;
+	}
+
+	states[2].cull_mode = VK_CULL_MODE_NONE;
+
+	uint64_t hashes[3];
+
+	for (uint32_t i = 0; i < 3u; ++i)
+		hashes[i] = rawHashVulkanPipelineState(&states[i]);
+
+	RAW_ASSERT(hashes[0] == hashes[1] && hashes[0] != hashes[2],
+		"Unexpected pipeline state hashes!");
+
+	RawVulkanPipelineMap pipeline_map;
+	bool result = rawCreateVulkanPipelineMap(4u, &pipeline_map);
+
+	RAW_ASSERT(result, "rawCreateVulkanPipelineMap failed!");
+	RAW_ASSERT(rawFindVulkanPipeline(&pipeline_map, hashes[0]) ==
+		VK_NULL_HANDLE, "Empty pipeline map found a pipeline!");
+
+	VkPipeline pipelines[3];
+
+	for (uint32_t i = 0; i < 3u; ++i) {
+		result = rawGetVulkanGraphicsPipeline(context.logical_device,
+			&pipeline_map, VK_NULL_HANDLE, &states[i], hashes[i],
+			&pipelines[i]);
+
+		RAW_ASSERT(result, "rawGetVulkanGraphicsPipeline failed!");
+	}
+
+	RAW_ASSERT(pipelines[0] == pipelines[1] &&
+		pipelines[0] != pipelines[2] && pipeline_map.n_pipelines == 2u,
+		"Identical pipeline states weren't deduplicated!");
+	RAW_ASSERT(rawFindVulkanPipeline(&pipeline_map, hashes[2]) ==
+		pipelines[2], "rawFindVulkanPipeline failed!");
+
+	rawDestroyVulkanPipelineMap(context.logical_device, &pipeline_map);
+
+	vkDestroyPipelineLayout(context.logical_device,
+		pipeline_layout, RAW_NULL_PTR);
+	vkDestroyShaderModule(context.logical_device,
+		fragment_shader, RAW_NULL_PTR);
+	vkDestroyShaderModule(context.logical_device,
+		vertex_shader, RAW_NULL_PTR);
+
+	destroyTestRenderTarget(&context, &target);
+	destroyTestVulkanContext(&context);
+
+	RAW_LOG_CMSG(RAW_LOG_GREEN, "Test succeeded!\n\n");
+}
+
+void testVulkanShaderPack() {
+	RAW_LOG_CMSG(RAW_LOG_BLUE,
+		"Running RAW Vulkan shader pack test...\n");
+
+	char const* path = "rawTestShaders.rspk";
+
+	// The vertex shader twice, as two materials would
+	uint32_t const* codes[] = {
+		test_vertex_shader_code,
+		test_fragment_shader_code,
+		test_compute_shader_code,
+		test_vertex_shader_code
+	};
+
+	uint64_t sizes[] = {
+		sizeof(test_vertex_shader_code),
+		sizeof(test_fragment_shader_code),
+		sizeof(test_compute_shader_code),
+		sizeof(test_vertex_shader_code)
+	};
+
+	uint64_t content_hashes[4];
+
+	bool result = rawWriteVulkanShaderPack(
+		path, codes, sizes, 4u, content_hashes);
+
+	RAW_ASSERT(result, "rawWriteVulkanShaderPack failed!");
+	RAW_ASSERT(content_hashes[0] == content_hashes[3] &&
+		content_hashes[0] != content_hashes[1],
+		"Unexpected shader content hashes!");
+
+	RawVulkanShaderPack shader_pack;
+	result = rawOpenVulkanShaderPack(path, &shader_pack);
+
+	RAW_ASSERT(result, "rawOpenVulkanShaderPack failed!");
+	RAW_ASSERT(shader_pack.n_shaders == 3u &&
+		shader_pack.n_shader_modules == 0u,
+		"Identical shaders weren't stored once!");
+
+	for (uint32_t i = 0; i < 4u; ++i) {
+		uint32_t const* code;
+		uint64_t size;
+
+		result = rawFindVulkanShaderCode(
+			&shader_pack, content_hashes[i], &code, &size);
+
+		RAW_ASSERT(result && size == sizes[i] &&
+			memcmp(code, codes[i], size) == 0, "Shader code mismatch!");
+	}
+
+	RawTestVulkanContext context;
+	createTestVulkanContext(&context);
+
+	VkShaderModule shader_modules[4];
+
+	for (uint32_t i = 0; i < 4u; ++i) {
+		result = rawGetVulkanShaderModule(context.logical_device,
+			&shader_pack, content_hashes[i], &shader_modules[i]);
+
+		RAW_ASSERT(result, "rawGetVulkanShaderModule failed!");
+	}
+
+	RAW_ASSERT(shader_modules[0] == shader_modules[3] &&
+		shader_modules[0] != shader_modules[1] &&
+		shader_pack.n_shader_modules == 3u,
+		"Shader modules weren't deduplicated!");
+
+	VkShaderModule missing_shader_module;
+
+	RAW_ASSERT(!rawGetVulkanShaderModule(context.logical_device,
+		&shader_pack, ~content_hashes[0], &missing_shader_module),
+		"Missing shader was found!");
+
+	rawCloseVulkanShaderPack(context.logical_device, &shader_pack);
+
+	destroyTestVulkanContext(&context);
+
+	// Not a shader pack
+	result = rawWriteFileAtomic(path, "RSPK", 4u);
+
+	RAW_ASSERT(result && !rawOpenVulkanShaderPack(path, &shader_pack),
+		"Invalid shader pack was opened!");
+
+	// Empty pack as written by a host of the other byte order
+	RawVulkanShaderPackHeader swapped_header = {
+		.magic = RAW_VULKAN_SHADER_PACK_SWAPPED_MAGIC,
+		.version = RAW_VULKAN_SHADER_PACK_VERSION << 24u,
+		.n_shaders = 0u,
+		.reserved = 0u
+	};
+
+	result = rawWriteFileAtomic(path,
+		&swapped_header, sizeof(RawVulkanShaderPackHeader));
+
+	RAW_ASSERT(result && !rawOpenVulkanShaderPack(path, &shader_pack),
+		"Shader pack of the other byte order was opened!");
+
+	remove(path);
+
+	RAW_LOG_CMSG(RAW_LOG_GREEN, "Test succeeded!\n\n");
+}
+
+/*
+ * Vertex shader with
+ *
+ *     layout(location = 0) in vec3 position;
+ *     layout(location = 1) in vec2 uv;
+ *     layout(set = 0, binding = 0) uniform Camera { mat4 view_projection; };
+ *     layout(push_constant) uniform Object { vec4 color; float scale; };
+ */
+static uint32_t const test_reflection_vertex_shader_code[] = {
+	0x07230203u, 0x00010000u, 0x00000000u, 0x00000014u, 0x00000000u,
+	0x00020011u, 0x00000001u, 0x0003000eu, 0x00000000u, 0x00000001u,
+	0x0007000fu, 0x00000000u, 0x00000001u, 0x6e69616du, 0x00000000u,
+	0x00000002u, 0x00000003u, 0x00040047u, 0x00000002u, 0x0000001eu,
+	0x00000000u, 0x00040047u, 0x00000003u, 0x0000001eu, 0x00000001u,
+	0x00030047u, 0x00000004u, 0x00000002u, 0x00050048u, 0x00000004u,
+	0x00000000u, 0x00000023u, 0x00000000u, 0x00050048u, 0x00000004u,
+	0x00000000u, 0x00000007u, 0x00000010u, 0x00040047u, 0x00000005u,
+	0x00000022u, 0x00000000u, 0x00040047u, 0x00000005u, 0x00000021u,
+	0x00000000u, 0x00030047u, 0x00000006u, 0x00000002u, 0x00050048u,
+	0x00000006u, 0x00000000u, 0x00000023u, 0x00000000u, 0x00050048u,
+	0x00000006u, 0x00000001u, 0x00000023u, 0x00000010u, 0x00020013u,
+	0x00000007u, 0x00030021u, 0x00000008u, 0x00000007u, 0x00030016u,
+	0x00000009u, 0x00000020u, 0x00040017u, 0x0000000au, 0x00000009u,
+	0x00000002u, 0x00040017u, 0x0000000bu, 0x00000009u, 0x00000003u,
+	0x00040017u, 0x0000000cu, 0x00000009u, 0x00000004u, 0x00040018u,
+	0x0000000du, 0x0000000cu, 0x00000004u, 0x0003001eu, 0x00000004u,
+	0x0000000du, 0x00040020u, 0x0000000eu, 0x00000002u, 0x00000004u,
+	0x0004003bu, 0x0000000eu, 0x00000005u, 0x00000002u, 0x0004001eu,
+	0x00000006u, 0x0000000cu, 0x00000009u, 0x00040020u, 0x0000000fu,
+	0x00000009u, 0x00000006u, 0x0004003bu, 0x0000000fu, 0x00000010u,
+	0x00000009u, 0x00040020u, 0x00000011u, 0x00000001u, 0x0000000bu,
+	0x0004003bu, 0x00000011u, 0x00000002u, 0x00000001u, 0x00040020u,
+	0x00000012u, 0x00000001u, 0x0000000au, 0x0004003bu, 0x00000012u,
+	0x00000003u, 0x00000001u, 0x00050036u, 0x00000007u, 0x00000001u,
+	0x00000000u, 0x00000008u, 0x000200f8u, 0x00000013u, 0x000100fdu,
+	0x00010038u
+};
+
+/*
+ * Fragment shader with
+ *
+ *     layout(set = 0, binding = 0) uniform Camera { vec4 position; };
+ *     layout(set = 1, binding = 0) uniform sampler2D textures[4];
+ *     layout(push_constant) uniform Object { layout(offset = 16) float scale; };
+ */
+static uint32_t const test_reflection_fragment_shader_code[] = {
+	0x07230203u, 0x00010000u, 0x00000000u, 0x00000014u, 0x00000000u,
+	0x00020011u, 0x00000001u, 0x0003000eu, 0x00000000u, 0x00000001u,
+	0x0005000fu, 0x00000004u, 0x00000001u, 0x6e69616du, 0x00000000u,
+	0x00030010u, 0x00000001u, 0x00000007u, 0x00040047u, 0x00000002u,
+	0x00000022u, 0x00000001u, 0x00040047u, 0x00000002u, 0x00000021u,
+	0x00000000u, 0x00030047u, 0x00000003u, 0x00000002u, 0x00050048u,
+	0x00000003u, 0x00000000u, 0x00000023u, 0x00000000u, 0x00040047u,
+	0x00000004u, 0x00000022u, 0x00000000u, 0x00040047u, 0x00000004u,
+	0x00000021u, 0x00000000u, 0x00030047u, 0x00000005u, 0x00000002u,
+	0x00050048u, 0x00000005u, 0x00000000u, 0x00000023u, 0x00000010u,
+	0x00020013u, 0x00000006u, 0x00030021u, 0x00000007u, 0x00000006u,
+	0x00030016u, 0x00000008u, 0x00000020u, 0x00040015u, 0x00000009u,
+	0x00000020u, 0x00000000u, 0x00040017u, 0x0000000au, 0x00000008u,
+	0x00000004u, 0x0004002bu, 0x00000009u, 0x0000000bu, 0x00000004u,
+	0x00090019u, 0x0000000cu, 0x00000008u, 0x00000001u, 0x00000000u,
+	0x00000000u, 0x00000000u, 0x00000001u, 0x00000000u, 0x0003001bu,
+	0x0000000du, 0x0000000cu, 0x0004001cu, 0x0000000eu, 0x0000000du,
+	0x0000000bu, 0x00040020u, 0x0000000fu, 0x00000000u, 0x0000000eu,
+	0x0004003bu, 0x0000000fu, 0x00000002u, 0x00000000u, 0x0003001eu,
+	0x00000003u, 0x0000000au, 0x00040020u, 0x00000010u, 0x00000002u,
+	0x00000003u, 0x0004003bu, 0x00000010u, 0x00000004u, 0x00000002u,
+	0x0003001eu, 0x00000005u, 0x00000008u, 0x00040020u, 0x00000011u,
+	0x00000009u, 0x00000005u, 0x0004003bu, 0x00000011u, 0x00000012u,
+	0x00000009u, 0x00050036u, 0x00000006u, 0x00000001u, 0x00000000u,
+	0x00000007u, 0x000200f8u, 0x00000013u, 0x000100fdu, 0x00010038u
+};
+
+void testVulkanReflectionAndLayoutCache() {
+	RAW_LOG_CMSG(RAW_LOG_BLUE,
+		"Running RAW Vulkan reflection and layout cache test...\n");
+
+	RawVulkanShaderReflection reflections[2];
+
+	bool result = rawReflectSpirv(test_reflection_vertex_shader_code,
+		sizeof(test_reflection_vertex_shader_code), &reflections[0]) &&
+		rawReflectSpirv(test_reflection_fragment_shader_code,
+		sizeof(test_reflection_fragment_shader_code), &reflections[1]);
+
+	RAW_ASSERT(result, "rawReflectSpirv failed!");
+
+	RawVulkanShaderReflection const* vertex = &reflections[0];
+
+	RAW_ASSERT(vertex->stage_flags == VK_SHADER_STAGE_VERTEX_BIT &&
+		vertex->n_bindings == 1u && vertex->bindings[0].descriptor_type ==
+		VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, "Unexpected vertex bindings!");
+	RAW_ASSERT(vertex->push_constant_range.offset == 0u &&
+		vertex->push_constant_range.size == 20u,
+		"Unexpected vertex push constants!");
+	RAW_ASSERT(vertex->n_vertex_inputs == 2u &&
+		vertex->vertex_inputs[0].location == 0u &&
+		vertex->vertex_inputs[0].format == VK_FORMAT_R32G32B32_SFLOAT &&
+		vertex->vertex_inputs[1].location == 1u &&
+		vertex->vertex_inputs[1].format == VK_FORMAT_R32G32_SFLOAT,
+		"Unexpected vertex inputs!");
+
+	RawVulkanShaderReflection merged;
+	result = rawMergeVulkanShaderReflections(reflections, 2u, &merged);
+
+	RAW_ASSERT(result, "rawMergeVulkanShaderReflections failed!");
+	RAW_ASSERT(merged.n_bindings == 2u &&
+		merged.bindings[0].stage_flags == (VK_SHADER_STAGE_VERTEX_BIT |
+			VK_SHADER_STAGE_FRAGMENT_BIT) &&
+		merged.bindings[1].set == 1u &&
+		merged.bindings[1].descriptor_type ==
+			VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER &&
+		merged.bindings[1].descriptor_count == 4u,
+		"Unexpected merged bindings!");
+	RAW_ASSERT(merged.push_constant_range.offset == 0u &&
+		merged.push_constant_range.size == 20u,
+		"Unexpected merged push constants!");
+
+	RawTestVulkanContext context;
+	createTestVulkanContext(&context);
+
+	RawVulkanLayoutCache layout_cache;
+	result = rawCreateVulkanLayoutCache(8u, 8u, &layout_cache);
+
+	RAW_ASSERT(result, "rawCreateVulkanLayoutCache failed!");
+
+	VkPipelineLayout pipeline_layouts[4];
+	VkDescriptorSetLayout set_layouts[2][RAW_VULKAN_MAX_DESCRIPTOR_SETS];
+	uint32_t n_set_layouts[2];
+
+	result = rawGetVulkanPipelineLayout(context.logical_device,
+		&layout_cache, reflections, 2u, 0u, RAW_NULL_PTR, 0u,
+		&pipeline_layouts[0], RAW_NULL_PTR, RAW_NULL_PTR) &&
+		rawGetVulkanPipelineLayout(context.logical_device,
+		&layout_cache, reflections, 2u, 0u, RAW_NULL_PTR, 0u,
+		&pipeline_layouts[1], RAW_NULL_PTR, RAW_NULL_PTR);
+
+	RAW_ASSERT(result, "rawGetVulkanPipelineLayout failed!");
+	RAW_ASSERT(pipeline_layouts[0] == pipeline_layouts[1] &&
+		layout_cache.n_pipeline_layouts == 1u &&
+		layout_cache.n_set_layouts == 2u,
+		"Pipeline layouts weren't deduplicated!");
+
+	// Widened stages, so set 0 is shared by both pipelines
+	result = rawGetVulkanPipelineLayout(context.logical_device,
+		&layout_cache, reflections, 2u, VK_SHADER_STAGE_ALL_GRAPHICS,
+		RAW_NULL_PTR, 0u, &pipeline_layouts[2],
+		set_layouts[0], &n_set_layouts[0]) &&
+		rawGetVulkanPipelineLayout(context.logical_device,
+		&layout_cache, reflections, 1u, VK_SHADER_STAGE_ALL_GRAPHICS,
+		RAW_NULL_PTR, 0u, &pipeline_layouts[3],
+		set_layouts[1], &n_set_layouts[1]);
+
+	RAW_ASSERT(result, "rawGetVulkanPipelineLayout failed!");
+	RAW_ASSERT(n_set_layouts[0] == 2u && n_set_layouts[1] == 1u &&
+		set_layouts[0][0] == set_layouts[1][0] &&
+		pipeline_layouts[2] != pipeline_layouts[0] &&
+		pipeline_layouts[2] != pipeline_layouts[3],
+		"Unexpected widened layouts!");
+
+	// The sampler array of set 1 as a runtime array, e.g. a bindless heap
+	RawVulkanShaderReflection runtime_array = reflections[1];
+
+	for (uint32_t i = 0; i < runtime_array.n_bindings; ++i)
+		if (runtime_array.bindings[i].set == 1u)
+			runtime_array.bindings[i].descriptor_count = 0u;
+
+	VkPipelineLayout runtime_array_layout;
+
+	result = rawGetVulkanPipelineLayout(context.logical_device,
+		&layout_cache, &runtime_array, 1u, 0u, RAW_NULL_PTR, 0u,
+		&runtime_array_layout, RAW_NULL_PTR, RAW_NULL_PTR);
+
+	RAW_ASSERT(!result, "Runtime array laid out without a count!");
+
+	VkDescriptorSetLayoutBinding heap_binding = {
+		.binding = 0u,
+		.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+		.descriptorCount = 64u,
+		.stageFlags = VK_SHADER_STAGE_ALL,
+		.pImmutableSamplers = RAW_NULL_PTR
+	};
+
+	VkDescriptorSetLayout external_set_layouts[2] = { VK_NULL_HANDLE };
+
+	result = rawGetVulkanDescriptorSetLayout(context.logical_device,
+		&layout_cache, &heap_binding, 1u, &external_set_layouts[1]);
+
+	RAW_ASSERT(result, "rawGetVulkanDescriptorSetLayout failed!");
+
+	result = rawGetVulkanPipelineLayout(context.logical_device,
+		&layout_cache, &runtime_array, 1u, 0u, external_set_layouts, 2u,
+		&runtime_array_layout, set_layouts[0], &n_set_layouts[0]);
+
+	RAW_ASSERT(result, "rawGetVulkanPipelineLayout failed!");
+	RAW_ASSERT(n_set_layouts[0] == 2u &&
+		set_layouts[0][1] == external_set_layouts[1],
+		"External set layout wasn't used!");
+
+	rawDestroyVulkanLayoutCache(context.logical_device, &layout_cache);
+
+	destroyTestVulkanContext(&context);
+
+	RAW_LOG_CMSG(RAW_LOG_GREEN, "Test succeeded!\n\n");
+}
+
+/*
+ * Empty compute shader with
+ *
+ *     layout(constant_id = 0) const bool use_fast_path = true;
+ *     layout(constant_id = 1) const uint n_samples = 4;
+ */
+static uint32_t const test_permutation_compute_shader_code[] = {
+	0x07230203u, 0x00010000u, 0x00000000u, 0x00000009u, 0x00000000u,
+	0x00020011u, 0x00000001u, 0x0003000eu, 0x00000000u, 0x00000001u,
+	0x0005000fu, 0x00000005u, 0x00000001u, 0x6e69616du, 0x00000000u,
+	0x00060010u, 0x00000001u, 0x00000011u, 0x00000001u, 0x00000001u,
+	0x00000001u, 0x00040047u, 0x00000002u, 0x00000001u, 0x00000000u,
+	0x00040047u, 0x00000003u, 0x00000001u, 0x00000001u, 0x00020013u,
+	0x00000004u, 0x00030021u, 0x00000005u, 0x00000004u, 0x00020014u,
+	0x00000006u, 0x00040015u, 0x00000007u, 0x00000020u, 0x00000000u,
+	0x00030030u, 0x00000006u, 0x00000002u, 0x00040032u, 0x00000007u,
+	0x00000003u, 0x00000004u, 0x00050036u, 0x00000004u, 0x00000001u,
+	0x00000000u, 0x00000005u, 0x000200f8u, 0x00000008u, 0x000100fdu,
+	0x00010038u
+};
+
+void testVulkanShaderPermutations() {
+	RAW_LOG_CMSG(RAW_LOG_BLUE,
+		"Running RAW Vulkan shader permutations test...\n");
+
+	RawTestVulkanContext context;
+	createTestVulkanContext(&context);
+
+	RawVulkanPipelineCacheStore store;
+
+	bool result = rawCreateVulkanPipelineCacheStore(context.physical_device,
+		context.logical_device, "rawTestMissingPipelineCache.bin", 2u, &store);
+
+	RAW_ASSERT(result, "rawCreateVulkanPipelineCacheStore failed!");
+
+	RawVulkanPipelineCompiler compiler;
+
+	result = rawCreateVulkanPipelineCompiler(
+		context.logical_device, &store, 2u, 8u, &compiler);
+
+	RAW_ASSERT(result, "rawCreateVulkanPipelineCompiler failed!");
+
+	VkShaderModule shader_module = createTestShaderModule(&context,
+		test_permutation_compute_shader_code,
+		sizeof(test_permutation_compute_shader_code));
+
+	VkPipelineLayoutCreateInfo layout_create_info = {
+		.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = 0,
+		.setLayoutCount = 0u,
+		.pSetLayouts = RAW_NULL_PTR,
+		.pushConstantRangeCount = 0u,
+		.pPushConstantRanges = RAW_NULL_PTR
+	};
+
+	VkPipelineLayout pipeline_layout;
+
+	VkResult vk_result = vkCreatePipelineLayout(context.logical_device,
+		&layout_create_info, RAW_NULL_PTR, &pipeline_layout);
+
+	RAW_ASSERT(vk_result == VK_SUCCESS, "vkCreatePipelineLayout failed!");
+
+	RawVulkanPipelineState base_state;
+	rawInitVulkanPipelineState(&base_state);
+	base_state.layout = pipeline_layout;
+
+	result = rawAddVulkanPipelineShaderStage(&base_state,
+		VK_SHADER_STAGE_COMPUTE_BIT, shader_module, "main");
+
+	RAW_ASSERT(result, "rawAddVulkanPipelineShaderStage failed!");
+
+	RawVulkanShaderPermutations permutations;
+
+	result = rawCreateVulkanShaderPermutations(
+		VK_PIPELINE_BIND_POINT_COMPUTE, &base_state, 3u, &permutations);
+
+	RAW_ASSERT(result, "rawCreateVulkanShaderPermutations failed!");
+
+	uint32_t fast_path_option;
+	uint32_t n_samples_option;
+
+	result = rawAddVulkanPermutationToggle(
+		&permutations, 0u, true, &fast_path_option) &&
+		rawAddVulkanPermutationConstant(&permutations, 1u,
+		RAW_VULKAN_PERMUTATION_UINT, 4u, &n_samples_option);
+
+	RAW_ASSERT(result, "Adding permutation options failed!");
+
+	RawVulkanPermutation permutation;
+	RawVulkanPipelineHandle handles[4];
+
+	for (uint32_t i = 0; i < 4u; ++i) {
+		rawGetDefaultVulkanPermutation(&permutations, &permutation);
+
+		// Default, no fast path, 16 samples, then default again when full
+		if (i == 1u)
+			rawSetVulkanPermutationToggle(
+				&permutation, fast_path_option, false);
+		else if (i == 2u)
+			rawSetVulkanPermutationUint(
+				&permutation, n_samples_option, 16u);
+
+		result = rawRequestVulkanPermutation(
+			&compiler, &permutations, &permutation, &handles[i]);
+
+		RAW_ASSERT(result, "rawRequestVulkanPermutation failed!");
+	}
+
+	RAW_ASSERT(handles[0] == handles[3] && handles[0] != handles[1] &&
+		handles[0] != handles[2] && handles[1] != handles[2] &&
+		permutations.n_variants == 3u,
+		"Permutations weren't deduplicated!");
+
+	RawVulkanPipelineHandle overflow_handle;
+
+	rawSetVulkanPermutationToggle(&permutation, fast_path_option, false);
+	rawSetVulkanPermutationUint(&permutation, n_samples_option, 16u);
+
+	result = rawRequestVulkanPermutation(
+		&compiler, &permutations, &permutation, &overflow_handle);
+
+	RAW_ASSERT(!result && permutations.n_variants == 3u,
+		"New permutation exceeded max_variants!");
+
+	rawWaitVulkanPipelineCompilerIdle(&compiler);
+
+	for (uint32_t i = 0; i < 3u; ++i) {
+		RAW_ASSERT(rawGetVulkanPipeline(&compiler, handles[i],
+			VK_NULL_HANDLE) != VK_NULL_HANDLE,
+			"Permutation compilation failed!");
+	}
+
+	rawDestroyVulkanPipelineCompiler(&compiler);
+	rawDestroyVulkanShaderPermutations(&permutations);
+
+	vkDestroyPipelineLayout(context.logical_device,
+		pipeline_layout, RAW_NULL_PTR);
+	vkDestroyShaderModule(context.logical_device,
+		shader_module, RAW_NULL_PTR);
+
+	rawDestroyVulkanPipelineCacheStore(context.logical_device, &store);
+
+	destroyTestVulkanContext(&context);
+
+	RAW_LOG_CMSG(RAW_LOG_GREEN, "Test succeeded!\n\n");
+}
+
+void testVulkanDescriptorAllocator() {
+	RAW_LOG_CMSG(RAW_LOG_BLUE,
+		"Running RAW Vulkan descriptor allocator test...\n");
+
+	RawTestVulkanContext context;
+	createTestVulkanContext(&context);
+
+	VkDescriptorSetLayoutBinding binding = {
+		.binding = 0u,
+		.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+		.descriptorCount = 1u,
+		.stageFlags = VK_SHADER_STAGE_VERTEX_BIT,
+		.pImmutableSamplers = RAW_NULL_PTR
+	};
+
+	VkDescriptorSetLayoutCreateInfo layout_create_info = {
+		.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = 0,
+		.bindingCount = 1u,
+		.pBindings = &binding
+	};
+
+	VkDescriptorSetLayout set_layout;
+	VkResult vk_result = vkCreateDescriptorSetLayout(context.logical_device,
+		&layout_create_info, RAW_NULL_PTR, &set_layout);
+
+	RAW_ASSERT(vk_result == VK_SUCCESS, "vkCreateDescriptorSetLayout failed!");
+
+	VkDescriptorPoolSize pool_size = {
+		.type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+		.descriptorCount = 2u
+	};
+
+	RawVulkanDescriptorAllocator descriptor_allocator;
+	bool result = rawCreateVulkanDescriptorAllocator(context.logical_device,
+		2u, 2u, &pool_size, 1u, &descriptor_allocator);
+
+	RAW_ASSERT(result, "rawCreateVulkanDescriptorAllocator failed!");
+
+	VkDescriptorSet descriptor_sets[5];
+
+	for (uint32_t i = 0; i < 5u; ++i) {
+		result = rawAllocateVulkanDescriptorSet(context.logical_device,
+			&descriptor_allocator, 0u, set_layout, &descriptor_sets[i]);
+
+		RAW_ASSERT(result, "rawAllocateVulkanDescriptorSet failed!");
+	}
+
+	RawVulkanDescriptorPoolList const* list = &descriptor_allocator.frames[0];
+
+	RAW_ASSERT(list->n_descriptor_pools == 3u && list->n_used == 3u,
+		"Descriptor allocator didn't grow!");
+	RAW_ASSERT(descriptor_allocator.frames[1].n_used == 0u,
+		"Frames share descriptor pools!");
+
+	// Nothing was submitted, so there is no fence to wait on
+	result = rawResetVulkanDescriptorAllocatorFrame(context.logical_device,
+		&descriptor_allocator, 0u, VK_NULL_HANDLE);
+
+	RAW_ASSERT(result && list->n_used == 0u,
+		"rawResetVulkanDescriptorAllocatorFrame failed!");
+
+	for (uint32_t i = 0; i < 5u; ++i) {
+		result = rawAllocateVulkanDescriptorSet(context.logical_device,
+			&descriptor_allocator, 0u, set_layout, &descriptor_sets[i]);
+
+		RAW_ASSERT(result, "rawAllocateVulkanDescriptorSet failed!");
+	}
+
+	RAW_ASSERT(list->n_descriptor_pools == 3u,
+		"Reset descriptor pools weren't reused!");
+
+	rawDestroyVulkanDescriptorAllocator(
+		context.logical_device, &descriptor_allocator);
+
+	vkDestroyDescriptorSetLayout(context.logical_device,
+		set_layout, RAW_NULL_PTR);
+
+	destroyTestVulkanContext(&context);
+
+	RAW_LOG_CMSG(RAW_LOG_GREEN, "Test succeeded!\n\n");
+}
+
+void testVulkanDescriptorSetCache() {
+	RAW_LOG_CMSG(RAW_LOG_BLUE,
+		"Running RAW Vulkan descriptor set cache test...\n");
+
+	RawTestVulkanContext context;
+	createTestVulkanContext(&context);
+
+	RawVulkanMegaBuffer uniform_buffer;
+
+	bool result = rawCreateVulkanMegaBuffer(context.logical_device,
+		&context.properties, &context.memory_properties,
+		RAW_VULKAN_BUFFER_USAGE_CLASS_UNIFORM, 1u << 16,
+		VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, &uniform_buffer);
+
+	RAW_ASSERT(result, "rawCreateVulkanMegaBuffer failed!");
+
+	RawVulkanBufferAllocation uniforms[3];
+
+	for (uint32_t i = 0; i < 3u; ++i) {
+		result = rawAllocateVulkanMegaBuffer(
+			&uniform_buffer, 64u, 0u, &uniforms[i]);
+
+		RAW_ASSERT(result, "rawAllocateVulkanMegaBuffer failed!");
+	}
+
+	VkDescriptorSetLayoutBinding binding = {
+		.binding = 0u,
+		.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+		.descriptorCount = 1u,
+		.stageFlags = VK_SHADER_STAGE_VERTEX_BIT,
+		.pImmutableSamplers = RAW_NULL_PTR
+	};
+
+	VkDescriptorSetLayoutCreateInfo layout_create_info = {
+		.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = 0,
+		.bindingCount = 1u,
+		.pBindings = &binding
+	};
+
+	VkDescriptorSetLayout set_layout;
+	VkResult vk_result = vkCreateDescriptorSetLayout(context.logical_device,
+		&layout_create_info, RAW_NULL_PTR, &set_layout);
+
+	RAW_ASSERT(vk_result == VK_SUCCESS, "vkCreateDescriptorSetLayout failed!");
+
+	VkDescriptorPoolSize pool_size = {
+		.type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+		.descriptorCount = 2u
+	};
+
+	RawVulkanDescriptorSetCache cache;
+	result = rawCreateVulkanDescriptorSetCache(
+		context.logical_device, 2u, &pool_size, 1u, &cache);
+
+	RAW_ASSERT(result, "rawCreateVulkanDescriptorSetCache failed!");
+
+	RawVulkanDescriptorSetKey keys[3];
+
+	for (uint32_t i = 0; i < 3u; ++i) {
+		rawInitVulkanDescriptorSetKey(set_layout, &keys[i]);
+
+		result = rawAddVulkanDescriptorBuffer(&keys[i], 0u,
+			VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, uniforms[i].buffer,
+			uniforms[i].offset, uniforms[i].size);
+
+		RAW_ASSERT(result, "rawAddVulkanDescriptorBuffer failed!");
+	}
+
+	VkDescriptorSet descriptor_sets[4];
+
+	rawBeginVulkanDescriptorSetCacheFrame(
+		context.logical_device, &cache, 0u, 0u);
+
+	result = rawGetVulkanDescriptorSet(context.logical_device,
+		&cache, &keys[0], &descriptor_sets[0]) &&
+		rawGetVulkanDescriptorSet(context.logical_device,
+		&cache, &keys[0], &descriptor_sets[1]) &&
+		rawGetVulkanDescriptorSet(context.logical_device,
+		&cache, &keys[1], &descriptor_sets[2]);
+
+	RAW_ASSERT(result, "rawGetVulkanDescriptorSet failed!");
+	RAW_ASSERT(descriptor_sets[0] == descriptor_sets[1] &&
+		descriptor_sets[0] != descriptor_sets[2] && cache.n_sets == 2u,
+		"Descriptor sets weren't deduplicated!");
+
+	// Both sets may still be in use by frame 0
+	result = rawGetVulkanDescriptorSet(context.logical_device,
+		&cache, &keys[2], &descriptor_sets[3]);
+
+	RAW_ASSERT(!result, "A descriptor set in flight was evicted!");
+
+	// Frame 0 completed, its least recently used set can go
+	rawBeginVulkanDescriptorSetCacheFrame(
+		context.logical_device, &cache, 2u, 1u);
+
+	result = rawGetVulkanDescriptorSet(context.logical_device,
+		&cache, &keys[2], &descriptor_sets[3]) &&
+		rawGetVulkanDescriptorSet(context.logical_device,
+		&cache, &keys[1], &descriptor_sets[1]);
+
+	RAW_ASSERT(result, "rawGetVulkanDescriptorSet failed!");
+	RAW_ASSERT(cache.n_sets == 2u && descriptor_sets[1] == descriptor_sets[2],
+		"The wrong descriptor set was evicted!");
+
+	// Every key uses the buffer, both sets are retired until frame 2 ends
+	rawEvictVulkanDescriptorSetsUsingBuffer(
+		context.logical_device, &cache, uniform_buffer.buffer);
+
+	result = rawGetVulkanDescriptorSet(context.logical_device,
+		&cache, &keys[1], &descriptor_sets[0]);
+
+	RAW_ASSERT(!result && cache.n_sets == 2u,
+		"A retired descriptor set was freed while in flight!");
+
+	rawBeginVulkanDescriptorSetCacheFrame(
+		context.logical_device, &cache, 3u, 3u);
+
+	RAW_ASSERT(cache.n_sets == 0u, "Retired descriptor sets weren't freed!");
+
+	result = rawGetVulkanDescriptorSet(context.logical_device,
+		&cache, &keys[1], &descriptor_sets[0]);
+
+	RAW_ASSERT(result && cache.n_sets == 1u,
+		"rawGetVulkanDescriptorSet failed!");
+
+	rawDestroyVulkanDescriptorSetCache(context.logical_device, &cache);
+
+	vkDestroyDescriptorSetLayout(context.logical_device,
+		set_layout, RAW_NULL_PTR);
+
+	rawDestroyVulkanMegaBuffer(context.logical_device, &uniform_buffer);
+
+	destroyTestVulkanContext(&context);
+
+	RAW_LOG_CMSG(RAW_LOG_GREEN, "Test succeeded!\n\n");
+}
+
+void testVulkanBindlessHeap() {
+	RAW_LOG_CMSG(RAW_LOG_BLUE,
+		"Running RAW Vulkan bindless heap test...\n");
+
+	RawTestVulkanContext context;
+	createTestVulkanContext(&context);
+
+	if (!context.bindless_enabled) {
+		RAW_LOG_WARNING("Descriptor indexing is not supported, skipping!");
+		destroyTestVulkanContext(&context);
+
+		RAW_LOG_CMSG(RAW_LOG_GREEN, "Test succeeded!\n\n");
+		return;
+	}
+
+	RawVulkanMegaBuffer storage_buffer;
+
+	bool result = rawCreateVulkanMegaBuffer(context.logical_device,
+		&context.properties, &context.memory_properties,
+		RAW_VULKAN_BUFFER_USAGE_CLASS_STORAGE, 1u << 16,
+		VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT, &storage_buffer);
+
+	RAW_ASSERT(result, "rawCreateVulkanMegaBuffer failed!");
+
+	RawVulkanBufferAllocation allocation;
+	result = rawAllocateVulkanMegaBuffer(
+		&storage_buffer, 256u, 0u, &allocation);
+
+	RAW_ASSERT(result, "rawAllocateVulkanMegaBuffer failed!");
+
+	VkSamplerCreateInfo sampler_create_info = {
+		.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = 0,
+		.magFilter = VK_FILTER_LINEAR,
+		.minFilter = VK_FILTER_LINEAR,
+		.mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR,
+		.addressModeU = VK_SAMPLER_ADDRESS_MODE_REPEAT,
+		.addressModeV = VK_SAMPLER_ADDRESS_MODE_REPEAT,
+		.addressModeW = VK_SAMPLER_ADDRESS_MODE_REPEAT,
+		.mipLodBias = 0.0f,
+		.anisotropyEnable = VK_FALSE,
+		.maxAnisotropy = 1.0f,
+		.compareEnable = VK_FALSE,
+		.compareOp = VK_COMPARE_OP_ALWAYS,
+		.minLod = 0.0f,
+		.maxLod = 0.0f,
+		.borderColor = VK_BORDER_COLOR_FLOAT_TRANSPARENT_BLACK,
+		.unnormalizedCoordinates = VK_FALSE
+	};
+
+	VkSampler sampler;
+	VkResult vk_result = vkCreateSampler(context.logical_device,
+		&sampler_create_info, RAW_NULL_PTR, &sampler);
+
+	RAW_ASSERT(vk_result == VK_SUCCESS, "vkCreateSampler failed!");
+
+	RawVulkanBindlessHeap heap;
+	result = rawCreateVulkanBindlessHeap(
+		context.logical_device, 16u, 16u, 4u, &heap);
+
+	RAW_ASSERT(result, "rawCreateVulkanBindlessHeap failed!");
+
+	uint32_t buffer_indices[4];
+	uint32_t sampler_index;
+
+	rawBeginVulkanBindlessHeapFrame(&heap, 0u, 0u);
+
+	for (uint32_t i = 0; i < 3u; ++i) {
+		result = rawRegisterVulkanBindlessBuffer(context.logical_device,
+			&heap, allocation.buffer, allocation.offset, allocation.size,
+			&buffer_indices[i]);
+
+		RAW_ASSERT(result, "rawRegisterVulkanBindlessBuffer failed!");
+	}
+
+	result = rawRegisterVulkanBindlessSampler(
+		context.logical_device, &heap, sampler, &sampler_index);
+
+	RAW_ASSERT(result, "rawRegisterVulkanBindlessSampler failed!");
+	RAW_ASSERT(buffer_indices[0] == 0u && buffer_indices[1] == 1u &&
+		buffer_indices[2] == 2u && sampler_index == 0u,
+		"Unexpected bindless indices!");
+
+	result = rawReleaseVulkanBindlessIndex(&heap,
+		RAW_VULKAN_BINDLESS_STORAGE_BUFFER, buffer_indices[1]);
+
+	RAW_ASSERT(result, "rawReleaseVulkanBindlessIndex failed!");
+
+	// Frame 0 may still read the released slot
+	rawBeginVulkanBindlessHeapFrame(&heap, 1u, 0u);
+
+	result = rawRegisterVulkanBindlessBuffer(context.logical_device,
+		&heap, allocation.buffer, allocation.offset, allocation.size,
+		&buffer_indices[3]);
+
+	RAW_ASSERT(result && buffer_indices[3] == 3u,
+		"A bindless index in flight was reused!");
+
+	rawBeginVulkanBindlessHeapFrame(&heap, 2u, 1u);
+
+	result = rawRegisterVulkanBindlessBuffer(context.logical_device,
+		&heap, allocation.buffer, allocation.offset, allocation.size,
+		&buffer_indices[1]);
+
+	RAW_ASSERT(result && buffer_indices[1] == 1u,
+		"Released bindless index wasn't reused!");
+
+	// Buffer and sampler indices
+	VkPipelineLayout pipeline_layout;
+	result = rawCreateVulkanBindlessPipelineLayout(context.logical_device,
+		&heap, VK_SHADER_STAGE_ALL, 2u * sizeof(uint32_t), &pipeline_layout);
+
+	RAW_ASSERT(result, "rawCreateVulkanBindlessPipelineLayout failed!");
+
+	vkDestroyPipelineLayout(context.logical_device,
+		pipeline_layout, RAW_NULL_PTR);
+
+	rawDestroyVulkanBindlessHeap(context.logical_device, &heap);
+
+	vkDestroySampler(context.logical_device, sampler, RAW_NULL_PTR);
+
+	rawDestroyVulkanMegaBuffer(context.logical_device, &storage_buffer);
+
+	destroyTestVulkanContext(&context);
+
+	RAW_LOG_CMSG(RAW_LOG_GREEN, "Test succeeded!\n\n");
+}
+
+typedef struct {
+	VkDevice logical_device;
+	RawVulkanDescriptorSetCache* descriptor_set_cache;
+	VkSampler evicted_sampler;
+	uint32_t n_evictions;
+} RawTestSamplerEviction;
+
+void testSamplerEviction(VkSampler sampler, void* user_data) {
+	RawTestSamplerEviction* eviction = user_data;
+
+	rawEvictVulkanDescriptorSetsUsingSampler(eviction->logical_device,
+		eviction->descriptor_set_cache, sampler);
+
+	eviction->evicted_sampler = sampler;
+	++eviction->n_evictions;
+}
+
+void testVulkanSamplerCache() {
+	RAW_LOG_CMSG(RAW_LOG_BLUE,
+		"Running RAW Vulkan sampler cache test...\n");
+
+	RawTestVulkanContext context;
+	createTestVulkanContext(&context);
+
+	VkSamplerCreateInfo linear_repeat = {
+		.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = 0,
+		.magFilter = VK_FILTER_LINEAR,
+		.minFilter = VK_FILTER_LINEAR,
+		.mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR,
+		.addressModeU = VK_SAMPLER_ADDRESS_MODE_REPEAT,
+		.addressModeV = VK_SAMPLER_ADDRESS_MODE_REPEAT,
+		.addressModeW = VK_SAMPLER_ADDRESS_MODE_REPEAT,
+		.mipLodBias = 0.0f,
+		.anisotropyEnable = VK_FALSE,
+		.maxAnisotropy = 1.0f,
+		.compareEnable = VK_FALSE,
+		.compareOp = VK_COMPARE_OP_ALWAYS,
+		.minLod = 0.0f,
+		.maxLod = 0.0f,
+		.borderColor = VK_BORDER_COLOR_FLOAT_TRANSPARENT_BLACK,
+		.unnormalizedCoordinates = VK_FALSE
+	};
+
+	// Differs only in state Vulkan ignores
+	VkSamplerCreateInfo same_state = linear_repeat;
+	same_state.maxAnisotropy = 16.0f;
+	same_state.compareOp = VK_COMPARE_OP_LESS;
+
+	VkSamplerCreateInfo nearest_repeat = linear_repeat;
+	nearest_repeat.magFilter = VK_FILTER_NEAREST;
+	nearest_repeat.minFilter = VK_FILTER_NEAREST;
+
+	VkSamplerCreateInfo linear_clamp = linear_repeat;
+	linear_clamp.addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+	linear_clamp.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+
+	// Descriptor sets over cached samplers, dropped on eviction
+	VkDescriptorSetLayoutBinding binding = {
+		.binding = 0u,
+		.descriptorType = VK_DESCRIPTOR_TYPE_SAMPLER,
+		.descriptorCount = 1u,
+		.stageFlags = VK_SHADER_STAGE_FRAGMENT_BIT,
+		.pImmutableSamplers = RAW_NULL_PTR
+	};
+
+	VkDescriptorSetLayoutCreateInfo layout_create_info = {
+		.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = 0,
+		.bindingCount = 1u,
+		.pBindings = &binding
+	};
+
+	VkDescriptorSetLayout set_layout;
+	VkResult vk_result = vkCreateDescriptorSetLayout(context.logical_device,
+		&layout_create_info, RAW_NULL_PTR, &set_layout);
+
+	RAW_ASSERT(vk_result == VK_SUCCESS, "vkCreateDescriptorSetLayout failed!");
+
+	VkDescriptorPoolSize pool_size = {
+		.type = VK_DESCRIPTOR_TYPE_SAMPLER,
+		.descriptorCount = 2u
+	};
+
+	RawVulkanDescriptorSetCache descriptor_set_cache;
+	bool result = rawCreateVulkanDescriptorSetCache(context.logical_device,
+		2u, &pool_size, 1u, &descriptor_set_cache);
+
+	RAW_ASSERT(result, "rawCreateVulkanDescriptorSetCache failed!");
+
+	RawTestSamplerEviction eviction = {
+		.logical_device = context.logical_device,
+		.descriptor_set_cache = &descriptor_set_cache,
+		.evicted_sampler = VK_NULL_HANDLE,
+		.n_evictions = 0u
+	};
+
+	RawVulkanSamplerCache sampler_cache;
+	result = rawCreateVulkanSamplerCache(
+		2u, testSamplerEviction, &eviction, &sampler_cache);
+
+	RAW_ASSERT(result, "rawCreateVulkanSamplerCache failed!");
+
+	VkSampler samplers[5];
+
+	rawBeginVulkanSamplerCacheFrame(&sampler_cache, 0u, 0u);
+	rawBeginVulkanDescriptorSetCacheFrame(
+		context.logical_device, &descriptor_set_cache, 0u, 0u);
+
+	result = rawAcquireVulkanSampler(context.logical_device,
+		&sampler_cache, &linear_repeat, &samplers[0]) &&
+		rawAcquireVulkanSampler(context.logical_device,
+		&sampler_cache, &same_state, &samplers[1]) &&
+		rawAcquireVulkanSampler(context.logical_device,
+		&sampler_cache, &nearest_repeat, &samplers[2]);
+
+	RAW_ASSERT(result, "rawAcquireVulkanSampler failed!");
+	RAW_ASSERT(samplers[0] == samplers[1] && samplers[0] != samplers[2] &&
+		sampler_cache.n_samplers == 2u, "Samplers weren't shared!");
+
+	RawVulkanDescriptorSetKey key;
+	rawInitVulkanDescriptorSetKey(set_layout, &key);
+
+	VkDescriptorSet descriptor_set;
+
+	result = rawAddVulkanDescriptorImage(&key, 0u,
+		VK_DESCRIPTOR_TYPE_SAMPLER, VK_NULL_HANDLE,
+		VK_IMAGE_LAYOUT_UNDEFINED, samplers[2]) &&
+		rawGetVulkanDescriptorSet(context.logical_device,
+		&descriptor_set_cache, &key, &descriptor_set);
+
+	RAW_ASSERT(result, "rawGetVulkanDescriptorSet failed!");
+
+	// Every cached sampler is referenced
+	result = rawAcquireVulkanSampler(context.logical_device,
+		&sampler_cache, &linear_clamp, &samplers[3]);
+
+	RAW_ASSERT(!result, "A referenced sampler was replaced!");
+
+	// Released, but frame 0 may still sample with it
+	result = rawReleaseVulkanSampler(&sampler_cache, samplers[2]);
+
+	RAW_ASSERT(result, "rawReleaseVulkanSampler failed!");
+
+	result = rawAcquireVulkanSampler(context.logical_device,
+		&sampler_cache, &linear_clamp, &samplers[3]);
+
+	RAW_ASSERT(!result && eviction.n_evictions == 0u,
+		"A sampler in flight was replaced!");
+
+	// Frame 0 completed
+	rawBeginVulkanSamplerCacheFrame(&sampler_cache, 2u, 1u);
+	rawBeginVulkanDescriptorSetCacheFrame(
+		context.logical_device, &descriptor_set_cache, 2u, 1u);
+
+	result = rawAcquireVulkanSampler(context.logical_device,
+		&sampler_cache, &linear_clamp, &samplers[3]);
+
+	RAW_ASSERT(result && sampler_cache.n_samplers == 2u,
+		"Unreferenced sampler wasn't replaced!");
+	RAW_ASSERT(eviction.n_evictions == 1u &&
+		eviction.evicted_sampler == samplers[2] &&
+		descriptor_set_cache.n_sets == 0u,
+		"The replaced sampler wasn't reported!");
+
+	// Unreferenced samplers are still shared until replaced
+	result = rawReleaseVulkanSampler(&sampler_cache, samplers[3]) &&
+		rawAcquireVulkanSampler(context.logical_device,
+		&sampler_cache, &linear_clamp, &samplers[4]);
+
+	RAW_ASSERT(result && samplers[4] == samplers[3],
+		"Unreferenced sampler wasn't reused!");
+
+	result = rawReleaseVulkanSampler(&sampler_cache, samplers[0]) &&
+		rawReleaseVulkanSampler(&sampler_cache, samplers[1]) &&
+		rawReleaseVulkanSampler(&sampler_cache, samplers[4]);
+
+	RAW_ASSERT(result, "rawReleaseVulkanSampler failed!");
+
+	rawDestroyVulkanSamplerCache(context.logical_device, &sampler_cache);
+	rawDestroyVulkanDescriptorSetCache(
+		context.logical_device, &descriptor_set_cache);
+
+	vkDestroyDescriptorSetLayout(context.logical_device,
+		set_layout, RAW_NULL_PTR);
+
+	destroyTestVulkanContext(&context);
+
+	RAW_LOG_CMSG(RAW_LOG_GREEN, "Test succeeded!\n\n");
+}
+
+void testVulkanRenderPassCache() {
+	RAW_LOG_CMSG(RAW_LOG_BLUE,
+		"Running RAW Vulkan render pass cache test...\n");
+
+	RawTestVulkanContext context;
+	createTestVulkanContext(&context);
+
+	RawTestRenderTarget target;
+	createTestRenderTarget(&context, 64u, 64u, &target);
+
+	RawVulkanRenderPassKey key;
+	rawInitVulkanRenderPassKey(&key);
+
+	key.attachments[0] = (VkAttachmentDescription){
+		.flags = 0,
+		.format = VK_FORMAT_R8G8B8A8_UNORM,
+		.samples = VK_SAMPLE_COUNT_1_BIT,
+		.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR,
+		.storeOp = VK_ATTACHMENT_STORE_OP_STORE,
+		.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE,
+		.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE,
+		.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+		.finalLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL
+	};
+
+	key.n_attachments = 1u;
+	key.subpasses[0].color_attachments[0] = 0u;
+	key.subpasses[0].n_color_attachments = 1u;
+	key.n_subpasses = 1u;
+
+	RawVulkanRenderPassCache render_pass_cache;
+	bool result = rawCreateVulkanRenderPassCache(4u, &render_pass_cache);
+
+	RAW_ASSERT(result, "rawCreateVulkanRenderPassCache failed!");
+
+	VkRenderPass render_passes[3];
+
+	result = rawGetVulkanRenderPass(context.logical_device,
+		&render_pass_cache, &key, &render_passes[0]) &&
+		rawGetVulkanRenderPass(context.logical_device,
+		&render_pass_cache, &key, &render_passes[1]);
+
+	RAW_ASSERT(result, "rawGetVulkanRenderPass failed!");
+
+	key.attachments[0].loadOp = VK_ATTACHMENT_LOAD_OP_LOAD;
+	key.attachments[0].initialLayout =
+		VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+
+	result = rawGetVulkanRenderPass(context.logical_device,
+		&render_pass_cache, &key, &render_passes[2]);
+
+	RAW_ASSERT(result, "rawGetVulkanRenderPass failed!");
+	RAW_ASSERT(render_passes[0] == render_passes[1] &&
+		render_passes[0] != render_passes[2] &&
+		render_pass_cache.n_render_passes == 2u,
+		"Render passes weren't deduplicated!");
+
+	// Only the fields the framebuffer cache reads
+	RawVulkanSwapchain swapchain;
+	memset(&swapchain, 0, sizeof(RawVulkanSwapchain));
+
+	swapchain.image_views = &target.image_view;
+	swapchain.n_images = 1u;
+	swapchain.generation = 1u;
+
+	RawVulkanFramebufferCache framebuffer_cache;
+	result = rawCreateVulkanFramebufferCache(4u, &framebuffer_cache);
+
+	RAW_ASSERT(result, "rawCreateVulkanFramebufferCache failed!");
+
+	VkExtent2D extent = { target.width, target.height };
+	VkFramebuffer framebuffers[3];
+
+	rawBeginVulkanFramebufferCacheFrame(
+		context.logical_device, &framebuffer_cache, 0u, 0u);
+
+	result = rawGetVulkanFramebuffer(context.logical_device,
+		&framebuffer_cache, &swapchain, render_passes[0],
+		&target.image_view, 1u, extent, &framebuffers[0]) &&
+		rawGetVulkanFramebuffer(context.logical_device,
+		&framebuffer_cache, &swapchain, render_passes[0],
+		&target.image_view, 1u, extent, &framebuffers[1]);
+
+	RAW_ASSERT(result, "rawGetVulkanFramebuffer failed!");
+	RAW_ASSERT(framebuffers[0] == framebuffers[1] &&
+		framebuffer_cache.n_framebuffers == 1u,
+		"Framebuffers weren't deduplicated!");
+
+	// As if the swapchain had been recreated
+	++swapchain.generation;
+
+	result = rawGetVulkanFramebuffer(context.logical_device,
+		&framebuffer_cache, &swapchain, render_passes[0],
+		&target.image_view, 1u, extent, &framebuffers[2]);
+
+	RAW_ASSERT(result, "rawGetVulkanFramebuffer failed!");
+	RAW_ASSERT(framebuffer_cache.n_framebuffers == 1u &&
+		framebuffer_cache.n_retired_framebuffers == 1u,
+		"Swapchain framebuffer wasn't retired!");
+
+	// As if the view was about to be destroyed
+	result = rawEvictVulkanFramebuffersUsingImageView(
+		&framebuffer_cache, target.image_view);
+
+	RAW_ASSERT(result && framebuffer_cache.n_framebuffers == 0u &&
+		framebuffer_cache.n_retired_framebuffers == 2u,
+		"Framebuffer using the view wasn't retired!");
+
+	rawBeginVulkanFramebufferCacheFrame(
+		context.logical_device, &framebuffer_cache, 1u, 1u);
+
+	RAW_ASSERT(framebuffer_cache.n_retired_framebuffers == 0u,
+		"Retired framebuffer wasn't destroyed!");
+
+	rawDestroyVulkanFramebufferCache(
+		context.logical_device, &framebuffer_cache);
+	rawDestroyVulkanRenderPassCache(
+		context.logical_device, &render_pass_cache);
+
+	destroyTestRenderTarget(&context, &target);
+	destroyTestVulkanContext(&context);
+
+	RAW_LOG_CMSG(RAW_LOG_GREEN, "Test succeeded!\n\n");
+}
+
+void testVulkanDeferredPass() {
+	RAW_LOG_CMSG(RAW_LOG_BLUE,
+		"Running RAW Vulkan deferred pass test...\n");
+
+	RawTestVulkanContext context;
+	createTestVulkanContext(&context);
+
+	RawTestRenderTarget target;
+	createTestRenderTarget(&context, 4u, 4u, &target);
+
+	VkBuffer readback_buffer;
+	VkDeviceMemory readback_memory;
+
+	createTestReadbackBuffer(&context, 4u * 4u * 4u,
+		&readback_buffer, &readback_memory);
+
+	VkFormat depth_format;
+	bool result = rawGetVulkanDeferredDepthFormat(
+		context.physical_device, &depth_format);
+
+	RAW_ASSERT(result, "rawGetVulkanDeferredDepthFormat failed!");
+
+	VkExtent2D extent = { target.width, target.height };
+	RawVulkanDeferredTargets deferred_targets;
+
+	result = rawCreateVulkanDeferredTargets(context.logical_device,
+		&context.memory_properties, depth_format, extent,
+		&deferred_targets);
+
+	RAW_ASSERT(result, "rawCreateVulkanDeferredTargets failed!");
+
+	RAW_LOG_CMSG(RAW_LOG_CYAN, "\tG-buffer memory is %s\n",
+		deferred_targets.lazily_allocated ?
+			"lazily allocated" : "device local");
+
+	RawVulkanRenderPassCache render_pass_cache;
+	result = rawCreateVulkanRenderPassCache(4u, &render_pass_cache);
+
+	RAW_ASSERT(result, "rawCreateVulkanRenderPassCache failed!");
+
+	RawVulkanFramebufferCache framebuffer_cache;
+	result = rawCreateVulkanFramebufferCache(4u, &framebuffer_cache);
+
+	RAW_ASSERT(result, "rawCreateVulkanFramebufferCache failed!");
+
+	VkRenderPass render_pass;
+	VkFramebuffer framebuffer;
+
+	result = rawGetVulkanDeferredRenderPass(context.logical_device,
+		&render_pass_cache, VK_FORMAT_R8G8B8A8_UNORM,
+		VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, depth_format, &render_pass) &&
+		rawGetVulkanDeferredFramebuffer(context.logical_device,
+		&framebuffer_cache, RAW_NULL_PTR, render_pass, &deferred_targets,
+		target.image_view, &framebuffer);
+
+	RAW_ASSERT(result, "Deferred render pass or framebuffer failed!");
+
+	// Only the bindings are checked, no set is allocated from the key
+	RawVulkanDescriptorSetKey descriptor_key;
+	rawInitVulkanDescriptorSetKey(VK_NULL_HANDLE, &descriptor_key);
+
+	result = rawAddVulkanDeferredInputAttachments(
+		&descriptor_key, 0u, &deferred_targets);
+
+	RAW_ASSERT(result && descriptor_key.n_bindings == 3u,
+		"rawAddVulkanDeferredInputAttachments failed!");
+
+	RawVulkanCommandAllocator command_allocator;
+
+	result = rawCreateVulkanCommandAllocator(context.logical_device,
+		context.graphics_queue_family_index, 1u, 1u, &command_allocator);
+
+	RAW_ASSERT(result, "rawCreateVulkanCommandAllocator failed!");
+
+	VkCommandBuffer command_buffer;
+
+	result = rawAllocateVulkanCommandBuffer(context.logical_device,
+		&command_allocator, 0u, 0u, VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+		&command_buffer);
+
+	RAW_ASSERT(result, "rawAllocateVulkanCommandBuffer failed!");
+
+	VkCommandBufferBeginInfo begin_info = {
+		.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+		.pNext = RAW_NULL_PTR,
+		.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
+		.pInheritanceInfo = RAW_NULL_PTR
+	};
+
+	VkClearColorValue clear_color = { .float32 = { 0.0f, 1.0f, 0.0f, 1.0f } };
+
+	// No draws: the output keeps its clear color through both subpasses
+	vkBeginCommandBuffer(command_buffer, &begin_info);
+	rawCmdBeginVulkanDeferredPass(command_buffer, render_pass,
+		framebuffer, &deferred_targets, clear_color);
+	vkCmdNextSubpass(command_buffer, VK_SUBPASS_CONTENTS_INLINE);
+	vkCmdEndRenderPass(command_buffer);
+
+	VkBufferImageCopy region = {
+		.bufferOffset = 0u,
+		.bufferRowLength = 0u,
+		.bufferImageHeight = 0u,
+		.imageSubresource = { VK_IMAGE_ASPECT_COLOR_BIT, 0u, 0u, 1u },
+		.imageOffset = { 0, 0, 0 },
+		.imageExtent = { 4u, 4u, 1u }
+	};
+
+	vkCmdCopyImageToBuffer(command_buffer, target.image,
+		VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, readback_buffer, 1u, &region);
+	vkEndCommandBuffer(command_buffer);
+
+	VkSubmitInfo submit_info = {
+		.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+		.pNext = RAW_NULL_PTR,
+		.waitSemaphoreCount = 0u,
+		.pWaitSemaphores = RAW_NULL_PTR,
+		.pWaitDstStageMask = RAW_NULL_PTR,
+		.commandBufferCount = 1u,
+		.pCommandBuffers = &command_buffer,
+		.signalSemaphoreCount = 0u,
+		.pSignalSemaphores = RAW_NULL_PTR
+	};
+
+	VkResult vk_result = vkQueueSubmit(context.graphics_queue,
+		1u, &submit_info, VK_NULL_HANDLE);
+
+	RAW_ASSERT(vk_result == VK_SUCCESS, "vkQueueSubmit failed!");
+
+	vkQueueWaitIdle(context.graphics_queue);
+
+	uint8_t* texels;
+
+	vk_result = vkMapMemory(context.logical_device, readback_memory,
+		0u, VK_WHOLE_SIZE, 0, (void**)&texels);
+
+	RAW_ASSERT(vk_result == VK_SUCCESS, "vkMapMemory failed!");
+
+	RAW_ASSERT(texels[0] == 0u && texels[1] == 255u &&
+		texels[2] == 0u && texels[3] == 255u,
+		"Deferred output doesn't match the clear color!");
+
+	vkUnmapMemory(context.logical_device, readback_memory);
+
+	rawDestroyVulkanCommandAllocator(
+		context.logical_device, &command_allocator);
+
+	rawDestroyVulkanDeferredTargets(context.logical_device,
+		&framebuffer_cache, RAW_NULL_PTR, &deferred_targets);
+
+	RAW_ASSERT(framebuffer_cache.n_framebuffers == 0u,
+		"Framebuffer over the G-buffer wasn't evicted!");
+
+	rawDestroyVulkanFramebufferCache(
+		context.logical_device, &framebuffer_cache);
+	rawDestroyVulkanRenderPassCache(
+		context.logical_device, &render_pass_cache);
+
+	destroyTestReadbackBuffer(&context, &readback_buffer, &readback_memory);
+	destroyTestRenderTarget(&context, &target);
+	destroyTestVulkanContext(&context);
+
+	RAW_LOG_CMSG(RAW_LOG_GREEN, "Test succeeded!\n\n");
+}
+
 #endif // RAW_CROSS_PLATFORM_TESTS
 
@@ -29,7 +29,7 @@
  *
  * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
  * Created: 16/03/2020
- * Last modified: 16/06/2020
+ * Last modified: 19/10/2026
  */
 
 #include <unitTests/rawCrossPlatformTests.h>
@@ -218,7 +218,7 @@ void testVulkanPresentationSurfaceCreationAndDestruction(
 		physical_devices[physical_device_index],
 		queue_create_infos, n_queue_create_infos,
 		desired_device_extensions, n_desired_device_extensions,
-		&features, &logical_device);
+		&features, RAW_NULL_PTR, &logical_device);
 
 	rawLoadVulkanDeviceLevelFunctions(logical_device,
 		desired_device_extensions, n_desired_device_extensions);
@@ -393,7 +393,7 @@ void testVulkanSwapchainCreationAndDestruction(
 		physical_devices[physical_device_index],
 		queue_create_infos, n_queue_create_infos,
 		desired_device_extensions, n_desired_device_extensions,
-		&features, &logical_device);
+		&features, RAW_NULL_PTR, &logical_device);
 
 	rawLoadVulkanDeviceLevelFunctions(logical_device,
 		desired_device_extensions, n_desired_device_extensions);
@@ -417,11 +417,200 @@ void testVulkanSwapchainCreationAndDestruction(
 
 	RAW_ASSERT(result, "rawCreateVulkanSwapchain failed!");
 
-	// Swapchain destruction
 	rawDestroyVulkanSwapchain(logical_device, &swapchain);
 
 	RAW_MEM_FREE(swapchain_images);
 
+	// Every present policy preset must resolve within surface limits
+	VkSurfaceCapabilitiesKHR surface_capabilities;
+
+	vkGetPhysicalDeviceSurfaceCapabilitiesKHR(
+		physical_devices[physical_device_index],
+		presentation_surface, &surface_capabilities);
+
+	RawVulkanPresentPolicy present_policy;
+
+	for (int i = RAW_VULKAN_PRESENT_POLICY_LOW_LATENCY;
+		i <= RAW_VULKAN_PRESENT_POLICY_TEAR_FREE; ++i) {
+		VkPresentModeKHR policy_present_mode;
+		VkSurfaceFormatKHR policy_surface_format;
+		uint32_t policy_n_images;
+
+		rawGetVulkanPresentPolicy(
+			(RawVulkanPresentPolicyPreset)i, &present_policy);
+
+		result = rawResolveVulkanPresentPolicy(
+			physical_devices[physical_device_index],
+			presentation_surface, &present_policy, &policy_present_mode,
+			&policy_surface_format, &policy_n_images);
+
+		RAW_ASSERT(result, "rawResolveVulkanPresentPolicy failed!");
+		RAW_ASSERT(policy_n_images >= surface_capabilities.minImageCount,
+			"Too few swapchain images!");
+		RAW_ASSERT(surface_capabilities.maxImageCount == 0u ||
+			policy_n_images <= surface_capabilities.maxImageCount,
+			"Too many swapchain images!");
+	}
+
+	// Resizable swapchain, recreated while frames are in flight
+	RawVulkanSwapchain resizable_swapchain;
+
+	rawGetVulkanPresentPolicy(
+		RAW_VULKAN_PRESENT_POLICY_POWER_SAVING, &present_policy);
+
+	result = rawCreateVulkanResizableSwapchain(
+		physical_devices[physical_device_index],
+		logical_device, presentation_surface,
+		&present_policy, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT,
+		VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR,
+		swapchain_width, swapchain_height, &resizable_swapchain);
+
+	RAW_ASSERT(result, "rawCreateVulkanResizableSwapchain failed!");
+
+	// Frames in flight
+	VkQueue presentation_queue;
+
+	vkGetDeviceQueue(logical_device,
+		presentation_queue_index, 0u, &presentation_queue);
+
+	RawVulkanCommandAllocator command_allocator;
+
+	result = rawCreateVulkanCommandAllocator(logical_device,
+		presentation_queue_index, 1u, 2u, &command_allocator);
+
+	RAW_ASSERT(result, "rawCreateVulkanCommandAllocator failed!");
+
+	RawVulkanFrameManager frame_manager;
+
+	result = rawCreateVulkanFrameManager(logical_device, 2u, &frame_manager);
+
+	RAW_ASSERT(result, "rawCreateVulkanFrameManager failed!");
+
+	RawVulkanFramePacer frame_pacer;
+
+	result = rawCreateVulkanFramePacer(physical_devices[physical_device_index],
+		logical_device, presentation_queue_index, 2u, &frame_pacer);
+
+	RAW_ASSERT(result, "rawCreateVulkanFramePacer failed!");
+
+	for (uint32_t i = 0u; i < 8u; ++i) {
+		uint32_t image_index;
+		bool swapchain_out_of_date;
+
+		// Same extent, but goes through the whole recreation path
+		if (i == 4u) {
+			result = rawResizeVulkanSwapchain(logical_device,
+				&frame_manager, swapchain_width, swapchain_height,
+				&resizable_swapchain);
+
+			RAW_ASSERT(result, "rawResizeVulkanSwapchain failed!");
+			RAW_ASSERT(resizable_swapchain.n_retired_swapchains == 1u,
+				"Swapchain wasn't retired!");
+		}
+
+		result = rawBeginVulkanPacedFrame(logical_device, &frame_pacer,
+			&frame_manager, resizable_swapchain.swapchain,
+			&command_allocator, &image_index, &swapchain_out_of_date);
+
+		RAW_ASSERT(result, "rawBeginVulkanPacedFrame failed!");
+
+		rawReleaseRetiredVulkanSwapchains(logical_device,
+			&frame_manager, &resizable_swapchain);
+
+		if (swapchain_out_of_date)
+			continue;
+
+		VkImageView image_view;
+
+		result = rawGetVulkanSwapchainImageView(logical_device,
+			&resizable_swapchain, image_index, &image_view);
+
+		RAW_ASSERT(result, "rawGetVulkanSwapchainImageView failed!");
+
+		VkCommandBuffer command_buffer;
+
+		result = rawAllocateVulkanCommandBuffer(logical_device,
+			&command_allocator, frame_manager.frame_index, 0u,
+			VK_COMMAND_BUFFER_LEVEL_PRIMARY, &command_buffer);
+
+		RAW_ASSERT(result, "rawAllocateVulkanCommandBuffer failed!");
+
+		VkCommandBufferBeginInfo begin_info = {
+			.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+			.pNext = RAW_NULL_PTR,
+			.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,
+			.pInheritanceInfo = RAW_NULL_PTR
+		};
+
+		vkBeginCommandBuffer(command_buffer, &begin_info);
+
+		rawCmdBeginVulkanFrameTimer(&frame_pacer,
+			&frame_manager, command_buffer);
+
+		VkImageMemoryBarrier to_present = {
+			.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+			.pNext = RAW_NULL_PTR,
+			.srcAccessMask = 0,
+			.dstAccessMask = 0,
+			.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+			.newLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR,
+			.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+			.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+			.image = resizable_swapchain.images[image_index],
+			.subresourceRange = { VK_IMAGE_ASPECT_COLOR_BIT, 0u, 1u, 0u, 1u }
+		};
+
+		vkCmdPipelineBarrier(command_buffer,
+			VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+			VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0,
+			0u, RAW_NULL_PTR, 0u, RAW_NULL_PTR, 1u, &to_present);
+
+		rawCmdEndVulkanFrameTimer(&frame_pacer,
+			&frame_manager, command_buffer);
+
+		vkEndCommandBuffer(command_buffer);
+
+		result = rawEndVulkanPacedFrame(logical_device, &frame_pacer,
+			&frame_manager, presentation_queue, presentation_queue,
+			resizable_swapchain.swapchain,
+			resizable_swapchain.render_finished_semaphores[image_index],
+			&command_buffer, 1u, &swapchain_out_of_date);
+
+		RAW_ASSERT(result, "rawEndVulkanPacedFrame failed!");
+	}
+
+	RawVulkanFrameTimings average_timings;
+	rawGetVulkanFramePacerAverageTimings(&frame_pacer, &average_timings);
+
+	RAW_ASSERT(average_timings.cpu_frame_time > 0u,
+		"CPU frame time wasn't measured!");
+	RAW_ASSERT(average_timings.acquire_to_present_time > 0u,
+		"Acquire to present latency wasn't measured!");
+
+	RAW_LOG_INFO("Frame timings (ns): CPU %" PRIu64 ", GPU %" PRIu64
+		", acquire to present %" PRIu64 ", present latency %" PRIu64,
+		average_timings.cpu_frame_time, average_timings.gpu_frame_time,
+		average_timings.acquire_to_present_time,
+		average_timings.present_latency);
+
+	// Presentation may still be waiting on the last semaphores
+	vkDeviceWaitIdle(logical_device);
+
+	rawReleaseRetiredVulkanSwapchains(logical_device,
+		&frame_manager, &resizable_swapchain);
+
+	RAW_ASSERT(resizable_swapchain.n_retired_swapchains == 0u,
+		"Retired swapchain wasn't released!");
+	RAW_ASSERT(resizable_swapchain.generation == 2u,
+		"Unexpected swapchain generation!");
+
+	rawDestroyVulkanFramePacer(logical_device, &frame_pacer);
+	rawDestroyVulkanFrameManager(logical_device, &frame_manager);
+	rawDestroyVulkanCommandAllocator(logical_device, &command_allocator);
+
+	// Swapchain destruction
+	rawDestroyVulkanResizableSwapchain(logical_device, &resizable_swapchain);
+
 	// Logical device destruction
 	rawDestroyVulkanLogicalDevice(&logical_device);
 
@@ -452,11 +641,33 @@ void testVulkanSwapchainCreationAndDestruction(
 int main() {
 	testLoggingLibrary();
 	testMemoryAllocation();
+	testPlatformClock();
 	testVulkanLibraryLoading();
 	testVulkanInstanceCreationAndDestruction();
 	testVulkanPhysicalDeviceCreationAndDestruction();
 	testRawSelectPhysicalDeviceWithDesiredCharacteristics();
 	testVulkanLogicalDeviceCreationAndDestruction();
+	testVulkanMegaBufferSuballocation();
+	testVulkanCommandAllocator();
+	testVulkanParallelRecording();
+	testVulkanQueueTimeline();
+	testVulkanRenderGraph();
+	testVulkanResourceStateTracker();
+	testVulkanAsyncCompute();
+	testVulkanOffscreenSwapchain();
+	testVulkanReadbackQueue();
+	testVulkanPipelineCacheStore();
+	testVulkanPipelineCompiler();
+	testVulkanPipelineStateMap();
+	testVulkanShaderPack();
+	testVulkanReflectionAndLayoutCache();
+	testVulkanShaderPermutations();
+	testVulkanDescriptorAllocator();
+	testVulkanDescriptorSetCache();
+	testVulkanBindlessHeap();
+	testVulkanSamplerCache();
+	testVulkanRenderPassCache();
+	testVulkanDeferredPass();
 	
 	xcb_connection_t* connection = RAW_NULL_PTR;
 	xcb_window_t window;
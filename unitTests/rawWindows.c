@@ -28,7 +28,7 @@
  *
  * Marcelo de Matos Menezes - marcelodmmenezes@gmail.com
  * Created: 20/03/2020
- * Last modified: 20/03/2020
+ * Last modified: 19/10/2026
  */
 
 #include <unitTests/rawCrossPlatformTests.h>
@@ -36,11 +36,33 @@
 int main() {
 	testLoggingLibrary();
 	testMemoryAllocation();
+	testPlatformClock();
 	testVulkanLibraryLoading();
 	testVulkanInstanceCreationAndDestruction();
 	testVulkanPhysicalDeviceCreationAndDestruction();
 	testRawSelectPhysicalDeviceWithDesiredCharacteristics();
 	testVulkanLogicalDeviceCreationAndDestruction();
+	testVulkanMegaBufferSuballocation();
+	testVulkanCommandAllocator();
+	testVulkanParallelRecording();
+	testVulkanQueueTimeline();
+	testVulkanRenderGraph();
+	testVulkanResourceStateTracker();
+	testVulkanAsyncCompute();
+	testVulkanOffscreenSwapchain();
+	testVulkanReadbackQueue();
+	testVulkanPipelineCacheStore();
+	testVulkanPipelineCompiler();
+	testVulkanPipelineStateMap();
+	testVulkanShaderPack();
+	testVulkanReflectionAndLayoutCache();
+	testVulkanShaderPermutations();
+	testVulkanDescriptorAllocator();
+	testVulkanDescriptorSetCache();
+	testVulkanBindlessHeap();
+	testVulkanSamplerCache();
+	testVulkanRenderPassCache();
+	testVulkanDeferredPass();
 
 	RAW_LOG_CMSG("All tests succeeded!\n", RAW_LOG_GREEN);
 }